@@ -13,8 +13,7 @@
 
 #include "COLLADABUPrerequisites.h"
 #include "COLLADABUUtils.h"
-
-#include <set>
+#include "COLLADABUhash_map.h"
 
 
 namespace COLLADABU
@@ -23,7 +22,11 @@ namespace COLLADABU
 	class IDList 	
     {
     private:
-        typedef std::set<String> IDSet;
+        typedef hash_set<String> IDSet;
+
+        /** Maps an id to the smallest number suffix that might still be free for it. All smaller number 
+        suffixes are known to be in use.*/
+        typedef hash_map<String, size_t> IdNumberSuffixMap;
 
         typedef String (*StringConversionFunction)(const String&);
 
@@ -34,6 +37,9 @@ namespace COLLADABU
         /** A map that stores ids that are already managed by this instance of IDList.*/
         IDSet mIdSet;
 
+        /** The next number suffix to try for each id, a number suffix has been added to.*/
+        IdNumberSuffixMap mNextNumberSuffixes;
+
     public:
         /** Constructor*/
         IDList(StringConversionFunction conversionFunction = Utils::checkID);
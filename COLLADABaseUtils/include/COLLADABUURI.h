@@ -364,6 +364,7 @@ namespace COLLADABU
 		*/
 		void initialize();
 
+	protected:
 		/** Parses @a path and splits it in its components.*/
 		static void parsePath(const String& path,
 			/* out */ String& dir,
@@ -381,7 +382,7 @@ namespace COLLADABU
 			String& query,
 			String& fragment);
 
-
+	private:
 		/** Checks if th eURI is valid.*/
 		void validate(const URI* baseURI);
 
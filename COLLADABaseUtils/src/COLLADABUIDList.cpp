@@ -40,16 +40,20 @@ namespace COLLADABU
             }
         }
 
+        // Ids are never removed, so all suffixes below the stored one are still in use and the search 
+        // continues where it stopped the last time.
+        size_t& nextNumberSuffix = mNextNumberSuffixes.insert ( std::make_pair ( newIdChecked, (size_t)1 ) ).first->second;
+
+        String idPrefix = newIdChecked + "_";
         String idCandidate;
-        size_t numberSuffix = 0;
-        do
+        size_t numberSuffix = nextNumberSuffix;
+        for ( ;; ++numberSuffix )
         {
-            ++numberSuffix;
-            idCandidate = newIdChecked + "_" + Utils::toString ( numberSuffix );
+            idCandidate = idPrefix + Utils::toString ( numberSuffix );
+            if ( mIdSet.insert ( idCandidate ).second )
+                break;
         }
-        while ( mIdSet.find ( idCandidate ) != mIdSet.end() );
-
-        mIdSet.insert ( idCandidate );
+        nextNumberSuffix = numberSuffix + 1;
 
         return returnConverted ? idCandidate : newId + "_" + Utils::toString ( numberSuffix );
     }
@@ -11,19 +11,14 @@
 #include "COLLADABUStableHeaders.h"
 #include "COLLADABUURI.h"
 #include "COLLADABUStringUtils.h"
-#include "COLLADABUPcreCompiledPattern.h"
 #include "COLLADABUHashFunctions.h"
 
 #include <algorithm>
-#include "pcre.h"
 
 namespace COLLADABU
 {
 
 
-	const int regExpMatchesVectorLength = 30;    /* should be a multiple of 3 */
-
-
 	const String URI::SCHEME_FILE = "file";
 	const String URI::SCHEME_HTTP = "http";
 	const String URI::SCHEME_HTTPS = "https";
@@ -130,14 +125,16 @@ namespace COLLADABU
 	}
 
 
-	void setStringFromMatches(String& matchString, const String& entireString, int *resultPositions, int index)
+	/** Returns the position of the first character in [@a begin, @a end) that is contained in @a characters, 
+	or @a end.*/
+	static size_t findFirstOf(const String& string, size_t begin, size_t end, const char* characters)
 	{
-		int& startPosition = resultPositions[2*index];
-		int& endPosition = resultPositions[2*index+1];
-		if ( startPosition >= 0)
+		for ( ; begin < end; ++begin )
 		{
-			matchString.assign( entireString, startPosition, endPosition - startPosition);
+			if ( string[begin] && strchr(characters, string[begin]) )
+				return begin;
 		}
+		return end;
 	}
 
 
@@ -288,57 +285,37 @@ namespace COLLADABU
 			// The following implementation cannot handle paths like this:
 			// /tmp/se.3/file
 
-			// regular expression: "(.*/)?(.*)?"
-			static const PcreCompiledPattern findDirCompiledPattern("(.*/)?(.*)?");
-
-			pcre* findDir = findDirCompiledPattern.getCompiledPattern();
-
-
-			// regular expression: "([^.]*)?(\.(.*))?"
-			static const PcreCompiledPattern findExtCompiledPattern("([^.]*)?(\\.(.*))?");
-			pcre* findExt = findExtCompiledPattern.getCompiledPattern();
-			
-			String tmpFile;
+			// This splits the path as the regular expression "(.*/)?(.*)?" did for the directory and 
+			// "([^.]*)?(\.(.*))?" for the file name. Like '.' in these, the file name ends at a line feed.
 			dir.clear();
 			baseName.clear();
 			extension.clear();
 
-			int dirMatches[regExpMatchesVectorLength];
-
-			int  dirResult = pcre_exec(
-										findDir,           /* the compiled pattern */
-										0,                 /* no extra data - we didn't study the pattern */
-										path.c_str(),      /* the subject string */
-										(int)path.size(),  /* the length of the subject */
-										0,                 /* start at offset 0 in the subject */
-										0,                 /* default options */
-										dirMatches,     /* output vector for substring information */
-										regExpMatchesVectorLength); /* number of elements in the output vector */
-
-			if ( dirResult >= 0 )
-			{	
-				setStringFromMatches(dir, path, dirMatches, 1);
-				setStringFromMatches(tmpFile, path, dirMatches, 2);
-
-				int extMatches[regExpMatchesVectorLength];
-
-				int  extResult = pcre_exec(
-											findExt,           /* the compiled pattern */
-											0,                 /* no extra data - we didn't study the pattern */
-											tmpFile.c_str(),      /* the subject string */
-											(int)tmpFile.size(),  /* the length of the subject */
-											0,                 /* start at offset 0 in the subject */
-											0,                 /* default options */
-											extMatches,     /* output vector for substring information */
-											regExpMatchesVectorLength); /* number of elements in the output vector */
-
-				
-				if ( extResult >= 0 )
+			size_t lineEnd = path.find('\n');
+			if ( lineEnd == String::npos )
+				lineEnd = path.length();
+
+			size_t fileBegin = 0;
+			if ( lineEnd > 0 )
+			{
+				size_t lastSlash = path.rfind('/', lineEnd - 1);
+				if ( lastSlash != String::npos )
 				{
-					setStringFromMatches(baseName, tmpFile, extMatches, 1);
-					setStringFromMatches(extension, tmpFile, extMatches, 3);
+					fileBegin = lastSlash + 1;
+					dir.assign(path, 0, fileBegin);
 				}
 			}
+
+			size_t dot = path.find('.', fileBegin);
+			if ( (dot == String::npos) || (dot >= lineEnd) )
+			{
+				baseName.assign(path, fileBegin, lineEnd - fileBegin);
+			}
+			else
+			{
+				baseName.assign(path, fileBegin, dot - fileBegin);
+				extension.assign(path, dot + 1, lineEnd - dot - 1);
+			}
 	}
 
 	void URI::set(const String& uriStr_, const URI* baseURI) {
@@ -902,37 +879,49 @@ namespace COLLADABU
 		}
 
 
-		// This regular expression for parsing URI references comes from the URI spec:
+		// This splits the URI reference as the regular expression from the URI spec does:
 		//   http://tools.ietf.org/html/rfc3986#appendix-B
 		// regular expression: "^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\?([^#]*))?(#(.*))?"
-		static const PcreCompiledPattern matchUriCompiledPattern("^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\\?([^#]*))?(#(.*))?");
-		pcre* matchUri = matchUriCompiledPattern.getCompiledPattern();
+		// Components that are not present are left unchanged, the query includes the leading '?' and the 
+		// fragment ends at a line feed, as they did with the regular expression.
+		size_t length = uriRef.length();
+		size_t position = 0;
 
+		size_t schemeEnd = findFirstOf(uriRef, 0, length, ":/?#");
+		if ( (schemeEnd > 0) && (schemeEnd < length) && (uriRef[schemeEnd] == ':') )
+		{
+			scheme.assign( uriRef, 0, schemeEnd );
+			position = schemeEnd + 1;
+		}
 
-		int uriMatches[regExpMatchesVectorLength];
+		if ( (position + 1 < length) && (uriRef[position] == '/') && (uriRef[position + 1] == '/') )
+		{
+			size_t authorityEnd = findFirstOf(uriRef, position + 2, length, "/?#");
+			authority.assign( uriRef, position + 2, authorityEnd - position - 2 );
+			position = authorityEnd;
+		}
 
-		int  uriResult = pcre_exec(
-									matchUri,					/* the compiled pattern */
-									0,							/* no extra data - we didn't study the pattern */
-									uriRef.c_str(),				/* the subject string */
-									(int)uriRef.size(),			/* the length of the subject */
-									0,							/* start at offset 0 in the subject */
-									0,							/* default options */
-									uriMatches,				/* output vector for substring information */
-									regExpMatchesVectorLength);		/* number of elements in the output vector */
+		size_t pathEnd = findFirstOf(uriRef, position, length, "?#");
+		path.assign( uriRef, position, pathEnd - position );
+		position = pathEnd;
 
+		if ( (position < length) && (uriRef[position] == '?') )
+		{
+			size_t queryEnd = findFirstOf(uriRef, position, length, "#");
+			query.assign( uriRef, position, queryEnd - position );
+			position = queryEnd;
+		}
 
-		if ( uriResult >= 0 )
+		if ( position < length )
 		{
-			setStringFromMatches(scheme, uriRef, uriMatches, 2);
-			setStringFromMatches(authority, uriRef, uriMatches, 4);
-			setStringFromMatches(path, uriRef, uriMatches, 5);
-			setStringFromMatches(query, uriRef, uriMatches, 6);
-			setStringFromMatches(fragment, uriRef, uriMatches, 9);
-			return true;
+			// uriRef[position] is '#'
+			size_t fragmentEnd = uriRef.find('\n', position + 1);
+			if ( fragmentEnd == String::npos )
+				fragmentEnd = length;
+			fragment.assign( uriRef, position + 1, fragmentEnd - position - 1 );
 		}
 
-		return false;
+		return true;
 	}
 
 	namespace {
@@ -37,6 +37,7 @@
 #include "COLLADAFWFormulas.h"
 #include "COLLADAFWGeometry.h"
 #include "COLLADAFWILoader.h"
+#include "COLLADAFWIMeshStreamWriter.h"
 #include "COLLADAFWIWriter.h"
 #include "COLLADAFWImage.h"
 #include "COLLADAFWImageSource.h"
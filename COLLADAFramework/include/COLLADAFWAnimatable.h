@@ -13,6 +13,7 @@
 
 #include "COLLADAFWPrerequisites.h"
 #include "COLLADAFWUniqueId.h"
+#include "COLLADAFWMemoryArena.h"
 
 
 namespace COLLADAFW
@@ -20,7 +21,7 @@ namespace COLLADAFW
 
     /** This is the base class for all objects, that can be animated. It connect the animatable object with 
 	the list of animations that animate the object.*/
-	class Animatable 
+	class Animatable : public ArenaAllocated
 	{
 	private:
 		/** The uniqueId of the AnimationList that animates the object.*/
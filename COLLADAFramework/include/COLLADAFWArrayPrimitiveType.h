@@ -13,6 +13,7 @@ http://www.opensource.org/licenses/mit-license.php
 
 #include "COLLADAFWPrerequisites.h"
 #include "COLLADAFWArray.h"
+#include "COLLADAFWMemoryArena.h"
 #include <string.h>
 #include <cassert>
 #include <stdlib.h>
@@ -22,7 +23,8 @@ namespace COLLADAFW
 {
 	/**
 	Array template that simplifies handling of C-arrays.
-	The memory will be allocated with malloc, freed with free and resized with realloc.
+	The memory will be allocated with malloc, freed with free and resized with realloc, or taken from the
+	current MemoryArena, if there is one.
 	Don't take this class for other data types then the primitives data types, because no
 	constructors and destructors will be called!
 	*/
@@ -146,7 +148,7 @@ namespace COLLADAFW
 			if ( capacity == 0 )
 				setData ( 0, 0, 0 );
 			else
-				setData ( ( Type* ) ( malloc ( capacity * sizeof (Type) ) ), 0, capacity );
+				setData ( ( Type* ) ( MemoryArena::allocateMemory ( capacity * sizeof (Type) ) ), 0, capacity );
 			mFlags |= flags;
 		}
 
@@ -154,7 +156,7 @@ namespace COLLADAFW
 		Must not be called, if the memory has not been allocated by allocateMemory().*/
 		void releaseMemory ()
 		{
-			free ( mData );
+			MemoryArena::freeMemory ( mData );
 			setData ( 0, 0, 0 );
 		}
 
@@ -167,6 +169,7 @@ namespace COLLADAFW
 		{
 			if ( minCapacity <= mCapacity)
 				return;
+			size_t oldCapacity = mCapacity;
 			size_t newCapacity = ( mCapacity * 3 ) / 2 + 1;
 			if (newCapacity < minCapacity)
 				newCapacity = minCapacity;
@@ -174,7 +177,7 @@ namespace COLLADAFW
 
 			if ( mData )
 			{
-				mData = ( Type* ) realloc ( mData, mCapacity * sizeof ( Type ) );
+				mData = ( Type* ) MemoryArena::reallocateMemory ( mData, oldCapacity * sizeof ( Type ), mCapacity * sizeof ( Type ) );
 				if ( mCount > mCapacity )
 					mCount = mCapacity;
 			}
@@ -73,6 +73,9 @@ namespace COLLADAFW
 		/** Sets the red component*/
 		void setAlpha( double a ) {mA = a; }
 
+        /** Returns the sid of the color*/
+        const String& getSid() const { return mSid; }
+
         /** A white color object*/
         static const Color WHITE;
 
@@ -0,0 +1,90 @@
+/*
+Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+This file is part of COLLADAFramework.
+
+Licensed under the MIT Open Source License,
+for details please see LICENSE file or the website
+http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_IMESHSTREAMWRITER_H__
+#define __COLLADAFW_IMESHSTREAMWRITER_H__
+
+#include "COLLADAFWPrerequisites.h"
+
+
+namespace COLLADAFW
+{
+	class Mesh;
+	class MeshVertexData;
+	class MeshPrimitive;
+
+
+	/** Optional interface for writers that want to receive meshes in blocks, while the mesh is still being
+	parsed, instead of receiving the entire mesh through IWriter::writeGeometry(). Only the current block is
+	kept in memory by the loader.
+	For each mesh, beginMesh() is called first, followed by any sequence of appendVertexBlock() and
+	appendPrimitiveBlock() calls and finally endMesh(). The vertex data a primitive block refers to has
+	always been passed before the primitive block.
+	All objects passed to the methods are owned by the loader and are only valid during the call.*/
+	class IMeshStreamWriter
+	{
+	public:
+
+		/** The kind of vertex data passed to appendVertexBlock().*/
+		enum VertexDataType
+		{
+			POSITIONS,
+			NORMALS,
+			COLORS,
+			UV_COORDINATES
+		};
+
+	public:
+
+		/** Constructor. */
+		IMeshStreamWriter() {};
+
+		/** Destructor. */
+		virtual ~IMeshStreamWriter() {};
+
+		/** Called when a new mesh starts. @a mesh does not contain any vertex data or primitives yet, only its
+		unique id, name and original id are set.
+		@return The writer should return true, if writing succeeded, false otherwise.*/
+		virtual bool beginMesh( const Mesh* mesh ) = 0;
+
+		/** Called for each block of vertex data of the current mesh.
+		@param vertexDataType The kind of the values in @a vertexData.
+		@param vertexData The values of the block. For colors and uv coordinates it contains one input info
+		per source of the block.
+		@param firstValueIndex The index of the first value of the block within all values of
+		@a vertexDataType of the mesh, i.e. the number of values passed in earlier blocks. The indices
+		in the primitive blocks refer to the values of all blocks, as if they were concatenated.
+		@return The writer should return true, if writing succeeded, false otherwise.*/
+		virtual bool appendVertexBlock( VertexDataType vertexDataType, const MeshVertexData& vertexData, size_t firstValueIndex ) = 0;
+
+		/** Called for each block of faces of the current mesh. The block contains only complete faces, lines,
+		strips or fans. The face count and, for grouped primitives, the vertex count array and the strip, fan or
+		line strip count refer to the block only. A COLLADA primitive element may be split into several
+		consecutive blocks, all with the same unique id.
+		@return The writer should return true, if writing succeeded, false otherwise.*/
+		virtual bool appendPrimitiveBlock( const MeshPrimitive* meshPrimitive ) = 0;
+
+		/** Called after the last block of the current mesh. @a mesh does not contain any vertex data or
+		primitives.
+		@return The writer should return true, if writing succeeded, false otherwise.*/
+		virtual bool endMesh( const Mesh* mesh ) = 0;
+
+	private:
+
+		/** Disable default copy ctor. */
+		IMeshStreamWriter( const IMeshStreamWriter& pre );
+
+		/** Disable default assignment operator. */
+		const IMeshStreamWriter& operator= ( const IMeshStreamWriter& pre );
+
+	};
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_IMESHSTREAMWRITER_H__
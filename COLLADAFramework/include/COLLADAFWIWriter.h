@@ -126,6 +126,29 @@ namespace COLLADAFW
 		@return The writer should return true, if writing succeeded, false otherwise.*/
 		virtual bool writeKinematicsScene( const KinematicsScene* kinematicsScene ) = 0;
 
+		/** The adopt methods are called instead of the corresponding write methods, if the loader does not 
+		need the object after the call. The writer takes ownership of the object and must delete it, when 
+		it is no longer needed. This allows writers that need the objects later on to keep them instead of 
+		copying them. Objects allocated in a MemoryArena must be deleted before the arena is released.
+		The default implementations call the write method and delete the object.
+		@return The writer should return true, if writing succeeded, false otherwise.*/
+		virtual bool adoptGeometry ( Geometry* geometry );
+
+		/** See adoptGeometry().*/
+		virtual bool adoptMaterial( Material* material );
+
+		/** See adoptGeometry().*/
+		virtual bool adoptEffect( Effect* effect );
+
+		/** See adoptGeometry().*/
+		virtual bool adoptImage( Image* image );
+
+		/** See adoptGeometry().*/
+		virtual bool adoptAnimation( Animation* animation );
+
+		/** See adoptGeometry().*/
+		virtual bool adoptSkinControllerData( SkinControllerData* skinControllerData );
+
 
     private:
 
@@ -18,7 +18,7 @@
 namespace COLLADAFW
 {
 
-    class IndexList
+    class IndexList : public ArenaAllocated
     {
     private:
         String mName;
@@ -0,0 +1,148 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_MEMORYARENA_H__
+#define __COLLADAFW_MEMORYARENA_H__
+
+#include "COLLADAFWPrerequisites.h"
+
+#include <map>
+
+
+namespace COLLADAFW
+{
+
+	/** Monotonic allocator for the framework objects and array data of one document. Memory is taken from
+	large chunks and is never freed individually. All chunks are freed at once, when the arena is
+	released or destroyed.
+	While an arena is the current arena, all objects derived from ArenaAllocated and the data of all
+	ArrayPrimitiveTypes are allocated in it. Deleting such an object or array still calls the destructors,
+	but the memory is only returned when the arena is released. Therefore the arena must outlive all
+	objects and arrays allocated in it, including data whose ownership has been passed on with
+	ArrayPrimitiveType::yieldOwnerShip().
+	The current arena is set per thread. An arena itself is not thread safe and must only be made
+	current in one thread at a time. Objects and arrays allocated in it may be deleted in any thread.*/
+	class MemoryArena
+	{
+	private:
+		/** Maps the first byte of each chunk to the first byte after the chunk.*/
+		typedef std::map<const char*, const char*> ChunkMap;
+
+	public:
+		/** The size of the chunks allocated by default.*/
+		static const size_t DEFAULT_CHUNK_SIZE = 1024 * 1024;
+
+	private:
+		/** All chunks of this arena.*/
+		ChunkMap mChunks;
+
+		/** The next free byte in the current chunk.*/
+		char* mCurrentPosition;
+
+		/** The first byte after the current chunk.*/
+		char* mCurrentChunkEnd;
+
+		/** The size of the chunks allocated for small requests.*/
+		size_t mChunkSize;
+
+		/** The number of bytes handed out since the arena has been created or released.*/
+		size_t mBytesAllocated;
+
+	public:
+
+		/** Constructor. @a chunkSize is the size of the chunks requested from the heap.*/
+		MemoryArena( size_t chunkSize = DEFAULT_CHUNK_SIZE );
+
+		/** Destructor. Releases all memory.*/
+		virtual ~MemoryArena();
+
+		/** Returns @a size bytes of memory, aligned for all primitive types.*/
+		void* allocate( size_t size );
+
+		/** Frees all memory at once. All objects allocated in the arena must have been destroyed before.*/
+		void release();
+
+		/** Returns true, if @a data has been allocated in this arena.*/
+		bool contains( const void* data ) const;
+
+		/** Returns the number of bytes handed out since the arena has been created or released.*/
+		size_t getBytesAllocated() const { return mBytesAllocated; }
+
+		/** Returns the arena new objects and arrays are allocated in by the calling thread, or 0, if they 
+		are allocated on the heap.*/
+		static MemoryArena* getCurrentArena();
+
+		/** Sets the arena new objects and arrays are allocated in by the calling thread. Pass 0 to allocate 
+		on the heap.*/
+		static void setCurrentArena( MemoryArena* memoryArena );
+
+		/** Allocates @a size bytes in the current arena or, if there is none, with malloc. The block is 
+		preceded by a header that records where it has been allocated. It must therefore only be passed to 
+		reallocateMemory() and freeMemory(), never to realloc() or free().*/
+		static void* allocateMemory( size_t size );
+
+		/** Resizes @a data, allocated by allocateMemory(), from @a oldSize to @a newSize bytes. Heap memory 
+		is reallocated. Data in an arena grows in place, if it is the last block allocated in the current 
+		arena, and is copied otherwise.*/
+		static void* reallocateMemory( void* data, size_t oldSize, size_t newSize );
+
+		/** Frees @a data, allocated by allocateMemory(). Does nothing for data in an arena.*/
+		static void freeMemory( void* data );
+
+	private:
+		/** Resizes the block at @a data from @a oldSize to @a newSize bytes without moving it. Succeeds only, 
+		if the block is the last one handed out from the current chunk and the chunk has enough space left.
+		@return True, if the block has been resized.*/
+		bool resizeLast( void* data, size_t oldSize, size_t newSize );
+
+        /** Disable default copy ctor. */
+		MemoryArena( const MemoryArena& pre );
+
+        /** Disable default assignment operator. */
+		const MemoryArena& operator= ( const MemoryArena& pre );
+	};
+
+
+	/** Makes @a memoryArena the current arena during its lifetime and restores the previous one afterwards.*/
+	class CurrentMemoryArenaScope
+	{
+	private:
+		MemoryArena* mPreviousArena;
+
+	public:
+		CurrentMemoryArenaScope( MemoryArena* memoryArena )
+			: mPreviousArena( MemoryArena::getCurrentArena() )
+		{
+			MemoryArena::setCurrentArena( memoryArena );
+		}
+
+		~CurrentMemoryArenaScope() { MemoryArena::setCurrentArena( mPreviousArena ); }
+
+	private:
+        /** Disable default copy ctor. */
+		CurrentMemoryArenaScope( const CurrentMemoryArenaScope& pre );
+
+        /** Disable default assignment operator. */
+		const CurrentMemoryArenaScope& operator= ( const CurrentMemoryArenaScope& pre );
+	};
+
+
+	/** Base class of the framework classes that are allocated in the current memory arena, if there is one.*/
+	class ArenaAllocated
+	{
+	public:
+		static void* operator new( size_t size );
+
+		static void operator delete( void* data );
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_MEMORYARENA_H__
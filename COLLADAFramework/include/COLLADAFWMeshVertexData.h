@@ -29,7 +29,7 @@ namespace COLLADAFW
         /**
         * Additional informations about multiple inputs.
         */
-        struct InputInfos
+        struct InputInfos : public ArenaAllocated
         {
             String mName;
             size_t mStride;
@@ -74,6 +74,17 @@ namespace COLLADAFW
 		/** Returns the InputInfosArray.*/
 		const InputInfosArray& getInputInfosArray() const { return mInputInfosArray; }
 
+		/** Clears the values and the input infos. The data type remains unchanged.*/
+		void clear()
+		{
+			for ( size_t i=0; i<mInputInfosArray.getCount(); ++i )
+			{
+				delete mInputInfosArray [i];
+			}
+			mInputInfosArray.setCount ( 0 );
+			FloatOrDoubleArray::clear ();
+		}
+
         /**
         * Appends the values in the array on the list of values and stores the information
         * of the current input.
@@ -138,6 +149,21 @@ namespace COLLADAFW
             return mInputInfosArray[index]->mLength;
         }
 
+        /**
+        * Stores the information of an input, whose values have already been set, e.g. by setData().
+        * @param const String& name The name of the input.
+        * @param const size_t stride The data stride.
+        * @param const size_t length The number of values of the input.
+        */
+        void appendInputInfos ( const String& name, const size_t stride, const size_t length )
+        {
+            InputInfos* info = new InputInfos();
+            info->mLength = length;
+            info->mName = name;
+            info->mStride = stride;
+
+            mInputInfosArray.append ( info );
+        }
 
 		/** Appends the values of the input array to the end of values array.
 		The programmer must ensure, that the memory allocated,
@@ -13,6 +13,7 @@ http://www.opensource.org/licenses/mit-license.php
 
 #include "COLLADAFWPrerequisites.h"
 #include "COLLADAFWUniqueId.h"
+#include "COLLADAFWMemoryArena.h"
 
 
 namespace COLLADAFW
@@ -20,7 +21,7 @@ namespace COLLADAFW
 
 
 	/** Base class of all classes that can be referenced in the model.*/
-	class Object
+	class Object : public ArenaAllocated
 	{
 	public:
 		virtual ~Object(){};
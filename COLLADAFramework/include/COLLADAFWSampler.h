@@ -138,7 +138,7 @@ namespace COLLADAFW
 		virtual ~Sampler();
 
 		/** Returns the sampler type. */
-		SamplerType getSamplerType ( ) { return mSamplerType; }
+		SamplerType getSamplerType ( ) const { return mSamplerType; }
 
 		/** Set the sampler type. */
 		void setSamplerType ( SamplerType samplerType ) { mSamplerType = samplerType; }
@@ -0,0 +1,72 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License, 
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWIWriter.h"
+#include "COLLADAFWGeometry.h"
+#include "COLLADAFWMaterial.h"
+#include "COLLADAFWEffect.h"
+#include "COLLADAFWImage.h"
+#include "COLLADAFWAnimation.h"
+#include "COLLADAFWSkinControllerData.h"
+
+
+namespace COLLADAFW
+{
+
+    //------------------------------
+	bool IWriter::adoptGeometry( Geometry* geometry )
+	{
+		bool success = writeGeometry( geometry );
+		FW_DELETE geometry;
+		return success;
+	}
+
+    //------------------------------
+	bool IWriter::adoptMaterial( Material* material )
+	{
+		bool success = writeMaterial( material );
+		FW_DELETE material;
+		return success;
+	}
+
+    //------------------------------
+	bool IWriter::adoptEffect( Effect* effect )
+	{
+		bool success = writeEffect( effect );
+		FW_DELETE effect;
+		return success;
+	}
+
+    //------------------------------
+	bool IWriter::adoptImage( Image* image )
+	{
+		bool success = writeImage( image );
+		FW_DELETE image;
+		return success;
+	}
+
+    //------------------------------
+	bool IWriter::adoptAnimation( Animation* animation )
+	{
+		bool success = writeAnimation( animation );
+		FW_DELETE animation;
+		return success;
+	}
+
+    //------------------------------
+	bool IWriter::adoptSkinControllerData( SkinControllerData* skinControllerData )
+	{
+		bool success = writeSkinControllerData( skinControllerData );
+		FW_DELETE skinControllerData;
+		return success;
+	}
+
+} // namespace COLLADAFW
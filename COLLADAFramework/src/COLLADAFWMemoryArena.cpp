@@ -0,0 +1,206 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWMemoryArena.h"
+
+#include "COLLADABUPlatform.h"
+
+#include <algorithm>
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+
+namespace COLLADAFW
+{
+	/** The alignment of all memory handed out by an arena.*/
+	static const size_t ALIGNMENT = 16;
+
+	/** Precedes each block handed out by MemoryArena::allocateMemory(). Padded to ALIGNMENT bytes, to keep 
+	the block aligned.*/
+	union BlockHeader
+	{
+		/** The arena the block has been allocated in, or 0, if it has been allocated on the heap.*/
+		MemoryArena* arena;
+		char padding[ALIGNMENT];
+	};
+
+	/** The arena new objects and arrays are allocated in by the current thread, or 0.*/
+#if defined(COLLADABU_OS_WIN)
+	static __declspec(thread) MemoryArena* currentArena = 0;
+#else
+	static __thread MemoryArena* currentArena = 0;
+#endif
+
+	//------------------------------
+	static BlockHeader* getBlockHeader( void* data )
+	{
+		return (BlockHeader*)data - 1;
+	}
+
+	//------------------------------
+	MemoryArena::MemoryArena( size_t chunkSize )
+		: mCurrentPosition(0)
+		, mCurrentChunkEnd(0)
+		, mChunkSize(chunkSize)
+		, mBytesAllocated(0)
+	{
+	}
+
+	//------------------------------
+	MemoryArena::~MemoryArena()
+	{
+		release();
+		if ( currentArena == this )
+			currentArena = 0;
+	}
+
+	//------------------------------
+	void* MemoryArena::allocate( size_t size )
+	{
+		size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+		if ( size > (size_t)(mCurrentChunkEnd - mCurrentPosition) )
+		{
+			// large blocks get a chunk of their own, to not waste the rest of the current chunk
+			size_t chunkSize = (size > mChunkSize / 4) ? size : mChunkSize;
+			char* chunk = (char*)malloc(chunkSize);
+			if ( !chunk )
+				return 0;
+			mChunks.insert(std::make_pair(chunk, chunk + chunkSize));
+			mBytesAllocated += size;
+
+			if ( chunkSize == size )
+				return chunk;
+
+			mCurrentPosition = chunk;
+			mCurrentChunkEnd = chunk + chunkSize;
+		}
+
+		void* data = mCurrentPosition;
+		mCurrentPosition += size;
+		mBytesAllocated += size;
+		return data;
+	}
+
+	//------------------------------
+	void MemoryArena::release()
+	{
+		for ( ChunkMap::iterator it = mChunks.begin(); it != mChunks.end(); ++it )
+			free((void*)it->first);
+		mChunks.clear();
+		mCurrentPosition = 0;
+		mCurrentChunkEnd = 0;
+		mBytesAllocated = 0;
+	}
+
+	//------------------------------
+	bool MemoryArena::contains( const void* data ) const
+	{
+		const char* position = (const char*)data;
+		ChunkMap::const_iterator it = mChunks.upper_bound(position);
+		if ( it == mChunks.begin() )
+			return false;
+		--it;
+		return position < it->second;
+	}
+
+	//------------------------------
+	bool MemoryArena::resizeLast( void* data, size_t oldSize, size_t newSize )
+	{
+		oldSize = (oldSize + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+		newSize = (newSize + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+		char* block = (char*)data;
+		if ( (block + oldSize != mCurrentPosition) || (newSize > (size_t)(mCurrentChunkEnd - block)) )
+			return false;
+
+		mCurrentPosition = block + newSize;
+		mBytesAllocated += newSize - oldSize;
+		return true;
+	}
+
+	//------------------------------
+	MemoryArena* MemoryArena::getCurrentArena()
+	{
+		return currentArena;
+	}
+
+	//------------------------------
+	void MemoryArena::setCurrentArena( MemoryArena* memoryArena )
+	{
+		currentArena = memoryArena;
+	}
+
+	//------------------------------
+	void* MemoryArena::allocateMemory( size_t size )
+	{
+		MemoryArena* arena = currentArena;
+		BlockHeader* header;
+		if ( arena )
+			header = (BlockHeader*)arena->allocate(sizeof(BlockHeader) + size);
+		else
+			header = (BlockHeader*)malloc(sizeof(BlockHeader) + size);
+		if ( !header )
+			return 0;
+
+		header->arena = arena;
+		return header + 1;
+	}
+
+	//------------------------------
+	void* MemoryArena::reallocateMemory( void* data, size_t oldSize, size_t newSize )
+	{
+		if ( !data )
+			return allocateMemory(newSize);
+
+		BlockHeader* header = getBlockHeader(data);
+		MemoryArena* arena = header->arena;
+		if ( !arena )
+		{
+			header = (BlockHeader*)realloc(header, sizeof(BlockHeader) + newSize);
+			return header ? header + 1 : 0;
+		}
+
+		// only the current arena of this thread may be modified
+		if ( (arena == currentArena) && arena->resizeLast(header, sizeof(BlockHeader) + oldSize, sizeof(BlockHeader) + newSize) )
+			return data;
+
+		void* newData = allocateMemory(newSize);
+		if ( newData )
+			memcpy(newData, data, std::min(oldSize, newSize));
+		return newData;
+	}
+
+	//------------------------------
+	void MemoryArena::freeMemory( void* data )
+	{
+		if ( !data || getBlockHeader(data)->arena )
+			return;
+		free(getBlockHeader(data));
+	}
+
+	//------------------------------
+	void* ArenaAllocated::operator new( size_t size )
+	{
+		void* data = MemoryArena::allocateMemory(size ? size : 1);
+		if ( !data )
+			throw std::bad_alloc();
+		return data;
+	}
+
+	//------------------------------
+	void ArenaAllocated::operator delete( void* data )
+	{
+		MemoryArena::freeMemory(data);
+	}
+
+} // namespace COLLADAFW
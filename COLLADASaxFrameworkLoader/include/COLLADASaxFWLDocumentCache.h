@@ -0,0 +1,128 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_DOCUMENTCACHE_H__
+#define __COLLADASAXFWL_DOCUMENTCACHE_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+#include "COLLADASaxFWLXmlTypes.h"
+
+#include "COLLADAFWTypes.h"
+
+#include "COLLADABUURI.h"
+
+#include <vector>
+
+
+namespace COLLADASaxFWL
+{
+
+    /** Definitions shared by DocumentCacheWriter and DocumentCacheReader.
+	A document cache is a binary file stored next to a COLLADA document. It contains all calls of the IWriter
+	write methods made while the document and the documents it references have been loaded, together with the
+	hashes of these documents. All values are stored in the native byte order of the machine that wrote the
+	cache. The file consists of
+	- the header: MAGIC, VERSION, BYTE_ORDER_MARK, the object flags and the COLLADA version of the load, the
+	  offset of the file table and the size of the cache file.
+	- the records: one record per writer call, starting with its RecordType. The values of arrays are aligned
+	  to 8 bytes, such that they can be used directly from a read only memory mapping of the cache. The last
+	  record is RECORD_END.
+	- the file table: the number of files, followed by the file id, uri, load decision, size and hash of each
+	  file.*/
+	class DocumentCache
+	{
+	public:
+		/** The type of a record, i.e. the writer method to call.*/
+		enum RecordType
+		{
+			RECORD_END = 0,
+			RECORD_GLOBAL_ASSET,
+			RECORD_SCENE,
+			RECORD_VISUAL_SCENE,
+			RECORD_LIBRARY_NODES,
+			RECORD_GEOMETRY,
+			RECORD_MATERIAL,
+			RECORD_EFFECT,
+			RECORD_CAMERA,
+			RECORD_IMAGE,
+			RECORD_LIGHT,
+			RECORD_ANIMATION,
+			RECORD_ANIMATION_LIST,
+			RECORD_SKIN_CONTROLLER_DATA,
+			RECORD_CONTROLLER,
+			RECORD_FORMULAS,
+			RECORD_KINEMATICS_SCENE
+		};
+
+		/** A file loaded or referenced while the cache has been recorded.*/
+		struct CachedFile
+		{
+			/** The file id assigned to the file.*/
+			COLLADAFW::FileId fileId;
+
+			/** The absolute uri of the file.*/
+			COLLADABU::URI uri;
+
+			/** True, if the file has been loaded, false if the external reference decider rejected it.*/
+			bool loaded;
+
+			/** The size of the file in bytes. Only set for loaded files.*/
+			uint64 size;
+
+			/** The hash of the contents of the file, see calculateHash(). Only set for loaded files.*/
+			uint64 hash;
+		};
+
+		typedef std::vector<CachedFile> CachedFileList;
+
+	public:
+		/** The first bytes of every cache file.*/
+		static const char MAGIC[8];
+
+		/** The version of the cache format. Must be increased, whenever the format changes.*/
+		static const uint32 VERSION;
+
+		/** Stored in the header, to reject caches written with a different byte order.*/
+		static const uint32 BYTE_ORDER_MARK;
+
+		/** The size of the header in bytes. The first record starts at this offset.*/
+		static const size_t HEADER_SIZE;
+
+		/** The alignment of the array values in bytes.*/
+		static const size_t ARRAY_ALIGNMENT;
+
+		/** Appended to the name of a COLLADA document to get the name of its cache file.*/
+		static const String FILE_EXTENSION;
+
+	public:
+		/** Returns the name of the cache file of the COLLADA document @a fileName.*/
+		static String getCacheFileName( const String& fileName ) { return fileName + FILE_EXTENSION; }
+
+		/** Calculates a 64 bit hash of @a size bytes starting at @a data. A variant of FNV-1a that processes
+		eight bytes per step, the hash is therefore cheap compared to parsing the data.*/
+		static uint64 calculateHash( const char* data, size_t size );
+
+		/** Calculates the size and the hash of the contents of the local file @a fileUri.
+		@return False, if the file could not be read.*/
+		static bool calculateFileHash( const COLLADABU::URI& fileUri, uint64& size, uint64& hash );
+
+	private:
+
+        /** Disable default copy ctor. */
+		DocumentCache( const DocumentCache& pre );
+
+        /** Disable default assignment operator. */
+		const DocumentCache& operator= ( const DocumentCache& pre );
+
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_DOCUMENTCACHE_H__
@@ -0,0 +1,198 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_DOCUMENTCACHEREADER_H__
+#define __COLLADASAXFWL_DOCUMENTCACHEREADER_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+#include "COLLADASaxFWLDocumentCache.h"
+
+#include "COLLADAFWArrayPrimitiveType.h"
+#include "COLLADAFWNode.h"
+
+#include "GeneratedSaxParserMemoryMappedFile.h"
+
+
+namespace COLLADABU
+{
+	namespace Math
+	{
+		class Matrix4;
+		class Vector3;
+	}
+}
+
+namespace COLLADAFW
+{
+	class IWriter;
+	class UniqueId;
+	class Color;
+	class ColorOrTexture;
+	class FloatOrParam;
+	class AnimatableFloat;
+	class FloatOrDoubleArray;
+	class MeshVertexData;
+	class MeshPrimitive;
+	class IndexList;
+	class MaterialBinding;
+	class Transformation;
+	class EffectCommon;
+	class Sampler;
+}
+
+
+namespace COLLADASaxFWL
+{
+
+    /** Replays a document cache written by DocumentCacheWriter, see DocumentCache. The cache file is mapped into
+	memory. The recorded objects are recreated one at a time, passed to the writer and deleted again. The values
+	of their arrays are not copied, but point into the read only mapping of the cache file. They must therefore
+	neither be modified nor used after the write call returned. The objects are therefore never handed over
+	to the adopt methods of the writer, see COLLADAFW::IWriter::adoptGeometry().*/
+	class DocumentCacheReader
+	{
+	private:
+		/** The mapping of the cache file.*/
+		GeneratedSaxParser::MemoryMappedFile mFile;
+
+		/** The position of the next value to read, relative to the beginning of the cache file.*/
+		size_t mPosition;
+
+		/** The position after the last byte that may be read, i.e. the end of the file while the file table is
+		read and the beginning of the file table while the records are read.*/
+		size_t mEnd;
+
+		/** False, if a value beyond mEnd has been read or an unknown value has been found.*/
+		bool mValid;
+
+		/** The object flags of the recorded load.*/
+		int mObjectFlags;
+
+		/** The COLLADA version of the recorded document.*/
+		COLLADAVersion mCOLLADAVersion;
+
+		/** The files loaded or rejected while the cache has been recorded.*/
+		DocumentCache::CachedFileList mFiles;
+
+	public:
+
+        /** Constructor.*/
+		DocumentCacheReader();
+
+        /** Destructor.*/
+		virtual ~DocumentCacheReader();
+
+		/** Maps the cache file @a cacheFileName into memory and reads its header and its file table.
+		@return False, if the file does not exist or is not a valid cache file written on this machine.*/
+		bool open( const String& cacheFileName );
+
+		/** Returns the object flags of the recorded load.*/
+		int getObjectFlags() const { return mObjectFlags; }
+
+		/** Returns the COLLADA version of the recorded document.*/
+		COLLADAVersion getCOLLADAVersion() const { return mCOLLADAVersion; }
+
+		/** Returns the files loaded or rejected while the cache has been recorded.*/
+		const DocumentCache::CachedFileList& getFiles() const { return mFiles; }
+
+		/** Passes all recorded objects to @a writer, in the order they have been recorded. Neither calls start(),
+		nor finish() of @a writer.
+		@return False, if the writer failed or the cache is corrupt, true otherwise.*/
+		bool replay( COLLADAFW::IWriter* writer );
+
+	private:
+
+		/** Replays the record starting at mPosition, which has type @a recordType.
+		@return The return value of the writer.*/
+		bool replayRecord( COLLADAFW::IWriter* writer, DocumentCache::RecordType recordType );
+
+		bool replayGlobalAsset( COLLADAFW::IWriter* writer );
+		bool replayScene( COLLADAFW::IWriter* writer );
+		bool replayVisualScene( COLLADAFW::IWriter* writer );
+		bool replayLibraryNodes( COLLADAFW::IWriter* writer );
+		bool replayGeometry( COLLADAFW::IWriter* writer );
+		bool replayMaterial( COLLADAFW::IWriter* writer );
+		bool replayEffect( COLLADAFW::IWriter* writer );
+		bool replayCamera( COLLADAFW::IWriter* writer );
+		bool replayImage( COLLADAFW::IWriter* writer );
+		bool replayLight( COLLADAFW::IWriter* writer );
+		bool replayAnimation( COLLADAFW::IWriter* writer );
+		bool replayAnimationList( COLLADAFW::IWriter* writer );
+		bool replaySkinControllerData( COLLADAFW::IWriter* writer );
+		bool replayController( COLLADAFW::IWriter* writer );
+		bool replayFormulas( COLLADAFW::IWriter* writer );
+		bool replayKinematicsScene( COLLADAFW::IWriter* writer );
+
+		/** Returns a pointer to @a size bytes at mPosition and advances mPosition. Returns 0 and sets mValid to
+		false, if less than @a size bytes are left before mEnd.*/
+		const char* readData( size_t size );
+
+		/** Advances mPosition to the next multiple of DocumentCache::ARRAY_ALIGNMENT.*/
+		void readAlignment();
+
+		uint32 readUInt32();
+		uint64 readUInt64();
+		size_t readSize();
+
+		/** Reads a number of elements. Sets mValid to false, if the number exceeds the number of bytes left,
+		which would make the cache read an arbitrary number of elements.*/
+		size_t readCount();
+
+		bool readBool() { return readUInt32() != 0; }
+		float readFloat();
+		double readDouble();
+		String readString();
+		COLLADABU::URI readUri();
+		COLLADAFW::UniqueId readUniqueId();
+		COLLADABU::Math::Matrix4 readMatrix();
+		COLLADABU::Math::Vector3 readVector();
+
+		/** Lets @a array point to the elements stored in the cache. @a array does not own the elements.*/
+		template<class Type>
+		void readArray( COLLADAFW::ArrayPrimitiveType<Type>& array );
+
+		void readColor( COLLADAFW::Color& color );
+		void readColorOrTexture( COLLADAFW::ColorOrTexture& colorOrTexture );
+		void readFloatOrParam( COLLADAFW::FloatOrParam& floatOrParam );
+		void readAnimatableFloat( COLLADAFW::AnimatableFloat& animatableFloat );
+		void readFloatOrDoubleArray( COLLADAFW::FloatOrDoubleArray& array );
+		void readMeshVertexData( COLLADAFW::MeshVertexData& vertexData );
+		COLLADAFW::IndexList* readIndexList();
+		COLLADAFW::MeshPrimitive* readMeshPrimitive();
+		void readMaterialBinding( COLLADAFW::MaterialBinding& materialBinding );
+		COLLADAFW::Transformation* readTransformation();
+		void readNodes( COLLADAFW::NodePointerArray& nodes );
+		COLLADAFW::EffectCommon* readEffectCommon();
+		COLLADAFW::Sampler* readSampler();
+
+		/** Creates an instance and reads its name, instantiated object and unique id.*/
+		template<class InstanceType>
+		InstanceType* readInstance();
+
+		/** Reads instances written by DocumentCacheWriter::writeInstances() and appends them to @a instances.*/
+		template<class InstanceType>
+		void readInstances( COLLADAFW::PointerArray<InstanceType>& instances );
+
+		/** Reads instances written by DocumentCacheWriter::writeBindingInstances() and appends them to
+		@a instances.*/
+		template<class InstanceType>
+		void readBindingInstances( COLLADAFW::PointerArray<InstanceType>& instances );
+
+        /** Disable default copy ctor. */
+		DocumentCacheReader( const DocumentCacheReader& pre );
+
+        /** Disable default assignment operator. */
+		const DocumentCacheReader& operator= ( const DocumentCacheReader& pre );
+
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_DOCUMENTCACHEREADER_H__
@@ -0,0 +1,211 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_DOCUMENTCACHEWRITER_H__
+#define __COLLADASAXFWL_DOCUMENTCACHEWRITER_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+#include "COLLADASaxFWLDocumentCache.h"
+
+#include "COLLADAFWIWriter.h"
+#include "COLLADAFWArrayPrimitiveType.h"
+#include "COLLADAFWNode.h"
+
+#include <stdio.h>
+
+
+namespace COLLADABU
+{
+	namespace Math
+	{
+		class Matrix4;
+		class Vector3;
+	}
+}
+
+namespace COLLADAFW
+{
+	class UniqueId;
+	class Color;
+	class ColorOrTexture;
+	class FloatOrParam;
+	class AnimatableFloat;
+	class FloatOrDoubleArray;
+	class MeshVertexData;
+	class MeshPrimitive;
+	class IndexList;
+	class MaterialBinding;
+	class Transformation;
+	class EffectCommon;
+	class Sampler;
+}
+
+
+namespace COLLADASaxFWL
+{
+
+    /** Writer that records all write calls into a document cache, see DocumentCache, and passes them on to
+	another writer. The objects are serialized during the call, i.e. they need not stay valid afterwards.
+	The records are written to a temporary file, which is moved to the cache file by save().
+	Formulas, kinematics scenes and geometries other than meshes can not be recorded, only the empty formulas
+	and kinematics scenes every load writes. If one of them is written or if the target writer fails, the 
+	recording is incomplete and can not be saved.*/
+	class DocumentCacheWriter : public COLLADAFW::IWriter
+	{
+	private:
+		/** The writer the calls are passed to.*/
+		COLLADAFW::IWriter* mWriter;
+
+		/** The name of the cache file created by save().*/
+		String mCacheFileName;
+
+		/** The name of the file the records are written to.*/
+		String mTemporaryFileName;
+
+		/** The temporary file, or 0 if it could not be created or has already been closed.*/
+		FILE* mFile;
+
+		/** The number of bytes written to mFile.*/
+		uint64 mOffset;
+
+		/** True, as long as all calls could be recorded and the target writer did not fail.*/
+		bool mComplete;
+
+		/** The files passed to addFile(), written to the file table by save().*/
+		DocumentCache::CachedFileList mFiles;
+
+	public:
+
+        /** Constructor. Creates the temporary file and writes a preliminary header.
+		@param writer The writer the calls are passed to. Not owned by the cache writer.
+		@param cacheFileName The name of the cache file to create.*/
+		DocumentCacheWriter( COLLADAFW::IWriter* writer, const String& cacheFileName );
+
+        /** Destructor. Deletes the temporary file, if the cache has not been saved.*/
+		virtual ~DocumentCacheWriter();
+
+		/** Returns the writer the calls are passed to.*/
+		COLLADAFW::IWriter* getWriter() const { return mWriter; }
+
+		/** Returns true, if all calls so far have been recorded.*/
+		bool isComplete() const { return mComplete; }
+
+		/** Adds the file @a fileUri with id @a fileId to the file table. The size and hash of a file that is 
+		loaded are calculated immediately. The file must therefore be added before it is parsed, such that a
+		change made while it is parsed invalidates the cache. If the file can not be hashed, the recording is 
+		incomplete. The files must be added in the order of their ids.
+		@param loaded True, if the file is loaded, false if the external reference decider rejected it.*/
+		void addFile( COLLADAFW::FileId fileId, const COLLADABU::URI& fileUri, bool loaded );
+
+		/** Writes the end record, the file table and the final header and replaces the cache file by the
+		recorded one. Must only be called, if the recording is complete.
+		@param objectFlags The flags of the objects that have been loaded.
+		@param cOLLADAVersion The version of the loaded document.
+		@return True, if the cache file has been written, false otherwise.*/
+		bool save( int objectFlags, COLLADAVersion cOLLADAVersion );
+
+		/** Stops the recording and passes the call to the target writer.*/
+		virtual void cancel( const String& errorMessage );
+
+		/** Passes the call to the target writer.*/
+		virtual void start();
+
+		/** Passes the call to the target writer.*/
+		virtual void finish();
+
+		/** The following methods pass the call to the target writer and record it, if the target writer
+		succeeded.
+		@return The return value of the target writer.*/
+		virtual bool writeGlobalAsset( const COLLADAFW::FileInfo* asset );
+		virtual bool writeScene( const COLLADAFW::Scene* scene );
+		virtual bool writeVisualScene( const COLLADAFW::VisualScene* visualScene );
+		virtual bool writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes );
+		virtual bool writeGeometry( const COLLADAFW::Geometry* geometry );
+		virtual bool writeMaterial( const COLLADAFW::Material* material );
+		virtual bool writeEffect( const COLLADAFW::Effect* effect );
+		virtual bool writeCamera( const COLLADAFW::Camera* camera );
+		virtual bool writeImage( const COLLADAFW::Image* image );
+		virtual bool writeLight( const COLLADAFW::Light* light );
+		virtual bool writeAnimation( const COLLADAFW::Animation* animation );
+		virtual bool writeAnimationList( const COLLADAFW::AnimationList* animationList );
+		virtual bool writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData );
+		virtual bool writeController( const COLLADAFW::Controller* controller );
+
+		/** Passes the call to the target writer. Records @a formulas, if it is empty, and marks the recording
+		as incomplete otherwise.*/
+		virtual bool writeFormulas( const COLLADAFW::Formulas* formulas );
+
+		/** Passes the call to the target writer. Records @a kinematicsScene, if it is empty, and marks the 
+		recording as incomplete otherwise.*/
+		virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene );
+
+	private:
+
+		/** Writes the header, using @a fileTableOffset and @a cacheSize, at the current position.*/
+		void writeHeader( int objectFlags, COLLADAVersion cOLLADAVersion, uint64 fileTableOffset, uint64 cacheSize );
+
+		/** Writes @a size bytes to the temporary file.*/
+		void writeData( const void* data, size_t size );
+
+		/** Writes zero bytes until mOffset is a multiple of DocumentCache::ARRAY_ALIGNMENT.*/
+		void writeAlignment();
+
+		void writeUInt32( uint32 value ) { writeData( &value, sizeof(value) ); }
+		void writeUInt64( uint64 value ) { writeData( &value, sizeof(value) ); }
+		void writeBool( bool value ) { writeUInt32( value ? 1 : 0 ); }
+		void writeFloat( float value ) { writeData( &value, sizeof(value) ); }
+		void writeDouble( double value ) { writeData( &value, sizeof(value) ); }
+		void writeString( const String& value );
+		void writeUri( const COLLADABU::URI& uri );
+		void writeUniqueId( const COLLADAFW::UniqueId& uniqueId );
+		void writeMatrix( const COLLADABU::Math::Matrix4& matrix );
+		void writeVector( const COLLADABU::Math::Vector3& vector );
+
+		/** Writes the number of elements and the aligned elements of @a array.*/
+		template<class Type>
+		void writeArray( const COLLADAFW::ArrayPrimitiveType<Type>& array );
+
+		void writeColor( const COLLADAFW::Color& color );
+		void writeColorOrTexture( const COLLADAFW::ColorOrTexture& colorOrTexture );
+		void writeFloatOrParam( const COLLADAFW::FloatOrParam& floatOrParam );
+		void writeAnimatableFloat( const COLLADAFW::AnimatableFloat& animatableFloat );
+		void writeFloatOrDoubleArray( const COLLADAFW::FloatOrDoubleArray& array );
+		void writeMeshVertexData( const COLLADAFW::MeshVertexData& vertexData );
+		void writeIndexList( const COLLADAFW::IndexList& indexList );
+		void writeMeshPrimitive( const COLLADAFW::MeshPrimitive& meshPrimitive );
+		void writeMaterialBinding( const COLLADAFW::MaterialBinding& materialBinding );
+		void writeTransformation( const COLLADAFW::Transformation& transformation );
+		void writeNodes( const COLLADAFW::NodePointerArray& nodes );
+		void writeEffectCommon( const COLLADAFW::EffectCommon& effectCommon );
+		void writeSampler( const COLLADAFW::Sampler& sampler );
+
+		/** Writes the name, instantiated object and unique id of an instance.*/
+		template<class InstanceType>
+		void writeInstance( const InstanceType& instance );
+
+		/** Writes the instances in @a instances, see writeInstance().*/
+		template<class InstanceType>
+		void writeInstances( const COLLADAFW::PointerArray<InstanceType>& instances );
+
+		/** Writes the instances in @a instances, including their material bindings.*/
+		template<class InstanceType>
+		void writeBindingInstances( const COLLADAFW::PointerArray<InstanceType>& instances );
+
+		/** Disable default copy ctor. */
+		DocumentCacheWriter( const DocumentCacheWriter& pre );
+
+		/** Disable default assignment operator. */
+		const DocumentCacheWriter& operator= ( const DocumentCacheWriter& pre );
+
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_DOCUMENTCACHEWRITER_H__
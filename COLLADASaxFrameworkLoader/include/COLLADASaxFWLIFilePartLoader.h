@@ -40,6 +40,7 @@ namespace COLLADAFW
 	class IWriter;
 	class Object;
 	class Animatable;
+	class Geometry;
 	class AnimationList;
 	class MorphController;
 }
@@ -94,6 +95,20 @@ namespace COLLADASaxFWL
 		/** Returns the writer the data will be written to.*/
 		COLLADAFW::IWriter* writer();
 
+		/** Passes @a object to the writer. If the loader uses a writer pipeline, @a object is only queued 
+		and written later on the pipeline thread. @a object must therefore not be modified after this call.
+		@param object The object to write. Supported are geometries, materials, effects, images, animations
+		and skin controller data.
+		@param deleteAfterWrite True, if the loader does not need @a object anymore. The caller passes the 
+		ownership, which is handed over to the writer, see COLLADAFW::IWriter::adoptGeometry(), and must not 
+		access @a object after the call. If false, @a object must stay valid until the document has been loaded.
+		@return False, if writing @a object or an object queued before failed, true otherwise.*/
+		bool writeObject( COLLADAFW::Object* object, bool deleteAfterWrite );
+
+		/** Waits until all objects passed to writeObject() have been written.
+		@return False, if writing one of these objects failed, true otherwise.*/
+		bool flushWriter();
+
 		/** Reports an error to the error handler. If this method returns true, the 
 		loader stops parsing immediately. If severity is not CRITICAL and this method 
 		returns true, the loader continues loading. */
@@ -180,6 +195,16 @@ namespace COLLADASaxFWL
 		/** Returns TextureMapId for @a semantic. Successive call with same semantic return the same TextureMapId.*/
 		COLLADAFW::TextureMapId getTextureMapIdBySematic( const String& semantic );
 
+		/** Passes the ownership of @a geometry, that has already been written, to the loader, if the loader 
+		retains geometries. Otherwise nothing is done and the caller keeps the ownership.
+		@return True, if the loader took the ownership of @a geometry, false otherwise.*/
+		bool retainGeometry( COLLADAFW::Geometry* geometry );
+
+		/** Passes the ownership of @a object, that has already been written, to the loader, if the loader 
+		retains objects. Otherwise nothing is done and the caller keeps the ownership.
+		@return True, if the loader took the ownership of @a object, false otherwise.*/
+		bool retainObject( COLLADAFW::Object* object );
+
 		/** Creates a new in the sid tree. Call this method for every collada element that has an sid or that has an id 
 		and can have children with sids. For every call of this method you have to call addToSidTree() when the element
 		is closed.
@@ -16,6 +16,7 @@
 #include "COLLADASaxFWLSidTreeNode.h"
 #include "COLLADASaxFWLKinematicsIntermediateData.h"
 #include "COLLADASaxFWLTypes.h"
+#include "COLLADASaxFWLURIInternTable.h"
 
 #include "COLLADAFWILoader.h"
 #include "COLLADAFWLoaderUtils.h"
@@ -29,10 +30,12 @@
 #include "COLLADABUhash_map.h"
 
 #include <set>
+#include <deque>
 
 namespace COLLADAFW
 {
 	class IWriter;
+	class IMeshStreamWriter;
 	class VisualScene;
 	class LibraryNodes;
 	class Effect;
@@ -41,6 +44,8 @@ namespace COLLADAFW
 	class Formula;
 	class AnimationList;
 	class MorphController;
+	class Geometry;
+	class MemoryArena;
 }
 
 
@@ -50,6 +55,9 @@ namespace COLLADASaxFWL
 	class IErrorHandler;
 	class DocumentProcessor;
 	class PostProcessor;
+	class WriterPipeline;
+	class DocumentCacheReader;
+	class DocumentCacheWriter;
 
 
 	typedef std::list<String> StringList;
@@ -92,13 +100,19 @@ namespace COLLADASaxFWL
 		};
 
 	public:
-		typedef COLLADABU::hash_map<COLLADABU::URI, COLLADAFW::UniqueId> URIUniqueIdMap;
+		/** Unique ids, indexed by the handles of the uris in the uri intern table. A deque, since references to 
+		the unique ids are returned, that must stay valid while new uris are added.*/
+		typedef std::deque<COLLADAFW::UniqueId> URIHandleUniqueIdArray;
 
-		typedef COLLADABU::hash_map<COLLADABU::URI, COLLADAFW::FileId> URIFileIdMap;
+		/** File ids, indexed by the handles of the uris in the uri intern table.*/
+		typedef std::vector<COLLADAFW::FileId> URIHandleFileIdArray;
 
 		/** Maps file id to uri.*/
 		typedef std::map<COLLADAFW::FileId, COLLADABU::URI> FileIdURIMap;
 
+		/** Maps file id to the decision of the external reference decider.*/
+		typedef std::map<COLLADAFW::FileId, bool> FileIdDecisionMap;
+
 		/** Maps the id of a collada element to the corresponding sit tree node.*/
 		typedef std::map<String /*id*/, SidTreeNode*> IdStringSidTreeNodeMap;
 
@@ -123,6 +137,12 @@ namespace COLLADASaxFWL
 		/** List of morph controller.*/
 		typedef std::vector<COLLADAFW::MorphController*> MorphControllerList;
 
+		/** List of geometries.*/
+		typedef std::vector<COLLADAFW::Geometry*> GeometryList;
+
+		/** List of framework objects.*/
+		typedef std::vector<COLLADAFW::Object*> ObjectList;
+
 		struct JointSidsOrIds
 		{
 			JointSidsOrIds():areIds(true){}
@@ -197,11 +217,17 @@ namespace COLLADASaxFWL
         /** List of registered extra data callback handlers. */
         ExtraDataCallbackHandlerList mExtraDataCallbackHandlerList;
 
-		/** Maps each already processed dae element to its COLLADAFW::UniqueId. */
-		URIUniqueIdMap mURIUniqueIdMap;
+		/** Assigns a handle to each uri passed to getUniqueId() or getFileId(). The handles index 
+		mURIUniqueIds and mURIFileIds.*/
+		URIInternTable mURIInternTable;
 
-		/** Maps each uri to the file id assigned to it. The Uris need to have empty fragments.*/
-		URIFileIdMap mURIFileIdMap;
+		/** The COLLADAFW::UniqueId of each already processed dae element, by uri handle. Invalid for uris 
+		without unique id. */
+		URIHandleUniqueIdArray mURIUniqueIds;
+
+		/** The file id assigned to each uri, by uri handle. The Uris need to have empty fragments. 
+		INVALID_FILE_ID for uris without file id.*/
+		URIHandleFileIdArray mURIFileIds;
 
 		/** Maps each file id, already assigned to an uri, to that uri.*/
 		FileIdURIMap mFileIdURIMap;
@@ -245,7 +271,7 @@ namespace COLLADASaxFWL
 		completely been parsed.*/
 		LibraryNodesList mLibraryNodes;
 
-		/** List of all effects in the file. They are send to the writer and deleted, when the file has 
+		/** List of all effects in the file. They are handed over to the writer, when the file has 
 		completely been parsed.*/
 		EffectList mEffects;
 
@@ -295,6 +321,57 @@ namespace COLLADASaxFWL
 		/** The call back function used to decide which filed should be leaded.*/
 		ExternalReferenceDeciderCallbackFunction mExternalReferenceDeciderCallbackFunction;
 
+		/** True, if the files should be parsed from a read only memory mapping instead of being read 
+		through intermediate buffers.*/
+		bool mUseMemoryMappedFiles;
+
+		/** True, if libraries not required by mObjectFlags should be skipped without being tokenized.*/
+		bool mSkipExcludedLibraries;
+
+		/** True, if referenced files should be read ahead in the background as soon as they are found.*/
+		bool mReadAheadExternalReferences;
+
+		/** The decisions of mExternalReferenceDeciderCallbackFunction, already made for a file id. Ensures
+		the callback is called only once per file.*/
+		FileIdDecisionMap mExternalReferenceDecisions;
+
+		/** True, if the geometries should be kept after they have been written.*/
+		bool mRetainGeometries;
+
+		/** The geometries kept after they have been written, in the order they have been written. They 
+		are deleted by deleteRetainedGeometries() or when the loader is destroyed.*/
+		GeometryList mRetainedGeometries;
+
+		/** True, if all objects the loader would delete after they have been written should be kept.*/
+		bool mRetainObjects;
+
+		/** The objects kept after they have been written, in the order they have been written, except the 
+		retained geometries. They are deleted by deleteRetainedObjects() or when the loader is destroyed.*/
+		ObjectList mRetainedObjects;
+
+		/** The arena the framework objects are allocated in while a document is loaded, or 0.*/
+		COLLADAFW::MemoryArena* mMemoryArena;
+
+		/** The writer the meshes are streamed to in blocks, or 0 if they are passed to mWriter.*/
+		COLLADAFW::IMeshStreamWriter* mMeshStreamWriter;
+
+		/** The number of mesh vertices after which a primitive block is passed to mMeshStreamWriter.*/
+		size_t mMeshStreamBlockVertexCount;
+
+		/** The maximal number of objects waiting to be written by the writer pipeline, or 0 if the writer 
+		is called directly on the parse thread.*/
+		size_t mWriterPipelineQueueSize;
+
+		/** The pipeline that passes the objects to the writer of the current load on a background thread, 
+		or 0 if the writer is called directly.*/
+		WriterPipeline* mWriterPipeline;
+
+		/** True, if loaded documents should be recorded into and replayed from document caches.*/
+		bool mUseDocumentCache;
+
+		/** Records the objects written during the current load into a document cache, or 0.*/
+		DocumentCacheWriter* mDocumentCacheWriter;
+
 	public:
 
         /** Constructor. */
@@ -324,6 +401,144 @@ namespace COLLADASaxFWL
 		@param objectFlags The flags indicating which objects should be loaded.*/
 		void setObjectFlags( int objectFlags ) { mObjectFlags = objectFlags; }
 
+		/** Sets if the files loaded by loadDocument(const String&, COLLADAFW::IWriter*) should be parsed 
+		from a read only memory mapping. The sax parser then works directly on the mapped pages, without 
+		copying the file into intermediate buffers. Recommended for very large files.
+		@param useMemoryMappedFiles True, if the files should be memory mapped, false to read them
+		through buffers (default).*/
+		void setUseMemoryMappedFiles( bool useMemoryMappedFiles ) { mUseMemoryMappedFiles = useMemoryMappedFiles; }
+
+		/** Returns true, if the files are parsed from a read only memory mapping.*/
+		bool getUseMemoryMappedFiles() const { return mUseMemoryMappedFiles; }
+
+		/** Sets if libraries that are not required to create the objects selected by setObjectFlags() should 
+		be skipped without being tokenized. The document is scanned for the byte ranges of its top level 
+		elements first. The ranges of the excluded libraries are then not passed to the xml parser at all. 
+		Only has an effect, if the object flags do not select all objects. Files are memory mapped for the 
+		scan. Note that line numbers in error messages refer to the document without the skipped libraries.
+		@param skipExcludedLibraries True, if excluded libraries should be skipped, false otherwise (default).*/
+		void setSkipExcludedLibraries( bool skipExcludedLibraries ) { mSkipExcludedLibraries = skipExcludedLibraries; }
+
+		/** Returns true, if libraries not required by the object flags are skipped.*/
+		bool getSkipExcludedLibraries() const { return mSkipExcludedLibraries; }
+
+		/** Sets if external files should be read ahead in the background. If set, the operating system is 
+		asked to read each referenced local file into the page cache as soon as the reference has been 
+		found, i.e. while the current file is still being parsed. The reading of all pending files then 
+		overlaps with parsing. Only the reading is done ahead: referenced files are not parsed concurrently,
+		parsing and the calls of the writer stay sequential and in the same order. The external reference decider is still called only right before a file would be loaded. Files it 
+		rejects might therefore have been read ahead, but are never parsed.
+		@param readAheadExternalReferences True, if referenced files should be read ahead, false otherwise 
+		(default).*/
+		void setReadAheadExternalReferences( bool readAheadExternalReferences ) { mReadAheadExternalReferences = readAheadExternalReferences; }
+
+		/** Returns true, if referenced files are read ahead in the background.*/
+		bool getReadAheadExternalReferences() const { return mReadAheadExternalReferences; }
+
+		/** Sets if the geometries should be kept by the loader after they have been passed to the writer. 
+		Writers that need the geometries only after the scene graph has been written, can then replay 
+		them with writeRetainedGeometries() instead of loading the document a second time. Note that 
+		all geometries are kept in memory until deleteRetainedGeometries() is called.
+		@param retainGeometries True, if the geometries should be kept, false otherwise (default).*/
+		void setRetainGeometries( bool retainGeometries ) { mRetainGeometries = retainGeometries; }
+
+		/** Returns true, if the geometries are kept after they have been written.*/
+		bool getRetainGeometries() const { return mRetainGeometries; }
+
+		/** Passes all retained geometries to @a writer again, in the order they have been loaded.
+		@return True, if all geometries have been written successfully, false otherwise.*/
+		bool writeRetainedGeometries( COLLADAFW::IWriter* writer ) const;
+
+		/** Deletes all retained geometries.*/
+		void deleteRetainedGeometries();
+
+		/** Sets if the loader should keep all objects it passed to the writer, instead of deleting them 
+		after the write call. Together with the visual scenes, library nodes, lights, cameras, 
+		controllers and animation lists the loader keeps anyway, every object passed to the writer then 
+		stays valid until the loader is destroyed or deleteRetainedObjects() is called. Writers that 
+		need the objects only after the whole document has been loaded, e.g. to resolve references 
+		between them, can then keep the pointers instead of copying the objects. Retained objects are 
+		not handed over to the adopt methods of the writer. Formulas, kinematics scenes and the global 
+		asset are still deleted after they have been written. If geometries are retained as well, see 
+		setRetainGeometries(), they are kept as retained geometries.
+		@param retainObjects True, if the objects should be kept, false otherwise (default).*/
+		void setRetainObjects( bool retainObjects ) { mRetainObjects = retainObjects; }
+
+		/** Returns true, if all objects are kept after they have been written.*/
+		bool getRetainObjects() const { return mRetainObjects; }
+
+		/** Deletes all retained objects, except the retained geometries.*/
+		void deleteRetainedObjects();
+
+		/** Sets the arena all framework objects and arrays are allocated in while a document is loaded, 
+		including the ones the writer creates in its callbacks. Their memory is then freed all at once, 
+		when the arena is released or destroyed. The arena must therefore outlive the loader and every 
+		framework object and array created during the load, also the ones kept by the writer.
+		@param memoryArena The arena to use, or 0 to allocate on the heap (default). The arena is not 
+		owned by the loader.*/
+		void setMemoryArena( COLLADAFW::MemoryArena* memoryArena ) { mMemoryArena = memoryArena; }
+
+		/** Returns the arena the framework objects are allocated in while a document is loaded, or 0.*/
+		COLLADAFW::MemoryArena* getMemoryArena() const { return mMemoryArena; }
+
+		/** Sets a writer that receives the meshes in blocks while they are parsed, instead of the complete 
+		meshes through IWriter::writeGeometry(). The vertex data of each source is passed and released as 
+		soon as it is referenced by a primitive, the indices are passed and released each time the given 
+		number of vertices has been read. Only the current block of indices is kept in memory. Streamed meshes
+		are never retained, see setRetainGeometries(). Other geometries are still passed to the writer.
+		@param meshStreamWriter The writer to stream the meshes to, or 0 to pass them as a whole (default). 
+		The writer is not owned by the loader.
+		@param blockVertexCount The minimal number of mesh vertices in each primitive block, except for the 
+		last block of a primitive.*/
+		void setMeshStreamWriter( COLLADAFW::IMeshStreamWriter* meshStreamWriter, size_t blockVertexCount = 65536 ) 
+		{ mMeshStreamWriter = meshStreamWriter; mMeshStreamBlockVertexCount = blockVertexCount; }
+
+		/** Returns the writer the meshes are streamed to, or 0.*/
+		COLLADAFW::IMeshStreamWriter* getMeshStreamWriter() const { return mMeshStreamWriter; }
+
+		/** Returns the number of mesh vertices after which a primitive block is streamed.*/
+		size_t getMeshStreamBlockVertexCount() const { return mMeshStreamBlockVertexCount; }
+
+		/** Sets if geometries, materials, effects, images, animations and skin controller data should be 
+		passed to the writer on a background thread, while the parser continues with the following 
+		elements. Completed objects are put into a queue of the given size. If the queue is full, the 
+		parser waits. The loader hands the ownership of the queued objects to the pipeline, which deletes 
+		them after they have been written. The objects passed to the writer are therefore valid only during 
+		the call, as without the pipeline.
+		All other writer calls wait until the queue is empty. The writer is therefore never called 
+		concurrently and receives all objects in the same order as without the pipeline. It must, however, 
+		not rely on being called on the thread that called loadDocument() and must not call the loader 
+		from its callbacks. A mesh stream writer is only called, when the queue is empty. If the writer 
+		fails, the objects queued after the failed one are discarded. Parsing stops, when the failure is 
+		noticed, i.e. possibly a few elements later than without the pipeline. The pipeline is not used, if
+		a memory arena is set, see setMemoryArena().
+		@param queueSize The maximal number of objects waiting to be written, or 0 to call the writer 
+		directly on the parse thread (default).*/
+		void setWriterPipelineQueueSize( size_t queueSize ) { mWriterPipelineQueueSize = queueSize; }
+
+		/** Returns the maximal number of objects waiting to be written by the pipeline, or 0 if the 
+		pipeline is not used.*/
+		size_t getWriterPipelineQueueSize() const { return mWriterPipelineQueueSize; }
+
+		/** Sets if documents loaded by loadDocument(const String&, COLLADAFW::IWriter*) should be cached. The 
+		objects passed to the writer are then recorded into a binary cache file next to the document, see 
+		DocumentCache. The next time the document is loaded, the objects are read from the cache and passed 
+		to the writer in the same order, without parsing the document. A cache is only used, if the document, 
+		all loaded external files, the object flags and the decisions of the external reference decider are 
+		unchanged. Otherwise, the document is parsed and the cache is recorded again.
+		Caching is only done by a loader that has not loaded a document before and if neither extra data 
+		callback handlers, nor a mesh stream writer are registered and neither geometries, nor objects are retained. Documents
+		containing formulas, kinematics scenes or splines and documents that produced parser errors are not 
+		cached. Errors the loader reported while the cache has been recorded are not reported again. The 
+		values of arrays passed to the writer point into a read only mapping of the cache and must not be 
+		modified. The loader does not know the unique ids of the elements of a document read from a cache, 
+		documents loaded later by the same loader therefore can not reference them.
+		@param useDocumentCache True, if documents should be cached, false otherwise (default).*/
+		void setUseDocumentCache( bool useDocumentCache ) { mUseDocumentCache = useDocumentCache; }
+
+		/** Returns true, if documents are recorded into and replayed from document caches.*/
+		bool getUseDocumentCache() const { return mUseDocumentCache; }
+
         /** Register an extra data callback handler.
         * @param ExtraDataCallbackHandler* extraDataCallbackHandler The callback handler to register.
         * @return bool True, if the handler could be registered successfull. */
@@ -384,16 +599,35 @@ namespace COLLADASaxFWL
 		this method before, the same file id is returned, if not a new one is created.*/
 		COLLADAFW::FileId getFileId(const COLLADABU::URI& uri);
 
-		/** Add the pair of @a fileId and @a uri to mURIFileIdMap and mFileIdURIMap. It is assumed, neither 
+		/** Add the pair of @a fileId and @a uri to mURIFileIds and mFileIdURIMap. It is assumed, neither 
 		@a fileId nor @a uri have been passed to that method before.*/
 		void addFileIdUriPair( COLLADAFW::FileId fileId, const COLLADABU::URI& uri );
 
+		/** Returns the handle of @a uri in mURIInternTable. If @a uri is new, mURIUniqueIds and mURIFileIds 
+		are extended by an invalid id.*/
+		URIInternTable::Handle internURI( const COLLADABU::URI& uri );
+
+		/** Returns true, if the file with id @a fileId and uri @a fileUri should be loaded. The root file is 
+		always loaded. Other files are passed to the external reference decider, if one is registered.*/
+		bool isFileToBeLoaded( COLLADAFW::FileId fileId, const COLLADABU::URI& fileUri );
+
+		/** Starts reading the file @a fileUri into the page cache, if it is a local file.*/
+		void readAheadFile( const COLLADABU::URI& fileUri );
+
 		/** Returns the GeometryMaterialIdInfo to map symbols to ids*/
 		GeometryMaterialIdInfo& getMeshMaterialIdInfo( );
 
 		/** Returns TextureMapId for @a semantic. Successive call with same semantic return the same TextureMapId.*/
 		COLLADAFW::TextureMapId getTextureMapIdBySematic( const String& semantic );
 
+		/** Takes the ownership of @a geometry, that has already been written, and adds it to the retained
+		geometries.*/
+		void addRetainedGeometry( COLLADAFW::Geometry* geometry ) { mRetainedGeometries.push_back(geometry); }
+
+		/** Takes the ownership of @a object, that has already been written, and adds it to the retained
+		objects.*/
+		void addRetainedObject( COLLADAFW::Object* object ) { mRetainedObjects.push_back(object); }
+
 		/** The root node of the sid tree. This tree is used to resolve sids.*/
 		SidTreeNode * getSidTreeRoot() { return mSidTreeRoot; }
 
@@ -408,7 +642,7 @@ namespace COLLADASaxFWL
 		completely been parsed.*/
 		LibraryNodesList& getLibraryNodes() { return mLibraryNodes; }
 
-		/** List of all effects in the file. They are send to the writer and deleted, when the file has 
+		/** List of all effects in the file. They are handed over to the writer, when the file has 
 		completely been parsed.*/
 		EffectList& getEffects() { return mEffects; }
 
@@ -462,6 +696,38 @@ namespace COLLADASaxFWL
 		/** Returns the writer the data will be written to.*/
 		COLLADAFW::IWriter* writer(){ return mWriter; }
 
+		/** Returns the pipeline of the current load, or 0 if the writer is called directly.*/
+		WriterPipeline* getWriterPipeline() { return mWriterPipeline; }
+
+		/** Puts a writer pipeline between the loader and mWriter, if requested by 
+		setWriterPipelineQueueSize().*/
+		void startWriterPipeline();
+
+		/** Waits for the writer pipeline and deletes it. mWriter is reset to the writer passed to 
+		loadDocument().*/
+		void stopWriterPipeline();
+
+		/** Returns true, if the document that is about to be loaded can be recorded into or replayed from a 
+		document cache, see setUseDocumentCache().*/
+		bool isDocumentCacheUsable() const;
+
+		/** Returns true, if the document cache opened by @a documentCacheReader has been recorded from the 
+		root file @a rootFileUri and the current versions of all files it depends on. The decisions of the 
+		external reference decider made during the check are kept.*/
+		bool isDocumentCacheValid( const DocumentCacheReader& documentCacheReader, const COLLADABU::URI& rootFileUri );
+
+		/** Passes the objects recorded in the document cache opened by @a documentCacheReader to mWriter and 
+		restores the file ids of the recorded load.
+		@return True, if all objects have been written successfully, false otherwise.*/
+		bool loadDocumentCache( DocumentCacheReader& documentCacheReader );
+
+		/** Puts a document cache writer, that records into @a cacheFileName, between the loader and mWriter.*/
+		void startDocumentCacheRecording( const String& cacheFileName );
+
+		/** Deletes the document cache writer. mWriter is reset to the writer passed to loadDocument().
+		@param save True, if the recorded cache should be saved, false if it should be discarded.*/
+		void stopDocumentCacheRecording( bool save );
+
 
         /** Disable default copy ctor. */
 		Loader( const Loader& pre );
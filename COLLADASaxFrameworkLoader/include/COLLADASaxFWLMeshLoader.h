@@ -18,6 +18,7 @@
 #include "COLLADASaxFWLSourceArrayLoader.h"
 
 #include "COLLADAFWMesh.h"
+#include "COLLADAFWIMeshStreamWriter.h"
 
 
 namespace COLLADASaxFWL
@@ -159,6 +160,26 @@ namespace COLLADASaxFWL
         /** Flag for the extra tag preservation, to know if we are parsing in the mesh. */
         bool mInMesh;
 
+		/** The writer the mesh is streamed to in blocks, or 0 if the mesh is written as a whole by the
+		GeometryLoader.*/
+		COLLADAFW::IMeshStreamWriter* mMeshStreamWriter;
+
+		/** The number of mesh vertices after which a primitive block is streamed.*/
+		size_t mMeshStreamBlockVertexCount;
+
+		/** The number of values already streamed, for each IMeshStreamWriter::VertexDataType.*/
+		size_t mStreamedValuesCounts[COLLADAFW::IMeshStreamWriter::UV_COORDINATES + 1];
+
+		/** The vertex count of the current MeshPrimitive, that has already been streamed.*/
+		size_t mStreamedVertexCount;
+
+		/** The face count of the current MeshPrimitive, that has already been streamed.*/
+		size_t mStreamedFaceCount;
+
+		/** The values of the vcount element of the current polylist. Only used while streaming, to find
+		the completed faces while the p element is parsed.*/
+		std::vector<unsigned int> mCurrentPolylistVertexCounts;
+
     public:
 
         /** Constructor. */
@@ -173,6 +194,12 @@ namespace COLLADASaxFWL
         /** Returns the mesh that has just been loaded.*/
 		COLLADAFW::Mesh* getMesh() { return mMesh; }
 
+		/** Returns the mesh that has just been loaded and passes its ownership to the caller.*/
+		COLLADAFW::Mesh* releaseMesh() { COLLADAFW::Mesh* mesh = mMesh; mMesh = 0; return mesh; }
+
+		/** Returns the writer the mesh is streamed to, or 0 if the mesh is loaded as a whole.*/
+		COLLADAFW::IMeshStreamWriter* getMeshStreamWriter() { return mMeshStreamWriter; }
+
 		/** Sax callback function for the beginning of a source element.*/
 		virtual bool begin__source(const source__AttributeData& attributes);
 
@@ -364,6 +391,26 @@ namespace COLLADASaxFWL
 		/** Writes all the indices in data into the indices array of the current mesh primitive.*/
 		bool writePrimitiveIndices ( const unsigned long long* data, size_t length );
 
+		/** Passes the vertex data loaded since the last call to the mesh stream writer and releases it.*/
+		bool streamVertexData();
+
+		/** Passes @a vertexData to the mesh stream writer and releases it.*/
+		bool streamVertexData( COLLADAFW::IMeshStreamWriter::VertexDataType vertexDataType, COLLADAFW::MeshVertexData& vertexData );
+
+		/** Called while streaming, each time a vertex of the current mesh primitive has been completed.
+		Streams a primitive block, if a face has been completed and the block is large enough.*/
+		bool streamCompletedFaces();
+
+		/** Passes the faces of the current mesh primitive that have not been streamed yet to the mesh stream 
+		writer and removes them from the mesh primitive. If @a lastBlock is false, this is only done if the 
+		block contains at least mMeshStreamBlockVertexCount vertices.
+		@param faceCount The number of faces of the current mesh primitive completed so far.*/
+		bool streamPrimitiveBlock( size_t faceCount, bool lastBlock );
+
+		/** Streams the last block of the current mesh primitive and deletes it.
+		@param faceCount The number of faces of the current mesh primitive.*/
+		bool endStreamedPrimitive( size_t faceCount );
+
         /**
          * Get the number of all indices in all p elements in the current primitive element.
          */
@@ -407,7 +454,8 @@ namespace COLLADASaxFWL
         */
         bool appendVertexValues ( 
             SourceBase* sourceBase, 
-            COLLADAFW::MeshVertexData& vertexData );
+            COLLADAFW::MeshVertexData& vertexData,
+            COLLADAFW::IMeshStreamWriter::VertexDataType vertexDataType );
     };
 }
 
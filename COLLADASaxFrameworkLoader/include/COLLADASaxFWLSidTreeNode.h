@@ -15,7 +15,8 @@
 #include "COLLADAFWAnimatable.h"
 #include "COLLADAFWObject.h"
 
-#include <map>
+#include "COLLADABUhash_map.h"
+
 #include <vector>
 
 namespace COLLADASaxFWL
@@ -25,30 +26,21 @@ namespace COLLADASaxFWL
 
     /** The SidTreeNode is used to build the Sid tree. The Sid tree  represents the parent child relation between elements
 	that can have sids. This tree is used to resolve sids.
+	Instead of storing all descendants in every node, all nodes of a tree share one index, that maps each sid to the 
+	nodes with this sid, in the order they have been created. Since the nodes are numbered in the order they are created
+	and children are always created in document order, i.e. depth first, the descendants of a node are exactly the nodes 
+	with numbers between the number of the node and the number of its last descendant.
 	TODO the sid node tree currently does not support multiple occurrences of an sid on the same hierarchy in different 
 	techniques.
 	*/
 	class SidTreeNode 	
 	{
 	public:
-		struct SidIdentifier
-		{
-			SidIdentifier( const String& _sid, size_t _hierarchyLevel)
-				: sid(_sid), hierarchyLevel(_hierarchyLevel){}
-
-			const String& sid;
-
-			/** Defines how deep in the hierarchy the node is placed. For the determination of the hierarchy level
-			only elements with an sid are considered.*/
-			size_t hierarchyLevel;
-
-			bool operator<(const SidIdentifier& rhs)const;
-		};
-
-		typedef std::map< SidIdentifier, SidTreeNode*> SidIdentifierSidTreeNodeMap;
-
 		typedef std::vector< SidTreeNode*> SidTreeNodeList;
 
+		/** Maps sids to all nodes with this sid, sorted by node number.*/
+		typedef COLLADABU::hash_map< String, SidTreeNodeList> SidSidTreeNodeListMap;
+
 		enum TargetTypeClass
 		{
 			TARGETTYPECLASS_UNKNOWN,
@@ -58,6 +50,18 @@ namespace COLLADASaxFWL
 		};
 
 	private:
+		/** The index shared by all nodes of one tree.*/
+		struct SidIndex
+		{
+			SidIndex() : nextNodeNumber(0) {}
+
+			/** All nodes with an sid, by sid.*/
+			SidSidTreeNodeListMap sidTreeNodes;
+
+			/** The number of the next node to create.*/
+			size_t nextNodeNumber;
+		};
+
 		union Target
 		{
 			COLLADAFW::Animatable * animatable;
@@ -69,9 +73,15 @@ namespace COLLADASaxFWL
 		/** The parent node.*/
 		SidTreeNode *mParent;
 
-		/** Maps sids to the children. One sid can appear more than once, since COLLADA allows sids to appear more than once
-		in different technique elements of the same parent.*/
-		SidIdentifierSidTreeNodeMap mChildren;
+		/** The sid index shared by all nodes of the tree. Owned by the root node.*/
+		SidIndex* mSidIndex;
+
+		/** The number of the node. Nodes are numbered in the order they are created, starting with zero at the root.*/
+		size_t mNodeNumber;
+
+		/** The number of nodes with an sid on the path from the root to this node, including this node. The hierarchy 
+		level of a descendant relative to this node is derived from it.*/
+		size_t mSidDepth;
 
 		/** List of all direct children. Is used to delete all of them.*/
 		SidTreeNodeList mDirectChildren;
@@ -95,6 +105,9 @@ namespace COLLADASaxFWL
 		/** Returns the parent.*/
 		SidTreeNode * getParent() { return mParent; }
 
+		/** Returns the number of the node. Nodes are numbered in the order they are created.*/
+		size_t getNodeNumber() const { return mNodeNumber; }
+
 		/** Returns the type of the target.*/
 		TargetTypeClass getTargetType() const { return mTargetType; }
 
@@ -119,14 +132,17 @@ namespace COLLADASaxFWL
 		/** Sets the target to @a target and the target type to @a TARGETTYPECLASS_ANIMATABLE.*/
 		void setTarget(IntermediateTargetable* target) { mTarget.intermediateTargetable= target; mTargetType = TARGETTYPECLASS_INTERMEDIATETARGETABLE; }
 
-		/** Creates a new child with sid @a sid and adds it to the list of children. */
+		/** Creates a new child with sid @a sid and adds it to the list of children. Children must be created in 
+		document order, i.e. no node may get a new child after a child of one of its later siblings has been created. */
 		SidTreeNode* createAndAddChild( const String& sid);
 
 		/** Returns the sid.*/
 		const String& getSid() const { return mSid; };
 
 		/** Searches for a child with @a sid in the entire sub hierarchy. If there exist more then one child with @a sid, 
-		the one with the lowest hierarchy level is returned. If no child could be found, null is returned.*/
+		the one with the lowest hierarchy level is returned. The hierarchy level of a child is the number of elements 
+		with an sid from this node, inclusive, to the parent of the child, exclusive. If there are more than one on the 
+		lowest level, the one created first is returned. If no child could be found, null is returned.*/
 		SidTreeNode* findChildBySid( const String& sid);
 
 
@@ -138,8 +154,12 @@ namespace COLLADASaxFWL
         /** Disable default assignment operator. */
 		const SidTreeNode& operator= ( const SidTreeNode& pre );
 
-		/** Adds @a sidTreeNode to the children map of all the parent nodes. For each level in the hierarchy */
-		void addChildToParents( SidTreeNode *sidTreeNode, const SidIdentifier& sidIdentifier);
+		/** Returns the number of the last node in the sub hierarchy of this node, or the number of this node if it 
+		has no children.*/
+		size_t getLastDescendantNumber() const;
+
+		/** Returns the number of nodes with an sid on the path from the root to this node, excluding this node.*/
+		size_t getSidDepthAbove() const { return mSid.empty() ? mSidDepth : mSidDepth - 1; }
 
 	};
 
@@ -17,6 +17,8 @@
 #include "COLLADASaxFWLXmlTypes.h"
 #include "COLLADAFWFloatOrDoubleArray.h"
 
+#include "COLLADABUhash_map.h"
+
 
 namespace COLLADASaxFWL
 {
@@ -32,6 +34,10 @@ namespace COLLADASaxFWL
 	public:
 		static const COLLADAFW::FloatOrDoubleArray::DataType DATA_TYPE_REAL;
 
+	private:
+		/** Maps the id of a source to the source.*/
+		typedef COLLADABU::hash_map<String, SourceBase*> SourceIdSourceMap;
+
 	protected:
 	
         /**
@@ -48,6 +54,11 @@ namespace COLLADASaxFWL
 		/** The id of the array being parsed.*/
 		String mCurrentArrayId;
 
+	private:
+		/** Index of all sources in mSourceArray by their ids, used by getSourceById. If several sources have
+		the same id, the first one is indexed.*/
+		SourceIdSourceMap mSourceIdSourceMap;
+
 	public:
 		/** Takes a null terminated string, that represents an uriFragment of URIFragmentType defined in the 
 		COLLADA XSD and returns the id it points to.*/
@@ -111,6 +122,9 @@ namespace COLLADASaxFWL
 		when a closing \<source\> tag is detected.*/
 		bool endSource();
 
+		/** Appends @a source to mSourceArray and adds it to the id index.*/
+		void appendSource( SourceBase* source );
+
 		/** Handles the beginning of a array element. Should be called when ever an array is opened.
 		@tparam SourceType Type of source to create a new instance from for the opened array, e.g. FloatSource for <float_array>
 		@param count The Value of the count attribute of the aray
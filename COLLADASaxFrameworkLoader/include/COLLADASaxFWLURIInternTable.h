@@ -0,0 +1,85 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License, 
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_URIINTERNTABLE_H__
+#define __COLLADASAXFWL_URIINTERNTABLE_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+
+#include "COLLADABUURI.h"
+#include "COLLADABUhash_map.h"
+
+#include <vector>
+
+
+namespace COLLADASaxFWL
+{
+
+    /** Assigns a small integer handle to each distinct uri. Handles are assigned consecutively, starting 
+	with zero, and can therefore be used as indices into arrays that store data per uri. Two uris get the 
+	same handle, if their uri strings are equal. Only the uri string is stored.*/
+	class URIInternTable 	
+	{
+	public:
+		/** Handle of an interned uri.*/
+		typedef size_t Handle;
+
+		/** Handle returned for uris that have not been interned.*/
+		static const Handle INVALID_HANDLE = (size_t)-1;
+
+	private:
+		/** Maps each interned uri string to its handle.*/
+		typedef COLLADABU::hash_map<String, Handle> UriStringHandleMap;
+
+		/** The interned uri strings, indexed by handle. Point into the keys of mUriStringHandleMap.*/
+		typedef std::vector<const String*> UriStringList;
+
+	private:
+		UriStringHandleMap mUriStringHandleMap;
+
+		UriStringList mUriStrings;
+
+	public:
+
+        /** Constructor. */
+		URIInternTable();
+
+        /** Destructor. */
+		virtual ~URIInternTable();
+
+		/** Returns the handle of @a uri. If @a uri has not been interned before, a new handle is assigned.
+		@param added Set to true, if a new handle has been assigned, false otherwise.*/
+		Handle intern( const COLLADABU::URI& uri, bool& added );
+
+		/** Returns the handle of @a uri, or INVALID_HANDLE, if @a uri has not been interned.*/
+		Handle find( const COLLADABU::URI& uri ) const;
+
+		/** Returns the uri string of the uri with handle @a handle.*/
+		const String& getUriString( Handle handle ) const { return *mUriStrings[handle]; }
+
+		/** Returns the number of interned uris, i.e. the next handle to be assigned.*/
+		size_t getSize() const { return mUriStrings.size(); }
+
+		/** Removes all uris.*/
+		void clear();
+
+	private:
+
+        /** Disable default copy ctor. */
+		URIInternTable( const URIInternTable& pre );
+
+        /** Disable default assignment operator. */
+		const URIInternTable& operator= ( const URIInternTable& pre );
+
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_URIINTERNTABLE_H__
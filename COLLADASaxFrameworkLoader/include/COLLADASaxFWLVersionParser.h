@@ -80,6 +80,11 @@ namespace COLLADASaxFWL
         bool createAndLaunchParser(const char* buffer, int length);
 
     protected:
+        /** Parses the document in @a buffer, skipping all top level libraries that are not required to 
+        create the objects selected by the flags. The libraries are located by a scan, without tokenizing 
+        their content.*/
+        bool parseWithoutExcludedLibraries( GeneratedSaxParser::SaxParser& saxParser, const char* uri, const char* buffer, size_t length );
+
         void createFunctionMap14();
         void createFunctionMap15();
         bool parse14( const ParserChar* elementName, const ParserAttributes& attributes );
@@ -0,0 +1,172 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_WRITERPIPELINE_H__
+#define __COLLADASAXFWL_WRITERPIPELINE_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+
+#include "COLLADAFWIWriter.h"
+
+#include <deque>
+
+
+namespace COLLADAFW
+{
+	class Object;
+}
+
+
+namespace COLLADASaxFWL
+{
+
+    /** Writer that passes framework objects to another writer on a background thread, while the loader
+	continues parsing. Objects passed to writeObject() are put into a queue of limited size. The background
+	thread takes them out of the queue and passes them to the target writer. Objects owned by the pipeline
+	are handed over to the target writer, see COLLADAFW::IWriter::adoptGeometry().
+	All other methods wait until the queue is empty and then call the target writer directly. The target
+	writer is therefore never called concurrently and receives all objects in the same order, as if they
+	had been passed to it directly.*/
+	class WriterPipeline : public COLLADAFW::IWriter
+	{
+	private:
+		/** An object waiting to be written by the background thread.*/
+		struct Job
+		{
+			/** The object to write.*/
+			COLLADAFW::Object* object;
+
+			/** True, if the background thread owns @a object and deletes it after it has been written.*/
+			bool deleteAfterWrite;
+		};
+
+		typedef std::deque<Job> JobQueue;
+
+		/** The thread and synchronization primitives of the operating system.*/
+		struct ThreadData;
+
+	private:
+		/** The writer the objects are passed to.*/
+		COLLADAFW::IWriter* mWriter;
+
+		/** The maximal number of objects waiting in mJobs.*/
+		size_t mQueueSize;
+
+		/** The objects waiting to be written, in the order they have been passed to writeObject().*/
+		JobQueue mJobs;
+
+		/** True, while the background thread writes an object taken from mJobs.*/
+		bool mWriting;
+
+		/** True, if writing one of the queued objects failed and the failure has not been reported by
+		writeObject() or flush() yet. The objects queued afterwards are discarded.*/
+		bool mFailed;
+
+		/** True, if the background thread should exit.*/
+		bool mStop;
+
+		/** The background thread, or 0 if it could not be started. mJobs, mWriting, mFailed and mStop are
+		only accessed with its mutex locked.*/
+		ThreadData* mThreadData;
+
+	public:
+
+        /** Constructor. Starts the background thread.
+		@param writer The writer the objects are passed to. Not owned by the pipeline.
+		@param queueSize The maximal number of objects waiting to be written. writeObject() blocks, while
+		the queue is full.*/
+		WriterPipeline( COLLADAFW::IWriter* writer, size_t queueSize );
+
+        /** Destructor. Waits until all queued objects have been written and stops the background thread.*/
+		virtual ~WriterPipeline();
+
+		/** Returns true, if the background thread is running. If not, the pipeline must not be used.*/
+		bool isRunning() const { return mThreadData != 0; }
+
+		/** Returns the writer the objects are passed to.*/
+		COLLADAFW::IWriter* getWriter() const { return mWriter; }
+
+		/** Queues @a object to be passed to the target writer by the background thread. Blocks, while the queue
+		is full. The object must not be modified by the caller after this call and, if @a deleteAfterWrite is
+		false, must stay valid until finish() or cancel() have been called.
+		@param object The object to write. Supported are geometries, materials, effects, images, animations
+		and skin controller data.
+		@param deleteAfterWrite True, if the pipeline takes the ownership of @a object and hands it over to
+		the target writer or deletes it, if it is discarded.
+		@return False, if writing one of the previously queued objects failed, true otherwise. In case of a
+		failure, @a object and all objects queued after the failed one are discarded. This corresponds to a
+		writer that is called directly, after which the parser stops at the failed object. Each failure is
+		reported only once.*/
+		bool writeObject( COLLADAFW::Object* object, bool deleteAfterWrite );
+
+		/** Waits until all queued objects have been written.
+		@return False, if writing one of the queued objects failed, true otherwise. Each failure is reported
+		only once.*/
+		bool flush();
+
+		/** Passes @a object to the corresponding write method of @a writer.
+		@return The return value of the write method, or false if the type of @a object is not supported
+		by writeObject().*/
+		static bool write( COLLADAFW::IWriter* writer, const COLLADAFW::Object* object );
+
+		/** Passes @a object to the corresponding adopt method of @a writer, which takes the ownership of 
+		@a object.
+		@return The return value of the adopt method, or false if the type of @a object is not supported
+		by writeObject(). In this case @a object is deleted.*/
+		static bool adopt( COLLADAFW::IWriter* writer, COLLADAFW::Object* object );
+
+		/** Discards all queued objects and passes the call to the target writer.*/
+		virtual void cancel( const String& errorMessage );
+
+		/** Flushes the queue and passes the call to the target writer.*/
+		virtual void start();
+
+		/** Flushes the queue and passes the call to the target writer.*/
+		virtual void finish();
+
+		/** The following methods flush the queue and pass the call to the target writer.
+		@return False, if writing a queued object or the passed object failed.*/
+		virtual bool writeGlobalAsset( const COLLADAFW::FileInfo* asset );
+		virtual bool writeScene( const COLLADAFW::Scene* scene );
+		virtual bool writeVisualScene( const COLLADAFW::VisualScene* visualScene );
+		virtual bool writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes );
+		virtual bool writeGeometry( const COLLADAFW::Geometry* geometry );
+		virtual bool writeMaterial( const COLLADAFW::Material* material );
+		virtual bool writeEffect( const COLLADAFW::Effect* effect );
+		virtual bool writeCamera( const COLLADAFW::Camera* camera );
+		virtual bool writeImage( const COLLADAFW::Image* image );
+		virtual bool writeLight( const COLLADAFW::Light* light );
+		virtual bool writeAnimation( const COLLADAFW::Animation* animation );
+		virtual bool writeAnimationList( const COLLADAFW::AnimationList* animationList );
+		virtual bool writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData );
+		virtual bool writeController( const COLLADAFW::Controller* controller );
+		virtual bool writeFormulas( const COLLADAFW::Formulas* formulas );
+		virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene );
+
+	private:
+
+		/** Entry point of the background thread. Writes the queued objects until mStop is set.*/
+		void run();
+
+		/** Deletes the objects of all queued jobs that are owned by the pipeline and clears the queue. The mutex
+		must be locked.*/
+		void discardJobs();
+
+		/** Disable default copy ctor. */
+		WriterPipeline( const WriterPipeline& pre );
+
+		/** Disable default assignment operator. */
+		const WriterPipeline& operator= ( const WriterPipeline& pre );
+
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_WRITERPIPELINE_H__
@@ -0,0 +1,23 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef ___PERFORMANCETEST_H__
+#define ___PERFORMANCETEST_H__
+
+/** Generates one synthetic COLLADA document per library type, loads each of them with COLLADASaxFWL::Loader
+into a writer that ignores all objects and prints the throughput in MB/s and elements/s and the peak resident
+set size of each load. Also measures the creation of many colliding ids with COLLADABU::IDList.
+@param scale Factor applied to the number of objects generated in each document.
+@param outputDirectory If not null, the generated documents are also written to this directory.
+@return True, if all documents have been loaded successfully.*/
+bool performanceTest( double scale, const char* outputDirectory );
+
+
+#endif // ___PERFORMANCETEST_H__
@@ -0,0 +1,23 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef ___ADDRESSUNITTEST_H__
+#define ___ADDRESSUNITTEST_H__
+
+#include <stddef.h>
+
+/** Splits a corpus of hand-picked and random strings with COLLADABU::URI and COLLADASaxFWL::SidAddress and
+with the regular expressions they used before, and prints the strings with different results.
+@param randomStringCount The number of random strings added to the hand-picked ones.
+@return True, if all results matched.*/
+bool addressUnitTest( size_t randomStringCount );
+
+
+#endif // ___ADDRESSUNITTEST_H__
@@ -0,0 +1,22 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef ___DOCUMENTCACHEUNITTEST_H__
+#define ___DOCUMENTCACHEUNITTEST_H__
+
+
+/** Writes a document containing all object types a document cache can record into the working directory and
+loads it directly, while recording its cache and from its cache. Prints the first call of the writer that
+differs from the direct load. The files written are removed again.
+@return True, if the writer got the same calls with the same objects in all loads.*/
+bool documentCacheUnitTest();
+
+
+#endif // ___DOCUMENTCACHEUNITTEST_H__
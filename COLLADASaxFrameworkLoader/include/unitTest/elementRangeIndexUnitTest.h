@@ -0,0 +1,22 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef ___ELEMENTRANGEINDEXUNITTEST_H__
+#define ___ELEMENTRANGEINDEXUNITTEST_H__
+
+
+/** Scans documents whose top level elements contain nested elements of the same name, their own end tag
+in comments, CDATA sections, processing instructions and attribute values, and documents that are cut off,
+with GeneratedSaxParser::ElementRangeIndex. Prints the documents whose ranges are not the expected ones.
+@return True, if all ranges were the expected ones.*/
+bool elementRangeIndexUnitTest();
+
+
+#endif // ___ELEMENTRANGEINDEXUNITTEST_H__
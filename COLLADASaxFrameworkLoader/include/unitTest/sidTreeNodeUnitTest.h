@@ -0,0 +1,22 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef ___SIDTREENODEUNITTEST_H__
+#define ___SIDTREENODEUNITTEST_H__
+
+
+/** Builds random sid trees with COLLADASaxFWL::SidTreeNode and with the sid tree node as it was before the
+sid index was shared by all nodes of a tree, looks up each sid below each node in both and prints the number
+of lookups with different results.
+@return True, if all lookups found the same node.*/
+bool sidTreeNodeUnitTest();
+
+
+#endif // ___SIDTREENODEUNITTEST_H__
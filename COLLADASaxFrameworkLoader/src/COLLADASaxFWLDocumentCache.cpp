@@ -0,0 +1,76 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLDocumentCache.h"
+
+#include "GeneratedSaxParserMemoryMappedFile.h"
+
+#include <string.h>
+
+
+namespace COLLADASaxFWL
+{
+
+	const char DocumentCache::MAGIC[8] = { 'C', 'O', 'L', 'F', 'W', 'D', 'C', 0 };
+
+	const uint32 DocumentCache::VERSION = 1;
+
+	const uint32 DocumentCache::BYTE_ORDER_MARK = 0x01020304;
+
+	// magic, version, byte order mark, object flags, COLLADA version, file table offset, cache size
+	const size_t DocumentCache::HEADER_SIZE = 8 + 4 * 4 + 2 * 8;
+
+	const size_t DocumentCache::ARRAY_ALIGNMENT = 8;
+
+	const String DocumentCache::FILE_EXTENSION = ".fwcache";
+
+	static const uint64 HASH_OFFSET_BASIS = 14695981039346656037ULL;
+
+	static const uint64 HASH_PRIME = 1099511628211ULL;
+
+	//------------------------------
+	uint64 DocumentCache::calculateHash( const char* data, size_t size )
+	{
+		uint64 hash = HASH_OFFSET_BASIS ^ (uint64)size;
+
+		size_t i = 0;
+		for ( ; i + sizeof(uint64) <= size; i += sizeof(uint64) )
+		{
+			uint64 word;
+			memcpy( &word, data + i, sizeof(uint64) );
+			hash = (hash ^ word) * HASH_PRIME;
+			// the multiplication only carries upwards, fold the high bits back
+			hash ^= hash >> 32;
+		}
+
+		for ( ; i < size; ++i )
+		{
+			hash = (hash ^ (unsigned char)data[i]) * HASH_PRIME;
+		}
+
+		return hash;
+	}
+
+	//------------------------------
+	bool DocumentCache::calculateFileHash( const COLLADABU::URI& fileUri, uint64& size, uint64& hash )
+	{
+		String nativePath = fileUri.toNativePath();
+		GeneratedSaxParser::MemoryMappedFile file;
+		if ( !file.open( nativePath.c_str() ) )
+			return false;
+
+		file.adviseSequential();
+		size = file.getSize();
+		hash = calculateHash( file.getData(), file.getSize() );
+		return true;
+	}
+
+} // namespace COLLADASAXFWL
@@ -0,0 +1,1011 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLDocumentCacheReader.h"
+
+#include "COLLADAFWIWriter.h"
+#include "COLLADAFWFileInfo.h"
+#include "COLLADAFWScene.h"
+#include "COLLADAFWInstanceVisualScene.h"
+#include "COLLADAFWVisualScene.h"
+#include "COLLADAFWLibraryNodes.h"
+#include "COLLADAFWNode.h"
+#include "COLLADAFWMatrix.h"
+#include "COLLADAFWTranslate.h"
+#include "COLLADAFWRotate.h"
+#include "COLLADAFWScale.h"
+#include "COLLADAFWLookat.h"
+#include "COLLADAFWSkew.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWLines.h"
+#include "COLLADAFWTriangles.h"
+#include "COLLADAFWPolygons.h"
+#include "COLLADAFWTristrips.h"
+#include "COLLADAFWTrifans.h"
+#include "COLLADAFWLinestrips.h"
+#include "COLLADAFWMaterial.h"
+#include "COLLADAFWEffect.h"
+#include "COLLADAFWEffectCommon.h"
+#include "COLLADAFWSampler.h"
+#include "COLLADAFWCamera.h"
+#include "COLLADAFWLight.h"
+#include "COLLADAFWImage.h"
+#include "COLLADAFWAnimationCurve.h"
+#include "COLLADAFWAnimationList.h"
+#include "COLLADAFWSkinControllerData.h"
+#include "COLLADAFWSkinController.h"
+#include "COLLADAFWMorphController.h"
+#include "COLLADAFWFormulas.h"
+#include "COLLADAFWKinematicsScene.h"
+
+#include "Math/COLLADABUMathMatrix4.h"
+
+#include <string.h>
+
+
+namespace COLLADASaxFWL
+{
+
+    //------------------------------
+	DocumentCacheReader::DocumentCacheReader()
+		: mPosition(0)
+		, mEnd(0)
+		, mValid(false)
+		, mObjectFlags(0)
+		, mCOLLADAVersion(COLLADA_UNKNOWN)
+	{
+	}
+
+    //------------------------------
+	DocumentCacheReader::~DocumentCacheReader()
+	{
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::open( const String& cacheFileName )
+	{
+		mFile.close();
+		mFiles.clear();
+
+		if ( !mFile.open( cacheFileName.c_str() ) )
+			return false;
+
+		mPosition = 0;
+		mEnd = mFile.getSize();
+		mValid = true;
+
+		const char* magic = readData( sizeof(DocumentCache::MAGIC) );
+		if ( !magic || (memcmp( magic, DocumentCache::MAGIC, sizeof(DocumentCache::MAGIC) ) != 0) )
+			return false;
+		if ( readUInt32() != DocumentCache::VERSION )
+			return false;
+		if ( readUInt32() != DocumentCache::BYTE_ORDER_MARK )
+			return false;
+		mObjectFlags = (int)readUInt32();
+		mCOLLADAVersion = (COLLADAVersion)readUInt32();
+		uint64 fileTableOffset = readUInt64();
+		uint64 cacheSize = readUInt64();
+
+		// a cache that has been truncated or is still being written
+		if ( !mValid || (cacheSize != mFile.getSize()) || (fileTableOffset < DocumentCache::HEADER_SIZE) || (fileTableOffset > cacheSize) )
+			return false;
+
+		mPosition = (size_t)fileTableOffset;
+		size_t fileCount = readCount();
+		for ( size_t i = 0; (i < fileCount) && mValid; ++i )
+		{
+			DocumentCache::CachedFile file;
+			file.fileId = (COLLADAFW::FileId)readUInt64();
+			file.uri = readUri();
+			file.loaded = readBool();
+			file.size = readUInt64();
+			file.hash = readUInt64();
+			mFiles.push_back( file );
+		}
+
+		if ( !mValid || mFiles.empty() )
+			return false;
+
+		mPosition = DocumentCache::HEADER_SIZE;
+		mEnd = (size_t)fileTableOffset;
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replay( COLLADAFW::IWriter* writer )
+	{
+		mPosition = DocumentCache::HEADER_SIZE;
+		while ( mValid )
+		{
+			DocumentCache::RecordType recordType = (DocumentCache::RecordType)readUInt32();
+			if ( !mValid )
+				break;
+			if ( recordType == DocumentCache::RECORD_END )
+				return true;
+			if ( !replayRecord( writer, recordType ) )
+				return false;
+		}
+		return false;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayRecord( COLLADAFW::IWriter* writer, DocumentCache::RecordType recordType )
+	{
+		switch ( recordType )
+		{
+		case DocumentCache::RECORD_GLOBAL_ASSET:
+			return replayGlobalAsset( writer );
+		case DocumentCache::RECORD_SCENE:
+			return replayScene( writer );
+		case DocumentCache::RECORD_VISUAL_SCENE:
+			return replayVisualScene( writer );
+		case DocumentCache::RECORD_LIBRARY_NODES:
+			return replayLibraryNodes( writer );
+		case DocumentCache::RECORD_GEOMETRY:
+			return replayGeometry( writer );
+		case DocumentCache::RECORD_MATERIAL:
+			return replayMaterial( writer );
+		case DocumentCache::RECORD_EFFECT:
+			return replayEffect( writer );
+		case DocumentCache::RECORD_CAMERA:
+			return replayCamera( writer );
+		case DocumentCache::RECORD_IMAGE:
+			return replayImage( writer );
+		case DocumentCache::RECORD_LIGHT:
+			return replayLight( writer );
+		case DocumentCache::RECORD_ANIMATION:
+			return replayAnimation( writer );
+		case DocumentCache::RECORD_ANIMATION_LIST:
+			return replayAnimationList( writer );
+		case DocumentCache::RECORD_SKIN_CONTROLLER_DATA:
+			return replaySkinControllerData( writer );
+		case DocumentCache::RECORD_CONTROLLER:
+			return replayController( writer );
+		case DocumentCache::RECORD_FORMULAS:
+			return replayFormulas( writer );
+		case DocumentCache::RECORD_KINEMATICS_SCENE:
+			return replayKinematicsScene( writer );
+		default:
+			mValid = false;
+			return false;
+		}
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayGlobalAsset( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::FileInfo* asset = FW_NEW COLLADAFW::FileInfo();
+
+		size_t valuePairCount = readCount();
+		for ( size_t i = 0; (i < valuePairCount) && mValid; ++i )
+		{
+			String first = readString();
+			String second = readString();
+			asset->appendValuePair( first, second );
+		}
+
+		COLLADAFW::FileInfo::Unit& unit = asset->getUnit();
+		unit.setLinearUnitName( readString() );
+		unit.setLinearUnitMeter( readDouble() );
+		unit.setLinearUnitUnit( (COLLADAFW::FileInfo::Unit::LinearUnit)readUInt32() );
+		unit.setAngularUnitName( readString() );
+		unit.setAngularUnit( (COLLADAFW::FileInfo::Unit::AngularUnit)readUInt32() );
+		unit.setTimeUnitName( readString() );
+
+		asset->setUpAxisType( (COLLADAFW::FileInfo::UpAxisType)readUInt32() );
+		asset->setAbsoluteFileUri( readUri() );
+
+		bool success = mValid && writer->writeGlobalAsset( asset );
+		FW_DELETE asset;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayScene( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::Scene* scene = FW_NEW COLLADAFW::Scene( readUniqueId() );
+		if ( readBool() )
+			scene->setInstanceVisualScene( readInstance<COLLADAFW::InstanceVisualScene>() );
+
+		bool success = mValid && writer->writeScene( scene );
+		FW_DELETE scene;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayVisualScene( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::VisualScene* visualScene = FW_NEW COLLADAFW::VisualScene( readUniqueId() );
+		visualScene->setName( readString() );
+		readNodes( visualScene->getRootNodes() );
+
+		bool success = mValid && writer->writeVisualScene( visualScene );
+		FW_DELETE visualScene;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayLibraryNodes( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::LibraryNodes* libraryNodes = FW_NEW COLLADAFW::LibraryNodes();
+		readNodes( libraryNodes->getNodes() );
+
+		bool success = mValid && writer->writeLibraryNodes( libraryNodes );
+		FW_DELETE libraryNodes;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayGeometry( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::Mesh* mesh = FW_NEW COLLADAFW::Mesh( readUniqueId() );
+		mesh->setOriginalId( readString() );
+		mesh->setName( readString() );
+		mesh->setType( (COLLADAFW::Geometry::GeometryType)readUInt32() );
+		readMeshVertexData( mesh->getPositions() );
+		readMeshVertexData( mesh->getNormals() );
+		readMeshVertexData( mesh->getColors() );
+		readMeshVertexData( mesh->getUVCoords() );
+
+		size_t meshPrimitiveCount = readCount();
+		for ( size_t i = 0; (i < meshPrimitiveCount) && mValid; ++i )
+		{
+			COLLADAFW::MeshPrimitive* meshPrimitive = readMeshPrimitive();
+			if ( meshPrimitive )
+				mesh->getMeshPrimitives().append( meshPrimitive );
+		}
+
+		bool success = mValid && writer->writeGeometry( mesh );
+		FW_DELETE mesh;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayMaterial( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::Material* material = FW_NEW COLLADAFW::Material( readUniqueId() );
+		material->setOriginalId( readString() );
+		material->setName( readString() );
+		material->setInstantiatedEffect( readUniqueId() );
+
+		bool success = mValid && writer->writeMaterial( material );
+		FW_DELETE material;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayEffect( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::Effect* effect = FW_NEW COLLADAFW::Effect( readUniqueId() );
+		effect->setOriginalId( readString() );
+		effect->setName( readString() );
+		COLLADAFW::Color standardColor;
+		readColor( standardColor );
+		effect->setStandardColor( standardColor );
+
+		size_t commonEffectCount = readCount();
+		for ( size_t i = 0; (i < commonEffectCount) && mValid; ++i )
+			effect->getCommonEffects().append( readEffectCommon() );
+
+		bool success = mValid && writer->writeEffect( effect );
+		FW_DELETE effect;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayCamera( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::Camera* camera = FW_NEW COLLADAFW::Camera( readUniqueId() );
+		camera->setOriginalId( readString() );
+		camera->setName( readString() );
+		camera->setCameraType( (COLLADAFW::Camera::CameraType)readUInt32() );
+		camera->setDescriptionType( (COLLADAFW::Camera::DescriptionType)readUInt32() );
+		readAnimatableFloat( camera->getXFov() );
+		readAnimatableFloat( camera->getYFov() );
+		readAnimatableFloat( camera->getAspectRatio() );
+		readAnimatableFloat( camera->getNearClippingPlane() );
+		readAnimatableFloat( camera->getFarClippingPlane() );
+
+		bool success = mValid && writer->writeCamera( camera );
+		FW_DELETE camera;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayImage( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::Image* image = FW_NEW COLLADAFW::Image( readUniqueId() );
+		image->setOriginalId( readString() );
+		image->setSourceType( (COLLADAFW::Image::SourceType)readUInt32() );
+		image->setName( readString() );
+		image->setFormat( readString() );
+		image->setHeight( readUInt32() );
+		image->setWidth( readUInt32() );
+		image->setDepth( readUInt32() );
+		image->setImageURI( readUri() );
+
+		bool success = mValid && writer->writeImage( image );
+		FW_DELETE image;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayLight( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::Light* light = FW_NEW COLLADAFW::Light( readUniqueId() );
+		light->setOriginalId( readString() );
+		light->setName( readString() );
+		light->setLightType( (COLLADAFW::Light::LightType)readUInt32() );
+		readColor( light->getColor() );
+		readAnimatableFloat( light->getConstantAttenuation() );
+		readAnimatableFloat( light->getLinearAttenuation() );
+		readAnimatableFloat( light->getQuadraticAttenuation() );
+		readAnimatableFloat( light->getFallOffAngle() );
+		readAnimatableFloat( light->getFallOffExponent() );
+
+		bool success = mValid && writer->writeLight( light );
+		FW_DELETE light;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayAnimation( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::AnimationCurve* animationCurve = FW_NEW COLLADAFW::AnimationCurve( readUniqueId() );
+		animationCurve->setOriginalId( readString() );
+		animationCurve->setName( readString() );
+		animationCurve->setInPhysicalDimension( (COLLADAFW::PhysicalDimension)readUInt32() );
+		readArray( animationCurve->getOutPhysicalDimensions() );
+		animationCurve->setOutDimension( readSize() );
+		animationCurve->setInterpolationType( (COLLADAFW::AnimationCurve::InterpolationType)readUInt32() );
+		readFloatOrDoubleArray( animationCurve->getInputValues() );
+		readFloatOrDoubleArray( animationCurve->getOutputValues() );
+		readArray( animationCurve->getInterpolationTypes() );
+		readFloatOrDoubleArray( animationCurve->getInTangentValues() );
+		readFloatOrDoubleArray( animationCurve->getOutTangentValues() );
+
+		bool success = mValid && writer->writeAnimation( animationCurve );
+		FW_DELETE animationCurve;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayAnimationList( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::AnimationList* animationList = FW_NEW COLLADAFW::AnimationList( readUniqueId() );
+
+		size_t animationBindingCount = readCount();
+		if ( mValid && (animationBindingCount > 0) )
+		{
+			COLLADAFW::AnimationList::AnimationBindings& animationBindings = animationList->getAnimationBindings();
+			animationBindings.allocMemory( animationBindingCount );
+			animationBindings.setCount( animationBindingCount );
+			for ( size_t i = 0; i < animationBindingCount; ++i )
+			{
+				COLLADAFW::AnimationList::AnimationBinding& animationBinding = animationBindings[i];
+				animationBinding.animation = readUniqueId();
+				animationBinding.animationClass = (COLLADAFW::AnimationList::AnimationClass)readUInt32();
+				animationBinding.firstIndex = readSize();
+				animationBinding.secondIndex = readSize();
+			}
+		}
+
+		bool success = mValid && writer->writeAnimationList( animationList );
+		FW_DELETE animationList;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replaySkinControllerData( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::SkinControllerData* skinControllerData = FW_NEW COLLADAFW::SkinControllerData( readUniqueId() );
+		skinControllerData->setOriginalId( readString() );
+		skinControllerData->setName( readString() );
+		skinControllerData->setJointsCount( readSize() );
+		skinControllerData->setBindShapeMatrix( readMatrix() );
+
+		size_t inverseBindMatrixCount = readCount();
+		if ( mValid && (inverseBindMatrixCount > 0) )
+		{
+			COLLADAFW::Matrix4Array& inverseBindMatrices = skinControllerData->getInverseBindMatrices();
+			inverseBindMatrices.allocMemory( inverseBindMatrixCount );
+			inverseBindMatrices.setCount( inverseBindMatrixCount );
+			for ( size_t i = 0; i < inverseBindMatrixCount; ++i )
+				inverseBindMatrices[i] = readMatrix();
+		}
+
+		readFloatOrDoubleArray( skinControllerData->getWeights() );
+		readArray( skinControllerData->getJointsPerVertex() );
+		readArray( skinControllerData->getWeightIndices() );
+		readArray( skinControllerData->getJointIndices() );
+
+		bool success = mValid && writer->writeSkinControllerData( skinControllerData );
+		FW_DELETE skinControllerData;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayController( COLLADAFW::IWriter* writer )
+	{
+		COLLADAFW::Controller::ControllerType controllerType = (COLLADAFW::Controller::ControllerType)readUInt32();
+		COLLADAFW::UniqueId uniqueId = readUniqueId();
+		COLLADAFW::UniqueId source = readUniqueId();
+
+		COLLADAFW::Controller* controller = 0;
+		switch ( controllerType )
+		{
+		case COLLADAFW::Controller::CONTROLLER_TYPE_SKIN:
+			{
+				COLLADAFW::SkinController* skinController = FW_NEW COLLADAFW::SkinController( uniqueId );
+				skinController->setSkinControllerData( readUniqueId() );
+				size_t jointCount = readCount();
+				if ( mValid && (jointCount > 0) )
+				{
+					COLLADAFW::UniqueIdArray& joints = skinController->getJoints();
+					joints.allocMemory( jointCount );
+					joints.setCount( jointCount );
+					for ( size_t i = 0; i < jointCount; ++i )
+						joints[i] = readUniqueId();
+				}
+				controller = skinController;
+				break;
+			}
+		case COLLADAFW::Controller::CONTROLLER_TYPE_MORPH:
+			{
+				COLLADAFW::MorphController* morphController = FW_NEW COLLADAFW::MorphController( uniqueId );
+				morphController->setOriginalId( readString() );
+				morphController->setName( readString() );
+				size_t morphTargetCount = readCount();
+				if ( mValid && (morphTargetCount > 0) )
+				{
+					COLLADAFW::UniqueIdArray& morphTargets = morphController->getMorphTargets();
+					morphTargets.allocMemory( morphTargetCount );
+					morphTargets.setCount( morphTargetCount );
+					for ( size_t i = 0; i < morphTargetCount; ++i )
+						morphTargets[i] = readUniqueId();
+				}
+				readFloatOrDoubleArray( morphController->getMorphWeights() );
+				controller = morphController;
+				break;
+			}
+		default:
+			mValid = false;
+			return false;
+		}
+		controller->setSource( source );
+
+		bool success = mValid && writer->writeController( controller );
+		FW_DELETE controller;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayFormulas( COLLADAFW::IWriter* writer )
+	{
+		// only empty formulas are recorded
+		COLLADAFW::Formulas* formulas = FW_NEW COLLADAFW::Formulas();
+		bool success = writer->writeFormulas( formulas );
+		FW_DELETE formulas;
+		return success;
+	}
+
+	//------------------------------
+	bool DocumentCacheReader::replayKinematicsScene( COLLADAFW::IWriter* writer )
+	{
+		// only empty kinematics scenes are recorded
+		COLLADAFW::KinematicsScene* kinematicsScene = FW_NEW COLLADAFW::KinematicsScene();
+		bool success = writer->writeKinematicsScene( kinematicsScene );
+		FW_DELETE kinematicsScene;
+		return success;
+	}
+
+	//------------------------------
+	const char* DocumentCacheReader::readData( size_t size )
+	{
+		if ( !mValid || (size > mEnd - mPosition) )
+		{
+			mValid = false;
+			return 0;
+		}
+
+		const char* data = mFile.getData() + mPosition;
+		mPosition += size;
+		return data;
+	}
+
+	//------------------------------
+	void DocumentCacheReader::readAlignment()
+	{
+		size_t remainder = mPosition % DocumentCache::ARRAY_ALIGNMENT;
+		if ( remainder != 0 )
+			readData( DocumentCache::ARRAY_ALIGNMENT - remainder );
+	}
+
+	//------------------------------
+	uint32 DocumentCacheReader::readUInt32()
+	{
+		uint32 value = 0;
+		const char* data = readData( sizeof(value) );
+		if ( data )
+			memcpy( &value, data, sizeof(value) );
+		return value;
+	}
+
+	//------------------------------
+	uint64 DocumentCacheReader::readUInt64()
+	{
+		uint64 value = 0;
+		const char* data = readData( sizeof(value) );
+		if ( data )
+			memcpy( &value, data, sizeof(value) );
+		return value;
+	}
+
+	//------------------------------
+	size_t DocumentCacheReader::readSize()
+	{
+		uint64 value = readUInt64();
+		if ( value != (uint64)(size_t)value )
+		{
+			mValid = false;
+			return 0;
+		}
+		return (size_t)value;
+	}
+
+	//------------------------------
+	size_t DocumentCacheReader::readCount()
+	{
+		size_t count = readSize();
+		// every element occupies at least one byte
+		if ( mValid && (count > mEnd - mPosition) )
+			mValid = false;
+		return mValid ? count : 0;
+	}
+
+	//------------------------------
+	float DocumentCacheReader::readFloat()
+	{
+		float value = 0;
+		const char* data = readData( sizeof(value) );
+		if ( data )
+			memcpy( &value, data, sizeof(value) );
+		return value;
+	}
+
+	//------------------------------
+	double DocumentCacheReader::readDouble()
+	{
+		double value = 0;
+		const char* data = readData( sizeof(value) );
+		if ( data )
+			memcpy( &value, data, sizeof(value) );
+		return value;
+	}
+
+	//------------------------------
+	String DocumentCacheReader::readString()
+	{
+		size_t length = readCount();
+		const char* data = readData( length );
+		return data ? String( data, length ) : String();
+	}
+
+	//------------------------------
+	COLLADABU::URI DocumentCacheReader::readUri()
+	{
+		String uriString = readString();
+		return uriString.empty() ? COLLADABU::URI() : COLLADABU::URI( uriString );
+	}
+
+	//------------------------------
+	COLLADAFW::UniqueId DocumentCacheReader::readUniqueId()
+	{
+		COLLADAFW::ClassId classId = (COLLADAFW::ClassId)readUInt32();
+		COLLADAFW::ObjectId objectId = readUInt64();
+		COLLADAFW::FileId fileId = (COLLADAFW::FileId)readUInt64();
+		return COLLADAFW::UniqueId( classId, objectId, fileId );
+	}
+
+	//------------------------------
+	COLLADABU::Math::Matrix4 DocumentCacheReader::readMatrix()
+	{
+		COLLADABU::Math::Matrix4 matrix;
+		for ( int i = 0; i < 16; ++i )
+			matrix.setElement( i, readDouble() );
+		return matrix;
+	}
+
+	//------------------------------
+	COLLADABU::Math::Vector3 DocumentCacheReader::readVector()
+	{
+		double x = readDouble();
+		double y = readDouble();
+		double z = readDouble();
+		return COLLADABU::Math::Vector3( x, y, z );
+	}
+
+	//------------------------------
+	template<class Type>
+	void DocumentCacheReader::readArray( COLLADAFW::ArrayPrimitiveType<Type>& array )
+	{
+		size_t count = readCount();
+		readAlignment();
+		if ( count > (mEnd - mPosition) / sizeof(Type) )
+			mValid = false;
+		const char* data = readData( count * sizeof(Type) );
+		readAlignment();
+		if ( !data )
+			return;
+
+		// the values are aligned in the file and the mapping starts at a page boundary
+		array.setData( (Type*)const_cast<char*>(data), count );
+		array.yieldOwnerShip();
+	}
+
+	//------------------------------
+	void DocumentCacheReader::readColor( COLLADAFW::Color& color )
+	{
+		double red = readDouble();
+		double green = readDouble();
+		double blue = readDouble();
+		double alpha = readDouble();
+		color.set( red, green, blue, alpha, readString() );
+		color.setAnimationList( readUniqueId() );
+	}
+
+	//------------------------------
+	void DocumentCacheReader::readColorOrTexture( COLLADAFW::ColorOrTexture& colorOrTexture )
+	{
+		colorOrTexture.setType( (COLLADAFW::ColorOrTexture::Type)readUInt32() );
+		readColor( colorOrTexture.getColor() );
+		COLLADAFW::Texture& texture = colorOrTexture.getTexture();
+		texture.setUniqueId( readUniqueId() );
+		texture.setSamplerId( (COLLADAFW::SamplerID)readUInt64() );
+		texture.setTextureMapId( (COLLADAFW::TextureMapId)readUInt64() );
+	}
+
+	//------------------------------
+	void DocumentCacheReader::readFloatOrParam( COLLADAFW::FloatOrParam& floatOrParam )
+	{
+		floatOrParam.setType( (COLLADAFW::FloatOrParam::Type)readUInt32() );
+		floatOrParam.setFloatValue( readFloat() );
+		COLLADAFW::Param param;
+		param.setName( readString() );
+		param.setSid( readString() );
+		param.setType( (COLLADAFW::ValueType::ColladaType)readUInt32() );
+		param.setSemantic( readString() );
+		floatOrParam.setParam( param );
+		floatOrParam.setAnimationList( readUniqueId() );
+	}
+
+	//------------------------------
+	void DocumentCacheReader::readAnimatableFloat( COLLADAFW::AnimatableFloat& animatableFloat )
+	{
+		animatableFloat.setValue( readDouble() );
+		animatableFloat.setAnimationList( readUniqueId() );
+	}
+
+	//------------------------------
+	void DocumentCacheReader::readFloatOrDoubleArray( COLLADAFW::FloatOrDoubleArray& array )
+	{
+		array.setType( (COLLADAFW::FloatOrDoubleArray::DataType)readUInt32() );
+		array.setAnimationList( readUniqueId() );
+		switch ( array.getType() )
+		{
+		case COLLADAFW::FloatOrDoubleArray::DATA_TYPE_FLOAT:
+			readArray( *array.getFloatValues() );
+			break;
+		case COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE:
+			readArray( *array.getDoubleValues() );
+			break;
+		case COLLADAFW::FloatOrDoubleArray::DATA_TYPE_UNKNOWN:
+			break;
+		default:
+			mValid = false;
+			break;
+		}
+	}
+
+	//------------------------------
+	void DocumentCacheReader::readMeshVertexData( COLLADAFW::MeshVertexData& vertexData )
+	{
+		readFloatOrDoubleArray( vertexData );
+		size_t inputInfosCount = readCount();
+		for ( size_t i = 0; (i < inputInfosCount) && mValid; ++i )
+		{
+			String name = readString();
+			size_t stride = readSize();
+			size_t length = readSize();
+			vertexData.appendInputInfos( name, stride, length );
+		}
+	}
+
+	//------------------------------
+	COLLADAFW::IndexList* DocumentCacheReader::readIndexList()
+	{
+		COLLADAFW::IndexList* indexList = FW_NEW COLLADAFW::IndexList();
+		indexList->setName( readString() );
+		readArray( indexList->getIndices() );
+		indexList->setStride( readSize() );
+		indexList->setSetIndex( readSize() );
+		indexList->setInitialIndex( readSize() );
+		return indexList;
+	}
+
+	//------------------------------
+	COLLADAFW::MeshPrimitive* DocumentCacheReader::readMeshPrimitive()
+	{
+		COLLADAFW::MeshPrimitive::PrimitiveType primitiveType = (COLLADAFW::MeshPrimitive::PrimitiveType)readUInt32();
+		COLLADAFW::UniqueId uniqueId = readUniqueId();
+
+		COLLADAFW::MeshPrimitive* meshPrimitive = 0;
+		switch ( primitiveType )
+		{
+		case COLLADAFW::MeshPrimitive::LINES:
+			meshPrimitive = FW_NEW COLLADAFW::Lines( uniqueId );
+			break;
+		case COLLADAFW::MeshPrimitive::TRIANGLES:
+			meshPrimitive = FW_NEW COLLADAFW::Triangles( uniqueId );
+			break;
+		case COLLADAFW::MeshPrimitive::POLYGONS:
+		case COLLADAFW::MeshPrimitive::POLYLIST:
+			meshPrimitive = FW_NEW COLLADAFW::Polygons( uniqueId );
+			meshPrimitive->setPrimitiveType( primitiveType );
+			break;
+		case COLLADAFW::MeshPrimitive::TRIANGLE_STRIPS:
+			meshPrimitive = FW_NEW COLLADAFW::Tristrips( uniqueId );
+			break;
+		case COLLADAFW::MeshPrimitive::TRIANGLE_FANS:
+			meshPrimitive = FW_NEW COLLADAFW::Trifans( uniqueId );
+			break;
+		case COLLADAFW::MeshPrimitive::LINE_STRIPS:
+			meshPrimitive = FW_NEW COLLADAFW::Linestrips( uniqueId );
+			break;
+		default:
+			mValid = false;
+			return 0;
+		}
+
+		meshPrimitive->setFaceCount( readSize() );
+		meshPrimitive->setMaterial( readString() );
+		meshPrimitive->setMaterialId( (COLLADAFW::MaterialId)readUInt64() );
+		readArray( meshPrimitive->getPositionIndices() );
+		readArray( meshPrimitive->getNormalIndices() );
+
+		size_t colorIndicesCount = readCount();
+		for ( size_t i = 0; (i < colorIndicesCount) && mValid; ++i )
+			meshPrimitive->getColorIndicesArray().append( readIndexList() );
+
+		size_t uvCoordIndicesCount = readCount();
+		for ( size_t i = 0; (i < uvCoordIndicesCount) && mValid; ++i )
+			meshPrimitive->getUVCoordIndicesArray().append( readIndexList() );
+
+		switch ( primitiveType )
+		{
+		case COLLADAFW::MeshPrimitive::POLYGONS:
+		case COLLADAFW::MeshPrimitive::POLYLIST:
+			readArray( ((COLLADAFW::Polygons*)meshPrimitive)->getGroupedVerticesVertexCountArray() );
+			break;
+		case COLLADAFW::MeshPrimitive::TRIANGLE_STRIPS:
+			{
+				COLLADAFW::Tristrips* tristrips = (COLLADAFW::Tristrips*)meshPrimitive;
+				readArray( tristrips->getGroupedVerticesVertexCountArray() );
+				tristrips->setTristripCount( readSize() );
+				break;
+			}
+		case COLLADAFW::MeshPrimitive::TRIANGLE_FANS:
+			{
+				COLLADAFW::Trifans* trifans = (COLLADAFW::Trifans*)meshPrimitive;
+				readArray( trifans->getGroupedVerticesVertexCountArray() );
+				trifans->setTrifanCount( readSize() );
+				break;
+			}
+		case COLLADAFW::MeshPrimitive::LINE_STRIPS:
+			{
+				COLLADAFW::Linestrips* linestrips = (COLLADAFW::Linestrips*)meshPrimitive;
+				readArray( linestrips->getGroupedVerticesVertexCountArray() );
+				linestrips->setLinestripCount( readSize() );
+				break;
+			}
+		default:
+			break;
+		}
+		return meshPrimitive;
+	}
+
+	//------------------------------
+	void DocumentCacheReader::readMaterialBinding( COLLADAFW::MaterialBinding& materialBinding )
+	{
+		materialBinding.setMaterialId( (COLLADAFW::MaterialId)readUInt64() );
+		materialBinding.setReferencedMaterial( readUniqueId() );
+		materialBinding.setName( readString() );
+
+		size_t textureCoordinateBindingCount = readCount();
+		if ( !mValid || (textureCoordinateBindingCount == 0) )
+			return;
+
+		COLLADAFW::TextureCoordinateBindingArray& textureCoordinateBindings = materialBinding.getTextureCoordinateBindingArray();
+		textureCoordinateBindings.allocMemory( textureCoordinateBindingCount );
+		textureCoordinateBindings.setCount( textureCoordinateBindingCount );
+		for ( size_t i = 0; i < textureCoordinateBindingCount; ++i )
+		{
+			COLLADAFW::TextureCoordinateBinding& textureCoordinateBinding = textureCoordinateBindings[i];
+			textureCoordinateBinding.setTextureMapId( (COLLADAFW::TextureMapId)readUInt64() );
+			textureCoordinateBinding.setSetIndex( readSize() );
+			textureCoordinateBinding.setSemantic( readString() );
+		}
+	}
+
+	//------------------------------
+	COLLADAFW::Transformation* DocumentCacheReader::readTransformation()
+	{
+		COLLADAFW::Transformation::TransformationType transformationType = (COLLADAFW::Transformation::TransformationType)readUInt32();
+		COLLADAFW::UniqueId animationList = readUniqueId();
+
+		COLLADAFW::Transformation* transformation = 0;
+		switch ( transformationType )
+		{
+		case COLLADAFW::Transformation::MATRIX:
+			transformation = FW_NEW COLLADAFW::Matrix( readMatrix() );
+			break;
+		case COLLADAFW::Transformation::TRANSLATE:
+			transformation = FW_NEW COLLADAFW::Translate( readVector() );
+			break;
+		case COLLADAFW::Transformation::ROTATE:
+			{
+				COLLADABU::Math::Vector3 rotationAxis = readVector();
+				transformation = FW_NEW COLLADAFW::Rotate( rotationAxis, readDouble() );
+				break;
+			}
+		case COLLADAFW::Transformation::SCALE:
+			transformation = FW_NEW COLLADAFW::Scale( readVector() );
+			break;
+		case COLLADAFW::Transformation::LOOKAT:
+			{
+				COLLADAFW::Lookat* lookat = FW_NEW COLLADAFW::Lookat();
+				lookat->getEyePosition() = readVector();
+				lookat->getInterestPointPosition() = readVector();
+				lookat->getUpAxisDirection() = readVector();
+				transformation = lookat;
+				break;
+			}
+		case COLLADAFW::Transformation::SKEW:
+			{
+				COLLADAFW::Skew* skew = FW_NEW COLLADAFW::Skew();
+				skew->setRotateAxis( readVector() );
+				skew->setTranslateAxis( readVector() );
+				skew->setAngle( readFloat() );
+				transformation = skew;
+				break;
+			}
+		default:
+			mValid = false;
+			return 0;
+		}
+		transformation->setAnimationList( animationList );
+		return transformation;
+	}
+
+	//------------------------------
+	template<class InstanceType>
+	InstanceType* DocumentCacheReader::readInstance()
+	{
+		COLLADAFW::UniqueId uniqueId = readUniqueId();
+		COLLADAFW::UniqueId instanciatedObjectId = readUniqueId();
+		InstanceType* instance = FW_NEW InstanceType( uniqueId, instanciatedObjectId );
+		instance->setName( readString() );
+		return instance;
+	}
+
+	//------------------------------
+	template<class InstanceType>
+	void DocumentCacheReader::readInstances( COLLADAFW::PointerArray<InstanceType>& instances )
+	{
+		size_t instanceCount = readCount();
+		for ( size_t i = 0; (i < instanceCount) && mValid; ++i )
+			instances.append( readInstance<InstanceType>() );
+	}
+
+	//------------------------------
+	template<class InstanceType>
+	void DocumentCacheReader::readBindingInstances( COLLADAFW::PointerArray<InstanceType>& instances )
+	{
+		size_t instanceCount = readCount();
+		for ( size_t i = 0; (i < instanceCount) && mValid; ++i )
+		{
+			InstanceType* instance = readInstance<InstanceType>();
+			instances.append( instance );
+
+			size_t materialBindingCount = readCount();
+			if ( !mValid || (materialBindingCount == 0) )
+				continue;
+
+			COLLADAFW::MaterialBindingArray& materialBindings = instance->getMaterialBindings();
+			materialBindings.allocMemory( materialBindingCount );
+			materialBindings.setCount( materialBindingCount );
+			for ( size_t j = 0; j < materialBindingCount; ++j )
+				readMaterialBinding( materialBindings[j] );
+		}
+	}
+
+	//------------------------------
+	void DocumentCacheReader::readNodes( COLLADAFW::NodePointerArray& nodes )
+	{
+		size_t nodeCount = readCount();
+		for ( size_t i = 0; (i < nodeCount) && mValid; ++i )
+		{
+			COLLADAFW::Node* node = FW_NEW COLLADAFW::Node( readUniqueId() );
+			nodes.append( node );
+			node->setOriginalId( readString() );
+			node->setName( readString() );
+			node->setType( (COLLADAFW::Node::NodeType)readUInt32() );
+
+			size_t transformationCount = readCount();
+			for ( size_t j = 0; (j < transformationCount) && mValid; ++j )
+			{
+				COLLADAFW::Transformation* transformation = readTransformation();
+				if ( transformation )
+					node->getTransformations().append( transformation );
+			}
+
+			readBindingInstances( node->getInstanceGeometries() );
+			readInstances( node->getInstanceNodes() );
+			readInstances( node->getInstanceCameras() );
+			readInstances( node->getInstanceLights() );
+			readBindingInstances( node->getInstanceControllers() );
+			readNodes( node->getChildNodes() );
+		}
+	}
+
+	//------------------------------
+	COLLADAFW::Sampler* DocumentCacheReader::readSampler()
+	{
+		COLLADAFW::Sampler* sampler = FW_NEW COLLADAFW::Sampler( readUniqueId() );
+		sampler->setSamplerType( (COLLADAFW::Sampler::SamplerType)readUInt32() );
+		sampler->setSource( readUniqueId() );
+		sampler->setMinFilter( (COLLADAFW::Sampler::SamplerFilter)readUInt32() );
+		sampler->setMagFilter( (COLLADAFW::Sampler::SamplerFilter)readUInt32() );
+		sampler->setMipFilter( (COLLADAFW::Sampler::SamplerFilter)readUInt32() );
+		sampler->setWrapS( (COLLADAFW::Sampler::WrapMode)readUInt32() );
+		sampler->setWrapT( (COLLADAFW::Sampler::WrapMode)readUInt32() );
+		sampler->setWrapP( (COLLADAFW::Sampler::WrapMode)readUInt32() );
+		COLLADAFW::Color borderColor;
+		readColor( borderColor );
+		sampler->setBorderColor( borderColor );
+		sampler->setMipmapMaxlevel( (unsigned char)readUInt32() );
+		sampler->setMipmapBias( readFloat() );
+		return sampler;
+	}
+
+	//------------------------------
+	COLLADAFW::EffectCommon* DocumentCacheReader::readEffectCommon()
+	{
+		COLLADAFW::EffectCommon* effectCommon = FW_NEW COLLADAFW::EffectCommon();
+		effectCommon->setOriginalId( readString() );
+		effectCommon->setShaderType( (COLLADAFW::EffectCommon::ShaderType)readUInt32() );
+		readColorOrTexture( effectCommon->getEmission() );
+		readColorOrTexture( effectCommon->getAmbient() );
+		readColorOrTexture( effectCommon->getDiffuse() );
+		readColorOrTexture( effectCommon->getSpecular() );
+		readFloatOrParam( effectCommon->getShininess() );
+		readColorOrTexture( effectCommon->getReflective() );
+		readFloatOrParam( effectCommon->getReflectivity() );
+		readColorOrTexture( effectCommon->getOpacity() );
+		readFloatOrParam( effectCommon->getIndexOfRefraction() );
+
+		size_t samplerCount = readCount();
+		for ( size_t i = 0; (i < samplerCount) && mValid; ++i )
+			effectCommon->getSamplerPointerArray().append( readSampler() );
+		return effectCommon;
+	}
+
+} // namespace COLLADASAXFWL
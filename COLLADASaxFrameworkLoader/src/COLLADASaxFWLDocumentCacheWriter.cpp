@@ -0,0 +1,941 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLDocumentCacheWriter.h"
+
+#include "COLLADAFWFileInfo.h"
+#include "COLLADAFWScene.h"
+#include "COLLADAFWInstanceVisualScene.h"
+#include "COLLADAFWVisualScene.h"
+#include "COLLADAFWLibraryNodes.h"
+#include "COLLADAFWNode.h"
+#include "COLLADAFWMatrix.h"
+#include "COLLADAFWTranslate.h"
+#include "COLLADAFWRotate.h"
+#include "COLLADAFWScale.h"
+#include "COLLADAFWLookat.h"
+#include "COLLADAFWSkew.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWPolygons.h"
+#include "COLLADAFWTristrips.h"
+#include "COLLADAFWTrifans.h"
+#include "COLLADAFWLinestrips.h"
+#include "COLLADAFWMaterial.h"
+#include "COLLADAFWEffect.h"
+#include "COLLADAFWEffectCommon.h"
+#include "COLLADAFWSampler.h"
+#include "COLLADAFWCamera.h"
+#include "COLLADAFWLight.h"
+#include "COLLADAFWImage.h"
+#include "COLLADAFWAnimationCurve.h"
+#include "COLLADAFWAnimationList.h"
+#include "COLLADAFWSkinControllerData.h"
+#include "COLLADAFWSkinController.h"
+#include "COLLADAFWMorphController.h"
+#include "COLLADAFWFormulas.h"
+#include "COLLADAFWKinematicsScene.h"
+
+#include "Math/COLLADABUMathMatrix4.h"
+
+
+namespace COLLADASaxFWL
+{
+
+	/** The size of the buffer of the temporary file.*/
+	static const size_t FILE_BUFFER_SIZE = 1024 * 1024;
+
+	/** Written by the alignment.*/
+	static const char ZERO_BYTES[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    //------------------------------
+	DocumentCacheWriter::DocumentCacheWriter( COLLADAFW::IWriter* writer, const String& cacheFileName )
+		: mWriter(writer)
+		, mCacheFileName(cacheFileName)
+		, mTemporaryFileName(cacheFileName + ".tmp")
+		, mFile(0)
+		, mOffset(0)
+		, mComplete(false)
+	{
+		mFile = fopen( mTemporaryFileName.c_str(), "wb" );
+		if ( !mFile )
+			return;
+
+		setvbuf( mFile, 0, _IOFBF, FILE_BUFFER_SIZE );
+		mComplete = true;
+		// the final offsets are not known yet, they are written by save()
+		writeHeader( 0, COLLADA_UNKNOWN, 0, 0 );
+	}
+
+    //------------------------------
+	DocumentCacheWriter::~DocumentCacheWriter()
+	{
+		if ( mFile )
+		{
+			fclose( mFile );
+			remove( mTemporaryFileName.c_str() );
+		}
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::addFile( COLLADAFW::FileId fileId, const COLLADABU::URI& fileUri, bool loaded )
+	{
+		DocumentCache::CachedFile file;
+		file.fileId = fileId;
+		file.uri = fileUri;
+		file.loaded = loaded;
+		file.size = 0;
+		file.hash = 0;
+		// a file that can not be hashed can not be validated
+		if ( loaded && !DocumentCache::calculateFileHash(fileUri, file.size, file.hash) )
+			mComplete = false;
+		mFiles.push_back( file );
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::save( int objectFlags, COLLADAVersion cOLLADAVersion )
+	{
+		if ( !mComplete )
+			return false;
+
+		writeUInt32( DocumentCache::RECORD_END );
+		writeAlignment();
+
+		uint64 fileTableOffset = mOffset;
+		writeUInt64( mFiles.size() );
+		for ( DocumentCache::CachedFileList::const_iterator it = mFiles.begin(); it != mFiles.end(); ++it )
+		{
+			writeUInt64( it->fileId );
+			writeUri( it->uri );
+			writeBool( it->loaded );
+			writeUInt64( it->size );
+			writeUInt64( it->hash );
+		}
+		uint64 cacheSize = mOffset;
+
+		if ( fseek( mFile, 0, SEEK_SET ) != 0 )
+			mComplete = false;
+		else
+			writeHeader( objectFlags, cOLLADAVersion, fileTableOffset, cacheSize );
+
+		bool success = mComplete && !ferror( mFile );
+		success = ( fclose( mFile ) == 0 ) && success;
+		mFile = 0;
+		mComplete = false;
+
+		if ( success )
+		{
+			remove( mCacheFileName.c_str() );
+			success = rename( mTemporaryFileName.c_str(), mCacheFileName.c_str() ) == 0;
+		}
+		if ( !success )
+			remove( mTemporaryFileName.c_str() );
+		return success;
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeHeader( int objectFlags, COLLADAVersion cOLLADAVersion, uint64 fileTableOffset, uint64 cacheSize )
+	{
+		writeData( DocumentCache::MAGIC, sizeof(DocumentCache::MAGIC) );
+		writeUInt32( DocumentCache::VERSION );
+		writeUInt32( DocumentCache::BYTE_ORDER_MARK );
+		writeUInt32( (uint32)objectFlags );
+		writeUInt32( (uint32)cOLLADAVersion );
+		writeUInt64( fileTableOffset );
+		writeUInt64( cacheSize );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeData( const void* data, size_t size )
+	{
+		if ( !mComplete )
+			return;
+
+		if ( (size != 0) && (fwrite( data, 1, size, mFile ) != size) )
+			mComplete = false;
+		mOffset += size;
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeAlignment()
+	{
+		size_t remainder = (size_t)(mOffset % DocumentCache::ARRAY_ALIGNMENT);
+		if ( remainder != 0 )
+			writeData( ZERO_BYTES, DocumentCache::ARRAY_ALIGNMENT - remainder );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeString( const String& value )
+	{
+		writeUInt64( value.length() );
+		writeData( value.c_str(), value.length() );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeUri( const COLLADABU::URI& uri )
+	{
+		writeString( uri.getURIString() );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeUniqueId( const COLLADAFW::UniqueId& uniqueId )
+	{
+		writeUInt32( (uint32)uniqueId.getClassId() );
+		writeUInt64( uniqueId.getObjectId() );
+		writeUInt64( uniqueId.getFileId() );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeMatrix( const COLLADABU::Math::Matrix4& matrix )
+	{
+		for ( int i = 0; i < 16; ++i )
+			writeDouble( matrix.getElement(i) );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeVector( const COLLADABU::Math::Vector3& vector )
+	{
+		writeDouble( vector.x );
+		writeDouble( vector.y );
+		writeDouble( vector.z );
+	}
+
+	//------------------------------
+	template<class Type>
+	void DocumentCacheWriter::writeArray( const COLLADAFW::ArrayPrimitiveType<Type>& array )
+	{
+		writeUInt64( array.getCount() );
+		writeAlignment();
+		writeData( array.getData(), array.getCount() * sizeof(Type) );
+		writeAlignment();
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeColor( const COLLADAFW::Color& color )
+	{
+		writeDouble( color.getRed() );
+		writeDouble( color.getGreen() );
+		writeDouble( color.getBlue() );
+		writeDouble( color.getAlpha() );
+		writeString( color.getSid() );
+		writeUniqueId( color.getAnimationList() );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeColorOrTexture( const COLLADAFW::ColorOrTexture& colorOrTexture )
+	{
+		writeUInt32( colorOrTexture.getType() );
+		writeColor( colorOrTexture.getColor() );
+		const COLLADAFW::Texture& texture = colorOrTexture.getTexture();
+		writeUniqueId( texture.getUniqueId() );
+		writeUInt64( texture.getSamplerId() );
+		writeUInt64( texture.getTextureMapId() );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeFloatOrParam( const COLLADAFW::FloatOrParam& floatOrParam )
+	{
+		writeUInt32( floatOrParam.getType() );
+		writeFloat( floatOrParam.getFloatValue() );
+		const COLLADAFW::Param& param = floatOrParam.getParam();
+		writeString( param.getName() );
+		writeString( param.getSid() );
+		writeUInt32( param.getType() );
+		writeString( param.getSemantic() );
+		writeUniqueId( floatOrParam.getAnimationList() );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeAnimatableFloat( const COLLADAFW::AnimatableFloat& animatableFloat )
+	{
+		writeDouble( animatableFloat.getValue() );
+		writeUniqueId( animatableFloat.getAnimationList() );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeFloatOrDoubleArray( const COLLADAFW::FloatOrDoubleArray& array )
+	{
+		writeUInt32( array.getType() );
+		writeUniqueId( array.getAnimationList() );
+		switch ( array.getType() )
+		{
+		case COLLADAFW::FloatOrDoubleArray::DATA_TYPE_FLOAT:
+			writeArray( *array.getFloatValues() );
+			break;
+		case COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE:
+			writeArray( *array.getDoubleValues() );
+			break;
+		default:
+			break;
+		}
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeMeshVertexData( const COLLADAFW::MeshVertexData& vertexData )
+	{
+		writeFloatOrDoubleArray( vertexData );
+		const COLLADAFW::MeshVertexData::InputInfosArray& inputInfos = vertexData.getInputInfosArray();
+		writeUInt64( inputInfos.getCount() );
+		for ( size_t i = 0; i < inputInfos.getCount(); ++i )
+		{
+			writeString( inputInfos[i]->mName );
+			writeUInt64( inputInfos[i]->mStride );
+			writeUInt64( inputInfos[i]->mLength );
+		}
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeIndexList( const COLLADAFW::IndexList& indexList )
+	{
+		writeString( indexList.getName() );
+		writeArray( indexList.getIndices() );
+		writeUInt64( indexList.getStride() );
+		writeUInt64( indexList.getSetIndex() );
+		writeUInt64( indexList.getInitialIndex() );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeMeshPrimitive( const COLLADAFW::MeshPrimitive& meshPrimitive )
+	{
+		COLLADAFW::MeshPrimitive::PrimitiveType primitiveType = meshPrimitive.getPrimitiveType();
+		writeUInt32( primitiveType );
+		writeUniqueId( meshPrimitive.getUniqueId() );
+		writeUInt64( meshPrimitive.getFaceCount() );
+		writeString( meshPrimitive.getMaterial() );
+		writeUInt64( meshPrimitive.getMaterialId() );
+		writeArray( meshPrimitive.getPositionIndices() );
+		writeArray( meshPrimitive.getNormalIndices() );
+
+		const COLLADAFW::IndexListArray& colorIndices = meshPrimitive.getColorIndicesArray();
+		writeUInt64( colorIndices.getCount() );
+		for ( size_t i = 0; i < colorIndices.getCount(); ++i )
+			writeIndexList( *colorIndices[i] );
+
+		const COLLADAFW::IndexListArray& uvCoordIndices = meshPrimitive.getUVCoordIndicesArray();
+		writeUInt64( uvCoordIndices.getCount() );
+		for ( size_t i = 0; i < uvCoordIndices.getCount(); ++i )
+			writeIndexList( *uvCoordIndices[i] );
+
+		switch ( primitiveType )
+		{
+		case COLLADAFW::MeshPrimitive::LINES:
+		case COLLADAFW::MeshPrimitive::TRIANGLES:
+			break;
+		case COLLADAFW::MeshPrimitive::POLYGONS:
+		case COLLADAFW::MeshPrimitive::POLYLIST:
+			writeArray( ((const COLLADAFW::Polygons&)meshPrimitive).getGroupedVerticesVertexCountArray() );
+			break;
+		case COLLADAFW::MeshPrimitive::TRIANGLE_STRIPS:
+			{
+				const COLLADAFW::Tristrips& tristrips = (const COLLADAFW::Tristrips&)meshPrimitive;
+				writeArray( tristrips.getGroupedVerticesVertexCountArray() );
+				writeUInt64( tristrips.getTristripCount() );
+				break;
+			}
+		case COLLADAFW::MeshPrimitive::TRIANGLE_FANS:
+			{
+				const COLLADAFW::Trifans& trifans = (const COLLADAFW::Trifans&)meshPrimitive;
+				writeArray( trifans.getGroupedVerticesVertexCountArray() );
+				writeUInt64( trifans.getTrifanCount() );
+				break;
+			}
+		case COLLADAFW::MeshPrimitive::LINE_STRIPS:
+			{
+				const COLLADAFW::Linestrips& linestrips = (const COLLADAFW::Linestrips&)meshPrimitive;
+				writeArray( linestrips.getGroupedVerticesVertexCountArray() );
+				writeUInt64( linestrips.getLinestripCount() );
+				break;
+			}
+		default:
+			// points and undefined primitives are not created by the loader
+			mComplete = false;
+			break;
+		}
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeMaterialBinding( const COLLADAFW::MaterialBinding& materialBinding )
+	{
+		writeUInt64( materialBinding.getMaterialId() );
+		writeUniqueId( materialBinding.getReferencedMaterial() );
+		writeString( materialBinding.getName() );
+
+		const COLLADAFW::TextureCoordinateBindingArray& textureCoordinateBindings = materialBinding.getTextureCoordinateBindingArray();
+		writeUInt64( textureCoordinateBindings.getCount() );
+		for ( size_t i = 0; i < textureCoordinateBindings.getCount(); ++i )
+		{
+			const COLLADAFW::TextureCoordinateBinding& textureCoordinateBinding = textureCoordinateBindings[i];
+			writeUInt64( textureCoordinateBinding.getTextureMapId() );
+			writeUInt64( textureCoordinateBinding.getSetIndex() );
+			writeString( textureCoordinateBinding.getSemantic() );
+		}
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeTransformation( const COLLADAFW::Transformation& transformation )
+	{
+		writeUInt32( transformation.getTransformationType() );
+		writeUniqueId( transformation.getAnimationList() );
+		switch ( transformation.getTransformationType() )
+		{
+		case COLLADAFW::Transformation::MATRIX:
+			writeMatrix( ((const COLLADAFW::Matrix&)transformation).getMatrix() );
+			break;
+		case COLLADAFW::Transformation::TRANSLATE:
+			writeVector( ((const COLLADAFW::Translate&)transformation).getTranslation() );
+			break;
+		case COLLADAFW::Transformation::ROTATE:
+			{
+				const COLLADAFW::Rotate& rotate = (const COLLADAFW::Rotate&)transformation;
+				writeVector( rotate.getRotationAxis() );
+				writeDouble( rotate.getRotationAngle() );
+				break;
+			}
+		case COLLADAFW::Transformation::SCALE:
+			writeVector( ((const COLLADAFW::Scale&)transformation).getScale() );
+			break;
+		case COLLADAFW::Transformation::LOOKAT:
+			{
+				const COLLADAFW::Lookat& lookat = (const COLLADAFW::Lookat&)transformation;
+				writeVector( lookat.getEyePosition() );
+				writeVector( lookat.getInterestPointPosition() );
+				writeVector( lookat.getUpAxisDirection() );
+				break;
+			}
+		case COLLADAFW::Transformation::SKEW:
+			{
+				const COLLADAFW::Skew& skew = (const COLLADAFW::Skew&)transformation;
+				writeVector( skew.getRotateAxis() );
+				writeVector( skew.getTranslateAxis() );
+				writeFloat( skew.getAngle() );
+				break;
+			}
+		default:
+			mComplete = false;
+			break;
+		}
+	}
+
+	//------------------------------
+	template<class InstanceType>
+	void DocumentCacheWriter::writeInstance( const InstanceType& instance )
+	{
+		writeUniqueId( instance.getUniqueId() );
+		writeUniqueId( instance.getInstanciatedObjectId() );
+		writeString( instance.getName() );
+	}
+
+	//------------------------------
+	template<class InstanceType>
+	void DocumentCacheWriter::writeInstances( const COLLADAFW::PointerArray<InstanceType>& instances )
+	{
+		writeUInt64( instances.getCount() );
+		for ( size_t i = 0; i < instances.getCount(); ++i )
+			writeInstance( *instances[i] );
+	}
+
+	//------------------------------
+	template<class InstanceType>
+	void DocumentCacheWriter::writeBindingInstances( const COLLADAFW::PointerArray<InstanceType>& instances )
+	{
+		writeUInt64( instances.getCount() );
+		for ( size_t i = 0; i < instances.getCount(); ++i )
+		{
+			const InstanceType& instance = *instances[i];
+			writeInstance( instance );
+
+			const COLLADAFW::MaterialBindingArray& materialBindings = instance.getMaterialBindings();
+			writeUInt64( materialBindings.getCount() );
+			for ( size_t j = 0; j < materialBindings.getCount(); ++j )
+				writeMaterialBinding( materialBindings[j] );
+		}
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeNodes( const COLLADAFW::NodePointerArray& nodes )
+	{
+		writeUInt64( nodes.getCount() );
+		for ( size_t i = 0; i < nodes.getCount(); ++i )
+		{
+			const COLLADAFW::Node& node = *nodes[i];
+			writeUniqueId( node.getUniqueId() );
+			writeString( node.getOriginalId() );
+			writeString( node.getName() );
+			writeUInt32( node.getType() );
+
+			const COLLADAFW::TransformationPointerArray& transformations = node.getTransformations();
+			writeUInt64( transformations.getCount() );
+			for ( size_t j = 0; j < transformations.getCount(); ++j )
+				writeTransformation( *transformations[j] );
+
+			writeBindingInstances( node.getInstanceGeometries() );
+			writeInstances( node.getInstanceNodes() );
+			writeInstances( node.getInstanceCameras() );
+			writeInstances( node.getInstanceLights() );
+			writeBindingInstances( node.getInstanceControllers() );
+			writeNodes( node.getChildNodes() );
+		}
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeSampler( const COLLADAFW::Sampler& sampler )
+	{
+		writeUniqueId( sampler.getUniqueId() );
+		writeUInt32( sampler.getSamplerType() );
+		writeUniqueId( sampler.getSourceImage() );
+		writeUInt32( sampler.getMinFilter() );
+		writeUInt32( sampler.getMagFilter() );
+		writeUInt32( sampler.getMipFilter() );
+		writeUInt32( sampler.getWrapS() );
+		writeUInt32( sampler.getWrapT() );
+		writeUInt32( sampler.getWrapP() );
+		writeColor( sampler.getBorderColor() );
+		writeUInt32( sampler.getMipmapMaxlevel() );
+		writeFloat( sampler.getMipmapBias() );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::writeEffectCommon( const COLLADAFW::EffectCommon& effectCommon )
+	{
+		writeString( effectCommon.getOriginalId() );
+		writeUInt32( effectCommon.getShaderType() );
+		writeColorOrTexture( effectCommon.getEmission() );
+		writeColorOrTexture( effectCommon.getAmbient() );
+		writeColorOrTexture( effectCommon.getDiffuse() );
+		writeColorOrTexture( effectCommon.getSpecular() );
+		writeFloatOrParam( effectCommon.getShininess() );
+		writeColorOrTexture( effectCommon.getReflective() );
+		writeFloatOrParam( effectCommon.getReflectivity() );
+		writeColorOrTexture( effectCommon.getOpacity() );
+		writeFloatOrParam( effectCommon.getIndexOfRefraction() );
+
+		const COLLADAFW::SamplerPointerArray& samplers = effectCommon.getSamplerPointerArray();
+		writeUInt64( samplers.getCount() );
+		for ( size_t i = 0; i < samplers.getCount(); ++i )
+			writeSampler( *samplers[i] );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::cancel( const String& errorMessage )
+	{
+		mComplete = false;
+		mWriter->cancel( errorMessage );
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::start()
+	{
+		mWriter->start();
+	}
+
+	//------------------------------
+	void DocumentCacheWriter::finish()
+	{
+		mWriter->finish();
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeGlobalAsset( const COLLADAFW::FileInfo* asset )
+	{
+		if ( !mWriter->writeGlobalAsset( asset ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		writeUInt32( DocumentCache::RECORD_GLOBAL_ASSET );
+
+		const COLLADAFW::FileInfo::ValuePairPointerArray& valuePairs = asset->getValuePairArray();
+		writeUInt64( valuePairs.getCount() );
+		for ( size_t i = 0; i < valuePairs.getCount(); ++i )
+		{
+			writeString( valuePairs[i]->first );
+			writeString( valuePairs[i]->second );
+		}
+
+		const COLLADAFW::FileInfo::Unit& unit = asset->getUnit();
+		writeString( unit.getLinearUnitName() );
+		writeDouble( unit.getLinearUnitMeter() );
+		writeUInt32( unit.getLinearUnitUnit() );
+		writeString( unit.getAngularUnitName() );
+		writeUInt32( unit.getAngularUnit() );
+		writeString( unit.getTimeUnitName() );
+
+		writeUInt32( asset->getUpAxisType() );
+		writeUri( asset->getAbsoluteFileUri() );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeScene( const COLLADAFW::Scene* scene )
+	{
+		if ( !mWriter->writeScene( scene ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		if ( scene->getInstanceKinematicsScene() )
+		{
+			// the kinematics scene itself can not be recorded, see writeKinematicsScene()
+			mComplete = false;
+			return true;
+		}
+
+		writeUInt32( DocumentCache::RECORD_SCENE );
+		writeUniqueId( scene->getUniqueId() );
+		const COLLADAFW::InstanceVisualScene* instanceVisualScene = scene->getInstanceVisualScene();
+		writeBool( instanceVisualScene != 0 );
+		if ( instanceVisualScene )
+			writeInstance( *instanceVisualScene );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeVisualScene( const COLLADAFW::VisualScene* visualScene )
+	{
+		if ( !mWriter->writeVisualScene( visualScene ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		writeUInt32( DocumentCache::RECORD_VISUAL_SCENE );
+		writeUniqueId( visualScene->getUniqueId() );
+		writeString( visualScene->getName() );
+		writeNodes( visualScene->getRootNodes() );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes )
+	{
+		if ( !mWriter->writeLibraryNodes( libraryNodes ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		writeUInt32( DocumentCache::RECORD_LIBRARY_NODES );
+		writeNodes( libraryNodes->getNodes() );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeGeometry( const COLLADAFW::Geometry* geometry )
+	{
+		if ( !mWriter->writeGeometry( geometry ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		if ( (geometry->getType() != COLLADAFW::Geometry::GEO_TYPE_MESH) && (geometry->getType() != COLLADAFW::Geometry::GEO_TYPE_CONVEX_MESH) )
+		{
+			// splines are passed to the writer, but can not be recorded
+			mComplete = false;
+			return true;
+		}
+
+		const COLLADAFW::Mesh* mesh = (const COLLADAFW::Mesh*)geometry;
+		writeUInt32( DocumentCache::RECORD_GEOMETRY );
+		writeUniqueId( mesh->getUniqueId() );
+		writeString( mesh->getOriginalId() );
+		writeString( mesh->getName() );
+		writeUInt32( mesh->getType() );
+		writeMeshVertexData( mesh->getPositions() );
+		writeMeshVertexData( mesh->getNormals() );
+		writeMeshVertexData( mesh->getColors() );
+		writeMeshVertexData( mesh->getUVCoords() );
+
+		const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mesh->getMeshPrimitives();
+		writeUInt64( meshPrimitives.getCount() );
+		for ( size_t i = 0; i < meshPrimitives.getCount(); ++i )
+			writeMeshPrimitive( *meshPrimitives[i] );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeMaterial( const COLLADAFW::Material* material )
+	{
+		if ( !mWriter->writeMaterial( material ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		writeUInt32( DocumentCache::RECORD_MATERIAL );
+		writeUniqueId( material->getUniqueId() );
+		writeString( material->getOriginalId() );
+		writeString( material->getName() );
+		writeUniqueId( material->getInstantiatedEffect() );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeEffect( const COLLADAFW::Effect* effect )
+	{
+		if ( !mWriter->writeEffect( effect ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		writeUInt32( DocumentCache::RECORD_EFFECT );
+		writeUniqueId( effect->getUniqueId() );
+		writeString( effect->getOriginalId() );
+		writeString( effect->getName() );
+		writeColor( effect->getStandardColor() );
+
+		const COLLADAFW::CommonEffectPointerArray& commonEffects = effect->getCommonEffects();
+		writeUInt64( commonEffects.getCount() );
+		for ( size_t i = 0; i < commonEffects.getCount(); ++i )
+			writeEffectCommon( *commonEffects[i] );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeCamera( const COLLADAFW::Camera* camera )
+	{
+		if ( !mWriter->writeCamera( camera ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		writeUInt32( DocumentCache::RECORD_CAMERA );
+		writeUniqueId( camera->getUniqueId() );
+		writeString( camera->getOriginalId() );
+		writeString( camera->getName() );
+		writeUInt32( camera->getCameraType() );
+		writeUInt32( camera->getDescriptionType() );
+		writeAnimatableFloat( camera->getXFov() );
+		writeAnimatableFloat( camera->getYFov() );
+		writeAnimatableFloat( camera->getAspectRatio() );
+		writeAnimatableFloat( camera->getNearClippingPlane() );
+		writeAnimatableFloat( camera->getFarClippingPlane() );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeImage( const COLLADAFW::Image* image )
+	{
+		if ( !mWriter->writeImage( image ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		writeUInt32( DocumentCache::RECORD_IMAGE );
+		writeUniqueId( image->getUniqueId() );
+		writeString( image->getOriginalId() );
+		writeUInt32( image->getSourceType() );
+		writeString( image->getName() );
+		writeString( image->getFormat() );
+		writeUInt32( image->getHeight() );
+		writeUInt32( image->getWidth() );
+		writeUInt32( image->getDepth() );
+		writeUri( image->getImageURI() );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeLight( const COLLADAFW::Light* light )
+	{
+		if ( !mWriter->writeLight( light ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		writeUInt32( DocumentCache::RECORD_LIGHT );
+		writeUniqueId( light->getUniqueId() );
+		writeString( light->getOriginalId() );
+		writeString( light->getName() );
+		writeUInt32( light->getLightType() );
+		writeColor( light->getColor() );
+		writeAnimatableFloat( light->getConstantAttenuation() );
+		writeAnimatableFloat( light->getLinearAttenuation() );
+		writeAnimatableFloat( light->getQuadraticAttenuation() );
+		writeAnimatableFloat( light->getFallOffAngle() );
+		writeAnimatableFloat( light->getFallOffExponent() );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeAnimation( const COLLADAFW::Animation* animation )
+	{
+		if ( !mWriter->writeAnimation( animation ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		if ( animation->getAnimationType() != COLLADAFW::Animation::ANIMATION_CURVE )
+		{
+			mComplete = false;
+			return true;
+		}
+
+		const COLLADAFW::AnimationCurve* animationCurve = (const COLLADAFW::AnimationCurve*)animation;
+		writeUInt32( DocumentCache::RECORD_ANIMATION );
+		writeUniqueId( animationCurve->getUniqueId() );
+		writeString( animationCurve->getOriginalId() );
+		writeString( animationCurve->getName() );
+		writeUInt32( animationCurve->getInPhysicalDimension() );
+		writeArray( animationCurve->getOutPhysicalDimensions() );
+		writeUInt64( animationCurve->getOutDimension() );
+		writeUInt32( animationCurve->getInterpolationType() );
+		writeFloatOrDoubleArray( animationCurve->getInputValues() );
+		writeFloatOrDoubleArray( animationCurve->getOutputValues() );
+		writeArray( animationCurve->getInterpolationTypes() );
+		writeFloatOrDoubleArray( animationCurve->getInTangentValues() );
+		writeFloatOrDoubleArray( animationCurve->getOutTangentValues() );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeAnimationList( const COLLADAFW::AnimationList* animationList )
+	{
+		if ( !mWriter->writeAnimationList( animationList ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		writeUInt32( DocumentCache::RECORD_ANIMATION_LIST );
+		writeUniqueId( animationList->getUniqueId() );
+
+		const COLLADAFW::AnimationList::AnimationBindings& animationBindings = animationList->getAnimationBindings();
+		writeUInt64( animationBindings.getCount() );
+		for ( size_t i = 0; i < animationBindings.getCount(); ++i )
+		{
+			const COLLADAFW::AnimationList::AnimationBinding& animationBinding = animationBindings[i];
+			writeUniqueId( animationBinding.animation );
+			writeUInt32( animationBinding.animationClass );
+			writeUInt64( animationBinding.firstIndex );
+			writeUInt64( animationBinding.secondIndex );
+		}
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData )
+	{
+		if ( !mWriter->writeSkinControllerData( skinControllerData ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		writeUInt32( DocumentCache::RECORD_SKIN_CONTROLLER_DATA );
+		writeUniqueId( skinControllerData->getUniqueId() );
+		writeString( skinControllerData->getOriginalId() );
+		writeString( skinControllerData->getName() );
+		writeUInt64( skinControllerData->getJointsCount() );
+		writeMatrix( skinControllerData->getBindShapeMatrix() );
+
+		const COLLADAFW::Matrix4Array& inverseBindMatrices = skinControllerData->getInverseBindMatrices();
+		writeUInt64( inverseBindMatrices.getCount() );
+		for ( size_t i = 0; i < inverseBindMatrices.getCount(); ++i )
+			writeMatrix( inverseBindMatrices[i] );
+
+		writeFloatOrDoubleArray( skinControllerData->getWeights() );
+		writeArray( skinControllerData->getJointsPerVertex() );
+		writeArray( skinControllerData->getWeightIndices() );
+		writeArray( skinControllerData->getJointIndices() );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeController( const COLLADAFW::Controller* controller )
+	{
+		if ( !mWriter->writeController( controller ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		writeUInt32( DocumentCache::RECORD_CONTROLLER );
+		writeUInt32( controller->getControllerType() );
+		writeUniqueId( controller->getUniqueId() );
+		writeUniqueId( controller->getSource() );
+		switch ( controller->getControllerType() )
+		{
+		case COLLADAFW::Controller::CONTROLLER_TYPE_SKIN:
+			{
+				const COLLADAFW::SkinController* skinController = (const COLLADAFW::SkinController*)controller;
+				writeUniqueId( skinController->getSkinControllerData() );
+				const COLLADAFW::UniqueIdArray& joints = skinController->getJoints();
+				writeUInt64( joints.getCount() );
+				for ( size_t i = 0; i < joints.getCount(); ++i )
+					writeUniqueId( joints[i] );
+				break;
+			}
+		case COLLADAFW::Controller::CONTROLLER_TYPE_MORPH:
+			{
+				const COLLADAFW::MorphController* morphController = (const COLLADAFW::MorphController*)controller;
+				writeString( morphController->getOriginalId() );
+				writeString( morphController->getName() );
+				const COLLADAFW::UniqueIdArray& morphTargets = morphController->getMorphTargets();
+				writeUInt64( morphTargets.getCount() );
+				for ( size_t i = 0; i < morphTargets.getCount(); ++i )
+					writeUniqueId( morphTargets[i] );
+				writeFloatOrDoubleArray( morphController->getMorphWeights() );
+				break;
+			}
+		default:
+			mComplete = false;
+			break;
+		}
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeFormulas( const COLLADAFW::Formulas* formulas )
+	{
+		if ( !mWriter->writeFormulas( formulas ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		if ( formulas->getFormulas().getCount() != 0 )
+		{
+			mComplete = false;
+			return true;
+		}
+
+		writeUInt32( DocumentCache::RECORD_FORMULAS );
+		return true;
+	}
+
+	//------------------------------
+	bool DocumentCacheWriter::writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene )
+	{
+		if ( !mWriter->writeKinematicsScene( kinematicsScene ) )
+		{
+			mComplete = false;
+			return false;
+		}
+
+		if ( (kinematicsScene->getKinematicsModels().getCount() != 0)
+			|| (kinematicsScene->getKinematicsControllers().getCount() != 0)
+			|| (kinematicsScene->getInstanceKinematicsScenes().getCount() != 0) )
+		{
+			mComplete = false;
+			return true;
+		}
+
+		writeUInt32( DocumentCache::RECORD_KINEMATICS_SCENE );
+		return true;
+	}
+
+} // namespace COLLADASAXFWL
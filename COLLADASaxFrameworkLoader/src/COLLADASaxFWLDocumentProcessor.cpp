@@ -417,9 +417,9 @@ namespace COLLADASaxFWL
 		Loader::SkinControllerSet::const_iterator skinControllerIt = mSkinControllerSet.find( skinController );
 		if ( skinControllerIt == mSkinControllerSet.end() )
 		{
-			skinControllerToWrite = &skinController;
+			// write the controller kept in the set, such that it stays valid as long as the loader
+			skinControllerToWrite = &(*mSkinControllerSet.insert( skinController ).first);
 			success = writer()->writeController(skinControllerToWrite);
-			mSkinControllerSet.insert( skinController );
 		}
 		else
 		{
@@ -14,6 +14,7 @@
 #include "COLLADASaxFWLGeometryLoader.h"
 
 #include "COLLADAFWIWriter.h"
+#include "COLLADAFWIMeshStreamWriter.h"
 
 
 namespace COLLADASaxFWL
@@ -60,6 +61,12 @@ namespace COLLADASaxFWL
             break;
             }
         }
+
+		// The mesh is passed to the writer in blocks while it is being parsed. The mesh stream writer must 
+		// not be called, while the writer pipeline writes queued objects.
+		COLLADAFW::IMeshStreamWriter* meshStreamWriter = mMeshLoader->getMeshStreamWriter();
+		if ( meshStreamWriter )
+			return flushWriter() && meshStreamWriter->beginMesh(mMeshLoader->getMesh());
 		return true;
 	}
 
@@ -68,9 +75,18 @@ namespace COLLADASaxFWL
 	{
 		bool success = true;
 		COLLADAFW::Mesh * mesh = mMeshLoader ? mMeshLoader->getMesh() : 0;
-		if ( ((getObjectFlags() & Loader::GEOMETRY_FLAG) != 0) && mesh )
+		COLLADAFW::IMeshStreamWriter* meshStreamWriter = mMeshLoader ? mMeshLoader->getMeshStreamWriter() : 0;
+		if ( meshStreamWriter && mesh )
+		{
+			// All blocks have already been written. The mesh is never retained.
+			success = meshStreamWriter->endMesh(mesh);
+		}
+		else if ( ((getObjectFlags() & Loader::GEOMETRY_FLAG) != 0) && mesh )
 		{
-			success = writer()->writeGeometry(mesh);
+			// keep the mesh, if the loader retains geometries, otherwise delete it once it has been written
+			bool retained = retainGeometry(mesh);
+			mMeshLoader->releaseMesh();
+			success = writeObject(mesh, !retained);
 		}
 
 		finish();
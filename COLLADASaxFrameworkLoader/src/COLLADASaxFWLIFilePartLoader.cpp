@@ -17,6 +17,7 @@
 #include "COLLADASaxFWLIParserImpl14.h"
 #include "COLLADASaxFWLIParserImpl15.h"
 #include "COLLADASaxFWLIExtraDataCallbackHandler.h"
+#include "COLLADASaxFWLWriterPipeline.h"
 
 
 namespace COLLADASaxFWL
@@ -46,6 +47,30 @@ namespace COLLADASaxFWL
 		return getColladaLoader()->writer();
 	}
 
+	//-----------------------------
+	bool IFilePartLoader::writeObject( COLLADAFW::Object* object, bool deleteAfterWrite )
+	{
+		// objects retained by the loader are deleted when the loader is destroyed, after the pipeline
+		if ( deleteAfterWrite && retainObject(object) )
+			deleteAfterWrite = false;
+
+		WriterPipeline* writerPipeline = getColladaLoader()->getWriterPipeline();
+		if ( writerPipeline )
+			return writerPipeline->writeObject(object, deleteAfterWrite);
+
+		// objects the loader does not need anymore are handed over to the writer
+		if ( deleteAfterWrite )
+			return WriterPipeline::adopt(writer(), object);
+		return WriterPipeline::write(writer(), object);
+	}
+
+	//-----------------------------
+	bool IFilePartLoader::flushWriter()
+	{
+		WriterPipeline* writerPipeline = getColladaLoader()->getWriterPipeline();
+		return writerPipeline ? writerPipeline->flush() : true;
+	}
+
 	//-----------------------------
 	const COLLADAFW::UniqueId& IFilePartLoader::createUniqueId( const String& uriString, COLLADAFW::ClassId classId )
 	{
@@ -194,6 +219,28 @@ namespace COLLADASaxFWL
 		return getColladaLoader()->getTextureMapIdBySematic(semantic);
 	}
 
+	//------------------------------
+	bool IFilePartLoader::retainGeometry( COLLADAFW::Geometry* geometry )
+	{
+		COLLADABU_ASSERT( getColladaLoader() );
+		Loader* loader = getColladaLoader();
+		if ( !loader->getRetainGeometries() )
+			return false;
+		loader->addRetainedGeometry(geometry);
+		return true;
+	}
+
+	//------------------------------
+	bool IFilePartLoader::retainObject( COLLADAFW::Object* object )
+	{
+		COLLADABU_ASSERT( getColladaLoader() );
+		Loader* loader = getColladaLoader();
+		if ( !loader->getRetainObjects() )
+			return false;
+		loader->addRetainedObject(object);
+		return true;
+	}
+
 	//------------------------------
 	SidTreeNode* IFilePartLoader::addToSidTree( const char* colladaId, const char* colladaSid )
 	{
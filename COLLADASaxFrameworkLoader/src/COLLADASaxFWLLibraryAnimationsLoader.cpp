@@ -393,8 +393,7 @@ namespace COLLADASaxFWL
 
 			if ( COLLADAFW::validate( mCurrentAnimationCurve ) )
 			{
-				success = writer()->writeAnimation(mCurrentAnimationCurve);
-				FW_DELETE mCurrentAnimationCurve;
+				success = writeObject(mCurrentAnimationCurve, true);
 			}
 			else
 			{
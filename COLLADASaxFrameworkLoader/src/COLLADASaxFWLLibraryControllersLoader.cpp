@@ -228,10 +228,12 @@ namespace COLLADASaxFWL
 		bool success = true;
 		if ( validate( mCurrentSkinControllerData ) )
 		{
-			success = writer()->writeSkinControllerData( mCurrentSkinControllerData );
+			success = writeObject( mCurrentSkinControllerData, true );
+		}
+		else
+		{
+			FW_DELETE mCurrentSkinControllerData;
 		}
-
-		FW_DELETE mCurrentSkinControllerData;
 		mCurrentSkinControllerData  = 0;
 		mJointSidsMap.clear();
 		mJointSidsOrIds = 0;
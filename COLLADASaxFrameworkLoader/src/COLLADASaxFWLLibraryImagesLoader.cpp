@@ -77,9 +77,12 @@ namespace COLLADASaxFWL
 		bool success = true;
 		if ( (getObjectFlags() & Loader::IMAGE_FLAG) != 0 )
 		{
-		    success = writer()->writeImage(mCurrentImage);
+		    success = writeObject(mCurrentImage, true);
+		}
+		else
+		{
+			FW_DELETE mCurrentImage;
 		}
-		FW_DELETE mCurrentImage;
 		mCurrentImage = 0;
 		return success;
 	}
@@ -56,10 +56,12 @@ namespace COLLADASaxFWL
 		bool success = true;
 		if ( (getObjectFlags() & Loader::MATERIAL_FLAG) != 0 )
 		{
-			success = writer()->writeMaterial(mCurrentMaterial);
+			success = writeObject(mCurrentMaterial, true);
+		}
+		else
+		{
+			FW_DELETE mCurrentMaterial;
 		}
-
-		FW_DELETE mCurrentMaterial;
 		mCurrentMaterial = 0;
 		return success;
 	}
@@ -14,9 +14,14 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADASaxFWLPostProcessor.h"
 #include "COLLADASaxFWLSaxParserErrorHandler.h"
 #include "COLLADASaxFWLUtils.h"
+#include "COLLADASaxFWLWriterPipeline.h"
+#include "COLLADASaxFWLDocumentCacheReader.h"
+#include "COLLADASaxFWLDocumentCacheWriter.h"
 
 #include "COLLADABUURI.h"
 
+#include "GeneratedSaxParserMemoryMappedFile.h"
+
 #include "COLLADAFWVisualScene.h"
 #include "COLLADAFWLibraryNodes.h"
 #include "COLLADAFWIWriter.h"
@@ -25,6 +30,8 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADAFWCamera.h"
 #include "COLLADAFWAnimationList.h"
 #include "COLLADAFWConstants.h"
+#include "COLLADAFWGeometry.h"
+#include "COLLADAFWMemoryArena.h"
 
 #include <sys/types.h>
 #include <sys/timeb.h>
@@ -37,6 +44,9 @@ namespace COLLADASaxFWL
 
 	const Loader::JointSidsOrIds Loader::EMPTY_JOINTSIDSORIDS;
 
+	/** Marks the uris in mURIFileIds, no file id has been assigned to.*/
+	static const COLLADAFW::FileId INVALID_FILE_ID = (COLLADAFW::FileId)-1;
+
 
 	Loader::Loader( IErrorHandler* errorHandler )
 		: mNextFileId(0)
@@ -48,7 +58,18 @@ namespace COLLADASaxFWL
 		, mSidTreeRoot( new SidTreeNode("", 0) )
 		, mSkinControllerSet( compare )
 		, mExternalReferenceDeciderCallbackFunction()
-
+		, mUseMemoryMappedFiles(false)
+		, mSkipExcludedLibraries(false)
+		, mReadAheadExternalReferences(false)
+		, mRetainGeometries(false)
+		, mRetainObjects(false)
+		, mMemoryArena(0)
+		, mMeshStreamWriter(0)
+		, mMeshStreamBlockVertexCount(65536)
+		, mWriterPipelineQueueSize(0)
+		, mWriterPipeline(0)
+		, mUseDocumentCache(false)
+		, mDocumentCacheWriter(0)
 	{
 	}
 
@@ -56,6 +77,10 @@ namespace COLLADASaxFWL
 	//---------------------------------
 	Loader::~Loader()
 	{
+		delete mWriterPipeline;
+
+		delete mDocumentCacheWriter;
+
 		delete mSidTreeRoot;
 
 		// delete visual scenes
@@ -73,6 +98,10 @@ namespace COLLADASaxFWL
 		// delete cameras
 		deleteVectorFW(mCameras);
 
+		deleteRetainedGeometries();
+
+		deleteRetainedObjects();
+
 		// We do not delete formulas here. They are deleted by the Formulas class
 
 		// delete animation lists
@@ -85,30 +114,42 @@ namespace COLLADASaxFWL
 	}
 
     //---------------------------------
-	const COLLADAFW::UniqueId& Loader::getUniqueId( const COLLADABU::URI& uri, COLLADAFW::ClassId classId )
+	URIInternTable::Handle Loader::internURI( const COLLADABU::URI& uri )
 	{
-		URIUniqueIdMap::iterator it = mURIUniqueIdMap.find(uri);
-		if ( it == mURIUniqueIdMap.end() )
+		bool added = false;
+		URIInternTable::Handle handle = mURIInternTable.intern( uri, added );
+		if ( added )
 		{
-			return mURIUniqueIdMap[uri] = COLLADAFW::UniqueId(classId, mLoaderUtil.getLowestObjectIdFor(classId), getFileId(uri));
+			mURIUniqueIds.push_back( COLLADAFW::UniqueId::INVALID );
+			mURIFileIds.push_back( INVALID_FILE_ID );
 		}
-		else
+		return handle;
+	}
+
+    //---------------------------------
+	const COLLADAFW::UniqueId& Loader::getUniqueId( const COLLADABU::URI& uri, COLLADAFW::ClassId classId )
+	{
+		URIInternTable::Handle handle = internURI( uri );
+		// push_back on a deque does not invalidate references
+		COLLADAFW::UniqueId& uniqueId = mURIUniqueIds[handle];
+		if ( !uniqueId.isValid() )
 		{
-			return it->second;
+			uniqueId = COLLADAFW::UniqueId(classId, mLoaderUtil.getLowestObjectIdFor(classId), getFileId(uri));
 		}
+		return uniqueId;
 	}
 
 	//---------------------------------
 	const COLLADAFW::UniqueId& Loader::getUniqueId( const COLLADABU::URI& uri)
 	{
-		URIUniqueIdMap::iterator it = mURIUniqueIdMap.find(uri);
-		if ( it == mURIUniqueIdMap.end() )
+		URIInternTable::Handle handle = mURIInternTable.find( uri );
+		if ( handle == URIInternTable::INVALID_HANDLE )
 		{
 			return COLLADAFW::UniqueId::INVALID;
 		}
 		else
 		{
-			return it->second;
+			return mURIUniqueIds[handle];
 		}
 	}
 
@@ -149,18 +190,14 @@ namespace COLLADASaxFWL
 			usedUri = &uriWithoutFragment;
 		}
 
-		URIFileIdMap::iterator it = mURIFileIdMap.find( *usedUri );
+		COLLADAFW::FileId fileId = mURIFileIds[ internURI( *usedUri ) ];
 
-		if ( it == mURIFileIdMap.end() )
+		if ( fileId == INVALID_FILE_ID )
 		{
-			COLLADAFW::FileId fileId = mNextFileId++;
+			fileId = mNextFileId++;
 			addFileIdUriPair( fileId, *usedUri );
-			return fileId;
-		}
-		else
-		{
-			return it->second;
 		}
+		return fileId;
 	}
 
 	//---------------------------------
@@ -181,8 +218,40 @@ namespace COLLADASaxFWL
 	//---------------------------------
 	void Loader::addFileIdUriPair( COLLADAFW::FileId fileId, const COLLADABU::URI& uri )
 	{
-		mURIFileIdMap[uri] = fileId;
+		mURIFileIds[ internURI( uri ) ] = fileId;
 		mFileIdURIMap[fileId] = uri;
+
+		// The root file is parsed immediately. There is nothing to overlap with. The external reference 
+		// decider is not asked here, but only when the file is about to be loaded, i.e. in the same order 
+		// and with the same loader state as without read ahead.
+		if ( mReadAheadExternalReferences && (fileId != 0) )
+		{
+			readAheadFile( uri );
+		}
+	}
+
+	//---------------------------------
+	bool Loader::isFileToBeLoaded( COLLADAFW::FileId fileId, const COLLADABU::URI& fileUri )
+	{
+		if ( (fileId == 0) || !mExternalReferenceDeciderCallbackFunction )
+			return true;
+
+		FileIdDecisionMap::const_iterator it = mExternalReferenceDecisions.find( fileId );
+		if ( it != mExternalReferenceDecisions.end() )
+			return it->second;
+
+		return mExternalReferenceDecisions[fileId] = mExternalReferenceDeciderCallbackFunction(fileUri, fileId);
+	}
+
+	//---------------------------------
+	void Loader::readAheadFile( const COLLADABU::URI& fileUri )
+	{
+		const String& scheme = fileUri.getScheme();
+		if ( !scheme.empty() && (scheme != "file") )
+			return;
+
+		String nativePath = fileUri.toNativePath();
+		GeneratedSaxParser::MemoryMappedFile::readAhead( nativePath.c_str() );
 	}
 
 	//---------------------------------
@@ -192,12 +261,27 @@ namespace COLLADASaxFWL
 			return false;
 		mWriter = writer;
 
+		COLLADAFW::CurrentMemoryArenaScope memoryArenaScope(mMemoryArena);
+
+		COLLADABU::URI rootFileUri(COLLADABU::URI::nativePathToUri(fileName));
+
+		if ( isDocumentCacheUsable() )
+		{
+			String cacheFileName = DocumentCache::getCacheFileName( fileName );
+			DocumentCacheReader documentCacheReader;
+			if ( documentCacheReader.open(cacheFileName) && isDocumentCacheValid(documentCacheReader, rootFileUri) )
+				return loadDocumentCache( documentCacheReader );
+
+			// the pipeline must pass the objects to the cache writer, it is therefore started afterwards
+			startDocumentCacheRecording( cacheFileName );
+		}
+
+		startWriterPipeline();
+
 		mWriter->start();
 
 		SaxParserErrorHandler saxParserErrorHandler(mErrorHandler);
 
-		COLLADABU::URI rootFileUri(COLLADABU::URI::nativePathToUri(fileName));
-		
 		// the root file has always file id 0
 		addFileIdUriPair( mNextFileId++, rootFileUri );
 
@@ -207,9 +291,11 @@ namespace COLLADASaxFWL
 		{
 			const COLLADABU::URI& fileUri = getFileUri( mCurrentFileId );
 
-			if ( (mCurrentFileId == 0) 
-				|| !mExternalReferenceDeciderCallbackFunction 
-				|| mExternalReferenceDeciderCallbackFunction(fileUri, mCurrentFileId) )
+			bool fileToBeLoaded = isFileToBeLoaded( mCurrentFileId, fileUri );
+			if ( mDocumentCacheWriter )
+				mDocumentCacheWriter->addFile( mCurrentFileId, fileUri, fileToBeLoaded );
+
+			if ( fileToBeLoaded )
 			{
 				FileLoader fileLoader(this, 
 					fileUri,
@@ -224,6 +310,11 @@ namespace COLLADASaxFWL
 			mCurrentFileId++;
 		}
 
+		// wait for the objects still queued. As for a writer that is called directly, a failure only
+		// stops parsing the file, which is done already.
+		if ( mWriterPipeline )
+			mWriterPipeline->flush();
+
 		if ( !abortLoading )
 		{
 			PostProcessor postProcessor(this, 
@@ -239,6 +330,10 @@ namespace COLLADASaxFWL
 
 		mWriter->finish();
 
+		stopWriterPipeline();
+
+		stopDocumentCacheRecording( !abortLoading && !saxParserErrorHandler.hasErrors() );
+
 		mParsedObjectFlags |= mObjectFlags;
 
 		return !abortLoading;
@@ -250,6 +345,10 @@ namespace COLLADASaxFWL
 		if ( !writer )
 			return false;
 		mWriter = writer;
+
+		COLLADAFW::CurrentMemoryArenaScope memoryArenaScope(mMemoryArena);
+
+		startWriterPipeline();
         
 		SaxParserErrorHandler saxParserErrorHandler(mErrorHandler);
         
@@ -264,9 +363,7 @@ namespace COLLADASaxFWL
 		{
 			const COLLADABU::URI& fileUri = getFileUri( mCurrentFileId );
 
-			if ( (mCurrentFileId == 0) 
-				|| !mExternalReferenceDeciderCallbackFunction 
-				|| mExternalReferenceDeciderCallbackFunction(fileUri, mCurrentFileId) )
+			if ( isFileToBeLoaded(mCurrentFileId, fileUri) )
 			{
 				FileLoader fileLoader(this, 
 					getFileUri( mCurrentFileId ),
@@ -274,12 +371,18 @@ namespace COLLADASaxFWL
 					mObjectFlags,
 					mParsedObjectFlags, 
 					mExtraDataCallbackHandlerList );
-				bool success = fileLoader.load();
+				// the root file is read from the buffer, referenced files from their uris
+				bool success = (mCurrentFileId == 0) ? fileLoader.load(buffer, length) : fileLoader.load();
 				abortLoading = !success;
 			}
             
 			mCurrentFileId++;
 		}
+
+		// wait for the objects still queued. As for a writer that is called directly, a failure only
+		// stops parsing the file, which is done already.
+		if ( mWriterPipeline )
+			mWriterPipeline->flush();
         
 		if ( !abortLoading )
 		{
@@ -296,11 +399,140 @@ namespace COLLADASaxFWL
         
 		mWriter->finish();
 
+		stopWriterPipeline();
+
 		mParsedObjectFlags |= mObjectFlags;
         
 		return !abortLoading;
 	}
 
+	//---------------------------------
+	void Loader::startWriterPipeline()
+	{
+		// the objects allocated in a memory arena must be created and deleted on the same thread
+		if ( (mWriterPipelineQueueSize == 0) || mMemoryArena )
+			return;
+
+		mWriterPipeline = new WriterPipeline(mWriter, mWriterPipelineQueueSize);
+		if ( !mWriterPipeline->isRunning() )
+		{
+			// no background thread available, call the writer directly
+			delete mWriterPipeline;
+			mWriterPipeline = 0;
+			return;
+		}
+		mWriter = mWriterPipeline;
+	}
+
+	//---------------------------------
+	void Loader::stopWriterPipeline()
+	{
+		if ( !mWriterPipeline )
+			return;
+
+		mWriter = mWriterPipeline->getWriter();
+		delete mWriterPipeline;
+		mWriterPipeline = 0;
+	}
+
+	//---------------------------------
+	bool Loader::isDocumentCacheUsable() const
+	{
+		// the unique ids of a replayed document are unknown, it can therefore not be combined with others
+		return mUseDocumentCache
+			&& (mNextFileId == 0)
+			&& mExtraDataCallbackHandlerList.empty()
+			&& !mMeshStreamWriter
+			&& !mRetainGeometries
+			&& !mRetainObjects;
+	}
+
+	//---------------------------------
+	bool Loader::isDocumentCacheValid( const DocumentCacheReader& documentCacheReader, const COLLADABU::URI& rootFileUri )
+	{
+		if ( documentCacheReader.getObjectFlags() != mObjectFlags )
+			return false;
+
+		const DocumentCache::CachedFileList& files = documentCacheReader.getFiles();
+		if ( (files[0].fileId != 0) || (files[0].uri.getURIString() != rootFileUri.getURIString()) )
+			return false;
+
+		// The files are checked in the order of their ids. If all files before a file are unchanged, the file 
+		// gets the same id when the document is parsed. The decisions made so far therefore stay valid, 
+		// even if the cache is rejected.
+		for ( DocumentCache::CachedFileList::const_iterator it = files.begin(); it != files.end(); ++it )
+		{
+			if ( isFileToBeLoaded(it->fileId, it->uri) != it->loaded )
+				return false;
+
+			if ( !it->loaded )
+				continue;
+
+			uint64 size = 0;
+			uint64 hash = 0;
+			if ( !DocumentCache::calculateFileHash(it->uri, size, hash) || (size != it->size) || (hash != it->hash) )
+				return false;
+		}
+		return true;
+	}
+
+	//---------------------------------
+	bool Loader::loadDocumentCache( DocumentCacheReader& documentCacheReader )
+	{
+		mWriter->start();
+
+		bool success = documentCacheReader.replay( mWriter );
+		if ( !success )
+			mWriter->cancel("Generic error");
+
+		mWriter->finish();
+
+		const DocumentCache::CachedFileList& files = documentCacheReader.getFiles();
+		for ( DocumentCache::CachedFileList::const_iterator it = files.begin(); it != files.end(); ++it )
+		{
+			// no read ahead as in addFileIdUriPair(), the files are not loaded
+			mURIFileIds[ internURI( it->uri ) ] = it->fileId;
+			mFileIdURIMap[it->fileId] = it->uri;
+			if ( it->fileId >= mNextFileId )
+				mNextFileId = it->fileId + 1;
+		}
+		mCurrentFileId = mNextFileId;
+
+		setCOLLADAVersion( documentCacheReader.getCOLLADAVersion() );
+		mParsedObjectFlags |= mObjectFlags;
+
+		return success;
+	}
+
+	//---------------------------------
+	void Loader::startDocumentCacheRecording( const String& cacheFileName )
+	{
+		mDocumentCacheWriter = new DocumentCacheWriter(mWriter, cacheFileName);
+		mWriter = mDocumentCacheWriter;
+	}
+
+	//---------------------------------
+	void Loader::stopDocumentCacheRecording( bool save )
+	{
+		if ( !mDocumentCacheWriter )
+			return;
+
+		mWriter = mDocumentCacheWriter->getWriter();
+
+		if ( save )
+		{
+			// The files visited by loadDocument() have been added before they were parsed. Files referenced 
+			// only during post processing are not parsed, but their decisions must stay the same.
+			for ( FileIdURIMap::const_iterator it = mFileIdURIMap.lower_bound(mCurrentFileId); it != mFileIdURIMap.end(); ++it )
+				mDocumentCacheWriter->addFile( it->first, it->second, isFileToBeLoaded(it->first, it->second) );
+
+			mDocumentCacheWriter->save( mObjectFlags, mCOLLADAVersion );
+		}
+
+		delete mDocumentCacheWriter;
+		mDocumentCacheWriter = 0;
+	}
+
     //---------------------------------
     bool Loader::registerExtraDataCallbackHandler ( IExtraDataCallbackHandler* extraDataCallbackHandler )
     {
@@ -310,6 +542,35 @@ namespace COLLADASaxFWL
         return true;
     }
 
+	//---------------------------------
+	bool Loader::writeRetainedGeometries( COLLADAFW::IWriter* writer ) const
+	{
+		if ( !writer )
+			return false;
+
+		for ( size_t i = 0, count = mRetainedGeometries.size(); i < count; ++i)
+		{
+			if ( !writer->writeGeometry(mRetainedGeometries[i]) )
+				return false;
+		}
+		return true;
+	}
+
+	//---------------------------------
+	void Loader::deleteRetainedGeometries()
+	{
+		// the geometries have been created by the mesh loaders using new
+		deleteVector(mRetainedGeometries);
+		mRetainedGeometries.clear();
+	}
+
+	//---------------------------------
+	void Loader::deleteRetainedObjects()
+	{
+		deleteVectorFW(mRetainedObjects);
+		mRetainedObjects.clear();
+	}
+
 	//---------------------------------
 	GeometryMaterialIdInfo& Loader::getMeshMaterialIdInfo( )
 	{
@@ -56,7 +56,19 @@ namespace COLLADASaxFWL
 		, mCurrentPrimitiveType(NONE)
 		, mPOrPhElementCountOfCurrentPrimitive(0)
         , mInMesh (true)
+		, mMeshStreamWriter(0)
+		, mMeshStreamBlockVertexCount(0)
+		, mStreamedVertexCount(0)
+		, mStreamedFaceCount(0)
 	{
+		if ( (getObjectFlags() & Loader::GEOMETRY_FLAG) != 0 )
+		{
+			mMeshStreamWriter = getColladaLoader()->getMeshStreamWriter();
+			mMeshStreamBlockVertexCount = getColladaLoader()->getMeshStreamBlockVertexCount();
+		}
+		for ( size_t i = 0; i <= COLLADAFW::IMeshStreamWriter::UV_COORDINATES; ++i )
+			mStreamedValuesCounts[i] = 0;
+
         if ( !geometryName.empty() )
             mMesh->setName ( geometryName );
         else if ( !geometryId.empty() )
@@ -198,12 +210,12 @@ namespace COLLADASaxFWL
                 // Check if there are already some values in the positions list.
                 // If so, we have to store the last index to increment the following indexes.
                 COLLADAFW::MeshVertexData& positions = mMesh->getPositions ();
-                const size_t initialIndex = positions.getValuesCount ();
+                const size_t initialIndex = positions.getValuesCount () + mStreamedValuesCounts[COLLADAFW::IMeshStreamWriter::POSITIONS];
                 sourceBase->setInitialIndex ( initialIndex );
 
                 // Push the new positions into the list of positions.
                 positions.setType ( COLLADAFW::MeshVertexData::DATA_TYPE_FLOAT );
-                if ( initialIndex != 0 ) 
+                if ( !positions.empty () ) 
 				{
 					positions.appendValues ( valuesArray );
 				}
@@ -228,12 +240,12 @@ namespace COLLADASaxFWL
                 // Check if there are already some values in the positions list.
                 // If so, we have to store the last index to increment the following indexes.
                 COLLADAFW::MeshVertexData& positions = mMesh->getPositions ();
-                const size_t initialIndex = positions.getValuesCount ();
+                const size_t initialIndex = positions.getValuesCount () + mStreamedValuesCounts[COLLADAFW::IMeshStreamWriter::POSITIONS];
                 sourceBase->setInitialIndex ( initialIndex );
 
                 // Push the new positions into the list of positions.
                 positions.setType ( COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE );
-                if ( initialIndex != 0 ) 
+                if ( !positions.empty () ) 
 				{
 					positions.appendValues ( valuesArray );
 				}
@@ -290,12 +302,12 @@ namespace COLLADASaxFWL
                 // Check if there are already some values in the positions list.
                 // If so, we have to store the last index to increment the following indexes.
                 COLLADAFW::MeshVertexData& normals = mMesh->getNormals ();
-                const size_t initialIndex = normals.getValuesCount ();
+                const size_t initialIndex = normals.getValuesCount () + mStreamedValuesCounts[COLLADAFW::IMeshStreamWriter::NORMALS];
                 sourceBase->setInitialIndex ( initialIndex );
 
                 // Push the new positions into the list of positions.
                 normals.setType ( COLLADAFW::MeshVertexData::DATA_TYPE_FLOAT );
-                if ( initialIndex != 0 ) 
+                if ( !normals.empty () ) 
 				{
 					normals.appendValues ( valuesArray );
 				}
@@ -320,12 +332,12 @@ namespace COLLADASaxFWL
                 // Check if there are already some values in the positions list.
                 // If so, we have to store the last index to increment the following indexes.
                 COLLADAFW::MeshVertexData& normals = mMesh->getNormals ();
-                const size_t initialIndex = normals.getValuesCount ();
+                const size_t initialIndex = normals.getValuesCount () + mStreamedValuesCounts[COLLADAFW::IMeshStreamWriter::NORMALS];
                 sourceBase->setInitialIndex ( initialIndex );
 
                 // Push the new positions into the list of positions.
                 normals.setType ( COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE );
-                if ( initialIndex != 0 ) 
+                if ( !normals.empty () ) 
 				{
 					normals.appendValues ( valuesArray );
 				}
@@ -383,7 +395,7 @@ namespace COLLADASaxFWL
         else
         {
             COLLADAFW::MeshVertexData& colors = mMesh->getColors ();
-            retValue = appendVertexValues ( sourceBase, colors );
+            retValue = appendVertexValues ( sourceBase, colors, COLLADAFW::IMeshStreamWriter::COLORS );
         }
 
         // Set the source base as loaded element.
@@ -395,13 +407,14 @@ namespace COLLADASaxFWL
     //------------------------------
     bool MeshLoader::appendVertexValues ( 
         SourceBase* sourceBase, 
-        COLLADAFW::MeshVertexData &vertexData )
+        COLLADAFW::MeshVertexData &vertexData,
+        COLLADAFW::IMeshStreamWriter::VertexDataType vertexDataType )
     {
         bool retValue = true;
 
         // Check if there are already some values in the positions list.
         // If so, we have to store the last index to increment the following indexes.
-        const size_t initialIndex = vertexData.getValuesCount ();
+        const size_t initialIndex = vertexData.getValuesCount () + mStreamedValuesCounts[vertexDataType];
         sourceBase->setInitialIndex ( initialIndex );
 
         // Get the source input array
@@ -418,6 +431,10 @@ namespace COLLADASaxFWL
                 // Push the values with the infos into the list.
                 vertexData.appendValues ( valuesArray, source->getId (), (size_t) source->getStride () );
 
+                // The copy is released after it has been streamed, release the source values too.
+                if ( mMeshStreamWriter )
+                    valuesArray.clear ();
+
                 break;  
             }
         case SourceBase::DATA_TYPE_DOUBLE:
@@ -430,6 +447,10 @@ namespace COLLADASaxFWL
                 // Push the values with the infos into the list.
                 vertexData.appendValues ( valuesArray, source->getId (), (size_t) source->getStride () );
 
+                // The copy is released after it has been streamed, release the source values too.
+                if ( mMeshStreamWriter )
+                    valuesArray.clear ();
+
                 break;
             }
         default:
@@ -476,7 +497,7 @@ namespace COLLADASaxFWL
         else
         {
             COLLADAFW::MeshVertexData& uvCoords = mMesh->getUVCoords ();
-            retValue = appendVertexValues ( sourceBase, uvCoords );
+            retValue = appendVertexValues ( sourceBase, uvCoords, COLLADAFW::IMeshStreamWriter::UV_COORDINATES );
         }
 
         // Set the source base as loaded element.
@@ -586,6 +607,9 @@ namespace COLLADASaxFWL
 				// Reset the current offset value
 				mCurrentOffset = 0;
 				++mCurrentVertexCount;
+
+				if ( mMeshStreamWriter && !streamCompletedFaces() )
+					return false;
 			}
 			else
 			{
@@ -596,6 +620,133 @@ namespace COLLADASaxFWL
 		return true;
 	}
 
+	//------------------------------
+	bool MeshLoader::streamVertexData()
+	{
+		bool success = streamVertexData( COLLADAFW::IMeshStreamWriter::POSITIONS, mMesh->getPositions() );
+		success = streamVertexData( COLLADAFW::IMeshStreamWriter::NORMALS, mMesh->getNormals() ) && success;
+		success = streamVertexData( COLLADAFW::IMeshStreamWriter::COLORS, mMesh->getColors() ) && success;
+		success = streamVertexData( COLLADAFW::IMeshStreamWriter::UV_COORDINATES, mMesh->getUVCoords() ) && success;
+		return success;
+	}
+
+	//------------------------------
+	bool MeshLoader::streamVertexData( COLLADAFW::IMeshStreamWriter::VertexDataType vertexDataType, COLLADAFW::MeshVertexData& vertexData )
+	{
+		if ( vertexData.empty() )
+			return true;
+
+		bool success = mMeshStreamWriter->appendVertexBlock( vertexDataType, vertexData, mStreamedValuesCounts[vertexDataType] );
+		mStreamedValuesCounts[vertexDataType] += vertexData.getValuesCount();
+		vertexData.clear();
+		return success;
+	}
+
+	//------------------------------
+	bool MeshLoader::streamCompletedFaces()
+	{
+		switch ( mCurrentPrimitiveType )
+		{
+		case TRIANGLES:
+			if ( (mCurrentVertexCount % 3) == 0 )
+				return streamPrimitiveBlock( mCurrentVertexCount / 3, false );
+			break;
+		case LINES:
+			if ( (mCurrentVertexCount % 2) == 0 )
+				return streamPrimitiveBlock( mCurrentVertexCount / 2, false );
+			break;
+		case POLYLIST:
+			{
+				// The vcount element has been read completely, before the p element
+				size_t polygonsCount = mCurrentPolylistVertexCounts.size();
+				size_t faceCountBefore = mCurrentFaceOrLineCount;
+				while ( (mCurrentFaceOrLineCount < polygonsCount) 
+					&& (mCurrentVertexCount >= mCurrentLastPrimitiveVertexCount + mCurrentPolylistVertexCounts[mCurrentFaceOrLineCount]) )
+				{
+					unsigned int faceVertexCount = mCurrentPolylistVertexCounts[mCurrentFaceOrLineCount];
+					COLLADAFW::Polygons* polygons = (COLLADAFW::Polygons*) mCurrentMeshPrimitive;
+					polygons->getGroupedVerticesVertexCountArray().append( (int)faceVertexCount );
+					mCurrentLastPrimitiveVertexCount += faceVertexCount;
+					mCurrentFaceOrLineCount++;
+				}
+				if ( mCurrentFaceOrLineCount != faceCountBefore )
+					return streamPrimitiveBlock( mCurrentFaceOrLineCount, false );
+			}
+			break;
+		default:
+			// The faces of the other primitives are completed in end__p or end__ph
+			break;
+		}
+		return true;
+	}
+
+	//------------------------------
+	bool MeshLoader::streamPrimitiveBlock( size_t faceCount, bool lastBlock )
+	{
+		if ( faceCount <= mStreamedFaceCount )
+			return true;
+		if ( !lastBlock && (mCurrentVertexCount - mStreamedVertexCount < mMeshStreamBlockVertexCount) )
+			return true;
+
+		mCurrentMeshPrimitive->setFaceCount( faceCount - mStreamedFaceCount );
+		bool success = mMeshStreamWriter->appendPrimitiveBlock( mCurrentMeshPrimitive );
+
+		// Keep the memory of the index arrays, the next block will be about the same size
+		mCurrentMeshPrimitive->getPositionIndices().setCount( 0 );
+		mCurrentMeshPrimitive->getNormalIndices().setCount( 0 );
+
+		const COLLADAFW::IndexListArray& colorIndicesArray = mCurrentMeshPrimitive->getColorIndicesArray ();
+		for ( size_t i=0; i<colorIndicesArray.getCount (); ++i )
+			mCurrentMeshPrimitive->getColorIndices(i)->getIndices ().setCount( 0 );
+
+		const COLLADAFW::IndexListArray& uvCoordIndicesArray = mCurrentMeshPrimitive->getUVCoordIndicesArray ();
+		for ( size_t i=0; i<uvCoordIndicesArray.getCount (); ++i )
+			mCurrentMeshPrimitive->getUVCoordIndices(i)->getIndices ().setCount( 0 );
+
+		switch ( mCurrentMeshPrimitive->getPrimitiveType() )
+		{
+		case COLLADAFW::MeshPrimitive::POLYGONS:
+		case COLLADAFW::MeshPrimitive::POLYLIST:
+			((COLLADAFW::Polygons*) mCurrentMeshPrimitive)->getGroupedVerticesVertexCountArray().setCount( 0 );
+			break;
+		case COLLADAFW::MeshPrimitive::TRIANGLE_STRIPS:
+			{
+				COLLADAFW::Tristrips* tristrips = (COLLADAFW::Tristrips*) mCurrentMeshPrimitive;
+				tristrips->getGroupedVerticesVertexCountArray().setCount( 0 );
+				tristrips->setTristripCount( 0 );
+			}
+			break;
+		case COLLADAFW::MeshPrimitive::TRIANGLE_FANS:
+			{
+				COLLADAFW::Trifans* trifans = (COLLADAFW::Trifans*) mCurrentMeshPrimitive;
+				trifans->getGroupedVerticesVertexCountArray().setCount( 0 );
+				trifans->setTrifanCount( 0 );
+			}
+			break;
+		case COLLADAFW::MeshPrimitive::LINE_STRIPS:
+			{
+				COLLADAFW::Linestrips* linestrips = (COLLADAFW::Linestrips*) mCurrentMeshPrimitive;
+				linestrips->getGroupedVerticesVertexCountArray().setCount( 0 );
+				linestrips->setLinestripCount( 0 );
+			}
+			break;
+		default:
+			break;
+		}
+
+		mStreamedVertexCount = mCurrentVertexCount;
+		mStreamedFaceCount = faceCount;
+		return success;
+	}
+
+	//------------------------------
+	bool MeshLoader::endStreamedPrimitive( size_t faceCount )
+	{
+		bool success = streamPrimitiveBlock( faceCount, true );
+		delete mCurrentMeshPrimitive;
+		return success;
+	}
+
 
 	//------------------------------
 	void MeshLoader::initializeOffsets()
@@ -776,6 +927,9 @@ namespace COLLADASaxFWL
 		mCurrentFaceOrLineCount = 0;
 		mCurrentPhHasEmptyP = true;
 		mPOrPhElementCountOfCurrentPrimitive = 0;
+		mStreamedVertexCount = 0;
+		mStreamedFaceCount = 0;
+		mCurrentPolylistVertexCounts.clear();
 	}
 
 	//------------------------------
@@ -840,12 +994,16 @@ namespace COLLADASaxFWL
 	{
 		mCurrentPrimitiveType = TRIANGLES;
 		mCurrentMeshPrimitive = new COLLADAFW::Triangles(createUniqueId(COLLADAFW::Triangles::ID()));
-		if ( (size_t)attributeData.count > 0)
+		size_t indicesCount = (size_t)attributeData.count;
+		// While streaming, only one block is kept
+		if ( mMeshStreamWriter && (indicesCount > mMeshStreamBlockVertexCount) )
+			indicesCount = mMeshStreamBlockVertexCount;
+		if ( indicesCount > 0)
 		{
-			mCurrentMeshPrimitive->getPositionIndices().reallocMemory((size_t)attributeData.count);
+			mCurrentMeshPrimitive->getPositionIndices().reallocMemory(indicesCount);
 			if ( mUseNormals )
 			{
-				mCurrentMeshPrimitive->getNormalIndices().reallocMemory((size_t)attributeData.count);
+				mCurrentMeshPrimitive->getNormalIndices().reallocMemory(indicesCount);
 			}
 			// TODO pre-alloc memory for uv indices
 		}
@@ -860,9 +1018,14 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__triangles()
 	{
+		bool success = true;
 		size_t trianglesCount = mCurrentVertexCount/3;
+		if ( mMeshStreamWriter )
+		{
+			success = endStreamedPrimitive(trianglesCount);
+		}
 		// check if the triangles really contains triangles. If not, we will discard it
-		if ( trianglesCount > 0 )
+		else if ( trianglesCount > 0 )
 		{
 			mCurrentMeshPrimitive->setFaceCount(trianglesCount);
 			mMesh->appendPrimitive(mCurrentMeshPrimitive);
@@ -874,7 +1037,7 @@ namespace COLLADASaxFWL
 		initCurrentValues();
 		mMeshPrimitiveInputs.clearInputs();
 		mCurrentPrimitiveType = NONE;
-		return true;
+		return success;
 	}
 
 
@@ -906,7 +1069,11 @@ namespace COLLADASaxFWL
 	{
 		mCurrentPrimitiveType = POLYLIST;
         COLLADAFW::Polygons* polygons = new COLLADAFW::Polygons(createUniqueId(COLLADAFW::Polygons::ID()));
-		polygons->getGroupedVerticesVertexCountArray().allocMemory((size_t)attributeData.count);
+		// While streaming, the face vertex counts are appended when the faces are completed
+		if ( !mMeshStreamWriter )
+			polygons->getGroupedVerticesVertexCountArray().allocMemory((size_t)attributeData.count);
+		else
+			mCurrentPolylistVertexCounts.reserve((size_t)attributeData.count);
 		mCurrentMeshPrimitive = polygons;
 		if ( attributeData.material )
 		{
@@ -920,9 +1087,14 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__polylist()
 	{
+		bool success = true;
+		if ( mMeshStreamWriter )
+		{
+			success = endStreamedPrimitive(mCurrentFaceOrLineCount);
+		}
 		// check if there are enough vertices as expected by the vcount and that there exist at least
 		// one polygon. If not, we will discard it
-		if ( mCurrentVertexCount >= mCurrentExpectedVertexCount && mCurrentVertexCount > 0 )
+		else if ( mCurrentVertexCount >= mCurrentExpectedVertexCount && mCurrentVertexCount > 0 )
 		{
 			COLLADAFW::Polygons* polygons = (COLLADAFW::Polygons*) mCurrentMeshPrimitive;
 			COLLADAFW::Polygons::VertexCountArray& vertexCountArray = polygons->getGroupedVerticesVertexCountArray();
@@ -937,7 +1109,7 @@ namespace COLLADASaxFWL
 		initCurrentValues();
 		mMeshPrimitiveInputs.clearInputs();
 		mCurrentPrimitiveType = NONE;
-		return true;
+		return success;
 	}
 
 	//------------------------------
@@ -979,9 +1151,14 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__linestrips()
 	{
+		bool success = true;
 		mCurrentPrimitiveType = LINESTRIPS;
+		if ( mMeshStreamWriter )
+		{
+			success = endStreamedPrimitive(mCurrentFaceOrLineCount);
+		}
 		// check if there is at least one linestrip. If not, we will discard it.
-		if ( mCurrentFaceOrLineCount > 0 )
+		else if ( mCurrentFaceOrLineCount > 0 )
 		{
 			mCurrentMeshPrimitive->setFaceCount(mCurrentFaceOrLineCount);
 			mMesh->appendPrimitive(mCurrentMeshPrimitive);
@@ -993,7 +1170,7 @@ namespace COLLADASaxFWL
 		initCurrentValues();
 		mMeshPrimitiveInputs.clearInputs();
 		mCurrentPrimitiveType = NONE;
-		return true;
+		return success;
 	}
 
 	//------------------------------
@@ -1012,6 +1189,16 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::data__vcount( const unsigned long long* data, size_t length )
 	{
+		if ( mMeshStreamWriter )
+		{
+			for ( size_t i = 0; i < length; ++i)
+			{
+				mCurrentPolylistVertexCounts.push_back((unsigned int)data[i]);
+				mCurrentExpectedVertexCount += (size_t)data[i];
+			}
+			return true;
+		}
+
 		COLLADAFW::Polygons* polygons = (COLLADAFW::Polygons*) mCurrentMeshPrimitive;
 		COLLADAFW::Polygons::VertexCountArray& vertexCountArray = polygons->getGroupedVerticesVertexCountArray();
 		size_t count = vertexCountArray.getCount();
@@ -1044,8 +1231,13 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__polygons()
 	{
+		bool success = true;
+		if ( mMeshStreamWriter )
+		{
+			success = endStreamedPrimitive(mCurrentFaceOrLineCount);
+		}
 		// check if there is at least one polygon. If not, we will discard it.
-		if ( mCurrentFaceOrLineCount > 0 )
+		else if ( mCurrentFaceOrLineCount > 0 )
 		{
 			mCurrentMeshPrimitive->setFaceCount(mCurrentFaceOrLineCount);
 			mMesh->appendPrimitive(mCurrentMeshPrimitive);
@@ -1057,7 +1249,7 @@ namespace COLLADASaxFWL
 		initCurrentValues();
 		mMeshPrimitiveInputs.clearInputs();
 		mCurrentPrimitiveType = NONE;
-		return true;
+		return success;
 	}
 
 	//------------------------------
@@ -1073,6 +1265,9 @@ namespace COLLADASaxFWL
 	{
 		mCurrentPrimitiveType = POLYGONS;
 		mPOrPhElementCountOfCurrentPrimitive++;
+		// The holes belong to the polygon, stream only after them
+		if ( mMeshStreamWriter )
+			return streamPrimitiveBlock(mCurrentFaceOrLineCount, false);
 		return true;
 	}
 
@@ -1124,9 +1319,14 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__tristrips()
 	{
+		bool success = true;
 		mCurrentPrimitiveType = TRISTRIPS;
+		if ( mMeshStreamWriter )
+		{
+			success = endStreamedPrimitive(mCurrentFaceOrLineCount);
+		}
 		// check if there is at least one tristrip. If not, we will discard it.
-		if ( mCurrentFaceOrLineCount > 0 )
+		else if ( mCurrentFaceOrLineCount > 0 )
 		{
 			mCurrentMeshPrimitive->setFaceCount(mCurrentFaceOrLineCount);
 			mMesh->appendPrimitive(mCurrentMeshPrimitive);
@@ -1138,7 +1338,7 @@ namespace COLLADASaxFWL
 		initCurrentValues();
 		mMeshPrimitiveInputs.clearInputs();
 		mCurrentPrimitiveType = NONE;
-		return true;
+		return success;
 	}
 
 	//------------------------------
@@ -1160,8 +1360,13 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__trifans()
 	{
+		bool success = true;
+		if ( mMeshStreamWriter )
+		{
+			success = endStreamedPrimitive(mCurrentFaceOrLineCount);
+		}
 		// check if there is at least one trifan. If not, we will discard it.
-		if ( mCurrentFaceOrLineCount > 0 )
+		else if ( mCurrentFaceOrLineCount > 0 )
 		{
 			mCurrentMeshPrimitive->setFaceCount(mCurrentFaceOrLineCount);
 			mMesh->appendPrimitive(mCurrentMeshPrimitive);
@@ -1173,7 +1378,7 @@ namespace COLLADASaxFWL
 		initCurrentValues();
 		mMeshPrimitiveInputs.clearInputs();
 		mCurrentPrimitiveType = NONE;
-		return true;
+		return success;
 	}
 
 	//------------------------------
@@ -1192,12 +1397,16 @@ namespace COLLADASaxFWL
                 loadSourceElements(mMeshPrimitiveInputs);
                 initializeOffsets();
                 mCurrentMeshPrimitive = new COLLADAFW::Lines(createUniqueId(COLLADAFW::Lines::ID()));
-                if ( mCurrentCOLLADAPrimitiveCount > 0)
+                size_t indicesCount = mCurrentCOLLADAPrimitiveCount;
+                // While streaming, only one block is kept
+                if ( mMeshStreamWriter && (indicesCount > mMeshStreamBlockVertexCount) )
+                    indicesCount = mMeshStreamBlockVertexCount;
+                if ( indicesCount > 0)
                 {
-                    mCurrentMeshPrimitive->getPositionIndices().reallocMemory(mCurrentCOLLADAPrimitiveCount);
+                    mCurrentMeshPrimitive->getPositionIndices().reallocMemory(indicesCount);
                     if ( mUseNormals )
                     {
-                        mCurrentMeshPrimitive->getNormalIndices().reallocMemory(mCurrentCOLLADAPrimitiveCount);
+                        mCurrentMeshPrimitive->getNormalIndices().reallocMemory(indicesCount);
                     }
                     // TODO pre-alloc memory for uv indices
                 }
@@ -1254,12 +1463,17 @@ namespace COLLADASaxFWL
 			}
 			break;
 		}
+
+		// Pass the vertex data just loaded, before the primitive refers to it
+		if ( mMeshStreamWriter )
+			return streamVertexData();
 		return true;
 	}
 
 	//------------------------------
 	bool MeshLoader::end__p()
 	{
+		bool success = true;
 		mPOrPhElementCountOfCurrentPrimitive++;
 		switch ( mCurrentPrimitiveType )
 		{
@@ -1271,8 +1485,12 @@ namespace COLLADASaxFWL
         case LINES:
             {
                 size_t linesCount = mCurrentVertexCount/2;
+                if ( mMeshStreamWriter )
+                {
+                    success = endStreamedPrimitive(linesCount);
+                }
                 // check if the lines really contains lines. If not, we will discard it
-                if ( linesCount > 0 )
+                else if ( linesCount > 0 )
                 {
                     mCurrentMeshPrimitive->setFaceCount(linesCount);
                     mMesh->appendPrimitive(mCurrentMeshPrimitive);
@@ -1312,6 +1530,8 @@ namespace COLLADASaxFWL
 					}
 					mCurrentLastPrimitiveVertexCount = mCurrentVertexCount;
 				}
+				if ( mMeshStreamWriter )
+					success = streamPrimitiveBlock(mCurrentFaceOrLineCount, false);
 			}
 			break;
 		case TRISTRIPS:
@@ -1342,6 +1562,8 @@ namespace COLLADASaxFWL
 					}
 					mCurrentLastPrimitiveVertexCount = mCurrentVertexCount;
 				}
+				if ( mMeshStreamWriter )
+					success = streamPrimitiveBlock(mCurrentFaceOrLineCount, false);
 			}
 			break;
 		case LINESTRIPS:
@@ -1372,6 +1594,8 @@ namespace COLLADASaxFWL
 					}
 					mCurrentLastPrimitiveVertexCount = mCurrentVertexCount;
 				}
+				if ( mMeshStreamWriter )
+					success = streamPrimitiveBlock(mCurrentFaceOrLineCount, false);
 			}
 			break;
 		case POLYLIST:
@@ -1390,6 +1614,8 @@ namespace COLLADASaxFWL
 					mCurrentLastPrimitiveVertexCount = mCurrentVertexCount;
 					mCurrentFaceOrLineCount++;
 				}
+				if ( mMeshStreamWriter )
+					success = streamPrimitiveBlock(mCurrentFaceOrLineCount, false);
 			}
 			break;
 		case POLYGONS_HOLE:
@@ -1411,7 +1637,7 @@ namespace COLLADASaxFWL
 			}
 			break;
 		}
-		return true;
+		return success;
 	}
 
 	//------------------------------
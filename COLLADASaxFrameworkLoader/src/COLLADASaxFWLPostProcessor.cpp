@@ -111,11 +111,13 @@ namespace COLLADASaxFWL
 	//-----------------------------
 	void PostProcessor::writeEffects()
 	{
+		// the effects are not needed after post processing. They are handed over to the writer.
 		for ( size_t i = 0, count = mEffects.size(); i < count; ++i)
 		{
 			COLLADAFW::Effect *effect = mEffects[i];
-			writer()->writeEffect(effect);
+			writeObject(effect, true);
 		}
+		mEffects.clear();
 	}
 
 	//-----------------------------
@@ -67,7 +67,8 @@ namespace COLLADASaxFWL
 		{
 			success = writer()->writeScene ( mCurrentScene );
 		}
-        delete mCurrentScene;
+		if ( !retainObject(mCurrentScene) )
+			delete mCurrentScene;
         finish();
         return success;
     }
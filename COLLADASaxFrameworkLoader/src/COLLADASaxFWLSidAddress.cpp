@@ -10,17 +10,65 @@ http://www.opensource.org/licenses/mit-license.php
 
 #include "COLLADASaxFWLStableHeaders.h"
 #include "COLLADASaxFWLSidAddress.h"
-#include "COLLADABUPcreCompiledPattern.h"
-
-#include "pcre.h"
 
 
 namespace COLLADASaxFWL
 {
 
-	const int regExpMatchesVectorLength = 30;    /* should be a multiple of 3 */
 	const char* sidSeparator = "/";
 
+	//------------------------------
+	/** Searches [@a begin, @a end) for a name accessor, as the regular expression "(.+)\.(.+)" does. Returns the 
+	position of the '.' separating the id or sid from the name and sets @a idOrSidBegin and @a nameEnd, or returns 
+	0 if there is no name accessor.*/
+	static const char* findAccessorName( const char* begin, const char* end, const char*& idOrSidBegin, const char*& nameEnd )
+	{
+		// '.' does not match line feeds, so the match has to be within one line
+		while ( begin < end )
+		{
+			const char* lineEnd = begin;
+			while ( (lineEnd < end) && (*lineEnd != '\n') )
+				++lineEnd;
+
+			// the last '.', that is neither the first nor the last character of the line
+			if ( lineEnd - begin > 2 )
+			{
+				for ( const char* separator = lineEnd - 2; separator > begin; --separator )
+				{
+					if ( *separator == '.' )
+					{
+						idOrSidBegin = begin;
+						nameEnd = lineEnd;
+						return separator;
+					}
+				}
+			}
+			begin = lineEnd + 1;
+		}
+		return 0;
+	}
+
+	//------------------------------
+	/** Parses an index accessor "(<number>)" at @a position. Returns true and sets @a indexBegin and @a indexEnd
+	to the number and @a position to the first character after the accessor, if there is one.*/
+	static bool findAccessorIndex( const char*& position, const char* end, const char*& indexBegin, const char*& indexEnd )
+	{
+		if ( (position == end) || (*position != '(') )
+			return false;
+
+		const char* digitsEnd = position + 1;
+		while ( (digitsEnd < end) && (*digitsEnd >= '0') && (*digitsEnd <= '9') )
+			++digitsEnd;
+
+		if ( (digitsEnd == position + 1) || (digitsEnd == end) || (*digitsEnd != ')') )
+			return false;
+
+		indexBegin = position + 1;
+		indexEnd = digitsEnd;
+		position = digitsEnd + 1;
+		return true;
+	}
+
 	//------------------------------
 	SidAddress::SidAddress( )
 		: mMemberSelection(MEMBER_SELECTION_NONE)
@@ -111,138 +159,92 @@ namespace COLLADASaxFWL
 		int secondPartLength = (int)sidAddress.length() - (int)lastSidSeparator - 1;
 
 
-		// regular expression: "(.+)\.(.+)"
-		static const COLLADABU::PcreCompiledPattern accessorNameRegexCompiledPattern("(.+)\\.(.+)");
-		pcre* accessorNameRegex = accessorNameRegexCompiledPattern.getCompiledPattern();
+		const char* secondPartEnd = secondPart + secondPartLength;
 
-		int accessorNameMatches[regExpMatchesVectorLength];
+		// The accessor is parsed as the regular expressions "(.+)\.(.+)" and 
+		// "([^(]+)(?:\(([0-9]+)\))?(?:\(([0-9]+)\))?" did, i.e. both do not need to match the entire second part.
+		const char* idOrSidBegin = 0;
+		const char* nameEnd = 0;
+		const char* nameSeparator = findAccessorName( secondPart, secondPartEnd, idOrSidBegin, nameEnd );
 
-
-		int  accessorNameResult = pcre_exec(
-											accessorNameRegex,			/* the compiled pattern */
-											0,							/* no extra data - we didn't study the pattern */
-											secondPart,					/* the subject string */
-											secondPartLength,			/* the length of the subject */
-											0,							/* start at offset 0 in the subject */
-											0,							/* default options */
-											accessorNameMatches,		/* output vector for substring information */
-											regExpMatchesVectorLength);	/* number of elements in the output vector */
-
-
-		if ( accessorNameResult >= 0 )
+		if ( nameSeparator )
 		{
 			// first try the name accessor
-			// this matches only, if the name accessor is present. Therefor there are exactly two matches 
-			int idOrSidStart = accessorNameMatches[2*1];
-			int idOrSidEnd = accessorNameMatches[2*1+1];
-			COLLADABU_ASSERT( idOrSidStart >= 0 );
-			if ( idOrSidStart >= 0 )
+			if ( hasId )
 			{
-				if ( hasId )
-				{
-					mSids.push_back(String( secondPart + idOrSidStart, idOrSidEnd - idOrSidStart));
-				}
-				else
-				{
-					if ( secondPart[idOrSidStart] != '.' )
-						mId.assign(secondPart + idOrSidStart, idOrSidEnd - idOrSidStart);
-					hasId = true;
-				}
+				mSids.push_back(String( idOrSidBegin, nameSeparator - idOrSidBegin));
 			}
-
-			int& nameStart = accessorNameMatches[2*2];
-			int& nameEnd = accessorNameMatches[2*2+1];
-			COLLADABU_ASSERT(nameStart>=0);
-			if ( nameStart>=0 )
+			else
 			{
-				mMemberSelectionName.assign(secondPart + nameStart, nameEnd - nameStart);
+				if ( *idOrSidBegin != '.' )
+					mId.assign(idOrSidBegin, nameSeparator - idOrSidBegin);
+				hasId = true;
 			}
 
+			mMemberSelectionName.assign(nameSeparator + 1, nameEnd - nameSeparator - 1);
 			mMemberSelection = MEMBER_SELECTION_NAME;
 
 			mIsValid = true;
 		}
 		else 
 		{
-			// regular expression: "([^(]+)(?:\(([0-9]+)\))?(?:\(([0-9]+)\))?"
-			static const COLLADABU::PcreCompiledPattern accessorIndexRegexCompiledPattern("([^(]+)(?:\\(([0-9]+)\\))?(?:\\(([0-9]+)\\))?");
-			pcre* accessorIndexRegex = accessorIndexRegexCompiledPattern.getCompiledPattern();
+			//check all other cases
+			// the id or sid starts at the first character that is not a '('
+			idOrSidBegin = secondPart;
+			while ( (idOrSidBegin < secondPartEnd) && (*idOrSidBegin == '(') )
+				++idOrSidBegin;
 
-			int accessorIndexMatches[regExpMatchesVectorLength];
+			if ( idOrSidBegin == secondPartEnd )
+			{
+				mIsValid = false;
+				return;
+			}
 
-			int  accessorIndexResult = pcre_exec(
-				accessorIndexRegex,			/* the compiled pattern */
-				0,							/* no extra data - we didn't study the pattern */
-				secondPart,					/* the subject string */
-				secondPartLength,			/* the length of the subject */
-				0,							/* start at offset 0 in the subject */
-				0,							/* default options */
-				accessorIndexMatches,		/* output vector for substring information */
-				regExpMatchesVectorLength);
+			const char* idOrSidEnd = idOrSidBegin;
+			while ( (idOrSidEnd < secondPartEnd) && (*idOrSidEnd != '(') )
+				++idOrSidEnd;
 
-			if ( accessorIndexResult >= 0 )
+			if ( hasId )
 			{
-				//check all other cases
-				// the first match is id or sid
-				int& idOrSidStart = accessorIndexMatches[2*1];
-				int& idOrSidEnd = accessorIndexMatches[2*1+1];
-				COLLADABU_ASSERT( idOrSidStart >= 0 );
-
-				if ( idOrSidStart >= 0 )
-				{
-					if ( hasId )
-					{
-						mSids.push_back(String( secondPart + idOrSidStart, idOrSidEnd - idOrSidStart));
-					}
-					else
-					{
-						if ( secondPart[idOrSidStart] != '.' )
-							mId.assign(secondPart + idOrSidStart, idOrSidEnd - idOrSidStart);
-						hasId = true;
-					}
-				}
-				mMemberSelection = MEMBER_SELECTION_NONE;
+				mSids.push_back(String( idOrSidBegin, idOrSidEnd - idOrSidBegin));
+			}
+			else
+			{
+				if ( *idOrSidBegin != '.' )
+					mId.assign(idOrSidBegin, idOrSidEnd - idOrSidBegin);
+				hasId = true;
+			}
+			mMemberSelection = MEMBER_SELECTION_NONE;
 
-				// this one matches only if two indices are specified. In case of one index, only the next matches
-				int& firstIndexStart = accessorIndexMatches[2*2];
-				int& firstIndexEnd = accessorIndexMatches[2*2+1];
-				if ( firstIndexStart >= 0)
+			const char* position = idOrSidEnd;
+			const char* firstIndexBegin = 0;
+			const char* firstIndexEnd = 0;
+			if ( findAccessorIndex( position, secondPartEnd, firstIndexBegin, firstIndexEnd ) )
+			{
+				mMemberSelection = MEMBER_SELECTION_ONE_INDEX;
+				bool failed = false;
+				mFirstIndex = (size_t)GeneratedSaxParser::Utils::toUint32(&firstIndexBegin, firstIndexEnd, failed);
+				if ( failed )
 				{
-					mMemberSelection = MEMBER_SELECTION_ONE_INDEX;
-					bool failed = false;
-					const char* bufferBegin = secondPart + firstIndexStart;
-					mFirstIndex = (size_t)GeneratedSaxParser::Utils::toUint32(&bufferBegin, secondPart + firstIndexEnd, failed);
-					if ( failed )
-					{
-						mIsValid = false;
-						return;
-					}
+					mIsValid = false;
+					return;
 				}
 
-				// this one matches if two indices or only index are specified. 
-				int& secondIndexStart = accessorIndexMatches[2*3];
-				int& secondIndexEnd = accessorIndexMatches[2*3+1];
-				if ( secondIndexStart >= 0)
+				const char* secondIndexBegin = 0;
+				const char* secondIndexEnd = 0;
+				if ( findAccessorIndex( position, secondPartEnd, secondIndexBegin, secondIndexEnd ) )
 				{
-					bool failed = false;
-					const char* bufferBegin = secondPart + secondIndexStart;
-					size_t index = (size_t)GeneratedSaxParser::Utils::toUint32(&bufferBegin, secondPart + secondIndexEnd, failed);
-					
 					mMemberSelection = MEMBER_SELECTION_TWO_INDICES;
-					mSecondIndex = index;
+					mSecondIndex = (size_t)GeneratedSaxParser::Utils::toUint32(&secondIndexBegin, secondIndexEnd, failed);
 					if ( failed )
 					{
 						mIsValid = false;
 						return;
 					}
 				}
+			}
 
-				mIsValid = true;
-			}
-			else
-			{
-				mIsValid = false;
-			}
+			mIsValid = true;
 		}
 
 	}
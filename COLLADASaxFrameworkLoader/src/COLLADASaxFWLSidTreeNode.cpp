@@ -11,33 +11,24 @@
 #include "COLLADASaxFWLStableHeaders.h"
 #include "COLLADASaxFWLSidTreeNode.h"
 
-#include <iostream>
+#include <algorithm>
 
 namespace COLLADASaxFWL
 {
 
 
 	//------------------------------
-	bool SidTreeNode::SidIdentifier::operator<( const SidIdentifier& rhs ) const
+	static bool nodeNumberLess( const SidTreeNode* sidTreeNode, size_t nodeNumber )
 	{
-		if ( sid < rhs.sid)
-			return true;
-
-		if ( sid > rhs.sid)
-			return false;
-
-		if ( hierarchyLevel < rhs.hierarchyLevel)
-			return true;
-
-		if ( hierarchyLevel > rhs.hierarchyLevel)
-			return false;
-
-		return false;
+		return sidTreeNode->getNodeNumber() < nodeNumber;
 	}
 
 	//------------------------------
 	SidTreeNode::SidTreeNode(const String& sid, SidTreeNode *parent)
 		: mParent(parent)
+		, mSidIndex( parent ? parent->mSidIndex : new SidIndex() )
+		, mNodeNumber( mSidIndex->nextNodeNumber++ )
+		, mSidDepth( (parent ? parent->mSidDepth : 0) + (sid.empty() ? 0 : 1) )
 		, mTargetType(TARGETTYPECLASS_UNKNOWN)
 		, mSid(sid)
 	{
@@ -52,60 +43,70 @@ namespace COLLADASaxFWL
 			const SidTreeNode*const& sidTreeNode = mDirectChildren[i];
 			delete sidTreeNode;
 		}
+		if ( !mParent )
+		{
+			delete mSidIndex;
+		}
 	}
 
 	//------------------------------
 	SidTreeNode* SidTreeNode::createAndAddChild( const String& sid )
 	{
+		// the numbering only describes the sub hierarchies, if the new node follows all existing descendants
+		COLLADABU_ASSERT( getLastDescendantNumber() + 1 == mSidIndex->nextNodeNumber );
 		SidTreeNode* newChild = new SidTreeNode(sid, this);
 		mDirectChildren.push_back(newChild);
 		if ( !sid.empty() )
 		{
-			SidIdentifier newIdentifier(newChild->getSid(), 0);
-			mChildren.insert(std::make_pair(newIdentifier, newChild));
-			addChildToParents( newChild, newIdentifier );
+			mSidIndex->sidTreeNodes[sid].push_back(newChild);
 		}
 		return newChild;
 	}
 
 	//------------------------------
-	void SidTreeNode::addChildToParents( SidTreeNode *sidTreeNode, const SidIdentifier& sidIdentifier )
+	size_t SidTreeNode::getLastDescendantNumber() const
 	{
-		if ( sidTreeNode )
+		const SidTreeNode* sidTreeNode = this;
+		while ( !sidTreeNode->mDirectChildren.empty() )
 		{
-			SidTreeNode *parent = getParent();
-			if ( parent )
-			{
-				SidIdentifier parentSidIdentifier = sidIdentifier;
-				// if the parent has no sid, i.e. it has an id, we don't increase the hierarchy level.*/
-				if ( !parent->getSid().empty() )
-				{
-					parentSidIdentifier.hierarchyLevel++;
-				}
-				parent->mChildren.insert(std::make_pair(parentSidIdentifier, sidTreeNode));
-				parent->addChildToParents( sidTreeNode, parentSidIdentifier );
-			}
+			sidTreeNode = sidTreeNode->mDirectChildren.back();
 		}
+		return sidTreeNode->mNodeNumber;
 	}
 
 	//------------------------------
 	SidTreeNode* SidTreeNode::findChildBySid( const String& sid )
 	{
-		SidIdentifier lowerBound( sid, 0);
-		SidIdentifierSidTreeNodeMap::iterator it = mChildren.lower_bound( lowerBound );
+		SidSidTreeNodeListMap::const_iterator it = mSidIndex->sidTreeNodes.find( sid );
 
-		if ( it == mChildren.end() )
+		if ( it == mSidIndex->sidTreeNodes.end() )
 			return 0;
 
-		SidIdentifier canidate = it->first;
-		if ( canidate.sid == sid )
-		{
-			return it->second;
-		}
-		else
+		// the descendants are the nodes with numbers in ]mNodeNumber, lastDescendantNumber]
+		const SidTreeNodeList& sidTreeNodes = it->second;
+		SidTreeNodeList::const_iterator candidateIt = std::lower_bound( sidTreeNodes.begin(), sidTreeNodes.end(), mNodeNumber + 1, nodeNumberLess );
+		size_t lastDescendantNumber = getLastDescendantNumber();
+
+		// the hierarchy level of a candidate is the sid depth above its parent minus the one above this node
+		size_t lowestSidDepth = getSidDepthAbove();
+		SidTreeNode* child = 0;
+		size_t childSidDepth = 0;
+		for ( ; (candidateIt != sidTreeNodes.end()) && ((*candidateIt)->mNodeNumber <= lastDescendantNumber); ++candidateIt )
 		{
-			return 0;
+			SidTreeNode* candidate = *candidateIt;
+			size_t candidateSidDepth = candidate->mParent->getSidDepthAbove();
+			if ( !child || (candidateSidDepth < childSidDepth) )
+			{
+				child = candidate;
+				childSidDepth = candidateSidDepth;
+				if ( childSidDepth == lowestSidDepth )
+				{
+					// a candidate on the lowest possible hierarchy level
+					break;
+				}
+			}
 		}
+		return child;
 	}
 
 } // namespace COLLADASaxFWL
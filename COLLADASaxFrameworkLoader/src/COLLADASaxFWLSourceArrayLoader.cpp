@@ -57,6 +57,7 @@ namespace COLLADASaxFWL
 		for ( size_t i = 0, count = mSourceArray.getCount(); i < count; ++i)
 			delete mSourceArray[i];
 		mSourceArray.setCount(0);
+		mSourceIdSourceMap.clear();
 	}
 
 	//------------------------------
@@ -121,32 +122,38 @@ namespace COLLADASaxFWL
     void SourceArrayLoader::setSourceArray ( const SourceArray& sourceArray )
     {
         mSourceArray = sourceArray;
+
+		mSourceIdSourceMap.clear();
+		for ( size_t i = 0, count = mSourceArray.getCount(); i < count; ++i)
+			mSourceIdSourceMap.insert(std::make_pair(mSourceArray[i]->getId(), mSourceArray[i]));
     }
 
     //------------------------------
     const SourceBase* SourceArrayLoader::getSourceById ( const String& sourceId ) const
     {
-        for ( size_t i=0; i<mSourceArray.getCount (); ++i )
-        {
-            const SourceBase* source = mSourceArray [ i ];
-            if ( COLLADABU::Utils::equals ( source->getId (), sourceId ) )
-                return source;
-        }
-        return 0;
+		SourceIdSourceMap::const_iterator it = mSourceIdSourceMap.find(sourceId);
+		if ( it == mSourceIdSourceMap.end() )
+			return 0;
+		return it->second;
     }
 
     //------------------------------
     SourceBase* SourceArrayLoader::getSourceById ( const String& sourceId ) 
     {
-        for ( size_t i=0; i<mSourceArray.getCount (); ++i )
-        {
-            SourceBase* source = mSourceArray [ i ];
-            if ( COLLADABU::Utils::equals ( source->getId (), sourceId ) )
-                return source;
-        }
-        return 0;
+		SourceIdSourceMap::const_iterator it = mSourceIdSourceMap.find(sourceId);
+		if ( it == mSourceIdSourceMap.end() )
+			return 0;
+		return it->second;
     }
 
+	//------------------------------
+	void SourceArrayLoader::appendSource( SourceBase* source )
+	{
+		mSourceArray.append(source);
+		// insert does not replace a source with the same id, i.e. the first one is found as before
+		mSourceIdSourceMap.insert(std::make_pair(source->getId(), source));
+	}
+
 	//------------------------------
 	bool SourceArrayLoader::beginSource( const source__AttributeData& attributes )
 	{
@@ -161,7 +168,7 @@ namespace COLLADASaxFWL
 	{
 		if ( mCurrentSoure )
 		{
-			mSourceArray.append(mCurrentSoure);
+			appendSource(mCurrentSoure);
 		}
 		mCurrentSoure = 0;
 		mCurrentSourceId.clear();
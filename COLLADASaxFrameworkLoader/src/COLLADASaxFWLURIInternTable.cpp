@@ -0,0 +1,60 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License, 
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLURIInternTable.h"
+
+
+namespace COLLADASaxFWL
+{
+
+	const URIInternTable::Handle URIInternTable::INVALID_HANDLE;
+
+	//------------------------------
+	URIInternTable::URIInternTable()
+	{
+	}
+
+	//------------------------------
+	URIInternTable::~URIInternTable()
+	{
+	}
+
+	//------------------------------
+	URIInternTable::Handle URIInternTable::intern( const COLLADABU::URI& uri, bool& added )
+	{
+		Handle newHandle = mUriStrings.size();
+		std::pair<UriStringHandleMap::iterator, bool> result = mUriStringHandleMap.insert( std::make_pair(uri.getURIString(), newHandle) );
+		added = result.second;
+		if ( added )
+		{
+			// the keys of the hash map are not moved on rehashing
+			mUriStrings.push_back( &result.first->first );
+		}
+		return result.first->second;
+	}
+
+	//------------------------------
+	URIInternTable::Handle URIInternTable::find( const COLLADABU::URI& uri ) const
+	{
+		UriStringHandleMap::const_iterator it = mUriStringHandleMap.find( uri.getURIString() );
+		if ( it == mUriStringHandleMap.end() )
+			return INVALID_HANDLE;
+		return it->second;
+	}
+
+	//------------------------------
+	void URIInternTable::clear()
+	{
+		mUriStringHandleMap.clear();
+		mUriStrings.clear();
+	}
+
+} // namespace COLLADASaxFWL
@@ -15,6 +15,8 @@
 #include "COLLADASaxFWLRootParser15.h"
 
 #include "GeneratedSaxParserUtils.h"
+#include "GeneratedSaxParserMemoryMappedFile.h"
+#include "GeneratedSaxParserElementRangeIndex.h"
 
 namespace COLLADASaxFWL
 {
@@ -160,114 +162,166 @@ namespace COLLADASaxFWL
         return ( (firstFlags & flag) != 0 ) && ( (secondFlags & flag) == 0 );
     }
 
-    //------------------------------
-    template<class FlagsMapPair, class ElementFunctionMap>
-    void createFunctionMap( int flags, int& parsedFlags, ElementFunctionMap& functionMap, FlagsMapPair* flagsMapMap, size_t flagsMapMapSize )
+    struct LibraryNameFlagPair
     {
-        // A combination of ObjectFlags, indicating which objects will have been parsed, after load() 
-        // has been called. These will be contained for sure.
-        // We need this to ensure that objects that are store by the Loader ( visual scene, library nodes, 
-        // effects, cameras, lights) are parsed only once.
-        int afterLoadParsedObjectFlags = parsedFlags | flags;
+        const char* name;
+        LibraryFlags flag;
+    };
 
-        if ( (flags & Loader::ALL_OBJECTS_MASK ) != Loader::ALL_OBJECTS_MASK )
-        {
-            // we need to set a customized function map, since we don't need all COLLADA libraries 
-            //determine which COLLADA elements we need to parse to get all date needed to parse objects in mObjectFlags
-            int requiredFunctionMaps = 0;
+    // The top level elements of the libraries that have a function map in both COLLADA versions. Only 
+    // these can be skipped without changing the behavior of the parser.
+    static const LibraryNameFlagPair libraryNameFlagPairs[] = {{"library_animation_clips", COLLADA_LIBRARY_ANIMATION_CLIPS},
+        {"library_animations", COLLADA_LIBRARY_ANIMATIONS},
+        {"library_cameras", COLLADA_LIBRARY_CAMERAS},
+        {"library_controllers", COLLADA_LIBRARY_CONTROLLERS},
+        {"library_effects", COLLADA_LIBRARY_EFFECTS},
+        {"library_force_fields", COLLADA_LIBRARY_FORCE_FIELDS},
+        {"library_geometries", COLLADA_LIBRARY_GEOMETRIES},
+        {"library_images", COLLADA_LIBRARY_IMAGES},
+        {"library_lights", COLLADA_LIBRARY_LIGHTS},
+        {"library_materials", COLLADA_LIBRARY_MATERIALS},
+        {"library_nodes", COLLADA_LIBRARY_NODES},
+        {"library_physics_materials", COLLADA_LIBRARY_PHYSICS_MATERIALS},
+        {"library_physics_models", COLLADA_LIBRARY_PHYSICS_MODELS},
+        {"library_physics_scenes", COLLADA_LIBRARY_PHYSICS_SCENES},
+        {"library_visual_scenes", COLLADA_LIBRARY_VISUAL_SCENES}};
+
+    static const size_t libraryNameFlagPairsSize = sizeof(libraryNameFlagPairs)/sizeof(LibraryNameFlagPair);
 
-            if ( (flags & Loader::ASSET_FLAG) != 0 )
+    //------------------------------
+    static LibraryFlags getLibraryFlag( const String& elementName )
+    {
+        for ( size_t i = 0; i < libraryNameFlagPairsSize; ++i )
+        {
+            if ( elementName == libraryNameFlagPairs[i].name )
             {
-                requiredFunctionMaps|= COLLADA_ASSET;
+                return libraryNameFlagPairs[i].flag;
             }
+        }
+        return COLLADA_NO_FLAGS;
+    }
 
-            if ( (flags & Loader::SCENE_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_SCENE;
-            }
+    //------------------------------
+    static bool isPartialLoad( int flags )
+    {
+        return (flags & Loader::ALL_OBJECTS_MASK ) != Loader::ALL_OBJECTS_MASK;
+    }
 
-            if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::VISUAL_SCENES_FLAG) )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+    //------------------------------
+    static int determineRequiredLibraries( int flags, int parsedFlags, int& afterLoadParsedObjectFlags )
+    {
+        //determine which COLLADA elements we need to parse to get all date needed to parse objects in mObjectFlags
+        int requiredFunctionMaps = 0;
 
-            if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::LIBRARY_NODES_FLAG) )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( (flags & Loader::ASSET_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_ASSET;
+        }
 
-            if ( (flags & Loader::GEOMETRY_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_GEOMETRIES;
-            }
+        if ( (flags & Loader::SCENE_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_SCENE;
+        }
 
-            if ( (flags & Loader::MATERIAL_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_MATERIALS;
-            }
+        if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::VISUAL_SCENES_FLAG) )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
+            requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::EFFECT_FLAG) )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_EFFECTS;
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::LIBRARY_NODES_FLAG) )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
+            requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( (flags & Loader::CAMERA_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_CAMERAS;
-                //requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( (flags & Loader::GEOMETRY_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_GEOMETRIES;
+        }
 
-            if ( (flags & Loader::IMAGE_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_IMAGES;
-            }
+        if ( (flags & Loader::MATERIAL_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_MATERIALS;
+        }
 
-            if ( (flags & Loader::LIGHT_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_LIGHTS;
-            }
+        if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::EFFECT_FLAG) )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_EFFECTS;
+            requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( (flags & Loader::ANIMATION_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( (flags & Loader::CAMERA_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_CAMERAS;
+            //requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( (flags & Loader::ANIMATION_LIST_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+        if ( (flags & Loader::IMAGE_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_IMAGES;
+        }
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
-                afterLoadParsedObjectFlags |= Loader::VISUAL_SCENES_FLAG;
+        if ( (flags & Loader::LIGHT_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_LIGHTS;
+        }
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
-                afterLoadParsedObjectFlags |= Loader::LIBRARY_NODES_FLAG;
+        if ( (flags & Loader::ANIMATION_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_EFFECTS;
-                afterLoadParsedObjectFlags |= Loader::EFFECT_FLAG;
+        if ( (flags & Loader::ANIMATION_LIST_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
 
-                //requiredFunctionMaps|= COLLADA_LIBRARY_CAMERAS;
-                //requiredFunctionMaps|= COLLADA_LIBRARY_LIGHTS;
-            }
+            requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
+            afterLoadParsedObjectFlags |= Loader::VISUAL_SCENES_FLAG;
 
-            if ( (flags & Loader::CONTROLLER_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_CONTROLLERS;
+            requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
+            afterLoadParsedObjectFlags |= Loader::LIBRARY_NODES_FLAG;
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
-                afterLoadParsedObjectFlags |= Loader::VISUAL_SCENES_FLAG;
+            requiredFunctionMaps|= COLLADA_LIBRARY_EFFECTS;
+            afterLoadParsedObjectFlags |= Loader::EFFECT_FLAG;
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
-                afterLoadParsedObjectFlags |= Loader::LIBRARY_NODES_FLAG;
-            }
+            //requiredFunctionMaps|= COLLADA_LIBRARY_CAMERAS;
+            //requiredFunctionMaps|= COLLADA_LIBRARY_LIGHTS;
+        }
 
-            if ( (flags & Loader::SKIN_CONTROLLER_DATA_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_CONTROLLERS;
-            }
+        if ( (flags & Loader::CONTROLLER_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_CONTROLLERS;
+
+            requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
+            afterLoadParsedObjectFlags |= Loader::VISUAL_SCENES_FLAG;
+
+            requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
+            afterLoadParsedObjectFlags |= Loader::LIBRARY_NODES_FLAG;
+        }
+
+        if ( (flags & Loader::SKIN_CONTROLLER_DATA_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_CONTROLLERS;
+        }
+
+        return requiredFunctionMaps;
+    }
+
+    //------------------------------
+    template<class FlagsMapPair, class ElementFunctionMap>
+    void createFunctionMap( int flags, int& parsedFlags, ElementFunctionMap& functionMap, FlagsMapPair* flagsMapMap, size_t flagsMapMapSize )
+    {
+        // A combination of ObjectFlags, indicating which objects will have been parsed, after load() 
+        // has been called. These will be contained for sure.
+        // We need this to ensure that objects that are store by the Loader ( visual scene, library nodes, 
+        // effects, cameras, lights) are parsed only once.
+        int afterLoadParsedObjectFlags = parsedFlags | flags;
 
+        if ( isPartialLoad(flags) )
+        {
+            // we need to set a customized function map, since we don't need all COLLADA libraries 
+            int requiredFunctionMaps = determineRequiredLibraries( flags, parsedFlags, afterLoadParsedObjectFlags );
 
             // Fills function map
             for ( size_t i = 0; i < flagsMapMapSize; ++i )
@@ -326,7 +380,29 @@ namespace COLLADASaxFWL
 #elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
         GeneratedSaxParser::ExpatSaxParser versionSaxParser( this, XMLPARSER_BUFFERSIZE );
 #endif
-        bool success = versionSaxParser.parseFile( fileName );
+        const Loader* loader = mFileLoader->getColladaLoader();
+        bool success = false;
+        if ( loader->getSkipExcludedLibraries() && isPartialLoad(mFlags) )
+        {
+            GeneratedSaxParser::MemoryMappedFile mappedFile;
+            if ( mappedFile.open(fileName) )
+            {
+                mappedFile.adviseSequential();
+                success = parseWithoutExcludedLibraries( versionSaxParser, fileName, mappedFile.getData(), mappedFile.getSize() );
+            }
+            else
+            {
+                success = versionSaxParser.parseFile( fileName );
+            }
+        }
+        else if ( loader->getUseMemoryMappedFiles() )
+        {
+            success = versionSaxParser.parseMappedFile( fileName );
+        }
+        else
+        {
+            success = versionSaxParser.parseFile( fileName );
+        }
 
  //       mFileLoader->postProcess();
 
@@ -350,7 +426,15 @@ namespace COLLADASaxFWL
 #elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
         GeneratedSaxParser::ExpatSaxParser versionSaxParser( this, XMLPARSER_BUFFERSIZE );
 #endif
-        bool success = versionSaxParser.parseBuffer( uriString, buffer, length );
+        bool success = false;
+        if ( mFileLoader->getColladaLoader()->getSkipExcludedLibraries() && isPartialLoad(mFlags) )
+        {
+            success = parseWithoutExcludedLibraries( versionSaxParser, uriString, buffer, (size_t)length );
+        }
+        else
+        {
+            success = versionSaxParser.parseBuffer( uriString, buffer, length );
+        }
         
         //       mFileLoader->postProcess();
         
@@ -363,6 +447,38 @@ namespace COLLADASaxFWL
         return success;
     }
     
+    //------------------------------
+    bool VersionParser::parseWithoutExcludedLibraries( GeneratedSaxParser::SaxParser& saxParser, const char* uri, const char* buffer, size_t length )
+    {
+        int afterLoadParsedObjectFlags = mParsedFlags | mFlags;
+        int requiredLibraries = determineRequiredLibraries( mFlags, mParsedFlags, afterLoadParsedObjectFlags );
+
+        // Each excluded library splits the document. If the document cannot be scanned, it is parsed as 
+        // a whole and the parser reports the errors.
+        std::vector<GeneratedSaxParser::BufferSegment> segments;
+        size_t segmentBegin = 0;
+        GeneratedSaxParser::ElementRangeIndex elementRangeIndex;
+        if ( elementRangeIndex.scan( buffer, length ) )
+        {
+            const GeneratedSaxParser::ElementRangeIndex::ElementRangeList& elementRanges = elementRangeIndex.getElementRanges();
+            for ( size_t i = 0, count = elementRanges.size(); i < count; ++i )
+            {
+                const GeneratedSaxParser::ElementRangeIndex::ElementRange& elementRange = elementRanges[i];
+                LibraryFlags libraryFlag = getLibraryFlag( elementRange.name );
+                if ( (libraryFlag == COLLADA_NO_FLAGS) || ((requiredLibraries & libraryFlag) != 0) )
+                    continue;
+
+                GeneratedSaxParser::BufferSegment segment = { buffer + segmentBegin, elementRange.begin - segmentBegin };
+                segments.push_back( segment );
+                segmentBegin = elementRange.end;
+            }
+        }
+        GeneratedSaxParser::BufferSegment lastSegment = { buffer + segmentBegin, length - segmentBegin };
+        segments.push_back( lastSegment );
+
+        return saxParser.parseBufferSegments( uri, &segments[0], segments.size() );
+    }
+
     //------------------------------
     bool VersionParser::elementBegin( const ParserChar* elementName, const ParserAttributes& attributes )
     {
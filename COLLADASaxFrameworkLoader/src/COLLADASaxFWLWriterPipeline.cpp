@@ -0,0 +1,428 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLWriterPipeline.h"
+
+#include "COLLADAFWObject.h"
+#include "COLLADAFWGeometry.h"
+#include "COLLADAFWMaterial.h"
+#include "COLLADAFWEffect.h"
+#include "COLLADAFWImage.h"
+#include "COLLADAFWAnimation.h"
+#include "COLLADAFWSkinControllerData.h"
+
+#if defined(COLLADABU_OS_WIN)
+#	include <windows.h>
+#	include <process.h>
+#else
+#	include <pthread.h>
+#endif
+
+
+namespace COLLADASaxFWL
+{
+
+#if defined(COLLADABU_OS_WIN)
+
+	struct WriterPipeline::ThreadData
+	{
+		HANDLE thread;
+		CRITICAL_SECTION mutex;
+		/** Signaled, when a job has been queued or the thread should stop.*/
+		CONDITION_VARIABLE jobQueued;
+		/** Signaled, when a job has been taken out of the queue or has been written.*/
+		CONDITION_VARIABLE jobDone;
+
+		ThreadData()
+			: thread(0)
+		{
+			InitializeCriticalSection(&mutex);
+			InitializeConditionVariable(&jobQueued);
+			InitializeConditionVariable(&jobDone);
+		}
+
+		~ThreadData() { DeleteCriticalSection(&mutex); }
+
+		void lock() { EnterCriticalSection(&mutex); }
+		void unlock() { LeaveCriticalSection(&mutex); }
+		void waitForJobQueued() { SleepConditionVariableCS(&jobQueued, &mutex, INFINITE); }
+		void waitForJobDone() { SleepConditionVariableCS(&jobDone, &mutex, INFINITE); }
+		void signalJobQueued() { WakeConditionVariable(&jobQueued); }
+		void signalJobDone() { WakeAllConditionVariable(&jobDone); }
+
+		static unsigned __stdcall threadMain( void* pipeline )
+		{
+			((WriterPipeline*)pipeline)->run();
+			return 0;
+		}
+
+		bool start( WriterPipeline* pipeline )
+		{
+			thread = (HANDLE)_beginthreadex(0, 0, threadMain, pipeline, 0, 0);
+			return thread != 0;
+		}
+
+		void join()
+		{
+			WaitForSingleObject(thread, INFINITE);
+			CloseHandle(thread);
+		}
+	};
+
+#else
+
+	struct WriterPipeline::ThreadData
+	{
+		pthread_t thread;
+		pthread_mutex_t mutex;
+		/** Signaled, when a job has been queued or the thread should stop.*/
+		pthread_cond_t jobQueued;
+		/** Signaled, when a job has been taken out of the queue or has been written.*/
+		pthread_cond_t jobDone;
+
+		ThreadData()
+		{
+			pthread_mutex_init(&mutex, 0);
+			pthread_cond_init(&jobQueued, 0);
+			pthread_cond_init(&jobDone, 0);
+		}
+
+		~ThreadData()
+		{
+			pthread_cond_destroy(&jobDone);
+			pthread_cond_destroy(&jobQueued);
+			pthread_mutex_destroy(&mutex);
+		}
+
+		void lock() { pthread_mutex_lock(&mutex); }
+		void unlock() { pthread_mutex_unlock(&mutex); }
+		void waitForJobQueued() { pthread_cond_wait(&jobQueued, &mutex); }
+		void waitForJobDone() { pthread_cond_wait(&jobDone, &mutex); }
+		void signalJobQueued() { pthread_cond_signal(&jobQueued); }
+		void signalJobDone() { pthread_cond_broadcast(&jobDone); }
+
+		static void* threadMain( void* pipeline )
+		{
+			((WriterPipeline*)pipeline)->run();
+			return 0;
+		}
+
+		bool start( WriterPipeline* pipeline )
+		{
+			return pthread_create(&thread, 0, threadMain, pipeline) == 0;
+		}
+
+		void join()
+		{
+			pthread_join(thread, 0);
+		}
+	};
+
+#endif
+
+    //------------------------------
+	WriterPipeline::WriterPipeline( COLLADAFW::IWriter* writer, size_t queueSize )
+		: mWriter(writer)
+		, mQueueSize( queueSize ? queueSize : 1 )
+		, mWriting(false)
+		, mFailed(false)
+		, mStop(false)
+		, mThreadData( new ThreadData() )
+	{
+		// the thread uses mThreadData, it must therefore be set before the thread is started
+		if ( !mThreadData->start(this) )
+		{
+			delete mThreadData;
+			mThreadData = 0;
+		}
+	}
+
+    //------------------------------
+	WriterPipeline::~WriterPipeline()
+	{
+		if ( !mThreadData )
+			return;
+
+		mThreadData->lock();
+		mStop = true;
+		mThreadData->signalJobQueued();
+		mThreadData->unlock();
+
+		mThreadData->join();
+		delete mThreadData;
+
+		// the thread writes all remaining jobs before it stops
+		COLLADABU_ASSERT( mJobs.empty() );
+	}
+
+	//------------------------------
+	void WriterPipeline::run()
+	{
+		mThreadData->lock();
+		for ( ;; )
+		{
+			while ( mJobs.empty() && !mStop )
+				mThreadData->waitForJobQueued();
+
+			if ( mJobs.empty() )
+				break;
+
+			Job job = mJobs.front();
+			mJobs.pop_front();
+			mWriting = true;
+			bool failed = mFailed;
+			mThreadData->signalJobDone();
+			mThreadData->unlock();
+
+			// the objects queued after a failed one are discarded, as the parser stops at the failure
+			bool success = true;
+			if ( failed )
+			{
+				if ( job.deleteAfterWrite )
+					FW_DELETE job.object;
+			}
+			else if ( job.deleteAfterWrite )
+			{
+				success = adopt(mWriter, job.object);
+			}
+			else
+			{
+				success = write(mWriter, job.object);
+			}
+
+			mThreadData->lock();
+			if ( !success )
+				mFailed = true;
+			mWriting = false;
+			mThreadData->signalJobDone();
+		}
+		mThreadData->unlock();
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeObject( COLLADAFW::Object* object, bool deleteAfterWrite )
+	{
+		Job job;
+		job.object = object;
+		job.deleteAfterWrite = deleteAfterWrite;
+
+		mThreadData->lock();
+		while ( (mJobs.size() >= mQueueSize) && !mFailed )
+			mThreadData->waitForJobDone();
+
+		if ( mFailed )
+		{
+			// report the failure, the parser stops now
+			mJobs.push_back(job);
+			discardJobs();
+			mFailed = false;
+			mThreadData->unlock();
+			return false;
+		}
+
+		mJobs.push_back(job);
+		mThreadData->signalJobQueued();
+		mThreadData->unlock();
+		return true;
+	}
+
+	//------------------------------
+	bool WriterPipeline::flush()
+	{
+		mThreadData->lock();
+		while ( !mJobs.empty() || mWriting )
+			mThreadData->waitForJobDone();
+		bool success = !mFailed;
+		mFailed = false;
+		mThreadData->unlock();
+		return success;
+	}
+
+	//------------------------------
+	void WriterPipeline::discardJobs()
+	{
+		for ( JobQueue::const_iterator it = mJobs.begin(); it != mJobs.end(); ++it )
+		{
+			if ( it->deleteAfterWrite )
+				FW_DELETE it->object;
+		}
+		mJobs.clear();
+	}
+
+	//------------------------------
+	bool WriterPipeline::write( COLLADAFW::IWriter* writer, const COLLADAFW::Object* object )
+	{
+		switch ( object->getClassId() )
+		{
+		case COLLADAFW::COLLADA_TYPE::GEOMETRY:
+			return writer->writeGeometry( COLLADAFW::objectSafeCast<COLLADAFW::Geometry>(object) );
+		case COLLADAFW::COLLADA_TYPE::MATERIAL:
+			return writer->writeMaterial( COLLADAFW::objectSafeCast<COLLADAFW::Material>(object) );
+		case COLLADAFW::COLLADA_TYPE::EFFECT:
+			return writer->writeEffect( COLLADAFW::objectSafeCast<COLLADAFW::Effect>(object) );
+		case COLLADAFW::COLLADA_TYPE::IMAGE:
+			return writer->writeImage( COLLADAFW::objectSafeCast<COLLADAFW::Image>(object) );
+		case COLLADAFW::COLLADA_TYPE::ANIMATION:
+			return writer->writeAnimation( COLLADAFW::objectSafeCast<COLLADAFW::Animation>(object) );
+		case COLLADAFW::COLLADA_TYPE::SKIN_DATA:
+			return writer->writeSkinControllerData( COLLADAFW::objectSafeCast<COLLADAFW::SkinControllerData>(object) );
+		default:
+			COLLADABU_ASSERT( false );
+			return false;
+		}
+	}
+
+	//------------------------------
+	bool WriterPipeline::adopt( COLLADAFW::IWriter* writer, COLLADAFW::Object* object )
+	{
+		switch ( object->getClassId() )
+		{
+		case COLLADAFW::COLLADA_TYPE::GEOMETRY:
+			return writer->adoptGeometry( COLLADAFW::objectSafeCast<COLLADAFW::Geometry>(object) );
+		case COLLADAFW::COLLADA_TYPE::MATERIAL:
+			return writer->adoptMaterial( COLLADAFW::objectSafeCast<COLLADAFW::Material>(object) );
+		case COLLADAFW::COLLADA_TYPE::EFFECT:
+			return writer->adoptEffect( COLLADAFW::objectSafeCast<COLLADAFW::Effect>(object) );
+		case COLLADAFW::COLLADA_TYPE::IMAGE:
+			return writer->adoptImage( COLLADAFW::objectSafeCast<COLLADAFW::Image>(object) );
+		case COLLADAFW::COLLADA_TYPE::ANIMATION:
+			return writer->adoptAnimation( COLLADAFW::objectSafeCast<COLLADAFW::Animation>(object) );
+		case COLLADAFW::COLLADA_TYPE::SKIN_DATA:
+			return writer->adoptSkinControllerData( COLLADAFW::objectSafeCast<COLLADAFW::SkinControllerData>(object) );
+		default:
+			COLLADABU_ASSERT( false );
+			FW_DELETE object;
+			return false;
+		}
+	}
+
+	//------------------------------
+	void WriterPipeline::cancel( const String& errorMessage )
+	{
+		mThreadData->lock();
+		discardJobs();
+		while ( mWriting )
+			mThreadData->waitForJobDone();
+		mThreadData->unlock();
+		mWriter->cancel(errorMessage);
+	}
+
+	//------------------------------
+	void WriterPipeline::start()
+	{
+		flush();
+		mWriter->start();
+	}
+
+	//------------------------------
+	void WriterPipeline::finish()
+	{
+		flush();
+		mWriter->finish();
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeGlobalAsset( const COLLADAFW::FileInfo* asset )
+	{
+		return flush() && mWriter->writeGlobalAsset(asset);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeScene( const COLLADAFW::Scene* scene )
+	{
+		return flush() && mWriter->writeScene(scene);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeVisualScene( const COLLADAFW::VisualScene* visualScene )
+	{
+		return flush() && mWriter->writeVisualScene(visualScene);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes )
+	{
+		return flush() && mWriter->writeLibraryNodes(libraryNodes);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeGeometry( const COLLADAFW::Geometry* geometry )
+	{
+		return flush() && mWriter->writeGeometry(geometry);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeMaterial( const COLLADAFW::Material* material )
+	{
+		return flush() && mWriter->writeMaterial(material);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeEffect( const COLLADAFW::Effect* effect )
+	{
+		return flush() && mWriter->writeEffect(effect);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeCamera( const COLLADAFW::Camera* camera )
+	{
+		return flush() && mWriter->writeCamera(camera);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeImage( const COLLADAFW::Image* image )
+	{
+		return flush() && mWriter->writeImage(image);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeLight( const COLLADAFW::Light* light )
+	{
+		return flush() && mWriter->writeLight(light);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeAnimation( const COLLADAFW::Animation* animation )
+	{
+		return flush() && mWriter->writeAnimation(animation);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeAnimationList( const COLLADAFW::AnimationList* animationList )
+	{
+		return flush() && mWriter->writeAnimationList(animationList);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData )
+	{
+		return flush() && mWriter->writeSkinControllerData(skinControllerData);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeController( const COLLADAFW::Controller* controller )
+	{
+		return flush() && mWriter->writeController(controller);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeFormulas( const COLLADAFW::Formulas* formulas )
+	{
+		return flush() && mWriter->writeFormulas(formulas);
+	}
+
+	//------------------------------
+	bool WriterPipeline::writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene )
+	{
+		return flush() && mWriter->writeKinematicsScene(kinematicsScene);
+	}
+
+} // namespace COLLADASaxFWL
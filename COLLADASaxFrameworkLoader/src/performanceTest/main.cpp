@@ -0,0 +1,28 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "performanceTest.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+int main( int argc, char** argv )
+{
+	if ( (argc > 3) || ((argc > 1) && (atof(argv[1]) <= 0)) )
+	{
+		printf("Usage: %s [scale [outputDirectory]]\n", argv[0]);
+		return 1;
+	}
+
+	double scale = (argc > 1) ? atof(argv[1]) : 1.0;
+	const char* outputDirectory = (argc > 2) ? argv[2] : 0;
+	return performanceTest(scale, outputDirectory) ? 0 : 1;
+}
@@ -0,0 +1,534 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "performanceTest.h"
+
+#include "COLLADASaxFWLLoader.h"
+#include "COLLADASaxFWLIErrorHandler.h"
+#include "COLLADASaxFWLIError.h"
+
+#include "COLLADAFWIWriter.h"
+
+#include "COLLADABUIDList.h"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include <sys/types.h>
+#include <sys/timeb.h>
+
+#ifndef WIN32
+#	include <sys/resource.h>
+#endif
+
+
+#if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
+static const char* XML_PARSER_NAME = "libxml";
+#elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
+static const char* XML_PARSER_NAME = "expat";
+#else
+static const char* XML_PARSER_NAME = "unknown xml parser";
+#endif
+
+
+/** Number of meshes in the geometries document, at scale 1.*/
+static const size_t MESH_COUNT = 100;
+
+/** Number of vertices of each mesh.*/
+static const size_t MESH_VERTEX_COUNT = 5000;
+
+/** Number of chains of nested nodes in the visual scenes document, at scale 1.*/
+static const size_t NODE_CHAIN_COUNT = 250;
+
+/** Number of nodes in each chain. Each node has a sid, so the chains are deep sid hierarchies. libxml
+refuses documents nested deeper than 256 elements.*/
+static const size_t NODE_CHAIN_DEPTH = 200;
+
+/** Number of animations in the animations document, at scale 1. Each has three sources, i.e. the
+animation library has 10k sources.*/
+static const size_t ANIMATION_COUNT = 3334;
+
+/** Number of keys of each animation.*/
+static const size_t ANIMATION_KEY_COUNT = 100;
+
+/** Number of skin controllers in the controllers document, at scale 1.*/
+static const size_t SKIN_COUNT = 100;
+
+/** Number of joints of each skin controller.*/
+static const size_t SKIN_JOINT_COUNT = 50;
+
+/** Number of vertices of the skinned mesh.*/
+static const size_t SKIN_VERTEX_COUNT = 2000;
+
+/** Number of joints influencing each vertex of the skinned mesh.*/
+static const size_t SKIN_INFLUENCE_COUNT = 4;
+
+/** Number of identical ids added to an IDList, at scale 1.*/
+static const size_t COLLIDING_ID_COUNT = 100000;
+
+
+/** Writer that ignores all objects, so that only the loading is measured.*/
+class NullWriter : public COLLADAFW::IWriter
+{
+public:
+	virtual void cancel( const COLLADAFW::String& errorMessage ) {}
+	virtual void start() {}
+	virtual void finish() {}
+	virtual bool writeGlobalAsset( const COLLADAFW::FileInfo* asset ) { return true; }
+	virtual bool writeScene( const COLLADAFW::Scene* scene ) { return true; }
+	virtual bool writeVisualScene( const COLLADAFW::VisualScene* visualScene ) { return true; }
+	virtual bool writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes ) { return true; }
+	virtual bool writeGeometry( const COLLADAFW::Geometry* geometry ) { return true; }
+	virtual bool writeMaterial( const COLLADAFW::Material* material ) { return true; }
+	virtual bool writeEffect( const COLLADAFW::Effect* effect ) { return true; }
+	virtual bool writeCamera( const COLLADAFW::Camera* camera ) { return true; }
+	virtual bool writeImage( const COLLADAFW::Image* image ) { return true; }
+	virtual bool writeLight( const COLLADAFW::Light* light ) { return true; }
+	virtual bool writeAnimation( const COLLADAFW::Animation* animation ) { return true; }
+	virtual bool writeAnimationList( const COLLADAFW::AnimationList* animationList ) { return true; }
+	virtual bool writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData ) { return true; }
+	virtual bool writeController( const COLLADAFW::Controller* controller ) { return true; }
+	virtual bool writeFormulas( const COLLADAFW::Formulas* formulas ) { return true; }
+	virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene ) { return true; }
+};
+
+
+/** Prints the first errors of a load and counts all of them.*/
+class ErrorHandler : public COLLADASaxFWL::IErrorHandler
+{
+private:
+	size_t mErrorCount;
+
+public:
+	ErrorHandler() : mErrorCount(0) {}
+
+	virtual bool handleError( const COLLADASaxFWL::IError* error )
+	{
+		if ( mErrorCount++ < 10 )
+			printf("  %s\n", error->getFullErrorMessage().c_str());
+		return false;
+	}
+
+	size_t getErrorCount() const { return mErrorCount; }
+};
+
+
+//--------------------------------------------------------------------
+/** Appends the printf like formatted @a format to @a text.*/
+static void appendFormatted( std::string& text, const char* format, ... )
+{
+	char buffer[512];
+	va_list arguments;
+	va_start(arguments, format);
+	int length = vsnprintf(buffer, sizeof(buffer), format, arguments);
+	va_end(arguments);
+	if ( length >= (int)sizeof(buffer) )
+		length = (int)sizeof(buffer) - 1;
+	if ( length > 0 )
+		text.append(buffer, length);
+}
+
+//--------------------------------------------------------------------
+/** Values of the positions, normals, outputs and matrices.*/
+static double wave( size_t index )
+{
+	return sin(index * 0.37) * 100;
+}
+
+//--------------------------------------------------------------------
+/** Values of the animation inputs, 30 keys per second.*/
+static double keyTime( size_t index )
+{
+	return index / 30.0;
+}
+
+//--------------------------------------------------------------------
+/** Values of the skin weights.*/
+static double skinWeight( size_t index )
+{
+	return 1.0 / SKIN_INFLUENCE_COUNT;
+}
+
+//--------------------------------------------------------------------
+/** Appends an accessor of @a count elements with the given parameters to @a text.*/
+static void appendAccessor( std::string& text, const std::string& arrayId, size_t count, size_t stride,
+							const char* const* parameterNames, size_t parameterCount, const char* parameterType )
+{
+	appendFormatted(text, "<technique_common><accessor source=\"#%s\" count=\"%u\" stride=\"%u\">",
+		arrayId.c_str(), (unsigned int)count, (unsigned int)stride);
+	for ( size_t i = 0; i < parameterCount; ++i )
+		appendFormatted(text, "<param name=\"%s\" type=\"%s\"/>", parameterNames[i], parameterType);
+	text += "</accessor></technique_common>";
+}
+
+//--------------------------------------------------------------------
+/** Appends a source with a float_array of @a count elements with @a stride values each to @a text. The
+values are returned by @a value for their index in the array.*/
+static void appendFloatSource( std::string& text, const std::string& id, size_t count, size_t stride,
+							   const char* const* parameterNames, size_t parameterCount, const char* parameterType,
+							   double (*value)( size_t index ) )
+{
+	std::string arrayId = id + "-array";
+	size_t valueCount = count * stride;
+	appendFormatted(text, "<source id=\"%s\"><float_array id=\"%s\" count=\"%u\">", id.c_str(), arrayId.c_str(), (unsigned int)valueCount);
+	for ( size_t i = 0; i < valueCount; ++i )
+		appendFormatted(text, (i == 0) ? "%g" : " %g", value(i));
+	text += "</float_array>";
+	appendAccessor(text, arrayId, count, stride, parameterNames, parameterCount, parameterType);
+	text += "</source>\n";
+}
+
+//--------------------------------------------------------------------
+/** Appends a source with a Name_array of @a count names to @a text. The names are formatted with
+@a nameFormat and their index.*/
+static void appendNameSource( std::string& text, const std::string& id, size_t count, const char* nameFormat,
+							  const char* parameterName )
+{
+	std::string arrayId = id + "-array";
+	appendFormatted(text, "<source id=\"%s\"><Name_array id=\"%s\" count=\"%u\">", id.c_str(), arrayId.c_str(), (unsigned int)count);
+	for ( size_t i = 0; i < count; ++i )
+	{
+		if ( i != 0 )
+			text += ' ';
+		appendFormatted(text, nameFormat, (unsigned int)i);
+	}
+	text += "</Name_array>";
+	appendAccessor(text, arrayId, count, 1, &parameterName, 1, "name");
+	text += "</source>\n";
+}
+
+//--------------------------------------------------------------------
+/** Appends a geometry with a mesh of @a vertexCount vertices and a strip of triangles to @a text.*/
+static void appendMesh( std::string& text, const std::string& id, size_t vertexCount )
+{
+	static const char* const XYZ[] = { "X", "Y", "Z" };
+
+	appendFormatted(text, "<geometry id=\"%s\"><mesh>\n", id.c_str());
+	appendFloatSource(text, id + "-positions", vertexCount, 3, XYZ, 3, "float", &wave);
+	appendFloatSource(text, id + "-normals", vertexCount, 3, XYZ, 3, "float", &wave);
+	appendFormatted(text, "<vertices id=\"%s-vertices\"><input semantic=\"POSITION\" source=\"#%s-positions\"/></vertices>\n",
+		id.c_str(), id.c_str());
+
+	size_t triangleCount = vertexCount - 2;
+	appendFormatted(text, "<triangles count=\"%u\"><input semantic=\"VERTEX\" source=\"#%s-vertices\" offset=\"0\"/>"
+		"<input semantic=\"NORMAL\" source=\"#%s-normals\" offset=\"1\"/><p>", (unsigned int)triangleCount, id.c_str(), id.c_str());
+	for ( size_t i = 0; i < triangleCount; ++i )
+	{
+		unsigned int index = (unsigned int)i;
+		appendFormatted(text, "%u %u %u %u %u %u ", index, index, index + 1, index + 1, index + 2, index + 2);
+	}
+	text += "</p></triangles></mesh></geometry>\n";
+}
+
+//--------------------------------------------------------------------
+static void appendDocumentBegin( std::string& text )
+{
+	text += "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+		"<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">\n"
+		"<asset><created>2009-01-01T00:00:00Z</created><modified>2009-01-01T00:00:00Z</modified>"
+		"<unit name=\"meter\" meter=\"1\"/><up_axis>Y_UP</up_axis></asset>\n";
+}
+
+//--------------------------------------------------------------------
+static void appendDocumentEnd( std::string& text, bool hasVisualScene )
+{
+	if ( hasVisualScene )
+		text += "<scene><instance_visual_scene url=\"#scene\"/></scene>\n";
+	text += "</COLLADA>\n";
+}
+
+//--------------------------------------------------------------------
+/** Returns a document with @a meshCount meshes.*/
+static std::string createGeometriesDocument( size_t meshCount )
+{
+	std::string text;
+	appendDocumentBegin(text);
+	text += "<library_geometries>\n";
+	for ( size_t i = 0; i < meshCount; ++i )
+	{
+		char id[32];
+		sprintf(id, "mesh%u", (unsigned int)i);
+		appendMesh(text, id, MESH_VERTEX_COUNT);
+	}
+	text += "</library_geometries>\n";
+	appendDocumentEnd(text, false);
+	return text;
+}
+
+//--------------------------------------------------------------------
+/** Returns a document with a visual scene, that contains @a chainCount chains of nested nodes.*/
+static std::string createVisualScenesDocument( size_t chainCount )
+{
+	std::string text;
+	appendDocumentBegin(text);
+	text += "<library_visual_scenes><visual_scene id=\"scene\">\n";
+	for ( size_t i = 0; i < chainCount; ++i )
+	{
+		for ( size_t j = 0; j < NODE_CHAIN_DEPTH; ++j )
+		{
+			appendFormatted(text, "<node id=\"chain%u_%u\" sid=\"node%u\"><translate sid=\"translate\">0 1 0</translate>\n",
+				(unsigned int)i, (unsigned int)j, (unsigned int)j);
+		}
+		for ( size_t j = 0; j < NODE_CHAIN_DEPTH; ++j )
+			text += "</node>";
+		text += '\n';
+	}
+	text += "</visual_scene></library_visual_scenes>\n";
+	appendDocumentEnd(text, true);
+	return text;
+}
+
+//--------------------------------------------------------------------
+/** Returns a document with @a animationCount animations, each of which animates the translation of its
+own node.*/
+static std::string createAnimationsDocument( size_t animationCount )
+{
+	static const char* const TIME = "TIME";
+	static const char* const X = "X";
+
+	std::string text;
+	appendDocumentBegin(text);
+	text += "<library_animations>\n";
+	for ( size_t i = 0; i < animationCount; ++i )
+	{
+		unsigned int index = (unsigned int)i;
+		char id[32];
+		sprintf(id, "animation%u", index);
+		std::string animationId = id;
+
+		appendFormatted(text, "<animation id=\"%s\">\n", id);
+		appendFloatSource(text, animationId + "-input", ANIMATION_KEY_COUNT, 1, &TIME, 1, "float", &keyTime);
+		appendFloatSource(text, animationId + "-output", ANIMATION_KEY_COUNT, 1, &X, 1, "float", &wave);
+		appendNameSource(text, animationId + "-interpolation", ANIMATION_KEY_COUNT, "LINEAR", "INTERPOLATION");
+		appendFormatted(text, "<sampler id=\"%s-sampler\"><input semantic=\"INPUT\" source=\"#%s-input\"/>"
+			"<input semantic=\"OUTPUT\" source=\"#%s-output\"/><input semantic=\"INTERPOLATION\" source=\"#%s-interpolation\"/></sampler>\n",
+			id, id, id, id);
+		appendFormatted(text, "<channel source=\"#%s-sampler\" target=\"node%u/translate.X\"/>\n", id, index);
+		text += "</animation>\n";
+	}
+	text += "</library_animations>\n";
+
+	text += "<library_visual_scenes><visual_scene id=\"scene\">\n";
+	for ( size_t i = 0; i < animationCount; ++i )
+		appendFormatted(text, "<node id=\"node%u\"><translate sid=\"translate\">0 0 0</translate></node>\n", (unsigned int)i);
+	text += "</visual_scene></library_visual_scenes>\n";
+
+	appendDocumentEnd(text, true);
+	return text;
+}
+
+//--------------------------------------------------------------------
+/** Returns a document with @a skinCount skin controllers of one mesh.*/
+static std::string createControllersDocument( size_t skinCount )
+{
+	static const char* const TRANSFORM = "TRANSFORM";
+	static const char* const WEIGHT = "WEIGHT";
+
+	std::string text;
+	appendDocumentBegin(text);
+	text += "<library_geometries>\n";
+	appendMesh(text, "skinMesh", SKIN_VERTEX_COUNT);
+	text += "</library_geometries>\n";
+
+	text += "<library_controllers>\n";
+	for ( size_t i = 0; i < skinCount; ++i )
+	{
+		char id[32];
+		sprintf(id, "skin%u", (unsigned int)i);
+		std::string skinId = id;
+
+		appendFormatted(text, "<controller id=\"%s\"><skin source=\"#skinMesh\">"
+			"<bind_shape_matrix>1 0 0 0 0 1 0 0 0 0 1 0 0 0 0 1</bind_shape_matrix>\n", id);
+		appendNameSource(text, skinId + "-joints", SKIN_JOINT_COUNT, "joint%u", "JOINT");
+		appendFloatSource(text, skinId + "-bind_poses", SKIN_JOINT_COUNT, 16, &TRANSFORM, 1, "float4x4", &wave);
+		appendFloatSource(text, skinId + "-weights", SKIN_VERTEX_COUNT * SKIN_INFLUENCE_COUNT, 1, &WEIGHT, 1, "float", &skinWeight);
+		appendFormatted(text, "<joints><input semantic=\"JOINT\" source=\"#%s-joints\"/>"
+			"<input semantic=\"INV_BIND_MATRIX\" source=\"#%s-bind_poses\"/></joints>\n", id, id);
+		appendFormatted(text, "<vertex_weights count=\"%u\"><input semantic=\"JOINT\" source=\"#%s-joints\" offset=\"0\"/>"
+			"<input semantic=\"WEIGHT\" source=\"#%s-weights\" offset=\"1\"/><vcount>", (unsigned int)SKIN_VERTEX_COUNT, id, id);
+		for ( size_t j = 0; j < SKIN_VERTEX_COUNT; ++j )
+			appendFormatted(text, "%u ", (unsigned int)SKIN_INFLUENCE_COUNT);
+		text += "</vcount><v>";
+		for ( size_t j = 0; j < SKIN_VERTEX_COUNT; ++j )
+		{
+			for ( size_t k = 0; k < SKIN_INFLUENCE_COUNT; ++k )
+			{
+				unsigned int joint = (unsigned int)((j + k) % SKIN_JOINT_COUNT);
+				unsigned int weight = (unsigned int)(j * SKIN_INFLUENCE_COUNT + k);
+				appendFormatted(text, "%u %u ", joint, weight);
+			}
+		}
+		text += "</v></vertex_weights></skin></controller>\n";
+	}
+	text += "</library_controllers>\n";
+
+	appendDocumentEnd(text, false);
+	return text;
+}
+
+//--------------------------------------------------------------------
+/** Returns the number of start tags in @a document.*/
+static size_t countElements( const std::string& document )
+{
+	size_t count = 0;
+	for ( size_t pos = document.find('<'); pos != std::string::npos; pos = document.find('<', pos + 1) )
+	{
+		char next = document[pos + 1];
+		if ( (next != '/') && (next != '?') && (next != '!') )
+			++count;
+	}
+	return count;
+}
+
+//--------------------------------------------------------------------
+/** Returns the wall clock time in seconds, with millisecond resolution.*/
+static double getTime()
+{
+#ifdef WIN32
+#pragma warning(disable: 4996)
+	_timeb timeBuffer;
+	_ftime( &timeBuffer );
+#pragma warning(default: 4996)
+#else
+	timeb timeBuffer;
+	ftime( &timeBuffer );
+#endif
+	return (double)timeBuffer.time + (double)timeBuffer.millitm / 1000;
+}
+
+//--------------------------------------------------------------------
+/** Returns the seconds elapsed since @a startTime, as returned by getTime(), but at least one millisecond.*/
+static double getSecondsSince( double startTime )
+{
+	double seconds = getTime() - startTime;
+	return (seconds > 0.001) ? seconds : 0.001;
+}
+
+//--------------------------------------------------------------------
+/** Resets the peak resident set size of the process to the current resident set size, if the system
+supports it.*/
+static void resetPeakResidentSetSize()
+{
+	FILE* file = fopen("/proc/self/clear_refs", "w");
+	if ( file )
+	{
+		fputs("5", file);
+		fclose(file);
+	}
+}
+
+//--------------------------------------------------------------------
+/** Returns the peak resident set size in MB since the last call of resetPeakResidentSetSize(), or, if the
+system does not support resetting it, since the start of the process.*/
+static double getPeakResidentSetSize()
+{
+	FILE* file = fopen("/proc/self/status", "r");
+	if ( file )
+	{
+		char line[256];
+		long kiloBytes = -1;
+		while ( fgets(line, sizeof(line), file) )
+		{
+			if ( sscanf(line, "VmHWM: %ld", &kiloBytes) == 1 )
+				break;
+		}
+		fclose(file);
+		if ( kiloBytes >= 0 )
+			return kiloBytes / 1024.0;
+	}
+
+#ifdef WIN32
+	return 0;
+#else
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+#	ifdef __APPLE__
+	return usage.ru_maxrss / (1024.0 * 1024.0);
+#	else
+	return usage.ru_maxrss / 1024.0;
+#	endif
+#endif
+}
+
+//--------------------------------------------------------------------
+static void writeDocument( const char* outputDirectory, const char* name, const std::string& document )
+{
+	std::string fileName = std::string(outputDirectory) + "/" + name + ".dae";
+	FILE* file = fopen(fileName.c_str(), "wb");
+	if ( !file )
+	{
+		printf("Could not write %s\n", fileName.c_str());
+		return;
+	}
+	fwrite(document.c_str(), 1, document.length(), file);
+	fclose(file);
+}
+
+//--------------------------------------------------------------------
+/** Loads @a document and prints the throughput and the peak resident set size, which includes
+@a document itself.*/
+static bool load( const char* name, const std::string& document, const char* outputDirectory )
+{
+	if ( outputDirectory )
+		writeDocument(outputDirectory, name, document);
+
+	size_t elementCount = countElements(document);
+	resetPeakResidentSetSize();
+
+	ErrorHandler errorHandler;
+	COLLADASaxFWL::Loader loader(&errorHandler);
+	NullWriter writer;
+
+	double startTime = getTime();
+	bool success = loader.loadDocument(std::string(name) + ".dae", document.c_str(), (int)document.length(), &writer);
+	double seconds = getSecondsSince(startTime);
+	success &= (errorHandler.getErrorCount() == 0);
+
+	printf("%s (%s): %.1f MB, %u elements in %.3f s, %.1f MB/s, %.0f elements/s, peak RSS %.1f MB%s\n",
+		name, XML_PARSER_NAME, document.length() / 1e6, (unsigned int)elementCount, seconds,
+		document.length() / 1e6 / seconds, elementCount / seconds, getPeakResidentSetSize(), success ? "" : " FAILED");
+	return success;
+}
+
+//--------------------------------------------------------------------
+/** Adds @a idCount identical ids to an IDList and prints the throughput.*/
+static void measureIdList( size_t idCount )
+{
+	COLLADABU::IDList idList;
+	double startTime = getTime();
+	for ( size_t i = 0; i < idCount; ++i )
+		idList.addId("polySurface");
+	double seconds = getSecondsSince(startTime);
+
+	printf("IDList: %u colliding ids in %.3f s, %.0f ids/s\n", (unsigned int)idCount, seconds, idCount / seconds);
+}
+
+//--------------------------------------------------------------------
+/** Returns @a count multiplied by @a scale, but at least 1.*/
+static size_t scaled( size_t count, double scale )
+{
+	size_t scaledCount = (size_t)(count * scale + 0.5);
+	return scaledCount > 0 ? scaledCount : 1;
+}
+
+//--------------------------------------------------------------------
+bool performanceTest( double scale, const char* outputDirectory )
+{
+	bool success = true;
+	success &= load("geometries", createGeometriesDocument(scaled(MESH_COUNT, scale)), outputDirectory);
+	success &= load("visual_scenes", createVisualScenesDocument(scaled(NODE_CHAIN_COUNT, scale)), outputDirectory);
+	success &= load("animations", createAnimationsDocument(scaled(ANIMATION_COUNT, scale)), outputDirectory);
+	success &= load("controllers", createControllersDocument(scaled(SKIN_COUNT, scale)), outputDirectory);
+	measureIdList(scaled(COLLIDING_ID_COUNT, scale));
+	return success;
+}
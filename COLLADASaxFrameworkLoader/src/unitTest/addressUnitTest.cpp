@@ -0,0 +1,375 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "addressUnitTest.h"
+
+#include "COLLADASaxFWLSidAddress.h"
+
+#include "COLLADABUURI.h"
+#include "COLLADABUPcreCompiledPattern.h"
+
+#include "GeneratedSaxParserUtils.h"
+
+#include "pcre.h"
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+
+typedef std::string String;
+
+/** Output vector length for pcre_exec, as used by the former implementations.*/
+static const int regExpMatchesVectorLength = 30;
+
+/** Value of the output strings before splitting, to detect components that are left unchanged.*/
+static const char* const UNCHANGED = "<unchanged>";
+
+/** Hand-picked URIs and sid addresses, including the quirks of the regular expressions.*/
+static const char* const HAND_PICKED_STRINGS[] =
+{
+	"", "#", "#frag", "file:///C:/a/b.dae#x", "http://host/p?q#f", "http://host", "//host/path", "a:b:c",
+	"../a/b.c.d", ".emacs", "a/b/", "/", "?", "?#", "#?", "a?b?c#d#e", "frag#line\nbreak",
+	"dir/file\n.ext", "dir\n/file.ext",
+	"node/trans.X", "node/matrix(1)(2)", "node/m(3)", "./a/b.ANGLE", "a", "a/", "(((", "a.", ".a", "..",
+	"x/y(1).Z", "x/y(a)(1)", "x/(1)y", "x/y(1)(2)(3)", "x/y()", "x/y(4294967296)", "x/y(1)z", "x/y.",
+	"x//y", "/y.Z", "./y"
+};
+
+/** Pieces the random strings are built from.*/
+static const char* const RANDOM_STRING_PIECES[] =
+{
+	":", "/", "?", "#", ".", "(", ")", "1", "23", "a", "bc", "\n", " ", "//", "file:", "http://", ".dae",
+	"(0)", "(12)", "%20"
+};
+
+
+//--------------------------------------------------------------------
+/** Gives access to the splitting functions of COLLADABU::URI.*/
+class URISplitter : public COLLADABU::URI
+{
+public:
+	using COLLADABU::URI::parseUriRef;
+	using COLLADABU::URI::parsePath;
+};
+
+//--------------------------------------------------------------------
+static void setStringFromMatches( String& matchString, const String& entireString, int* resultPositions, int index )
+{
+	int& startPosition = resultPositions[2*index];
+	int& endPosition = resultPositions[2*index+1];
+	if ( startPosition >= 0 )
+	{
+		matchString.assign( entireString, startPosition, endPosition - startPosition );
+	}
+}
+
+//--------------------------------------------------------------------
+/** COLLADABU::URI::parseUriRef, as it was implemented with a regular expression.*/
+static bool formerParseUriRef( const String& uriRef, String& scheme, String& authority, String& path, String& query, String& fragment )
+{
+	if ( !uriRef.empty() && uriRef[0] == '#' )
+	{
+		fragment.assign( uriRef, 1, uriRef.length() - 1 );
+		return true;
+	}
+
+	static const COLLADABU::PcreCompiledPattern matchUriCompiledPattern("^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\\?([^#]*))?(#(.*))?");
+	pcre* matchUri = matchUriCompiledPattern.getCompiledPattern();
+
+	int uriMatches[regExpMatchesVectorLength];
+	int uriResult = pcre_exec(matchUri, 0, uriRef.c_str(), (int)uriRef.size(), 0, 0, uriMatches, regExpMatchesVectorLength);
+	if ( uriResult >= 0 )
+	{
+		setStringFromMatches(scheme, uriRef, uriMatches, 2);
+		setStringFromMatches(authority, uriRef, uriMatches, 4);
+		setStringFromMatches(path, uriRef, uriMatches, 5);
+		setStringFromMatches(query, uriRef, uriMatches, 6);
+		setStringFromMatches(fragment, uriRef, uriMatches, 9);
+		return true;
+	}
+	return false;
+}
+
+//--------------------------------------------------------------------
+/** COLLADABU::URI::parsePath, as it was implemented with regular expressions.*/
+static void formerParsePath( const String& path, String& dir, String& baseName, String& extension )
+{
+	static const COLLADABU::PcreCompiledPattern findDirCompiledPattern("(.*/)?(.*)?");
+	pcre* findDir = findDirCompiledPattern.getCompiledPattern();
+
+	static const COLLADABU::PcreCompiledPattern findExtCompiledPattern("([^.]*)?(\\.(.*))?");
+	pcre* findExt = findExtCompiledPattern.getCompiledPattern();
+
+	String tmpFile;
+	dir.clear();
+	baseName.clear();
+	extension.clear();
+
+	int dirMatches[regExpMatchesVectorLength];
+	int dirResult = pcre_exec(findDir, 0, path.c_str(), (int)path.size(), 0, 0, dirMatches, regExpMatchesVectorLength);
+	if ( dirResult >= 0 )
+	{
+		setStringFromMatches(dir, path, dirMatches, 1);
+		setStringFromMatches(tmpFile, path, dirMatches, 2);
+
+		int extMatches[regExpMatchesVectorLength];
+		int extResult = pcre_exec(findExt, 0, tmpFile.c_str(), (int)tmpFile.size(), 0, 0, extMatches, regExpMatchesVectorLength);
+		if ( extResult >= 0 )
+		{
+			setStringFromMatches(baseName, tmpFile, extMatches, 1);
+			setStringFromMatches(extension, tmpFile, extMatches, 3);
+		}
+	}
+}
+
+//--------------------------------------------------------------------
+/** The members of COLLADASaxFWL::SidAddress, as they were set with regular expressions.*/
+struct FormerSidAddress
+{
+	String id;
+	std::vector<String> sids;
+	String memberSelectionName;
+	COLLADASaxFWL::SidAddress::MemberSelection memberSelection;
+	size_t firstIndex;
+	size_t secondIndex;
+	bool isValid;
+
+	FormerSidAddress( const String& sidAddress )
+		: memberSelection(COLLADASaxFWL::SidAddress::MEMBER_SELECTION_NONE)
+		, firstIndex(0)
+		, secondIndex(0)
+		, isValid(false)
+	{
+		parseAddress(sidAddress);
+	}
+
+	/** Adds the id or sid [@a begin, @a end) of @a secondPart as the former parseAddress did.*/
+	void addIdOrSid( const char* secondPart, int begin, int end, bool& hasId )
+	{
+		if ( hasId )
+		{
+			sids.push_back(String(secondPart + begin, end - begin));
+		}
+		else
+		{
+			if ( secondPart[begin] != '.' )
+				id.assign(secondPart + begin, end - begin);
+			hasId = true;
+		}
+	}
+
+	void parseAddress( const String& sidAddress )
+	{
+		size_t lastSidSeparator = sidAddress.find_last_of("/");
+
+		bool hasId = false;
+		if ( lastSidSeparator != String::npos )
+		{
+			size_t nextTokenIndex = 0;
+			size_t startPos = 0;
+			while ( nextTokenIndex != lastSidSeparator )
+			{
+				nextTokenIndex = sidAddress.find_first_of("/", startPos);
+				if ( hasId )
+				{
+					sids.push_back(String(sidAddress, startPos, nextTokenIndex - startPos));
+				}
+				else
+				{
+					if ( sidAddress[startPos] != '.' )
+						id.assign(sidAddress, startPos, nextTokenIndex - startPos);
+					hasId = true;
+				}
+				startPos = nextTokenIndex + 1;
+			}
+		}
+
+		const char* secondPart = sidAddress.c_str() + lastSidSeparator + 1;
+		int secondPartLength = (int)sidAddress.length() - (int)lastSidSeparator - 1;
+
+		static const COLLADABU::PcreCompiledPattern accessorNameRegexCompiledPattern("(.+)\\.(.+)");
+		pcre* accessorNameRegex = accessorNameRegexCompiledPattern.getCompiledPattern();
+
+		int accessorNameMatches[regExpMatchesVectorLength];
+		int accessorNameResult = pcre_exec(accessorNameRegex, 0, secondPart, secondPartLength, 0, 0, accessorNameMatches, regExpMatchesVectorLength);
+		if ( accessorNameResult >= 0 )
+		{
+			if ( accessorNameMatches[2*1] >= 0 )
+				addIdOrSid(secondPart, accessorNameMatches[2*1], accessorNameMatches[2*1+1], hasId);
+			if ( accessorNameMatches[2*2] >= 0 )
+				memberSelectionName.assign(secondPart + accessorNameMatches[2*2], accessorNameMatches[2*2+1] - accessorNameMatches[2*2]);
+			memberSelection = COLLADASaxFWL::SidAddress::MEMBER_SELECTION_NAME;
+			isValid = true;
+			return;
+		}
+
+		static const COLLADABU::PcreCompiledPattern accessorIndexRegexCompiledPattern("([^(]+)(?:\\(([0-9]+)\\))?(?:\\(([0-9]+)\\))?");
+		pcre* accessorIndexRegex = accessorIndexRegexCompiledPattern.getCompiledPattern();
+
+		int accessorIndexMatches[regExpMatchesVectorLength];
+		int accessorIndexResult = pcre_exec(accessorIndexRegex, 0, secondPart, secondPartLength, 0, 0, accessorIndexMatches, regExpMatchesVectorLength);
+		if ( accessorIndexResult < 0 )
+		{
+			isValid = false;
+			return;
+		}
+
+		if ( accessorIndexMatches[2*1] >= 0 )
+			addIdOrSid(secondPart, accessorIndexMatches[2*1], accessorIndexMatches[2*1+1], hasId);
+		memberSelection = COLLADASaxFWL::SidAddress::MEMBER_SELECTION_NONE;
+
+		if ( accessorIndexMatches[2*2] >= 0 )
+		{
+			memberSelection = COLLADASaxFWL::SidAddress::MEMBER_SELECTION_ONE_INDEX;
+			bool failed = false;
+			const char* bufferBegin = secondPart + accessorIndexMatches[2*2];
+			firstIndex = (size_t)GeneratedSaxParser::Utils::toUint32(&bufferBegin, secondPart + accessorIndexMatches[2*2+1], failed);
+			if ( failed )
+			{
+				isValid = false;
+				return;
+			}
+		}
+
+		if ( accessorIndexMatches[2*3] >= 0 )
+		{
+			bool failed = false;
+			const char* bufferBegin = secondPart + accessorIndexMatches[2*3];
+			size_t index = (size_t)GeneratedSaxParser::Utils::toUint32(&bufferBegin, secondPart + accessorIndexMatches[2*3+1], failed);
+			memberSelection = COLLADASaxFWL::SidAddress::MEMBER_SELECTION_TWO_INDICES;
+			secondIndex = index;
+			if ( failed )
+			{
+				isValid = false;
+				return;
+			}
+		}
+
+		isValid = true;
+	}
+};
+
+//--------------------------------------------------------------------
+/** Returns @a text with line feeds and NULs escaped, to print it on one line.*/
+static String escape( const String& text )
+{
+	String escaped;
+	for ( size_t i = 0; i < text.length(); ++i )
+	{
+		if ( text[i] == '\n' )
+			escaped += "\\n";
+		else if ( text[i] == '\0' )
+			escaped += "\\0";
+		else
+			escaped += text[i];
+	}
+	return escaped;
+}
+
+//--------------------------------------------------------------------
+static bool compareUriRef( const String& uriRef )
+{
+	String scheme(UNCHANGED), authority(UNCHANGED), path(UNCHANGED), query(UNCHANGED), fragment(UNCHANGED);
+	bool result = URISplitter::parseUriRef(uriRef, scheme, authority, path, query, fragment);
+
+	String formerScheme(UNCHANGED), formerAuthority(UNCHANGED), formerPath(UNCHANGED), formerQuery(UNCHANGED), formerFragment(UNCHANGED);
+	bool formerResult = formerParseUriRef(uriRef, formerScheme, formerAuthority, formerPath, formerQuery, formerFragment);
+
+	if ( (result == formerResult) && (scheme == formerScheme) && (authority == formerAuthority) && (path == formerPath)
+		&& (query == formerQuery) && (fragment == formerFragment) )
+		return true;
+
+	printf("URI::parseUriRef(\"%s\"): \"%s\" \"%s\" \"%s\" \"%s\" \"%s\", expected \"%s\" \"%s\" \"%s\" \"%s\" \"%s\"\n",
+		escape(uriRef).c_str(), escape(scheme).c_str(), escape(authority).c_str(), escape(path).c_str(), escape(query).c_str(),
+		escape(fragment).c_str(), escape(formerScheme).c_str(), escape(formerAuthority).c_str(), escape(formerPath).c_str(),
+		escape(formerQuery).c_str(), escape(formerFragment).c_str());
+	return false;
+}
+
+//--------------------------------------------------------------------
+static bool comparePath( const String& path )
+{
+	String dir(UNCHANGED), baseName(UNCHANGED), extension(UNCHANGED);
+	URISplitter::parsePath(path, dir, baseName, extension);
+
+	String formerDir(UNCHANGED), formerBaseName(UNCHANGED), formerExtension(UNCHANGED);
+	formerParsePath(path, formerDir, formerBaseName, formerExtension);
+
+	if ( (dir == formerDir) && (baseName == formerBaseName) && (extension == formerExtension) )
+		return true;
+
+	printf("URI::parsePath(\"%s\"): \"%s\" \"%s\" \"%s\", expected \"%s\" \"%s\" \"%s\"\n", escape(path).c_str(),
+		escape(dir).c_str(), escape(baseName).c_str(), escape(extension).c_str(),
+		escape(formerDir).c_str(), escape(formerBaseName).c_str(), escape(formerExtension).c_str());
+	return false;
+}
+
+//--------------------------------------------------------------------
+static bool compareSidAddress( const String& address )
+{
+	COLLADASaxFWL::SidAddress sidAddress(address);
+	FormerSidAddress formerSidAddress(address);
+
+	if ( (sidAddress.isValid() == formerSidAddress.isValid) && (sidAddress.getId() == formerSidAddress.id)
+		&& (sidAddress.getSids() == formerSidAddress.sids) && (sidAddress.getMemberSelection() == formerSidAddress.memberSelection)
+		&& (sidAddress.getMemberSelectionName() == formerSidAddress.memberSelectionName)
+		&& (sidAddress.getFirstIndex() == formerSidAddress.firstIndex) && (sidAddress.getSecondIndex() == formerSidAddress.secondIndex) )
+		return true;
+
+	printf("SidAddress(\"%s\"): \"%s\" differs from the former result\n", escape(address).c_str(),
+		escape(sidAddress.getSidAddressString()).c_str());
+	return false;
+}
+
+//--------------------------------------------------------------------
+bool addressUnitTest( size_t randomStringCount )
+{
+	std::vector<String> corpus;
+	for ( size_t i = 0; i < sizeof(HAND_PICKED_STRINGS) / sizeof(HAND_PICKED_STRINGS[0]); ++i )
+		corpus.push_back(HAND_PICKED_STRINGS[i]);
+	corpus.push_back(String("a\0b/c.d", 7));
+	corpus.push_back(String("#\0", 2));
+
+	// a fixed linear congruential generator, to get the same corpus on all platforms
+	unsigned int random = 1;
+	const size_t pieceCount = sizeof(RANDOM_STRING_PIECES) / sizeof(RANDOM_STRING_PIECES[0]);
+	for ( size_t i = 0; i < randomStringCount; ++i )
+	{
+		random = random * 1103515245 + 12345;
+		size_t length = (random >> 16) % 11;
+		String text;
+		for ( size_t j = 0; j < length; ++j )
+		{
+			random = random * 1103515245 + 12345;
+			size_t piece = (random >> 16) % (pieceCount + 1);
+			if ( piece == pieceCount )
+				text += '\0';
+			else
+				text += RANDOM_STRING_PIECES[piece];
+		}
+		corpus.push_back(text);
+	}
+
+	size_t differenceCount = 0;
+	for ( size_t i = 0; i < corpus.size(); ++i )
+	{
+		if ( !compareUriRef(corpus[i]) )
+			++differenceCount;
+		if ( !comparePath(corpus[i]) )
+			++differenceCount;
+		if ( !compareSidAddress(corpus[i]) )
+			++differenceCount;
+	}
+
+	printf("%u strings, %u results, %u differ from the former regular expressions%s\n", (unsigned int)corpus.size(),
+		(unsigned int)(3 * corpus.size()), (unsigned int)differenceCount, (differenceCount == 0) ? "" : " FAILED");
+	return differenceCount == 0;
+}
@@ -0,0 +1,781 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "documentCacheUnitTest.h"
+
+#include "COLLADASaxFWLLoader.h"
+#include "COLLADASaxFWLIErrorHandler.h"
+#include "COLLADASaxFWLIError.h"
+#include "COLLADASaxFWLDocumentCache.h"
+#include "COLLADASaxFWLDocumentCacheReader.h"
+
+#include "COLLADAFWIWriter.h"
+#include "COLLADAFWFileInfo.h"
+#include "COLLADAFWScene.h"
+#include "COLLADAFWInstanceVisualScene.h"
+#include "COLLADAFWVisualScene.h"
+#include "COLLADAFWLibraryNodes.h"
+#include "COLLADAFWNode.h"
+#include "COLLADAFWMatrix.h"
+#include "COLLADAFWTranslate.h"
+#include "COLLADAFWRotate.h"
+#include "COLLADAFWScale.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWMaterial.h"
+#include "COLLADAFWEffect.h"
+#include "COLLADAFWEffectCommon.h"
+#include "COLLADAFWSampler.h"
+#include "COLLADAFWCamera.h"
+#include "COLLADAFWLight.h"
+#include "COLLADAFWImage.h"
+#include "COLLADAFWAnimationCurve.h"
+#include "COLLADAFWAnimationList.h"
+#include "COLLADAFWSkinControllerData.h"
+#include "COLLADAFWSkinController.h"
+#include "COLLADAFWMorphController.h"
+#include "COLLADAFWFormulas.h"
+#include "COLLADAFWKinematicsScene.h"
+
+#include "Math/COLLADABUMathMatrix4.h"
+
+#include <algorithm>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string>
+
+
+typedef std::string String;
+
+/** The name of the document written into the working directory.*/
+static const char* const DOCUMENT_FILE_NAME = "documentCacheUnitTest.dae";
+
+/** A document with an object of each type the document cache records.*/
+static const char* const DOCUMENT =
+	"<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+	"<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">\n"
+	"<asset><contributor><author>documentCacheUnitTest</author></contributor>"
+	"<created>2009-01-01T00:00:00Z</created><modified>2009-01-01T00:00:00Z</modified>"
+	"<unit name=\"centimeter\" meter=\"0.01\"/><up_axis>Z_UP</up_axis></asset>\n"
+	"<library_cameras><camera id=\"camera\" name=\"camera\"><optics><technique_common><perspective>"
+	"<yfov>37.8</yfov><aspect_ratio>1.5</aspect_ratio><znear>0.1</znear><zfar>1000</zfar>"
+	"</perspective></technique_common></optics></camera></library_cameras>\n"
+	"<library_lights><light id=\"light\" name=\"light\"><technique_common><point><color>1 0.5 0.25</color>"
+	"<constant_attenuation>1</constant_attenuation><linear_attenuation>0.5</linear_attenuation>"
+	"<quadratic_attenuation>0.25</quadratic_attenuation></point></technique_common></light></library_lights>\n"
+	"<library_images><image id=\"image\" name=\"image\"><init_from>texture.png</init_from></image></library_images>\n"
+	"<library_effects><effect id=\"effect\"><profile_COMMON>"
+	"<newparam sid=\"surface\"><surface type=\"2D\"><init_from>image</init_from></surface></newparam>"
+	"<newparam sid=\"sampler\"><sampler2D><source>surface</source></sampler2D></newparam>"
+	"<technique sid=\"common\"><phong><diffuse><texture texture=\"sampler\" texcoord=\"uv\"/></diffuse>"
+	"<specular><color>0.5 0.5 0.5 1</color></specular><shininess><float>20</float></shininess></phong></technique>"
+	"</profile_COMMON></effect></library_effects>\n"
+	"<library_materials><material id=\"material\" name=\"material\"><instance_effect url=\"#effect\"/></material>"
+	"</library_materials>\n"
+	"<library_geometries><geometry id=\"mesh\" name=\"mesh\"><mesh>"
+	"<source id=\"mesh-positions\"><float_array id=\"mesh-positions-array\" count=\"12\">0 0 0 1 0 0 1 1 0 0 1 0</float_array>"
+	"<technique_common><accessor source=\"#mesh-positions-array\" count=\"4\" stride=\"3\">"
+	"<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/>"
+	"</accessor></technique_common></source>"
+	"<source id=\"mesh-uvs\"><float_array id=\"mesh-uvs-array\" count=\"8\">0 0 1 0 1 1 0 1</float_array>"
+	"<technique_common><accessor source=\"#mesh-uvs-array\" count=\"4\" stride=\"2\">"
+	"<param name=\"S\" type=\"float\"/><param name=\"T\" type=\"float\"/></accessor></technique_common></source>"
+	"<vertices id=\"mesh-vertices\"><input semantic=\"POSITION\" source=\"#mesh-positions\"/></vertices>"
+	"<triangles material=\"symbol\" count=\"2\"><input semantic=\"VERTEX\" source=\"#mesh-vertices\" offset=\"0\"/>"
+	"<input semantic=\"TEXCOORD\" source=\"#mesh-uvs\" offset=\"1\" set=\"0\"/><p>0 0 1 1 2 2 0 0 2 2 3 3</p></triangles>"
+	"<polylist material=\"symbol\" count=\"1\"><input semantic=\"VERTEX\" source=\"#mesh-vertices\" offset=\"0\"/>"
+	"<vcount>4</vcount><p>0 1 2 3</p></polylist>"
+	"</mesh></geometry></library_geometries>\n"
+	"<library_controllers><controller id=\"skin\"><skin source=\"#mesh\">"
+	"<bind_shape_matrix>1 0 0 0 0 1 0 0 0 0 1 0 0 0 0 1</bind_shape_matrix>"
+	"<source id=\"skin-joints\"><Name_array id=\"skin-joints-array\" count=\"2\">joint0 joint1</Name_array>"
+	"<technique_common><accessor source=\"#skin-joints-array\" count=\"2\"><param name=\"JOINT\" type=\"name\"/>"
+	"</accessor></technique_common></source>"
+	"<source id=\"skin-matrices\"><float_array id=\"skin-matrices-array\" count=\"32\">"
+	"1 0 0 0 0 1 0 0 0 0 1 0 0 0 0 1 1 0 0 0 0 1 0 0 0 0 1 -2 0 0 0 1</float_array>"
+	"<technique_common><accessor source=\"#skin-matrices-array\" count=\"2\" stride=\"16\">"
+	"<param name=\"TRANSFORM\" type=\"float4x4\"/></accessor></technique_common></source>"
+	"<source id=\"skin-weights\"><float_array id=\"skin-weights-array\" count=\"3\">1 0.5 0.5</float_array>"
+	"<technique_common><accessor source=\"#skin-weights-array\" count=\"3\"><param name=\"WEIGHT\" type=\"float\"/>"
+	"</accessor></technique_common></source>"
+	"<joints><input semantic=\"JOINT\" source=\"#skin-joints\"/><input semantic=\"INV_BIND_MATRIX\" source=\"#skin-matrices\"/>"
+	"</joints><vertex_weights count=\"4\"><input semantic=\"JOINT\" source=\"#skin-joints\" offset=\"0\"/>"
+	"<input semantic=\"WEIGHT\" source=\"#skin-weights\" offset=\"1\"/><vcount>1 2 1 1</vcount>"
+	"<v>0 0 0 1 1 2 1 0 0 0</v></vertex_weights></skin></controller></library_controllers>\n"
+	"<library_animations><animation id=\"animation\">"
+	"<source id=\"animation-input\"><float_array id=\"animation-input-array\" count=\"3\">0 1 2</float_array>"
+	"<technique_common><accessor source=\"#animation-input-array\" count=\"3\"><param name=\"TIME\" type=\"float\"/>"
+	"</accessor></technique_common></source>"
+	"<source id=\"animation-output\"><float_array id=\"animation-output-array\" count=\"3\">0 5 10</float_array>"
+	"<technique_common><accessor source=\"#animation-output-array\" count=\"3\"><param name=\"X\" type=\"float\"/>"
+	"</accessor></technique_common></source>"
+	"<source id=\"animation-interpolation\"><Name_array id=\"animation-interpolation-array\" count=\"3\">"
+	"LINEAR LINEAR STEP</Name_array><technique_common><accessor source=\"#animation-interpolation-array\" count=\"3\">"
+	"<param name=\"INTERPOLATION\" type=\"name\"/></accessor></technique_common></source>"
+	"<sampler id=\"animation-sampler\"><input semantic=\"INPUT\" source=\"#animation-input\"/>"
+	"<input semantic=\"OUTPUT\" source=\"#animation-output\"/>"
+	"<input semantic=\"INTERPOLATION\" source=\"#animation-interpolation\"/></sampler>"
+	"<channel source=\"#animation-sampler\" target=\"node/translate.X\"/></animation></library_animations>\n"
+	"<library_nodes><node id=\"libraryNode\" name=\"libraryNode\"><scale>2 2 2</scale>"
+	"<instance_light url=\"#light\"/></node></library_nodes>\n"
+	"<library_visual_scenes><visual_scene id=\"scene\" name=\"scene\">"
+	"<node id=\"joint0\" sid=\"joint0\" name=\"joint0\" type=\"JOINT\"><translate sid=\"translate\">0 0 0</translate>"
+	"<node id=\"joint1\" sid=\"joint1\" name=\"joint1\" type=\"JOINT\"><rotate sid=\"rotate\">0 0 1 45</rotate></node></node>"
+	"<node id=\"node\" name=\"node\"><translate sid=\"translate\">1 2 3</translate><rotate>0 0 1 90</rotate>"
+	"<scale>1 1 2</scale><instance_camera url=\"#camera\"/><instance_geometry url=\"#mesh\"><bind_material>"
+	"<technique_common><instance_material symbol=\"symbol\" target=\"#material\">"
+	"<bind_vertex_input semantic=\"uv\" input_semantic=\"TEXCOORD\" input_set=\"0\"/></instance_material>"
+	"</technique_common></bind_material></instance_geometry><instance_light url=\"#light\"/>"
+	"<instance_node url=\"#libraryNode\"/></node>"
+	"<node id=\"skinned\" name=\"skinned\"><matrix>1 0 0 4 0 1 0 5 0 0 1 6 0 0 0 1</matrix>"
+	"<instance_controller url=\"#skin\"><skeleton>#joint0</skeleton><bind_material><technique_common>"
+	"<instance_material symbol=\"symbol\" target=\"#material\"/></technique_common></bind_material>"
+	"</instance_controller></node>"
+	"</visual_scene></library_visual_scenes>\n"
+	"<scene><instance_visual_scene url=\"#scene\"/></scene>\n"
+	"</COLLADA>\n";
+
+
+//--------------------------------------------------------------------
+/** Appends the printf like formatted @a format to @a text.*/
+static void appendFormatted( String& text, const char* format, ... )
+{
+	char buffer[256];
+	va_list arguments;
+	va_start(arguments, format);
+	vsnprintf(buffer, sizeof(buffer), format, arguments);
+	va_end(arguments);
+	buffer[sizeof(buffer) - 1] = 0;
+	text += buffer;
+}
+
+//--------------------------------------------------------------------
+static void appendUniqueId( String& trace, const COLLADAFW::UniqueId& uniqueId )
+{
+	appendFormatted(trace, " %d:%llu:%lu", (int)uniqueId.getClassId(), uniqueId.getObjectId(), uniqueId.getFileId());
+}
+
+//--------------------------------------------------------------------
+static void appendString( String& trace, const String& value )
+{
+	trace += " \"";
+	trace += value;
+	trace += "\"";
+}
+
+//--------------------------------------------------------------------
+/** Appends the count and all values of @a array.*/
+template<class Type>
+static void appendArray( String& trace, const COLLADAFW::ArrayPrimitiveType<Type>& array )
+{
+	appendFormatted(trace, " [%lu:", (unsigned long)array.getCount());
+	for ( size_t i = 0; i < array.getCount(); ++i )
+		appendFormatted(trace, " %.17g", (double)array[i]);
+	trace += "]";
+}
+
+//--------------------------------------------------------------------
+static void appendMatrix( String& trace, const COLLADABU::Math::Matrix4& matrix )
+{
+	trace += " (";
+	for ( int i = 0; i < 16; ++i )
+		appendFormatted(trace, " %.17g", matrix.getElement(i));
+	trace += ")";
+}
+
+//--------------------------------------------------------------------
+static void appendColor( String& trace, const COLLADAFW::Color& color )
+{
+	appendFormatted(trace, " (%.17g %.17g %.17g %.17g)", color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha());
+	appendUniqueId(trace, color.getAnimationList());
+}
+
+//--------------------------------------------------------------------
+static void appendAnimatableFloat( String& trace, const COLLADAFW::AnimatableFloat& animatableFloat )
+{
+	appendFormatted(trace, " %.17g", (double)animatableFloat.getValue());
+	appendUniqueId(trace, animatableFloat.getAnimationList());
+}
+
+//--------------------------------------------------------------------
+static void appendFloatOrDoubleArray( String& trace, const COLLADAFW::FloatOrDoubleArray& array )
+{
+	appendFormatted(trace, " type %d", (int)array.getType());
+	appendUniqueId(trace, array.getAnimationList());
+	if ( array.getType() == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_FLOAT )
+		appendArray(trace, *array.getFloatValues());
+	else if ( array.getType() == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE )
+		appendArray(trace, *array.getDoubleValues());
+}
+
+//--------------------------------------------------------------------
+static void appendMeshVertexData( String& trace, const COLLADAFW::MeshVertexData& vertexData )
+{
+	appendFloatOrDoubleArray(trace, vertexData);
+	const COLLADAFW::MeshVertexData::InputInfosArray& inputInfos = vertexData.getInputInfosArray();
+	for ( size_t i = 0; i < inputInfos.getCount(); ++i )
+	{
+		appendString(trace, inputInfos[i]->mName);
+		appendFormatted(trace, " %lu %lu", (unsigned long)inputInfos[i]->mStride, (unsigned long)inputInfos[i]->mLength);
+	}
+	trace += "\n";
+}
+
+//--------------------------------------------------------------------
+static void appendIndexLists( String& trace, const COLLADAFW::IndexListArray& indexLists )
+{
+	for ( size_t i = 0; i < indexLists.getCount(); ++i )
+	{
+		const COLLADAFW::IndexList& indexList = *indexLists[i];
+		appendString(trace, indexList.getName());
+		appendArray(trace, indexList.getIndices());
+		appendFormatted(trace, " %lu %lu %lu", (unsigned long)indexList.getStride(), (unsigned long)indexList.getSetIndex(),
+			(unsigned long)indexList.getInitialIndex());
+	}
+}
+
+//--------------------------------------------------------------------
+/** Appends the name, instantiated object and unique id of @a instance.*/
+template<class InstanceType>
+static void appendInstance( String& trace, const char* kind, const InstanceType& instance )
+{
+	appendFormatted(trace, "  %s", kind);
+	appendUniqueId(trace, instance.getUniqueId());
+	appendUniqueId(trace, instance.getInstanciatedObjectId());
+	appendString(trace, instance.getName());
+	trace += "\n";
+}
+
+//--------------------------------------------------------------------
+template<class InstanceType>
+static void appendInstances( String& trace, const char* kind, const COLLADAFW::PointerArray<InstanceType>& instances )
+{
+	for ( size_t i = 0; i < instances.getCount(); ++i )
+		appendInstance(trace, kind, *instances[i]);
+}
+
+//--------------------------------------------------------------------
+/** Appends the instances in @a instances, including their material bindings.*/
+template<class InstanceType>
+static void appendBindingInstances( String& trace, const char* kind, const COLLADAFW::PointerArray<InstanceType>& instances )
+{
+	for ( size_t i = 0; i < instances.getCount(); ++i )
+	{
+		const InstanceType& instance = *instances[i];
+		appendInstance(trace, kind, instance);
+
+		const COLLADAFW::MaterialBindingArray& materialBindings = instance.getMaterialBindings();
+		for ( size_t j = 0; j < materialBindings.getCount(); ++j )
+		{
+			const COLLADAFW::MaterialBinding& materialBinding = materialBindings[j];
+			appendFormatted(trace, "   material binding %lu", (unsigned long)materialBinding.getMaterialId());
+			appendUniqueId(trace, materialBinding.getReferencedMaterial());
+			appendString(trace, materialBinding.getName());
+
+			const COLLADAFW::TextureCoordinateBindingArray& textureCoordinateBindings = materialBinding.getTextureCoordinateBindingArray();
+			for ( size_t k = 0; k < textureCoordinateBindings.getCount(); ++k )
+			{
+				const COLLADAFW::TextureCoordinateBinding& textureCoordinateBinding = textureCoordinateBindings[k];
+				appendFormatted(trace, " %lu %lu", (unsigned long)textureCoordinateBinding.getTextureMapId(),
+					(unsigned long)textureCoordinateBinding.getSetIndex());
+				appendString(trace, textureCoordinateBinding.getSemantic());
+			}
+			trace += "\n";
+		}
+	}
+}
+
+//--------------------------------------------------------------------
+static void appendTransformation( String& trace, const COLLADAFW::Transformation& transformation )
+{
+	appendFormatted(trace, "  transformation %d", (int)transformation.getTransformationType());
+	appendUniqueId(trace, transformation.getAnimationList());
+	switch ( transformation.getTransformationType() )
+	{
+	case COLLADAFW::Transformation::MATRIX:
+		appendMatrix(trace, ((const COLLADAFW::Matrix&)transformation).getMatrix());
+		break;
+	case COLLADAFW::Transformation::TRANSLATE:
+		{
+			const COLLADABU::Math::Vector3& translation = ((const COLLADAFW::Translate&)transformation).getTranslation();
+			appendFormatted(trace, " %.17g %.17g %.17g", translation.x, translation.y, translation.z);
+			break;
+		}
+	case COLLADAFW::Transformation::ROTATE:
+		{
+			const COLLADAFW::Rotate& rotate = (const COLLADAFW::Rotate&)transformation;
+			const COLLADABU::Math::Vector3& axis = rotate.getRotationAxis();
+			appendFormatted(trace, " %.17g %.17g %.17g %.17g", axis.x, axis.y, axis.z, rotate.getRotationAngle());
+			break;
+		}
+	case COLLADAFW::Transformation::SCALE:
+		{
+			const COLLADABU::Math::Vector3& scale = ((const COLLADAFW::Scale&)transformation).getScale();
+			appendFormatted(trace, " %.17g %.17g %.17g", scale.x, scale.y, scale.z);
+			break;
+		}
+	default:
+		break;
+	}
+	trace += "\n";
+}
+
+//--------------------------------------------------------------------
+/** Appends @a nodes and, after each node, its child nodes.*/
+static void appendNodes( String& trace, const COLLADAFW::NodePointerArray& nodes )
+{
+	for ( size_t i = 0; i < nodes.getCount(); ++i )
+	{
+		const COLLADAFW::Node& node = *nodes[i];
+		trace += " node";
+		appendUniqueId(trace, node.getUniqueId());
+		appendString(trace, node.getOriginalId());
+		appendString(trace, node.getName());
+		appendFormatted(trace, " type %d children %lu\n", (int)node.getType(), (unsigned long)node.getChildNodes().getCount());
+
+		const COLLADAFW::TransformationPointerArray& transformations = node.getTransformations();
+		for ( size_t j = 0; j < transformations.getCount(); ++j )
+			appendTransformation(trace, *transformations[j]);
+
+		appendBindingInstances(trace, "instance geometry", node.getInstanceGeometries());
+		appendInstances(trace, "instance node", node.getInstanceNodes());
+		appendInstances(trace, "instance camera", node.getInstanceCameras());
+		appendInstances(trace, "instance light", node.getInstanceLights());
+		appendBindingInstances(trace, "instance controller", node.getInstanceControllers());
+		appendNodes(trace, node.getChildNodes());
+	}
+}
+
+//--------------------------------------------------------------------
+static void appendColorOrTexture( String& trace, const char* kind, const COLLADAFW::ColorOrTexture& colorOrTexture )
+{
+	appendFormatted(trace, "  %s %d", kind, (int)colorOrTexture.getType());
+	appendColor(trace, colorOrTexture.getColor());
+	const COLLADAFW::Texture& texture = colorOrTexture.getTexture();
+	appendUniqueId(trace, texture.getUniqueId());
+	appendFormatted(trace, " %lu %lu\n", (unsigned long)texture.getSamplerId(), (unsigned long)texture.getTextureMapId());
+}
+
+
+/** Writer that appends a description of each call and of the values of the passed object to a trace. The
+traces of two loads are equal, if the writer got the same calls with the same objects.*/
+class TraceWriter : public COLLADAFW::IWriter
+{
+private:
+	String mTrace;
+
+public:
+	const String& getTrace() const { return mTrace; }
+
+	virtual void cancel( const COLLADAFW::String& errorMessage )
+	{
+		appendFormatted(mTrace, "cancel %s\n", errorMessage.c_str());
+	}
+
+	virtual void start() { mTrace += "start\n"; }
+
+	virtual void finish() { mTrace += "finish\n"; }
+
+	virtual bool writeGlobalAsset( const COLLADAFW::FileInfo* asset )
+	{
+		mTrace += "global asset";
+		const COLLADAFW::FileInfo::ValuePairPointerArray& valuePairs = asset->getValuePairArray();
+		for ( size_t i = 0; i < valuePairs.getCount(); ++i )
+		{
+			appendString(mTrace, valuePairs[i]->first);
+			appendString(mTrace, valuePairs[i]->second);
+		}
+		const COLLADAFW::FileInfo::Unit& unit = asset->getUnit();
+		appendString(mTrace, unit.getLinearUnitName());
+		appendFormatted(mTrace, " %.17g %d", unit.getLinearUnitMeter(), (int)asset->getUpAxisType());
+		appendString(mTrace, asset->getAbsoluteFileUri().getURIString());
+		mTrace += "\n";
+		return true;
+	}
+
+	virtual bool writeScene( const COLLADAFW::Scene* scene )
+	{
+		mTrace += "scene";
+		appendUniqueId(mTrace, scene->getUniqueId());
+		mTrace += "\n";
+		if ( scene->getInstanceVisualScene() )
+			appendInstance(mTrace, "instance visual scene", *scene->getInstanceVisualScene());
+		return true;
+	}
+
+	virtual bool writeVisualScene( const COLLADAFW::VisualScene* visualScene )
+	{
+		mTrace += "visual scene";
+		appendUniqueId(mTrace, visualScene->getUniqueId());
+		appendString(mTrace, visualScene->getName());
+		mTrace += "\n";
+		appendNodes(mTrace, visualScene->getRootNodes());
+		return true;
+	}
+
+	virtual bool writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes )
+	{
+		mTrace += "library nodes\n";
+		appendNodes(mTrace, libraryNodes->getNodes());
+		return true;
+	}
+
+	virtual bool writeGeometry( const COLLADAFW::Geometry* geometry )
+	{
+		mTrace += "geometry";
+		appendUniqueId(mTrace, geometry->getUniqueId());
+		appendString(mTrace, geometry->getOriginalId());
+		appendString(mTrace, geometry->getName());
+		appendFormatted(mTrace, " type %d\n", (int)geometry->getType());
+		if ( geometry->getType() != COLLADAFW::Geometry::GEO_TYPE_MESH )
+			return true;
+
+		const COLLADAFW::Mesh* mesh = (const COLLADAFW::Mesh*)geometry;
+		mTrace += "  positions";
+		appendMeshVertexData(mTrace, mesh->getPositions());
+		mTrace += "  normals";
+		appendMeshVertexData(mTrace, mesh->getNormals());
+		mTrace += "  uv coordinates";
+		appendMeshVertexData(mTrace, mesh->getUVCoords());
+
+		const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mesh->getMeshPrimitives();
+		for ( size_t i = 0; i < meshPrimitives.getCount(); ++i )
+		{
+			const COLLADAFW::MeshPrimitive& meshPrimitive = *meshPrimitives[i];
+			appendFormatted(mTrace, "  primitive %d", (int)meshPrimitive.getPrimitiveType());
+			appendUniqueId(mTrace, meshPrimitive.getUniqueId());
+			appendFormatted(mTrace, " faces %lu", (unsigned long)meshPrimitive.getFaceCount());
+			appendString(mTrace, meshPrimitive.getMaterial());
+			appendFormatted(mTrace, " %lu", (unsigned long)meshPrimitive.getMaterialId());
+			appendArray(mTrace, meshPrimitive.getPositionIndices());
+			appendArray(mTrace, meshPrimitive.getNormalIndices());
+			appendIndexLists(mTrace, meshPrimitive.getUVCoordIndicesArray());
+			mTrace += "\n";
+		}
+		return true;
+	}
+
+	virtual bool writeMaterial( const COLLADAFW::Material* material )
+	{
+		mTrace += "material";
+		appendUniqueId(mTrace, material->getUniqueId());
+		appendString(mTrace, material->getOriginalId());
+		appendString(mTrace, material->getName());
+		appendUniqueId(mTrace, material->getInstantiatedEffect());
+		mTrace += "\n";
+		return true;
+	}
+
+	virtual bool writeEffect( const COLLADAFW::Effect* effect )
+	{
+		mTrace += "effect";
+		appendUniqueId(mTrace, effect->getUniqueId());
+		appendString(mTrace, effect->getOriginalId());
+		appendString(mTrace, effect->getName());
+		appendColor(mTrace, effect->getStandardColor());
+		mTrace += "\n";
+
+		const COLLADAFW::CommonEffectPointerArray& commonEffects = effect->getCommonEffects();
+		for ( size_t i = 0; i < commonEffects.getCount(); ++i )
+		{
+			const COLLADAFW::EffectCommon& effectCommon = *commonEffects[i];
+			appendFormatted(mTrace, " common effect %d\n", (int)effectCommon.getShaderType());
+			appendColorOrTexture(mTrace, "diffuse", effectCommon.getDiffuse());
+			appendColorOrTexture(mTrace, "specular", effectCommon.getSpecular());
+			appendFormatted(mTrace, "  shininess %d %.17g\n", (int)effectCommon.getShininess().getType(),
+				(double)effectCommon.getShininess().getFloatValue());
+
+			const COLLADAFW::SamplerPointerArray& samplers = effectCommon.getSamplerPointerArray();
+			for ( size_t j = 0; j < samplers.getCount(); ++j )
+			{
+				const COLLADAFW::Sampler& sampler = *samplers[j];
+				mTrace += "  sampler";
+				appendUniqueId(mTrace, sampler.getUniqueId());
+				appendFormatted(mTrace, " type %d", (int)sampler.getSamplerType());
+				appendUniqueId(mTrace, sampler.getSourceImage());
+				mTrace += "\n";
+			}
+		}
+		return true;
+	}
+
+	virtual bool writeCamera( const COLLADAFW::Camera* camera )
+	{
+		mTrace += "camera";
+		appendUniqueId(mTrace, camera->getUniqueId());
+		appendString(mTrace, camera->getOriginalId());
+		appendString(mTrace, camera->getName());
+		appendFormatted(mTrace, " type %d %d", (int)camera->getCameraType(), (int)camera->getDescriptionType());
+		appendAnimatableFloat(mTrace, camera->getYFov());
+		appendAnimatableFloat(mTrace, camera->getAspectRatio());
+		appendAnimatableFloat(mTrace, camera->getNearClippingPlane());
+		appendAnimatableFloat(mTrace, camera->getFarClippingPlane());
+		mTrace += "\n";
+		return true;
+	}
+
+	virtual bool writeImage( const COLLADAFW::Image* image )
+	{
+		mTrace += "image";
+		appendUniqueId(mTrace, image->getUniqueId());
+		appendString(mTrace, image->getOriginalId());
+		appendString(mTrace, image->getName());
+		appendFormatted(mTrace, " type %d", (int)image->getSourceType());
+		appendString(mTrace, image->getImageURI().getURIString());
+		mTrace += "\n";
+		return true;
+	}
+
+	virtual bool writeLight( const COLLADAFW::Light* light )
+	{
+		mTrace += "light";
+		appendUniqueId(mTrace, light->getUniqueId());
+		appendString(mTrace, light->getOriginalId());
+		appendString(mTrace, light->getName());
+		appendFormatted(mTrace, " type %d", (int)light->getLightType());
+		appendColor(mTrace, light->getColor());
+		appendAnimatableFloat(mTrace, light->getConstantAttenuation());
+		appendAnimatableFloat(mTrace, light->getLinearAttenuation());
+		appendAnimatableFloat(mTrace, light->getQuadraticAttenuation());
+		mTrace += "\n";
+		return true;
+	}
+
+	virtual bool writeAnimation( const COLLADAFW::Animation* animation )
+	{
+		mTrace += "animation";
+		appendUniqueId(mTrace, animation->getUniqueId());
+		appendString(mTrace, animation->getOriginalId());
+		appendFormatted(mTrace, " type %d\n", (int)animation->getAnimationType());
+		if ( animation->getAnimationType() != COLLADAFW::Animation::ANIMATION_CURVE )
+			return true;
+
+		const COLLADAFW::AnimationCurve* animationCurve = (const COLLADAFW::AnimationCurve*)animation;
+		appendFormatted(mTrace, "  dimension %lu interpolation %d\n", (unsigned long)animationCurve->getOutDimension(),
+			(int)animationCurve->getInterpolationType());
+		mTrace += "  input";
+		appendFloatOrDoubleArray(mTrace, animationCurve->getInputValues());
+		mTrace += "\n  output";
+		appendFloatOrDoubleArray(mTrace, animationCurve->getOutputValues());
+		mTrace += "\n  interpolations";
+		appendArray(mTrace, animationCurve->getInterpolationTypes());
+		mTrace += "\n";
+		return true;
+	}
+
+	virtual bool writeAnimationList( const COLLADAFW::AnimationList* animationList )
+	{
+		mTrace += "animation list";
+		appendUniqueId(mTrace, animationList->getUniqueId());
+		mTrace += "\n";
+
+		const COLLADAFW::AnimationList::AnimationBindings& animationBindings = animationList->getAnimationBindings();
+		for ( size_t i = 0; i < animationBindings.getCount(); ++i )
+		{
+			const COLLADAFW::AnimationList::AnimationBinding& animationBinding = animationBindings[i];
+			mTrace += "  binding";
+			appendUniqueId(mTrace, animationBinding.animation);
+			appendFormatted(mTrace, " %d %lu %lu\n", (int)animationBinding.animationClass,
+				(unsigned long)animationBinding.firstIndex, (unsigned long)animationBinding.secondIndex);
+		}
+		return true;
+	}
+
+	virtual bool writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData )
+	{
+		mTrace += "skin controller data";
+		appendUniqueId(mTrace, skinControllerData->getUniqueId());
+		appendString(mTrace, skinControllerData->getOriginalId());
+		appendFormatted(mTrace, " joints %lu\n  bind shape", (unsigned long)skinControllerData->getJointsCount());
+		appendMatrix(mTrace, skinControllerData->getBindShapeMatrix());
+		mTrace += "\n";
+
+		const COLLADAFW::Matrix4Array& inverseBindMatrices = skinControllerData->getInverseBindMatrices();
+		for ( size_t i = 0; i < inverseBindMatrices.getCount(); ++i )
+		{
+			mTrace += "  inverse bind";
+			appendMatrix(mTrace, inverseBindMatrices[i]);
+			mTrace += "\n";
+		}
+
+		mTrace += "  weights";
+		appendFloatOrDoubleArray(mTrace, skinControllerData->getWeights());
+		mTrace += "\n  joints per vertex";
+		appendArray(mTrace, skinControllerData->getJointsPerVertex());
+		mTrace += "\n  weight indices";
+		appendArray(mTrace, skinControllerData->getWeightIndices());
+		mTrace += "\n  joint indices";
+		appendArray(mTrace, skinControllerData->getJointIndices());
+		mTrace += "\n";
+		return true;
+	}
+
+	virtual bool writeController( const COLLADAFW::Controller* controller )
+	{
+		appendFormatted(mTrace, "controller %d", (int)controller->getControllerType());
+		appendUniqueId(mTrace, controller->getUniqueId());
+		appendUniqueId(mTrace, controller->getSource());
+		if ( controller->getControllerType() == COLLADAFW::Controller::CONTROLLER_TYPE_SKIN )
+		{
+			const COLLADAFW::SkinController* skinController = (const COLLADAFW::SkinController*)controller;
+			appendUniqueId(mTrace, skinController->getSkinControllerData());
+			const COLLADAFW::UniqueIdArray& joints = skinController->getJoints();
+			for ( size_t i = 0; i < joints.getCount(); ++i )
+				appendUniqueId(mTrace, joints[i]);
+		}
+		else if ( controller->getControllerType() == COLLADAFW::Controller::CONTROLLER_TYPE_MORPH )
+		{
+			const COLLADAFW::MorphController* morphController = (const COLLADAFW::MorphController*)controller;
+			const COLLADAFW::UniqueIdArray& morphTargets = morphController->getMorphTargets();
+			for ( size_t i = 0; i < morphTargets.getCount(); ++i )
+				appendUniqueId(mTrace, morphTargets[i]);
+			appendFloatOrDoubleArray(mTrace, morphController->getMorphWeights());
+		}
+		mTrace += "\n";
+		return true;
+	}
+
+	virtual bool writeFormulas( const COLLADAFW::Formulas* formulas )
+	{
+		appendFormatted(mTrace, "formulas %lu\n", (unsigned long)formulas->getFormulas().getCount());
+		return true;
+	}
+
+	virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene )
+	{
+		appendFormatted(mTrace, "kinematics scene %lu %lu\n", (unsigned long)kinematicsScene->getKinematicsModels().getCount(),
+			(unsigned long)kinematicsScene->getKinematicsControllers().getCount());
+		return true;
+	}
+};
+
+
+/** Prints all errors of a load and counts them.*/
+class ErrorHandler : public COLLADASaxFWL::IErrorHandler
+{
+private:
+	size_t mErrorCount;
+
+public:
+	ErrorHandler() : mErrorCount(0) {}
+
+	virtual bool handleError( const COLLADASaxFWL::IError* error )
+	{
+		mErrorCount++;
+		printf("  %s\n", error->getFullErrorMessage().c_str());
+		return false;
+	}
+
+	size_t getErrorCount() const { return mErrorCount; }
+};
+
+
+//--------------------------------------------------------------------
+/** Loads the document with a new loader, that uses the document cache if @a useDocumentCache is true.
+@return The trace of the writer, or an empty string if the load failed.*/
+static String loadDocument( bool useDocumentCache )
+{
+	ErrorHandler errorHandler;
+	COLLADASaxFWL::Loader loader(&errorHandler);
+	loader.setUseDocumentCache(useDocumentCache);
+	TraceWriter writer;
+	if ( !loader.loadDocument(DOCUMENT_FILE_NAME, &writer) || (errorHandler.getErrorCount() != 0) )
+		return String();
+	return writer.getTrace();
+}
+
+//--------------------------------------------------------------------
+/** Replays the document cache directly with a DocumentCacheReader, in the way Loader does.
+@return The trace of the writer, or an empty string if the cache could not be replayed.*/
+static String replayDocumentCache()
+{
+	COLLADASaxFWL::DocumentCacheReader documentCacheReader;
+	if ( !documentCacheReader.open(COLLADASaxFWL::DocumentCache::getCacheFileName(DOCUMENT_FILE_NAME)) )
+		return String();
+
+	TraceWriter writer;
+	writer.start();
+	bool success = documentCacheReader.replay(&writer);
+	writer.finish();
+	return success ? writer.getTrace() : String();
+}
+
+//--------------------------------------------------------------------
+/** Prints the first line of @a trace that differs from @a expectedTrace.
+@return True, if the traces are equal.*/
+static bool compareTraces( const char* loadName, const String& expectedTrace, const String& trace )
+{
+	if ( trace.empty() )
+	{
+		printf("Document cache: the %s failed\n", loadName);
+		return false;
+	}
+	if ( trace == expectedTrace )
+		return true;
+
+	size_t position = 0;
+	while ( (position < trace.length()) && (position < expectedTrace.length()) && (trace[position] == expectedTrace[position]) )
+		position++;
+	size_t lineBegin = expectedTrace.rfind('\n', position);
+	lineBegin = (lineBegin == String::npos || position == 0) ? 0 : lineBegin + 1;
+	printf("Document cache: the %s differs from the direct load\n  expected: %s\n  found:    %s\n", loadName,
+		expectedTrace.substr(lineBegin, expectedTrace.find('\n', lineBegin) - lineBegin).c_str(),
+		trace.substr(lineBegin, trace.find('\n', lineBegin) - lineBegin).c_str());
+	return false;
+}
+
+//--------------------------------------------------------------------
+bool documentCacheUnitTest()
+{
+	String cacheFileName = COLLADASaxFWL::DocumentCache::getCacheFileName(DOCUMENT_FILE_NAME);
+	remove(cacheFileName.c_str());
+
+	FILE* file = fopen(DOCUMENT_FILE_NAME, "wb");
+	if ( !file )
+	{
+		printf("Document cache: could not write %s\n", DOCUMENT_FILE_NAME);
+		return false;
+	}
+	fputs(DOCUMENT, file);
+	fclose(file);
+
+	bool success = true;
+	String directTrace = loadDocument(false);
+	if ( directTrace.empty() )
+	{
+		printf("Document cache: the direct load failed\n");
+		success = false;
+	}
+
+	if ( success )
+		success = compareTraces("recording load", directTrace, loadDocument(true));
+
+	FILE* cacheFile = fopen(cacheFileName.c_str(), "rb");
+	if ( success && !cacheFile )
+	{
+		printf("Document cache: the recording load did not write %s\n", cacheFileName.c_str());
+		success = false;
+	}
+	if ( cacheFile )
+		fclose(cacheFile);
+
+	if ( success )
+		success = compareTraces("replay of the cache", directTrace, replayDocumentCache());
+
+	if ( success )
+		success = compareTraces("load from the cache", directTrace, loadDocument(true));
+
+	if ( success )
+		printf("Document cache: %lu trace lines equal in all loads\n",
+			(unsigned long)std::count(directTrace.begin(), directTrace.end(), '\n'));
+
+	remove(cacheFileName.c_str());
+	remove(DOCUMENT_FILE_NAME);
+	return success;
+}
@@ -0,0 +1,130 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "elementRangeIndexUnitTest.h"
+
+#include "GeneratedSaxParserElementRangeIndex.h"
+
+#include <stdio.h>
+#include <string>
+
+
+typedef std::string String;
+
+/** Terminates a list of top level elements.*/
+static const char* const END_OF_ELEMENTS = 0;
+
+/** Top level elements of the documents that must be scanned, one document per list. Each element
+must be found with exactly this text as its range.*/
+static const char* const ELEMENT_LISTS[][5] =
+{
+	{ "<asset><unit meter=\"1\"/></asset>", "<library_nodes/>", END_OF_ELEMENTS },
+	{ "<extra><technique profile=\"A\"><extra><extra/></extra><extra>x</extra></technique></extra>",
+	  "<library_nodes><node id=\"n\"/></library_nodes>", END_OF_ELEMENTS },
+	{ "<library_nodes><node><library_nodes><node/></library_nodes></node></library_nodes>",
+	  "<scene/>", END_OF_ELEMENTS },
+	{ "<library_geometries><!-- </library_geometries> --><geometry/></library_geometries>",
+	  "<library_effects><![CDATA[</library_effects><library_effects>]]></library_effects>",
+	  "<library_images><?pi </library_images>?></library_images>", END_OF_ELEMENTS },
+	{ "<asset a=\"</asset>\" b='<asset>'>t</asset >", "<library_nodes><library_nodesX/></library_nodes>",
+	  "<scene><!----></scene>", END_OF_ELEMENTS },
+	{ END_OF_ELEMENTS }
+};
+
+/** Documents that must not be scanned, because an end tag is missing.*/
+static const char* const CUT_OFF_DOCUMENTS[] =
+{
+	"<COLLADA><extra><extra></extra></COLLADA>",
+	"<COLLADA><asset><!-- </asset> --></COLLADA>",
+	"<COLLADA><asset><![CDATA[</asset>]]>",
+	"<COLLADA><asset></asset>",
+	"<COLLADA><asset><!-- </asset></COLLADA>"
+};
+
+
+//--------------------------------------------------------------------
+/** Builds a document of the elements in @a elements and checks that each of them is found with its text
+as range.*/
+static bool testElementList( const char* const* elements )
+{
+	String document = "<?xml version=\"1.0\"?>\n<!-- </COLLADA> -->\n<COLLADA version=\"1.4.1\">";
+	size_t elementCount = 0;
+	for ( ; elements[elementCount]; ++elementCount )
+	{
+		document += "\n  ";
+		document += elements[elementCount];
+	}
+	document += "\n</COLLADA>\n";
+
+	GeneratedSaxParser::ElementRangeIndex elementRangeIndex;
+	bool success = elementRangeIndex.scan(document.c_str(), document.length());
+
+	const GeneratedSaxParser::ElementRangeIndex::ElementRangeList& elementRanges = elementRangeIndex.getElementRanges();
+	if ( success && (elementRanges.size() == elementCount) )
+	{
+		for ( size_t i = 0; i < elementCount; ++i )
+		{
+			const GeneratedSaxParser::ElementRangeIndex::ElementRange& elementRange = elementRanges[i];
+			String text(document, elementRange.begin, elementRange.end - elementRange.begin);
+			String name(elements[i] + 1, String(elements[i]).find_first_of(" />") - 1);
+			if ( (text != elements[i]) || (elementRange.name != name) )
+			{
+				success = false;
+				break;
+			}
+		}
+	}
+	else
+	{
+		success = false;
+	}
+
+	if ( !success )
+	{
+		printf("Element range index: wrong ranges in\n%s", document.c_str());
+		for ( size_t i = 0; i < elementRanges.size(); ++i )
+		{
+			const GeneratedSaxParser::ElementRangeIndex::ElementRange& elementRange = elementRanges[i];
+			printf("  found %s: %s\n", elementRange.name.c_str(),
+				String(document, elementRange.begin, elementRange.end - elementRange.begin).c_str());
+		}
+	}
+	return success;
+}
+
+//--------------------------------------------------------------------
+/** Checks that @a document is rejected and the index is left empty.*/
+static bool testCutOffDocument( const char* document )
+{
+	GeneratedSaxParser::ElementRangeIndex elementRangeIndex;
+	String documentString = document;
+	if ( !elementRangeIndex.scan(documentString.c_str(), documentString.length())
+		&& elementRangeIndex.getElementRanges().empty() )
+	{
+		return true;
+	}
+	printf("Element range index: the cut off document was scanned: %s\n", document);
+	return false;
+}
+
+//--------------------------------------------------------------------
+bool elementRangeIndexUnitTest()
+{
+	bool success = true;
+	size_t documentCount = 0;
+	for ( size_t i = 0; ELEMENT_LISTS[i][0]; ++i, ++documentCount )
+		success = testElementList(ELEMENT_LISTS[i]) && success;
+	for ( size_t i = 0; i < sizeof(CUT_OFF_DOCUMENTS) / sizeof(CUT_OFF_DOCUMENTS[0]); ++i, ++documentCount )
+		success = testCutOffDocument(CUT_OFF_DOCUMENTS[i]) && success;
+
+	if ( success )
+		printf("Element range index: %lu documents scanned as expected\n", (unsigned long)documentCount);
+	return success;
+}
@@ -0,0 +1,38 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "addressUnitTest.h"
+#include "documentCacheUnitTest.h"
+#include "elementRangeIndexUnitTest.h"
+#include "sidTreeNodeUnitTest.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/** Number of random strings in the address corpus, if no other number is passed.*/
+static const size_t DEFAULT_RANDOM_STRING_COUNT = 60000;
+
+
+int main( int argc, char** argv )
+{
+	if ( (argc > 2) || ((argc > 1) && (atoi(argv[1]) < 0)) )
+	{
+		printf("Usage: %s [randomStringCount]\n", argv[0]);
+		return 1;
+	}
+
+	size_t randomStringCount = (argc > 1) ? (size_t)atoi(argv[1]) : DEFAULT_RANDOM_STRING_COUNT;
+	bool success = addressUnitTest(randomStringCount);
+	success = documentCacheUnitTest() && success;
+	success = elementRangeIndexUnitTest() && success;
+	success = sidTreeNodeUnitTest() && success;
+	return success ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "sidTreeNodeUnitTest.h"
+
+#include "COLLADASaxFWLSidTreeNode.h"
+
+#include <stdio.h>
+#include <string>
+#include <map>
+#include <vector>
+
+
+/** Number of random sid trees, on which SidTreeNode::findChildBySid is compared to the former lookup.*/
+static const size_t SID_TREE_COUNT = 200;
+
+/** Number of nodes in each random sid tree.*/
+static const size_t SID_TREE_NODE_COUNT = 300;
+
+/** The sids of the nodes in the random sid trees. Nodes without sid, i.e. with an id, are included.*/
+static const char* const SID_TREE_SIDS[] = { "", "a", "b", "c", "d" };
+static const size_t SID_TREE_SID_COUNT = sizeof(SID_TREE_SIDS) / sizeof(SID_TREE_SIDS[0]);
+
+
+//--------------------------------------------------------------------
+/** The sid tree node as it was before SidTreeNode shared one sid index per tree. Every node maps the sids
+and hierarchy levels of all its descendants to the first descendant created with them. Used as reference
+for SidTreeNode::findChildBySid.*/
+class FormerSidTreeNode
+{
+private:
+	typedef std::map< std::pair<std::string, size_t>, FormerSidTreeNode*> SidLevelNodeMap;
+
+	FormerSidTreeNode* mParent;
+	std::string mSid;
+	SidLevelNodeMap mChildren;
+	std::vector<FormerSidTreeNode*> mDirectChildren;
+
+public:
+	FormerSidTreeNode( const std::string& sid, FormerSidTreeNode* parent ) : mParent(parent), mSid(sid) {}
+
+	~FormerSidTreeNode()
+	{
+		for ( size_t i = 0; i < mDirectChildren.size(); ++i )
+			delete mDirectChildren[i];
+	}
+
+	FormerSidTreeNode* createAndAddChild( const std::string& sid )
+	{
+		FormerSidTreeNode* newChild = new FormerSidTreeNode(sid, this);
+		mDirectChildren.push_back(newChild);
+		if ( sid.empty() )
+			return newChild;
+
+		// the level is increased by the sid of the parent of each ancestor, as the former code did
+		size_t hierarchyLevel = 0;
+		mChildren.insert(std::make_pair(std::make_pair(sid, hierarchyLevel), newChild));
+		for ( FormerSidTreeNode* node = this; node->mParent; node = node->mParent )
+		{
+			if ( !node->mParent->mSid.empty() )
+				++hierarchyLevel;
+			node->mParent->mChildren.insert(std::make_pair(std::make_pair(sid, hierarchyLevel), newChild));
+		}
+		return newChild;
+	}
+
+	FormerSidTreeNode* findChildBySid( const std::string& sid )
+	{
+		SidLevelNodeMap::const_iterator it = mChildren.lower_bound(std::make_pair(sid, (size_t)0));
+		if ( (it == mChildren.end()) || (it->first.first != sid) )
+			return 0;
+		return it->second;
+	}
+};
+
+//--------------------------------------------------------------------
+bool sidTreeNodeUnitTest()
+{
+	// a fixed linear congruential generator, to get the same trees on all platforms
+	unsigned int random = 12345;
+
+	size_t lookupCount = 0;
+	size_t differenceCount = 0;
+	for ( size_t i = 0; i < SID_TREE_COUNT; ++i )
+	{
+		COLLADASaxFWL::SidTreeNode* root = new COLLADASaxFWL::SidTreeNode("", 0);
+		FormerSidTreeNode* formerRoot = new FormerSidTreeNode("", 0);
+
+		// nodes[k] and formerNodes[k] are the same node in both trees, path holds the indices of the open nodes
+		std::vector<COLLADASaxFWL::SidTreeNode*> nodes(1, root);
+		std::vector<FormerSidTreeNode*> formerNodes(1, formerRoot);
+		std::vector<size_t> path(1, 0);
+		while ( nodes.size() < SID_TREE_NODE_COUNT )
+		{
+			random = random * 1103515245 + 12345;
+			unsigned int value = random >> 16;
+			if ( (value % 3 == 0) && (path.size() > 1) )
+			{
+				path.pop_back();
+				continue;
+			}
+			const char* sid = SID_TREE_SIDS[(value / 3) % SID_TREE_SID_COUNT];
+			nodes.push_back(nodes[path.back()]->createAndAddChild(sid));
+			formerNodes.push_back(formerNodes[path.back()]->createAndAddChild(sid));
+			path.push_back(nodes.size() - 1);
+		}
+
+		// map the found nodes to their indices to compare the results of both trees
+		std::map<const void*, size_t> nodeIndices;
+		for ( size_t j = 0; j < nodes.size(); ++j )
+		{
+			nodeIndices[nodes[j]] = j;
+			nodeIndices[formerNodes[j]] = j;
+		}
+		nodeIndices[0] = nodes.size();
+
+		for ( size_t j = 0; j < nodes.size(); ++j )
+		{
+			for ( size_t k = 1; k < SID_TREE_SID_COUNT; ++k )
+			{
+				++lookupCount;
+				if ( nodeIndices[nodes[j]->findChildBySid(SID_TREE_SIDS[k])] != nodeIndices[formerNodes[j]->findChildBySid(SID_TREE_SIDS[k])] )
+					++differenceCount;
+			}
+		}
+
+		delete root;
+		delete formerRoot;
+	}
+
+	printf("SidTreeNode: %u random trees, %u lookups, %u differ from the former lookup%s\n", (unsigned int)SID_TREE_COUNT,
+		(unsigned int)lookupCount, (unsigned int)differenceCount, (differenceCount == 0) ? "" : " FAILED");
+	return differenceCount == 0;
+}
@@ -0,0 +1,115 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+	This file is part of COLLADAStreamWriter.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASTREAMWRITER_PARALLELENCODER_H__
+#define __COLLADASTREAMWRITER_PARALLELENCODER_H__
+
+#include "COLLADASWPrerequisites.h"
+
+#include <vector>
+
+namespace Common
+{
+	class CharacterBuffer;
+}
+
+namespace COLLADASW
+{
+
+    /** Formats large arrays on a pool of worker threads. An array is split into chunks, that are formatted
+	concurrently into private buffers. The chunks are copied into the target buffer in their order, the output
+	is therefore identical to formatting the array serially. While the calling thread waits for the next
+	chunk to copy, it formats chunks as well. The number of chunks formatted ahead of the copied ones is
+	limited, such that the memory used does not depend on the size of the array.*/
+    class ParallelEncoder
+    {
+	public:
+		/** Formats the chunks of one array.*/
+		class IChunkEncoder
+		{
+		public:
+			virtual ~IChunkEncoder() {}
+
+			/** Formats the chunk with index @a chunkIndex into @a buffer. Called concurrently for different
+			chunks.*/
+			virtual void encodeChunk( size_t chunkIndex, Common::CharacterBuffer& buffer ) const = 0;
+		};
+
+	private:
+		/** The threads and synchronization primitives of the operating system.*/
+		struct ThreadData;
+
+		/** The private buffer of a chunk.*/
+		struct Slot;
+
+		typedef std::vector<Slot*> SlotList;
+
+	private:
+		/** The encoder of the array currently formatted, or 0 if there is none.*/
+		const IChunkEncoder* mChunkEncoder;
+
+		/** The number of chunks of the array currently formatted.*/
+		size_t mChunkCount;
+
+		/** The index of the next chunk to format.*/
+		size_t mNextChunk;
+
+		/** The number of chunks already copied into the target buffer.*/
+		size_t mCopiedChunks;
+
+		/** The buffers of the chunks. Chunk i is formatted into slot i modulo the number of slots.*/
+		SlotList mSlots;
+
+		/** True, if the worker threads should exit.*/
+		bool mStop;
+
+		/** The worker threads. All members above are only accessed with its mutex locked, except the slots
+		of the chunks claimed by a thread.*/
+		ThreadData* mThreadData;
+
+	public:
+
+        /** Constructor. Starts up to @a threadCount worker threads.*/
+		ParallelEncoder( size_t threadCount );
+
+        /** Destructor. Stops the worker threads.*/
+		~ParallelEncoder();
+
+		/** Returns the number of worker threads that have been started.*/
+		size_t getThreadCount() const;
+
+		/** Formats @a chunkCount chunks using @a chunkEncoder and copies them in their order into
+		@a targetBuffer. Returns after all chunks have been copied.*/
+		void encode( const IChunkEncoder& chunkEncoder, size_t chunkCount, Common::CharacterBuffer& targetBuffer );
+
+	private:
+		/** The main loop of the worker threads.*/
+		void run();
+
+		/** Sets @a chunkIndex to the next chunk to format, if there is one and its slot is free. Must be called
+		with the mutex locked.
+		@return True, if a chunk has been claimed, false otherwise.*/
+		bool claimChunk( size_t& chunkIndex );
+
+		/** Formats the claimed chunk @a chunkIndex into its slot. Must be called with the mutex unlocked.*/
+		void encodeChunk( size_t chunkIndex );
+
+        /** Disable default copy ctor. */
+		ParallelEncoder( const ParallelEncoder& pre );
+
+        /** Disable default assignment operator. */
+		const ParallelEncoder& operator= ( const ParallelEncoder& pre );
+
+	};
+
+} //namespace COLLADASW
+
+
+#endif //__COLLADASTREAMWRITER_PARALLELENCODER_H__
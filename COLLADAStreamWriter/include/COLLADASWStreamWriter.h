@@ -41,6 +41,7 @@ namespace COLLADASW
 {
 
     class StreamWriter;
+	class ParallelEncoder;
 
 	typedef unsigned long ElementIndexType;
 
@@ -106,6 +107,13 @@ namespace COLLADASW
         /** If true, the double values will be exported with a maximum precision of 20 digits. */
         bool mDoublePrecision;
 
+		/** If true, floats and doubles are exported with the shortest representation that is read back
+		exactly, instead of a fixed number of digits. mDoublePrecision is ignored then.*/
+		bool mShortestRoundTrip;
+
+		/** Formats large arrays of numbers on worker threads, or 0 if they are formatted serially.*/
+		ParallelEncoder* mParallelEncoder;
+
         OpenTagStack mOpenTags;  //!< A stack that holds all the open tags.
 
         size_t mLevel;
@@ -116,6 +124,10 @@ namespace COLLADASW
 
 		static const int CHARACTERBUFFERSIZE;
 
+		/** The number of values of an array formatted as one chunk by mParallelEncoder. Smaller arrays are 
+		formatted serially.*/
+		static const size_t PARALLEL_ENCODING_CHUNK_SIZE;
+
         static const String mWhiteSpaceString;
 
         friend class TagCloser;
@@ -317,6 +329,25 @@ namespace COLLADASW
 		/** Returns the version of the COLLADA file that ias written by the StreamWriter.*/
 		COLLADAVersion getCOLLADAVersion() const { return mCOLLADAVersion; } 
 
+		/** Returns true, if floats and doubles are written with the shortest representation that is read
+		back exactly.*/
+		bool getShortestRoundTrip() const { return mShortestRoundTrip; }
+
+		/** If @a shortestRoundTrip is true, floats and doubles are written with the shortest representation
+		that is read back exactly, instead of a fixed number of significant digits. Small numbers are not
+		rounded to zero then.*/
+		void setShortestRoundTrip( bool shortestRoundTrip ) { mShortestRoundTrip = shortestRoundTrip; }
+
+		/** Returns the number of worker threads that format large arrays of numbers, or 0 if they are 
+		formatted serially.*/
+		size_t getEncodingThreadCount() const;
+
+		/** Starts @a threadCount worker threads, that format large arrays of numbers passed to appendValues()
+		in chunks. The calling thread formats chunks as well and writes them in their order, the output is
+		therefore identical to the serial formatting. If @a threadCount is 0 (default) or no thread can be 
+		started, the arrays are formatted serially.*/
+		void setEncodingThreadCount( size_t threadCount );
+
     private:
 
 		/** Closes all elements opened since the element with index @a elementIndex has been open, 
@@ -377,6 +408,28 @@ namespace COLLADASW
         /** Adds the bool @a value to the stream*/
         void appendBoolean ( bool value );
 
+		/** Adds the double @a number to @a buffer*/
+		void appendNumber ( Common::CharacterBuffer& buffer, double number ) const;
+
+		/** Adds the float @a number to @a buffer*/
+		void appendNumber ( Common::CharacterBuffer& buffer, float number ) const;
+
+		/** Adds the int @a number to @a buffer*/
+		void appendNumber ( Common::CharacterBuffer& buffer, int number ) const;
+
+		/** Adds the unsigned long @a number to @a buffer*/
+		void appendNumber ( Common::CharacterBuffer& buffer, unsigned long number ) const;
+
+		/** Formats a chunk of an array passed to appendValues() on the worker threads.*/
+		template<class Type>
+		class ArrayChunkEncoder;
+
+		/** Adds the @a length values in @a values, each followed by a space, to the stream using
+		mParallelEncoder.
+		@return False, if nothing has been added, since the array is too small or there are no worker threads.*/
+		template<class Type>
+		bool appendValuesParallel ( const Type values[], size_t length );
+
         /** Adds a new line to the stream*/
         inline void appendNewLine()
         {
@@ -0,0 +1,316 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+	This file is part of COLLADAStreamWriter.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASWParallelEncoder.h"
+
+#include "COLLADABUPlatform.h"
+
+#include "CommonCharacterBuffer.h"
+#include "CommonIBufferFlusher.h"
+
+#if defined(COLLADABU_OS_WIN)
+#	include <windows.h>
+#	include <process.h>
+#else
+#	include <pthread.h>
+#endif
+
+
+namespace COLLADASW
+{
+
+#if defined(COLLADABU_OS_WIN)
+
+	struct ParallelEncoder::ThreadData
+	{
+		std::vector<HANDLE> threads;
+		CRITICAL_SECTION mutex;
+		/** Signaled, when a chunk can be claimed or the threads should stop.*/
+		CONDITION_VARIABLE chunkAvailable;
+		/** Signaled, when a worker thread has formatted a chunk.*/
+		CONDITION_VARIABLE chunkEncoded;
+
+		ThreadData()
+		{
+			InitializeCriticalSection(&mutex);
+			InitializeConditionVariable(&chunkAvailable);
+			InitializeConditionVariable(&chunkEncoded);
+		}
+
+		~ThreadData() { DeleteCriticalSection(&mutex); }
+
+		void lock() { EnterCriticalSection(&mutex); }
+		void unlock() { LeaveCriticalSection(&mutex); }
+		void waitForChunkAvailable() { SleepConditionVariableCS(&chunkAvailable, &mutex, INFINITE); }
+		void waitForChunkEncoded() { SleepConditionVariableCS(&chunkEncoded, &mutex, INFINITE); }
+		void signalChunkAvailable() { WakeAllConditionVariable(&chunkAvailable); }
+		void signalChunkEncoded() { WakeConditionVariable(&chunkEncoded); }
+
+		static unsigned __stdcall threadMain( void* encoder )
+		{
+			((ParallelEncoder*)encoder)->run();
+			return 0;
+		}
+
+		bool start( ParallelEncoder* encoder )
+		{
+			HANDLE thread = (HANDLE)_beginthreadex(0, 0, threadMain, encoder, 0, 0);
+			if ( thread == 0 )
+				return false;
+			threads.push_back(thread);
+			return true;
+		}
+
+		void join()
+		{
+			for ( size_t i = 0; i < threads.size(); ++i )
+			{
+				WaitForSingleObject(threads[i], INFINITE);
+				CloseHandle(threads[i]);
+			}
+			threads.clear();
+		}
+	};
+
+#else
+
+	struct ParallelEncoder::ThreadData
+	{
+		std::vector<pthread_t> threads;
+		pthread_mutex_t mutex;
+		/** Signaled, when a chunk can be claimed or the threads should stop.*/
+		pthread_cond_t chunkAvailable;
+		/** Signaled, when a worker thread has formatted a chunk.*/
+		pthread_cond_t chunkEncoded;
+
+		ThreadData()
+		{
+			pthread_mutex_init(&mutex, 0);
+			pthread_cond_init(&chunkAvailable, 0);
+			pthread_cond_init(&chunkEncoded, 0);
+		}
+
+		~ThreadData()
+		{
+			pthread_cond_destroy(&chunkEncoded);
+			pthread_cond_destroy(&chunkAvailable);
+			pthread_mutex_destroy(&mutex);
+		}
+
+		void lock() { pthread_mutex_lock(&mutex); }
+		void unlock() { pthread_mutex_unlock(&mutex); }
+		void waitForChunkAvailable() { pthread_cond_wait(&chunkAvailable, &mutex); }
+		void waitForChunkEncoded() { pthread_cond_wait(&chunkEncoded, &mutex); }
+		void signalChunkAvailable() { pthread_cond_broadcast(&chunkAvailable); }
+		void signalChunkEncoded() { pthread_cond_signal(&chunkEncoded); }
+
+		static void* threadMain( void* encoder )
+		{
+			((ParallelEncoder*)encoder)->run();
+			return 0;
+		}
+
+		bool start( ParallelEncoder* encoder )
+		{
+			pthread_t thread;
+			if ( pthread_create(&thread, 0, threadMain, encoder) != 0 )
+				return false;
+			threads.push_back(thread);
+			return true;
+		}
+
+		void join()
+		{
+			for ( size_t i = 0; i < threads.size(); ++i )
+				pthread_join(threads[i], 0);
+			threads.clear();
+		}
+	};
+
+#endif
+
+	/** Flusher that collects the formatted chunk in memory, until it is copied into the target buffer.*/
+	class ChunkBufferFlusher : public Common::IBufferFlusher
+	{
+	private:
+		std::vector<char> mData;
+
+	public:
+		ChunkBufferFlusher() {}
+		virtual ~ChunkBufferFlusher() {}
+
+		/** Returns the data received since the last call of clear().*/
+		const std::vector<char>& getData() const { return mData; }
+
+		/** Discards the received data, but keeps the allocated memory.*/
+		void clear() { mData.clear(); }
+
+		virtual bool receiveData( const char* buffer, size_t length )
+		{
+			mData.insert( mData.end(), buffer, buffer + length );
+			return true;
+		}
+
+		virtual bool flush() { return true; }
+		virtual void startMark() {}
+		virtual MarkId endMark() { return INVALID_ID; }
+		virtual bool jumpToMark( MarkId markId, bool keepMarkId = false ) { return false; }
+		virtual int getError() const { return 0; }
+	};
+
+	/** The size of the character buffer of each slot. Larger chunks are collected by the flusher.*/
+	static const size_t SLOT_BUFFER_SIZE = 1024*64;
+
+	struct ParallelEncoder::Slot
+	{
+		ChunkBufferFlusher flusher;
+		Common::CharacterBuffer buffer;
+		/** True, if the chunk of the slot has been formatted and not yet copied.*/
+		bool encoded;
+
+		Slot()
+			: buffer(SLOT_BUFFER_SIZE, &flusher)
+			, encoded(false)
+		{}
+	};
+
+    //---------------------------------------------------------------
+	ParallelEncoder::ParallelEncoder( size_t threadCount )
+		: mChunkEncoder(0)
+		, mChunkCount(0)
+		, mNextChunk(0)
+		, mCopiedChunks(0)
+		, mStop(false)
+		, mThreadData( new ThreadData() )
+	{
+		for ( size_t i = 0; i < threadCount; ++i )
+		{
+			if ( !mThreadData->start(this) )
+				break;
+		}
+
+		// two chunks per thread, including the calling one, keep the threads busy while chunks are copied
+		size_t slotCount = 2 * (getThreadCount() + 1);
+		for ( size_t i = 0; i < slotCount; ++i )
+			mSlots.push_back( new Slot() );
+	}
+
+    //---------------------------------------------------------------
+	ParallelEncoder::~ParallelEncoder()
+	{
+		mThreadData->lock();
+		mStop = true;
+		mThreadData->signalChunkAvailable();
+		mThreadData->unlock();
+
+		mThreadData->join();
+		delete mThreadData;
+
+		for ( size_t i = 0; i < mSlots.size(); ++i )
+			delete mSlots[i];
+	}
+
+    //---------------------------------------------------------------
+	size_t ParallelEncoder::getThreadCount() const
+	{
+		return mThreadData->threads.size();
+	}
+
+    //---------------------------------------------------------------
+	void ParallelEncoder::encode( const IChunkEncoder& chunkEncoder, size_t chunkCount, Common::CharacterBuffer& targetBuffer )
+	{
+		mThreadData->lock();
+		mChunkEncoder = &chunkEncoder;
+		mChunkCount = chunkCount;
+		mNextChunk = 0;
+		mCopiedChunks = 0;
+		mThreadData->signalChunkAvailable();
+
+		for ( size_t i = 0; i < chunkCount; ++i )
+		{
+			Slot& slot = *mSlots[i % mSlots.size()];
+			while ( !slot.encoded )
+			{
+				// help the worker threads instead of waiting for them
+				size_t chunkIndex;
+				if ( claimChunk(chunkIndex) )
+				{
+					mThreadData->unlock();
+					encodeChunk(chunkIndex);
+					mThreadData->lock();
+					mSlots[chunkIndex % mSlots.size()]->encoded = true;
+				}
+				else
+				{
+					mThreadData->waitForChunkEncoded();
+				}
+			}
+			mThreadData->unlock();
+
+			// the slot can not be claimed again, before the chunk has been copied
+			const std::vector<char>& data = slot.flusher.getData();
+			if ( !data.empty() )
+				targetBuffer.copyToBuffer( &data[0], data.size() );
+
+			mThreadData->lock();
+			slot.encoded = false;
+			++mCopiedChunks;
+			mThreadData->signalChunkAvailable();
+		}
+
+		mChunkEncoder = 0;
+		mThreadData->unlock();
+	}
+
+    //---------------------------------------------------------------
+	void ParallelEncoder::run()
+	{
+		mThreadData->lock();
+		for ( ;; )
+		{
+			size_t chunkIndex;
+			if ( !claimChunk(chunkIndex) )
+			{
+				if ( mStop )
+					break;
+				mThreadData->waitForChunkAvailable();
+				continue;
+			}
+			mThreadData->unlock();
+
+			encodeChunk(chunkIndex);
+
+			mThreadData->lock();
+			mSlots[chunkIndex % mSlots.size()]->encoded = true;
+			mThreadData->signalChunkEncoded();
+		}
+		mThreadData->unlock();
+	}
+
+    //---------------------------------------------------------------
+	bool ParallelEncoder::claimChunk( size_t& chunkIndex )
+	{
+		if ( !mChunkEncoder || (mNextChunk >= mChunkCount) || (mNextChunk >= mCopiedChunks + mSlots.size()) )
+			return false;
+
+		chunkIndex = mNextChunk++;
+		return true;
+	}
+
+    //---------------------------------------------------------------
+	void ParallelEncoder::encodeChunk( size_t chunkIndex )
+	{
+		Slot& slot = *mSlots[chunkIndex % mSlots.size()];
+		slot.flusher.clear();
+		mChunkEncoder->encodeChunk( chunkIndex, slot.buffer );
+		slot.buffer.flushBuffer();
+	}
+
+} //namespace COLLADASW
@@ -12,6 +12,7 @@
 
 #include "COLLADASWConstants.h"
 #include "COLLADASWException.h"
+#include "COLLADASWParallelEncoder.h"
 
 #include "COLLADABUStringUtils.h"
 
@@ -62,6 +63,7 @@ namespace COLLADASW
 
 	const int StreamWriter::FWRITEBUFFERSIZE = 1024*64;
 	const int StreamWriter::CHARACTERBUFFERSIZE = 1024*64*64;
+	const size_t StreamWriter::PARALLEL_ENCODING_CHUNK_SIZE = 1024*16;
 
 
     //---------------------------------------------------------------
@@ -71,6 +73,8 @@ namespace COLLADASW
 			, mLevel ( 0 )
             , mIndent ( 2 )
             , mDoublePrecision (doublePrecision)
+            , mShortestRoundTrip (false)
+            , mParallelEncoder (0)
 			, mCOLLADAVersion(cOLLADAVersion)
 			, mNextElementIndex(0)
     {
@@ -85,6 +89,7 @@ namespace COLLADASW
     StreamWriter::~StreamWriter()
     {
         endDocument();
+		delete mParallelEncoder;
 		delete mCharacterBuffer;
 		delete mBufferFlusher;
     }
@@ -112,6 +117,71 @@ namespace COLLADASW
 		}
     }
 
+	//---------------------------------------------------------------
+	template<class Type>
+	class StreamWriter::ArrayChunkEncoder : public ParallelEncoder::IChunkEncoder
+	{
+	private:
+		const StreamWriter& mStreamWriter;
+		const Type* mValues;
+		size_t mLength;
+
+	public:
+		ArrayChunkEncoder( const StreamWriter& streamWriter, const Type values[], size_t length )
+			: mStreamWriter(streamWriter)
+			, mValues(values)
+			, mLength(length)
+		{}
+
+		virtual void encodeChunk( size_t chunkIndex, Common::CharacterBuffer& buffer ) const
+		{
+			size_t first = chunkIndex * PARALLEL_ENCODING_CHUNK_SIZE;
+			size_t last = std::min( first + PARALLEL_ENCODING_CHUNK_SIZE, mLength );
+			for ( size_t i = first; i < last; ++i )
+			{
+				mStreamWriter.appendNumber( buffer, mValues[i] );
+				buffer.copyToBuffer( ' ' );
+			}
+		}
+	};
+
+	//---------------------------------------------------------------
+	template<class Type>
+	bool StreamWriter::appendValuesParallel ( const Type values[], size_t length )
+	{
+		// an array of a single chunk would be formatted by the calling thread anyway
+		if ( !mParallelEncoder || (length < 2 * PARALLEL_ENCODING_CHUNK_SIZE) )
+			return false;
+
+		ArrayChunkEncoder<Type> chunkEncoder( *this, values, length );
+		size_t chunkCount = (length + PARALLEL_ENCODING_CHUNK_SIZE - 1) / PARALLEL_ENCODING_CHUNK_SIZE;
+		mParallelEncoder->encode( chunkEncoder, chunkCount, *mCharacterBuffer );
+		return true;
+	}
+
+    //---------------------------------------------------------------
+	size_t StreamWriter::getEncodingThreadCount() const
+	{
+		return mParallelEncoder ? mParallelEncoder->getThreadCount() : 0;
+	}
+
+    //---------------------------------------------------------------
+	void StreamWriter::setEncodingThreadCount( size_t threadCount )
+	{
+		delete mParallelEncoder;
+		mParallelEncoder = 0;
+
+		if ( threadCount == 0 )
+			return;
+
+		mParallelEncoder = new ParallelEncoder( threadCount );
+		if ( mParallelEncoder->getThreadCount() == 0 )
+		{
+			delete mParallelEncoder;
+			mParallelEncoder = 0;
+		}
+	}
+
     //---------------------------------------------------------------
     void StreamWriter::endDocument()
     {
@@ -358,10 +428,13 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        for ( size_t i=0; i<length; ++i )
+        if ( !appendValuesParallel ( values, length ) )
         {
-            appendNumber ( values[i] );
-            appendChar ( ' ' );
+            for ( size_t i=0; i<length; ++i )
+            {
+                appendNumber ( values[i] );
+                appendChar ( ' ' );
+            }
         }
 
         mOpenTags.back().mHasText = true;
@@ -374,10 +447,13 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        for ( size_t i=0; i<length; ++i )
+        if ( !appendValuesParallel ( values, length ) )
         {
-            appendNumber ( values[i] );
-            appendChar ( ' ' );
+            for ( size_t i=0; i<length; ++i )
+            {
+                appendNumber ( values[i] );
+                appendChar ( ' ' );
+            }
         }
 
         mOpenTags.back().mHasText = true;
@@ -436,10 +512,13 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        for ( size_t i=0; i<length; ++i )
+        if ( !appendValuesParallel ( values, length ) )
         {
-            appendNumber ( values[i] );
-            appendChar ( ' ' );
+            for ( size_t i=0; i<length; ++i )
+            {
+                appendNumber ( values[i] );
+                appendChar ( ' ' );
+            }
         }
 
         mOpenTags.back().mHasText = true;
@@ -498,11 +577,14 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        std::vector<float>::const_iterator it = values.begin();
-        for ( ; it!=values.end(); ++it )
+        if ( values.empty() || !appendValuesParallel ( &values[0], values.size() ) )
         {
-            appendNumber ( *it );
-            appendChar ( ' ' );
+            std::vector<float>::const_iterator it = values.begin();
+            for ( ; it!=values.end(); ++it )
+            {
+                appendNumber ( *it );
+                appendChar ( ' ' );
+            }
         }
 
         mOpenTags.back().mHasText = true;
@@ -515,11 +597,14 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        std::vector<double>::const_iterator it = values.begin();
-        for ( ; it!=values.end(); ++it )
+        if ( values.empty() || !appendValuesParallel ( &values[0], values.size() ) )
         {
-            appendNumber ( *it );
-            appendChar ( ' ' );
+            std::vector<double>::const_iterator it = values.begin();
+            for ( ; it!=values.end(); ++it )
+            {
+                appendNumber ( *it );
+                appendChar ( ' ' );
+            }
         }
 
         mOpenTags.back().mHasText = true;
@@ -549,11 +634,14 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        std::vector<unsigned long>::const_iterator it = values.begin();
-        for ( ; it!=values.end(); ++it )
+        if ( values.empty() || !appendValuesParallel ( &values[0], values.size() ) )
         {
-            appendNumber ( *it );
-            appendChar ( ' ' );
+            std::vector<unsigned long>::const_iterator it = values.begin();
+            for ( ; it!=values.end(); ++it )
+            {
+                appendNumber ( *it );
+                appendChar ( ' ' );
+            }
         }
 
         mOpenTags.back().mHasText = true;
@@ -1063,33 +1151,19 @@ namespace COLLADASW
 	//---------------------------------------------------------------
 	void StreamWriter::appendNumber( double number )
 	{
-		if ( COLLADABU::Math::Utils::equals<double>(number, 0, std::numeric_limits<double>::epsilon()) )
-		{
-			appendChar('0');
-		}
-		else
-		{
-			mCharacterBuffer->copyToBufferAsChar( number, mDoublePrecision );
-		}
+		appendNumber( *mCharacterBuffer, number );
 	}
 
 	//---------------------------------------------------------------
 	void StreamWriter::appendNumber( float number )
 	{
-		if ( COLLADABU::Math::Utils::equals<float>(number, 0, std::numeric_limits<float>::epsilon()) )
-		{
-			appendChar('0');
-		}
-		else
-		{
-			mCharacterBuffer->copyToBufferAsChar( number );
-		}
+		appendNumber( *mCharacterBuffer, number );
 	}
 
 	//---------------------------------------------------------------
 	void StreamWriter::appendNumber( int number )
 	{
-		mCharacterBuffer->copyToBufferAsChar( number );
+		appendNumber( *mCharacterBuffer, number );
 	}
 
 	//---------------------------------------------------------------
@@ -1107,7 +1181,7 @@ namespace COLLADASW
 	//---------------------------------------------------------------
 	void StreamWriter::appendNumber( unsigned long number )
 	{
-		mCharacterBuffer->copyToBufferAsChar( number );
+		appendNumber( *mCharacterBuffer, number );
 	}
 
 	//---------------------------------------------------------------
@@ -1127,4 +1201,56 @@ namespace COLLADASW
 	{
 		mCharacterBuffer->copyToBufferAsChar( value );
 	}
+
+	//---------------------------------------------------------------
+	void StreamWriter::appendNumber( Common::CharacterBuffer& buffer, double number ) const
+	{
+		if ( mShortestRoundTrip )
+		{
+			if ( number == 0 )
+				buffer.copyToBuffer('0');
+			else
+				buffer.copyToBufferAsCharShortest( number );
+		}
+		else if ( COLLADABU::Math::Utils::equals<double>(number, 0, std::numeric_limits<double>::epsilon()) )
+		{
+			buffer.copyToBuffer('0');
+		}
+		else
+		{
+			buffer.copyToBufferAsChar( number, mDoublePrecision );
+		}
+	}
+
+	//---------------------------------------------------------------
+	void StreamWriter::appendNumber( Common::CharacterBuffer& buffer, float number ) const
+	{
+		if ( mShortestRoundTrip )
+		{
+			if ( number == 0 )
+				buffer.copyToBuffer('0');
+			else
+				buffer.copyToBufferAsCharShortest( number );
+		}
+		else if ( COLLADABU::Math::Utils::equals<float>(number, 0, std::numeric_limits<float>::epsilon()) )
+		{
+			buffer.copyToBuffer('0');
+		}
+		else
+		{
+			buffer.copyToBufferAsChar( number );
+		}
+	}
+
+	//---------------------------------------------------------------
+	void StreamWriter::appendNumber( Common::CharacterBuffer& buffer, int number ) const
+	{
+		buffer.copyToBufferAsChar( number );
+	}
+
+	//---------------------------------------------------------------
+	void StreamWriter::appendNumber( Common::CharacterBuffer& buffer, unsigned long number ) const
+	{
+		buffer.copyToBufferAsChar( number );
+	}
 } //namespace COLLADASW
@@ -23,9 +23,11 @@ public:
 		double directionZ;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", directionX);
-			fprintf(file,"%f ", directionY);
-			fprintf(file,"%f", directionZ);
+			writeNumber(file,directionX);
+			fputc(' ',file);
+			writeNumber(file,directionY);
+			fputc(' ',file);
+			writeNumber(file,directionZ);
 		}
 	};
 public:
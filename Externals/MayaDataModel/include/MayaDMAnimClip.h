@@ -40,8 +40,8 @@ public:
 		size_t size = (ac_end-ac_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ac[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ac[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -51,7 +51,7 @@ public:
 	}
 	void appendAbsoluteChannel(bool ac)const
 	{
-		fprintf(mFile," %i",ac);
+		appendNumber(mFile,ac);
 	}
 	void endAbsoluteChannel()const
 	{
@@ -68,8 +68,8 @@ public:
 		size_t size = (co_end-co_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",co[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,co[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -79,7 +79,7 @@ public:
 	}
 	void appendChannelOffset(double co)const
 	{
-		fprintf(mFile," %f",co);
+		appendNumber(mFile,co);
 	}
 	void endChannelOffset()const
 	{
@@ -45,8 +45,8 @@ public:
 		size_t size = (ktl_end-ktl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ktl[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ktl[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -56,7 +56,7 @@ public:
 	}
 	void appendKeyTanLocked(bool ktl)const
 	{
-		fprintf(mFile," %i",ktl);
+		appendNumber(mFile,ktl);
 	}
 	void endKeyTanLocked()const
 	{
@@ -73,8 +73,8 @@ public:
 		size_t size = (kwl_end-kwl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",kwl[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,kwl[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -84,7 +84,7 @@ public:
 	}
 	void appendKeyWeightLocked(bool kwl)const
 	{
-		fprintf(mFile," %i",kwl);
+		appendNumber(mFile,kwl);
 	}
 	void endKeyWeightLocked()const
 	{
@@ -101,8 +101,8 @@ public:
 		size_t size = (kix_end-kix_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",kix[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,kix[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -112,7 +112,7 @@ public:
 	}
 	void appendKeyTanInX(double kix)const
 	{
-		fprintf(mFile," %f",kix);
+		appendNumber(mFile,kix);
 	}
 	void endKeyTanInX()const
 	{
@@ -129,8 +129,8 @@ public:
 		size_t size = (kiy_end-kiy_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",kiy[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,kiy[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -140,7 +140,7 @@ public:
 	}
 	void appendKeyTanInY(double kiy)const
 	{
-		fprintf(mFile," %f",kiy);
+		appendNumber(mFile,kiy);
 	}
 	void endKeyTanInY()const
 	{
@@ -157,8 +157,8 @@ public:
 		size_t size = (kox_end-kox_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",kox[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,kox[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -168,7 +168,7 @@ public:
 	}
 	void appendKeyTanOutX(double kox)const
 	{
-		fprintf(mFile," %f",kox);
+		appendNumber(mFile,kox);
 	}
 	void endKeyTanOutX()const
 	{
@@ -185,8 +185,8 @@ public:
 		size_t size = (koy_end-koy_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",koy[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,koy[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -196,7 +196,7 @@ public:
 	}
 	void appendKeyTanOutY(double koy)const
 	{
-		fprintf(mFile," %f",koy);
+		appendNumber(mFile,koy);
 	}
 	void endKeyTanOutY()const
 	{
@@ -213,8 +213,8 @@ public:
 		size_t size = (kit_end-kit_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",kit[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,kit[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -224,7 +224,7 @@ public:
 	}
 	void appendKeyTanInType(unsigned int kit)const
 	{
-		fprintf(mFile," %i",kit);
+		appendNumber(mFile,kit);
 	}
 	void endKeyTanInType()const
 	{
@@ -241,8 +241,8 @@ public:
 		size_t size = (kot_end-kot_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",kot[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,kot[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -252,7 +252,7 @@ public:
 	}
 	void appendKeyTanOutType(unsigned int kot)const
 	{
-		fprintf(mFile," %i",kot);
+		appendNumber(mFile,kot);
 	}
 	void endKeyTanOutType()const
 	{
@@ -269,8 +269,8 @@ public:
 		size_t size = (kbd_end-kbd_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",kbd[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,kbd[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -280,7 +280,7 @@ public:
 	}
 	void appendKeyBreakdown(bool kbd)const
 	{
-		fprintf(mFile," %i",kbd);
+		appendNumber(mFile,kbd);
 	}
 	void endKeyBreakdown()const
 	{
@@ -297,8 +297,8 @@ public:
 		size_t size = (kyts_end-kyts_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",kyts[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,kyts[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -308,7 +308,7 @@ public:
 	}
 	void appendKeyTickDrawSpecial(bool kyts)const
 	{
-		fprintf(mFile," %i",kyts);
+		appendNumber(mFile,kyts);
 	}
 	void endKeyTickDrawSpecial()const
 	{
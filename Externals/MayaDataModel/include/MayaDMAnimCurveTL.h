@@ -22,8 +22,9 @@ public:
 		double keyValue;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", keyTime);
-			fprintf(file,"%f", keyValue);
+			writeNumber(file,keyTime);
+			fputc(' ',file);
+			writeNumber(file,keyValue);
 		}
 	};
 public:
@@ -57,7 +58,7 @@ public:
 	}
 	void appendKeyTimeValue(const KeyTimeValue& ktv)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ktv.write(mFile);
 	}
 	void endKeyTimeValue()const
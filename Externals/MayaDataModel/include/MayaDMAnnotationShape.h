@@ -56,7 +56,7 @@ public:
 	}
 	void appendDagObjectMatrix(const matrix& dom)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		dom.write(mFile);
 	}
 	void endDagObjectMatrix()const
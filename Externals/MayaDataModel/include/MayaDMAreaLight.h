@@ -47,10 +47,13 @@ public:
 			short smapWindowYMax;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", smapWindowXMin);
-				fprintf(file,"%i ", smapWindowYMin);
-				fprintf(file,"%i ", smapWindowXMax);
-				fprintf(file,"%i", smapWindowYMax);
+				writeNumber(file,smapWindowXMin);
+				fputc(' ',file);
+				writeNumber(file,smapWindowYMin);
+				fputc(' ',file);
+				writeNumber(file,smapWindowXMax);
+				fputc(' ',file);
+				writeNumber(file,smapWindowYMax);
 			}
 		} smapWindow;
 		bool smapMerge;
@@ -64,41 +67,70 @@ public:
 		bool areaVisible;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miExportMrLight);
-			fprintf(file,"%i ", emitPhotons);
+			writeNumber(file,miExportMrLight);
+			fputc(' ',file);
+			writeNumber(file,emitPhotons);
+			fputc(' ',file);
 			energy.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", photonIntensity);
-			fprintf(file,"%f ", exponent);
-			fprintf(file,"%i ", causticPhotons);
-			fprintf(file,"%i ", causticPhotonsEmit);
-			fprintf(file,"%i ", globIllPhotons);
-			fprintf(file,"%i ", globIllPhotonsEmit);
-			fprintf(file,"%i ", shadowMap);
-			fprintf(file,"%i ", smapResolution);
-			fprintf(file,"%i ", smapSamples);
-			fprintf(file,"%f ", smapSoftness);
-			fprintf(file,"%f ", smapBias);
+			fputc(' ', file);
+			writeNumber(file,photonIntensity);
+			fputc(' ',file);
+			writeNumber(file,exponent);
+			fputc(' ',file);
+			writeNumber(file,causticPhotons);
+			fputc(' ',file);
+			writeNumber(file,causticPhotonsEmit);
+			fputc(' ',file);
+			writeNumber(file,globIllPhotons);
+			fputc(' ',file);
+			writeNumber(file,globIllPhotonsEmit);
+			fputc(' ',file);
+			writeNumber(file,shadowMap);
+			fputc(' ',file);
+			writeNumber(file,smapResolution);
+			fputc(' ',file);
+			writeNumber(file,smapSamples);
+			fputc(' ',file);
+			writeNumber(file,smapSoftness);
+			fputc(' ',file);
+			writeNumber(file,smapBias);
+			fputc(' ',file);
 			smapFilename.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", smapLightName);
-			fprintf(file,"%i ", smapSceneName);
-			fprintf(file,"%i ", smapFrameExt);
-			fprintf(file,"%i ", smapDetail);
-			fprintf(file,"%i ", smapDetailSamples);
-			fprintf(file,"%f ", smapDetailAccuracy);
-			fprintf(file,"%i ", smapDetailAlpha);
+			fputc(' ', file);
+			writeNumber(file,smapLightName);
+			fputc(' ',file);
+			writeNumber(file,smapSceneName);
+			fputc(' ',file);
+			writeNumber(file,smapFrameExt);
+			fputc(' ',file);
+			writeNumber(file,smapDetail);
+			fputc(' ',file);
+			writeNumber(file,smapDetailSamples);
+			fputc(' ',file);
+			writeNumber(file,smapDetailAccuracy);
+			fputc(' ',file);
+			writeNumber(file,smapDetailAlpha);
+			fputc(' ',file);
 			smapWindow.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", smapMerge);
-			fprintf(file,"%i ", smapTrace);
-			fprintf(file,"%i ", areaLight);
-			fprintf(file,"%i ", areaType);
-			fprintf(file,"%f ", areaShapeIntensity);
-			fprintf(file,"%i ", areaHiSamples);
-			fprintf(file,"%i ", areaHiSampleLimit);
-			fprintf(file,"%i ", areaLoSamples);
-			fprintf(file,"%i ", areaVisible);
+			fputc(' ', file);
+			writeNumber(file,smapMerge);
+			fputc(' ',file);
+			writeNumber(file,smapTrace);
+			fputc(' ',file);
+			writeNumber(file,areaLight);
+			fputc(' ',file);
+			writeNumber(file,areaType);
+			fputc(' ',file);
+			writeNumber(file,areaShapeIntensity);
+			fputc(' ',file);
+			writeNumber(file,areaHiSamples);
+			fputc(' ',file);
+			writeNumber(file,areaHiSampleLimit);
+			fputc(' ',file);
+			writeNumber(file,areaLoSamples);
+			fputc(' ',file);
+			writeNumber(file,areaVisible);
+			fputc(' ',file);
 		}
 	};
 public:
@@ -27,12 +27,16 @@ public:
 		void write(FILE* file) const
 		{
 			inputSurface.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", weight);
-			fprintf(file,"%f ", parameterU);
-			fprintf(file,"%f ", parameterV);
-			fprintf(file,"%i ", cvIthIndex);
-			fprintf(file,"%i", cvJthIndex);
+			fputc(' ', file);
+			writeNumber(file,weight);
+			fputc(' ',file);
+			writeNumber(file,parameterU);
+			fputc(' ',file);
+			writeNumber(file,parameterV);
+			fputc(' ',file);
+			writeNumber(file,cvIthIndex);
+			fputc(' ',file);
+			writeNumber(file,cvJthIndex);
 		}
 	};
 	struct Result{
@@ -71,7 +75,7 @@ public:
 	}
 	void appendSurfacePoint(const SurfacePoint& sp)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		sp.write(mFile);
 	}
 	void endSurfacePoint()const
@@ -40,8 +40,8 @@ public:
 		size_t size = (wt_end-wt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",wt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,wt[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -51,7 +51,7 @@ public:
 	}
 	void appendWeight(double wt)const
 	{
-		fprintf(mFile," %f",wt);
+		appendNumber(mFile,wt);
 	}
 	void endWeight()const
 	{
@@ -68,8 +68,8 @@ public:
 		size_t size = (u_end-u_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",u[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,u[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -79,7 +79,7 @@ public:
 	}
 	void appendParameterU(double u)const
 	{
-		fprintf(mFile," %f",u);
+		appendNumber(mFile,u);
 	}
 	void endParameterU()const
 	{
@@ -96,8 +96,8 @@ public:
 		size_t size = (v_end-v_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,v[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -107,7 +107,7 @@ public:
 	}
 	void appendParameterV(double v)const
 	{
-		fprintf(mFile," %f",v);
+		appendNumber(mFile,v);
 	}
 	void endParameterV()const
 	{
@@ -35,8 +35,8 @@ public:
 		size_t size = (i_end-i_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",i_[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,i_[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendInput(double i)const
 	{
-		fprintf(mFile," %f",i);
+		appendNumber(mFile,i);
 	}
 	void endInput()const
 	{
@@ -35,8 +35,8 @@ public:
 		size_t size = (ia_end-ia_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ia[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ia[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendInputAngle(double ia)const
 	{
-		fprintf(mFile," %f",ia);
+		appendNumber(mFile,ia);
 	}
 	void endInputAngle()const
 	{
@@ -63,8 +63,8 @@ public:
 		size_t size = (il_end-il_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",il[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,il[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -74,7 +74,7 @@ public:
 	}
 	void appendInputLinear(double il)const
 	{
-		fprintf(mFile," %f",il);
+		appendNumber(mFile,il);
 	}
 	void endInputLinear()const
 	{
@@ -25,7 +25,7 @@ public:
 				void write(FILE* file) const
 				{
 					inputPointsTarget.write(file);
-					fprintf(file, " ");
+					fputc(' ', file);
 					inputComponentsTarget.write(file);
 				}
 			}* inputTargetItem;
@@ -36,14 +36,14 @@ public:
 				for(size_t i=0; i<size; ++i)
 				{
 					inputTargetItem[i].write(file);
-					fprintf(file, " ");
-					if(i+1<size) fprintf(file," ");
+					fputc(' ', file);
+					if(i+1<size) fputc(' ',file);
 				}
 				size = sizeof(targetWeights)/sizeof(float);
 				for(size_t i=0; i<size; ++i)
 				{
-					fprintf(file,"%f", targetWeights[i]);
-					if(i+1<size) fprintf(file," ");
+					writeNumber(file,targetWeights[i]);
+					if(i+1<size) fputc(' ',file);
 				}
 			}
 		}* inputTargetGroup;
@@ -53,7 +53,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				inputTargetGroup[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -80,8 +80,8 @@ public:
 		size_t size = (w_end-w_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,w[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -91,7 +91,7 @@ public:
 	}
 	void appendWeight(float w)const
 	{
-		fprintf(mFile," %f",w);
+		appendNumber(mFile,w);
 	}
 	void endWeight()const
 	{
@@ -122,7 +122,7 @@ public:
 	}
 	void appendIcon(const string& icn)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		icn.write(mFile);
 	}
 	void endIcon()const
@@ -153,7 +153,7 @@ public:
 	}
 	void appendInputTarget(const InputTarget& it)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		it.write(mFile);
 	}
 	void endInputTarget()const
@@ -184,7 +184,7 @@ public:
 	}
 	void appendInputTargetGroup(const InputTarget::InputTargetGroup& itg)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		itg.write(mFile);
 	}
 	void endInputTargetGroup()const
@@ -215,7 +215,7 @@ public:
 	}
 	void appendInputTargetItem(const InputTarget::InputTargetGroup::InputTargetItem& iti)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		iti.write(mFile);
 	}
 	void endInputTargetItem()const
@@ -245,8 +245,8 @@ public:
 		size_t size = (tw_end-tw_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tw[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,tw[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -256,7 +256,7 @@ public:
 	}
 	void appendTargetWeights(float tw)const
 	{
-		fprintf(mFile," %f",tw);
+		appendNumber(mFile,tw);
 	}
 	void endTargetWeights()const
 	{
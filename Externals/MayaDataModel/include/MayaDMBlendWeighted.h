@@ -35,8 +35,8 @@ public:
 		size_t size = (w_end-w_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,w[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendWeight(float w)const
 	{
-		fprintf(mFile," %f",w);
+		appendNumber(mFile,w);
 	}
 	void endWeight()const
 	{
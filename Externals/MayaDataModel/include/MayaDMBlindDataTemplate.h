@@ -25,19 +25,19 @@ public:
 			void write(FILE* file) const
 			{
 				bdPresetAttr.write(file);
-				fprintf(file, " ");
+				fputc(' ', file);
 				bdPresetValue.write(file);
 			}
 		}* bdPresetElements;
 		void write(FILE* file) const
 		{
 			bdPresetName.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			size_t size = sizeof(bdPresetElements)/sizeof(BdPresetElements);
 			for(size_t i=0; i<size; ++i)
 			{
 				bdPresetElements[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -47,7 +47,7 @@ public:
 		void write(FILE* file) const
 		{
 			bdUserInfoName.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			bdUserInfoValue.write(file);
 		}
 	};
@@ -87,7 +87,7 @@ public:
 	}
 	void appendBlindDataPresets(const BlindDataPresets& bdps)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		bdps.write(mFile);
 	}
 	void endBlindDataPresets()const
@@ -125,7 +125,7 @@ public:
 	}
 	void appendBdPresetElements(const BlindDataPresets::BdPresetElements& bdpe)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		bdpe.write(mFile);
 	}
 	void endBdPresetElements()const
@@ -170,7 +170,7 @@ public:
 	}
 	void appendBdUserInfo(const BdUserInfo& bdui)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		bdui.write(mFile);
 	}
 	void endBdUserInfo()const
@@ -23,9 +23,11 @@ public:
 		unsigned int leafCurl_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", leafCurl_Position);
-			fprintf(file,"%f ", leafCurl_FloatValue);
-			fprintf(file,"%i", leafCurl_Interp);
+			writeNumber(file,leafCurl_Position);
+			fputc(' ',file);
+			writeNumber(file,leafCurl_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,leafCurl_Interp);
 		}
 	};
 	struct PetalCurl{
@@ -34,9 +36,11 @@ public:
 		unsigned int petalCurl_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", petalCurl_Position);
-			fprintf(file,"%f ", petalCurl_FloatValue);
-			fprintf(file,"%i", petalCurl_Interp);
+			writeNumber(file,petalCurl_Position);
+			fputc(' ',file);
+			writeNumber(file,petalCurl_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,petalCurl_Interp);
 		}
 	};
 	struct WidthScale{
@@ -45,9 +49,11 @@ public:
 		unsigned int widthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", widthScale_Position);
-			fprintf(file,"%f ", widthScale_FloatValue);
-			fprintf(file,"%i", widthScale_Interp);
+			writeNumber(file,widthScale_Position);
+			fputc(' ',file);
+			writeNumber(file,widthScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,widthScale_Interp);
 		}
 	};
 	struct LeafWidthScale{
@@ -56,9 +62,11 @@ public:
 		unsigned int leafWidthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", leafWidthScale_Position);
-			fprintf(file,"%f ", leafWidthScale_FloatValue);
-			fprintf(file,"%i", leafWidthScale_Interp);
+			writeNumber(file,leafWidthScale_Position);
+			fputc(' ',file);
+			writeNumber(file,leafWidthScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,leafWidthScale_Interp);
 		}
 	};
 	struct PetalWidthScale{
@@ -67,9 +75,11 @@ public:
 		unsigned int petalWidthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", petalWidthScale_Position);
-			fprintf(file,"%f ", petalWidthScale_FloatValue);
-			fprintf(file,"%i", petalWidthScale_Interp);
+			writeNumber(file,petalWidthScale_Position);
+			fputc(' ',file);
+			writeNumber(file,petalWidthScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,petalWidthScale_Interp);
 		}
 	};
 	struct TwigLengthScale{
@@ -78,9 +88,11 @@ public:
 		unsigned int twigLengthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", twigLengthScale_Position);
-			fprintf(file,"%f ", twigLengthScale_FloatValue);
-			fprintf(file,"%i", twigLengthScale_Interp);
+			writeNumber(file,twigLengthScale_Position);
+			fputc(' ',file);
+			writeNumber(file,twigLengthScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,twigLengthScale_Interp);
 		}
 	};
 	struct Environment{
@@ -89,10 +101,11 @@ public:
 		unsigned int environment_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", environment_Position);
+			writeNumber(file,environment_Position);
+			fputc(' ',file);
 			environment_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", environment_Interp);
+			fputc(' ', file);
+			writeNumber(file,environment_Interp);
 		}
 	};
 	struct ReflectionRolloff{
@@ -101,9 +114,11 @@ public:
 		unsigned int reflectionRolloff_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", reflectionRolloff_Position);
-			fprintf(file,"%f ", reflectionRolloff_FloatValue);
-			fprintf(file,"%i", reflectionRolloff_Interp);
+			writeNumber(file,reflectionRolloff_Position);
+			fputc(' ',file);
+			writeNumber(file,reflectionRolloff_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,reflectionRolloff_Interp);
 		}
 	};
 public:
@@ -1102,7 +1117,7 @@ public:
 	}
 	void appendLeafCurl(const LeafCurl& lcl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		lcl.write(mFile);
 	}
 	void endLeafCurl()const
@@ -1343,7 +1358,7 @@ public:
 	}
 	void appendPetalCurl(const PetalCurl& pcl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		pcl.write(mFile);
 	}
 	void endPetalCurl()const
@@ -1802,7 +1817,7 @@ public:
 	}
 	void appendWidthScale(const WidthScale& wsc)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		wsc.write(mFile);
 	}
 	void endWidthScale()const
@@ -1848,7 +1863,7 @@ public:
 	}
 	void appendLeafWidthScale(const LeafWidthScale& lws)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		lws.write(mFile);
 	}
 	void endLeafWidthScale()const
@@ -1894,7 +1909,7 @@ public:
 	}
 	void appendPetalWidthScale(const PetalWidthScale& pws)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		pws.write(mFile);
 	}
 	void endPetalWidthScale()const
@@ -1940,7 +1955,7 @@ public:
 	}
 	void appendTwigLengthScale(const TwigLengthScale& tls)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		tls.write(mFile);
 	}
 	void endTwigLengthScale()const
@@ -2078,7 +2093,7 @@ public:
 	}
 	void appendEnvironment(const Environment& env)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		env.write(mFile);
 	}
 	void endEnvironment()const
@@ -2140,7 +2155,7 @@ public:
 	}
 	void appendReflectionRolloff(const ReflectionRolloff& rro)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		rro.write(mFile);
 	}
 	void endReflectionRolloff()const
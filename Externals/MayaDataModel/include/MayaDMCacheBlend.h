@@ -25,7 +25,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				perPtWeights[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -36,10 +36,13 @@ public:
 		double weight;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", start);
-			fprintf(file,"%f ", end);
-			fprintf(file,"%i ", range);
-			fprintf(file,"%f", weight);
+			writeNumber(file,start);
+			fputc(' ',file);
+			writeNumber(file,end);
+			fputc(' ',file);
+			writeNumber(file,range);
+			fputc(' ',file);
+			writeNumber(file,weight);
 		}
 	};
 public:
@@ -73,7 +76,7 @@ public:
 	}
 	void appendInCache(const InCache& ic)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ic.write(mFile);
 	}
 	void endInCache()const
@@ -105,7 +108,7 @@ public:
 	}
 	void appendPerPtWeights(const doubleArray& ppw)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ppw.write(mFile);
 	}
 	void endPerPtWeights()const
@@ -141,7 +144,7 @@ public:
 	}
 	void appendCacheData(const CacheData& cd)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cd.write(mFile);
 	}
 	void endCacheData()const
@@ -27,20 +27,22 @@ public:
 			void write(FILE* file) const
 			{
 				filmRollPivot.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%f ", filmRollValue);
-				fprintf(file,"%i", filmRollOrder);
+				fputc(' ', file);
+				writeNumber(file,filmRollValue);
+				fputc(' ',file);
+				writeNumber(file,filmRollOrder);
 			}
 		} filmRollControl;
 		double postScale;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", preScale);
+			writeNumber(file,preScale);
+			fputc(' ',file);
 			filmTranslate.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			filmRollControl.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", postScale);
+			fputc(' ', file);
+			writeNumber(file,postScale);
 		}
 	};
 	struct MentalRayControls{
@@ -56,16 +58,26 @@ public:
 		bool miFbComputeContour;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miFbComputeColor);
-			fprintf(file,"%i ", miFbBitsizeColor);
-			fprintf(file,"%i ", miFbComputeAlpha);
-			fprintf(file,"%i ", miFbBitsizeAlpha);
-			fprintf(file,"%i ", miFbComputeDepth);
-			fprintf(file,"%i ", miFbComputeNormal);
-			fprintf(file,"%i ", miFbComputeMotion);
-			fprintf(file,"%i ", miFbComputeCoverage);
-			fprintf(file,"%i ", miFbComputeTag);
-			fprintf(file,"%i ", miFbComputeContour);
+			writeNumber(file,miFbComputeColor);
+			fputc(' ',file);
+			writeNumber(file,miFbBitsizeColor);
+			fputc(' ',file);
+			writeNumber(file,miFbComputeAlpha);
+			fputc(' ',file);
+			writeNumber(file,miFbBitsizeAlpha);
+			fputc(' ',file);
+			writeNumber(file,miFbComputeDepth);
+			fputc(' ',file);
+			writeNumber(file,miFbComputeNormal);
+			fputc(' ',file);
+			writeNumber(file,miFbComputeMotion);
+			fputc(' ',file);
+			writeNumber(file,miFbComputeCoverage);
+			fputc(' ',file);
+			writeNumber(file,miFbComputeTag);
+			fputc(' ',file);
+			writeNumber(file,miFbComputeContour);
+			fputc(' ',file);
 		}
 	};
 public:
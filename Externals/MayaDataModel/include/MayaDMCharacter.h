@@ -23,8 +23,9 @@ public:
 			short clipEvaluate_InmapFrom;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", clipEvaluate_InmapTo);
-				fprintf(file,"%i", clipEvaluate_InmapFrom);
+				writeNumber(file,clipEvaluate_InmapTo);
+				fputc(' ',file);
+				writeNumber(file,clipEvaluate_InmapFrom);
 			}
 		}* clipEvaluate_Inmap;
 		struct ClipEvaluate_Outmap{
@@ -32,8 +33,9 @@ public:
 			short clipEvaluate_OutmapFrom;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", clipEvaluate_OutmapTo);
-				fprintf(file,"%i", clipEvaluate_OutmapFrom);
+				writeNumber(file,clipEvaluate_OutmapTo);
+				fputc(' ',file);
+				writeNumber(file,clipEvaluate_OutmapFrom);
 			}
 		}* clipEvaluate_Outmap;
 		void write(FILE* file) const
@@ -42,14 +44,14 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				clipEvaluate_Inmap[i].write(file);
-				fprintf(file, " ");
-				if(i+1<size) fprintf(file," ");
+				fputc(' ', file);
+				if(i+1<size) fputc(' ',file);
 			}
 			size = sizeof(clipEvaluate_Outmap)/sizeof(ClipEvaluate_Outmap);
 			for(size_t i=0; i<size; ++i)
 			{
 				clipEvaluate_Outmap[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -90,7 +92,7 @@ public:
 	}
 	void appendClipEvaluate_Inmap(const ClipEvaluate::ClipEvaluate_Inmap& cei)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cei.write(mFile);
 	}
 	void endClipEvaluate_Inmap()const
@@ -131,7 +133,7 @@ public:
 	}
 	void appendClipEvaluate_Outmap(const ClipEvaluate::ClipEvaluate_Outmap& ceo)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ceo.write(mFile);
 	}
 	void endClipEvaluate_Outmap()const
@@ -159,8 +161,8 @@ public:
 		size_t size = (uv_end-uv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uv[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,uv[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -170,7 +172,7 @@ public:
 	}
 	void appendUnitlessValues(double uv)const
 	{
-		fprintf(mFile," %f",uv);
+		appendNumber(mFile,uv);
 	}
 	void endUnitlessValues()const
 	{
@@ -187,8 +189,8 @@ public:
 		size_t size = (lv_end-lv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",lv[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,lv[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -198,7 +200,7 @@ public:
 	}
 	void appendLinearValues(double lv)const
 	{
-		fprintf(mFile," %f",lv);
+		appendNumber(mFile,lv);
 	}
 	void endLinearValues()const
 	{
@@ -215,8 +217,8 @@ public:
 		size_t size = (av_end-av_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",av[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,av[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -226,7 +228,7 @@ public:
 	}
 	void appendAngularValues(double av)const
 	{
-		fprintf(mFile," %f",av);
+		appendNumber(mFile,av);
 	}
 	void endAngularValues()const
 	{
@@ -243,8 +245,8 @@ public:
 		size_t size = (tv_end-tv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tv[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,tv[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -254,7 +256,7 @@ public:
 	}
 	void appendTimeValues(double tv)const
 	{
-		fprintf(mFile," %f",tv);
+		appendNumber(mFile,tv);
 	}
 	void endTimeValues()const
 	{
@@ -35,8 +35,8 @@ public:
 		size_t size = (il_end-il_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",il[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,il[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendInLevel(bool il)const
 	{
-		fprintf(mFile," %i",il);
+		appendNumber(mFile,il);
 	}
 	void endInLevel()const
 	{
@@ -63,8 +63,8 @@ public:
 		size_t size = (dl_end-dl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",dl[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,dl[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -74,7 +74,7 @@ public:
 	}
 	void appendDisplayLevel(unsigned int dl)const
 	{
-		fprintf(mFile," %i",dl);
+		appendNumber(mFile,dl);
 	}
 	void endDisplayLevel()const
 	{
@@ -24,8 +24,9 @@ public:
 				short clipEval_InmapFrom;
 				void write(FILE* file) const
 				{
-					fprintf(file,"%i ", clipEval_InmapTo);
-					fprintf(file,"%i", clipEval_InmapFrom);
+					writeNumber(file,clipEval_InmapTo);
+					fputc(' ',file);
+					writeNumber(file,clipEval_InmapFrom);
 				}
 			}* clipEval_Inmap;
 			struct ClipEval_Outmap{
@@ -33,8 +34,9 @@ public:
 				short clipEval_OutmapFrom;
 				void write(FILE* file) const
 				{
-					fprintf(file,"%i ", clipEval_OutmapTo);
-					fprintf(file,"%i", clipEval_OutmapFrom);
+					writeNumber(file,clipEval_OutmapTo);
+					fputc(' ',file);
+					writeNumber(file,clipEval_OutmapFrom);
 				}
 			}* clipEval_Outmap;
 			void write(FILE* file) const
@@ -43,14 +45,14 @@ public:
 				for(size_t i=0; i<size; ++i)
 				{
 					clipEval_Inmap[i].write(file);
-					fprintf(file, " ");
-					if(i+1<size) fprintf(file," ");
+					fputc(' ', file);
+					if(i+1<size) fputc(' ',file);
 				}
 				size = sizeof(clipEval_Outmap)/sizeof(ClipEval_Outmap);
 				for(size_t i=0; i<size; ++i)
 				{
 					clipEval_Outmap[i].write(file);
-					if(i+1<size) fprintf(file," ");
+					if(i+1<size) fputc(' ',file);
 				}
 			}
 		}* clipEval;
@@ -60,7 +62,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				clipEval[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -102,7 +104,7 @@ public:
 	}
 	void appendClipEvalList(const ClipEvalList& cel)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cel.write(mFile);
 	}
 	void endClipEvalList()const
@@ -133,7 +135,7 @@ public:
 	}
 	void appendClipEval(const ClipEvalList::ClipEval& cev)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cev.write(mFile);
 	}
 	void endClipEval()const
@@ -164,7 +166,7 @@ public:
 	}
 	void appendClipEval_Inmap(const ClipEvalList::ClipEval::ClipEval_Inmap& cevi)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cevi.write(mFile);
 	}
 	void endClipEval_Inmap()const
@@ -205,7 +207,7 @@ public:
 	}
 	void appendClipEval_Outmap(const ClipEvalList::ClipEval::ClipEval_Outmap& cevo)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cevo.write(mFile);
 	}
 	void endClipEval_Outmap()const
@@ -246,7 +248,7 @@ public:
 	}
 	void appendCharacterdata(const Characterdata& cd)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cd.write(mFile);
 	}
 	void endCharacterdata()const
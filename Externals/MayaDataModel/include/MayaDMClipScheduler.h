@@ -23,8 +23,9 @@ public:
 			short blendList_InmapFrom;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", blendList_InmapTo);
-				fprintf(file,"%i", blendList_InmapFrom);
+				writeNumber(file,blendList_InmapTo);
+				fputc(' ',file);
+				writeNumber(file,blendList_InmapFrom);
 			}
 		}* blendList_Inmap;
 		struct BlendList_Outmap{
@@ -32,8 +33,9 @@ public:
 			short blendList_OutmapFrom;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", blendList_OutmapTo);
-				fprintf(file,"%i", blendList_OutmapFrom);
+				writeNumber(file,blendList_OutmapTo);
+				fputc(' ',file);
+				writeNumber(file,blendList_OutmapFrom);
 			}
 		}* blendList_Outmap;
 		void write(FILE* file) const
@@ -42,14 +44,14 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				blendList_Inmap[i].write(file);
-				fprintf(file, " ");
-				if(i+1<size) fprintf(file," ");
+				fputc(' ', file);
+				if(i+1<size) fputc(' ',file);
 			}
 			size = sizeof(blendList_Outmap)/sizeof(BlendList_Outmap);
 			for(size_t i=0; i<size; ++i)
 			{
 				blendList_Outmap[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -58,8 +60,9 @@ public:
 		int secondClip;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", firstClip);
-			fprintf(file,"%i", secondClip);
+			writeNumber(file,firstClip);
+			fputc(' ',file);
+			writeNumber(file,secondClip);
 		}
 	};
 	struct ClipFunction{
@@ -68,8 +71,9 @@ public:
 			short clipFunction_InmapFrom;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", clipFunction_InmapTo);
-				fprintf(file,"%i", clipFunction_InmapFrom);
+				writeNumber(file,clipFunction_InmapTo);
+				fputc(' ',file);
+				writeNumber(file,clipFunction_InmapFrom);
 			}
 		}* clipFunction_Inmap;
 		struct ClipFunction_Outmap{
@@ -77,8 +81,9 @@ public:
 			short clipFunction_OutmapFrom;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", clipFunction_OutmapTo);
-				fprintf(file,"%i", clipFunction_OutmapFrom);
+				writeNumber(file,clipFunction_OutmapTo);
+				fputc(' ',file);
+				writeNumber(file,clipFunction_OutmapFrom);
 			}
 		}* clipFunction_Outmap;
 		void write(FILE* file) const
@@ -87,14 +92,14 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				clipFunction_Inmap[i].write(file);
-				fprintf(file, " ");
-				if(i+1<size) fprintf(file," ");
+				fputc(' ', file);
+				if(i+1<size) fputc(' ',file);
 			}
 			size = sizeof(clipFunction_Outmap)/sizeof(ClipFunction_Outmap);
 			for(size_t i=0; i<size; ++i)
 			{
 				clipFunction_Outmap[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -129,7 +134,7 @@ public:
 	}
 	void appendBlendList(const BlendList& bl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		bl.write(mFile);
 	}
 	void endBlendList()const
@@ -160,7 +165,7 @@ public:
 	}
 	void appendBlendList_Inmap(const BlendList::BlendList_Inmap& bli)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		bli.write(mFile);
 	}
 	void endBlendList_Inmap()const
@@ -201,7 +206,7 @@ public:
 	}
 	void appendBlendList_Outmap(const BlendList::BlendList_Outmap& blo)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		blo.write(mFile);
 	}
 	void endBlendList_Outmap()const
@@ -242,7 +247,7 @@ public:
 	}
 	void appendBlendClips(const BlendClips& bc)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		bc.write(mFile);
 	}
 	void endBlendClips()const
@@ -283,7 +288,7 @@ public:
 	}
 	void appendClipFunction_Inmap(const ClipFunction::ClipFunction_Inmap& cfi)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cfi.write(mFile);
 	}
 	void endClipFunction_Inmap()const
@@ -324,7 +329,7 @@ public:
 	}
 	void appendClipFunction_Outmap(const ClipFunction::ClipFunction_Outmap& cfo)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cfo.write(mFile);
 	}
 	void endClipFunction_Outmap()const
@@ -352,8 +357,8 @@ public:
 		size_t size = (st_end-st_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",st[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,st[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -363,7 +368,7 @@ public:
 	}
 	void appendStart(double st)const
 	{
-		fprintf(mFile," %f",st);
+		appendNumber(mFile,st);
 	}
 	void endStart()const
 	{
@@ -380,8 +385,8 @@ public:
 		size_t size = (ss_end-ss_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ss[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ss[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -391,7 +396,7 @@ public:
 	}
 	void appendSourceStart(double ss)const
 	{
-		fprintf(mFile," %f",ss);
+		appendNumber(mFile,ss);
 	}
 	void endSourceStart()const
 	{
@@ -408,8 +413,8 @@ public:
 		size_t size = (se_end-se_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",se[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,se[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -419,7 +424,7 @@ public:
 	}
 	void appendSourceEnd(double se)const
 	{
-		fprintf(mFile," %f",se);
+		appendNumber(mFile,se);
 	}
 	void endSourceEnd()const
 	{
@@ -436,8 +441,8 @@ public:
 		size_t size = (sc_end-sc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",sc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,sc[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -447,7 +452,7 @@ public:
 	}
 	void appendScale(double sc)const
 	{
-		fprintf(mFile," %f",sc);
+		appendNumber(mFile,sc);
 	}
 	void endScale()const
 	{
@@ -464,8 +469,8 @@ public:
 		size_t size = (h_end-h_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",h[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,h[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -475,7 +480,7 @@ public:
 	}
 	void appendHold(double h)const
 	{
-		fprintf(mFile," %f",h);
+		appendNumber(mFile,h);
 	}
 	void endHold()const
 	{
@@ -492,8 +497,8 @@ public:
 		size_t size = (w_end-w_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,w[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -503,7 +508,7 @@ public:
 	}
 	void appendWeight(double w)const
 	{
-		fprintf(mFile," %f",w);
+		appendNumber(mFile,w);
 	}
 	void endWeight()const
 	{
@@ -520,8 +525,8 @@ public:
 		size_t size = (ws_end-ws_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ws[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ws[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -531,7 +536,7 @@ public:
 	}
 	void appendWeightStyle(unsigned int ws)const
 	{
-		fprintf(mFile," %i",ws);
+		appendNumber(mFile,ws);
 	}
 	void endWeightStyle()const
 	{
@@ -548,8 +553,8 @@ public:
 		size_t size = (cb_end-cb_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cb[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,cb[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -559,7 +564,7 @@ public:
 	}
 	void appendPreCycle(double cb)const
 	{
-		fprintf(mFile," %f",cb);
+		appendNumber(mFile,cb);
 	}
 	void endPreCycle()const
 	{
@@ -576,8 +581,8 @@ public:
 		size_t size = (ca_end-ca_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ca[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ca[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -587,7 +592,7 @@ public:
 	}
 	void appendPostCycle(double ca)const
 	{
-		fprintf(mFile," %f",ca);
+		appendNumber(mFile,ca);
 	}
 	void endPostCycle()const
 	{
@@ -604,8 +609,8 @@ public:
 		size_t size = (ea_end-ea_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ea[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ea[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -615,7 +620,7 @@ public:
 	}
 	void appendEnable(bool ea)const
 	{
-		fprintf(mFile," %i",ea);
+		appendNumber(mFile,ea);
 	}
 	void endEnable()const
 	{
@@ -632,8 +637,8 @@ public:
 		size_t size = (tr_end-tr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",tr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,tr[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -643,7 +648,7 @@ public:
 	}
 	void appendTrack(short tr)const
 	{
-		fprintf(mFile," %i",tr);
+		appendNumber(mFile,tr);
 	}
 	void endTrack()const
 	{
@@ -660,8 +665,8 @@ public:
 		size_t size = (ts_end-ts_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ts[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ts[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -671,7 +676,7 @@ public:
 	}
 	void appendTrackState(short ts)const
 	{
-		fprintf(mFile," %i",ts);
+		appendNumber(mFile,ts);
 	}
 	void endTrackState()const
 	{
@@ -693,8 +698,8 @@ public:
 		size_t size = (cy_end-cy_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cy[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,cy[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -704,7 +709,7 @@ public:
 	}
 	void appendCycle(double cy)const
 	{
-		fprintf(mFile," %f",cy);
+		appendNumber(mFile,cy);
 	}
 	void endCycle()const
 	{
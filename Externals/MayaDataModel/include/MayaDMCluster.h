@@ -76,7 +76,7 @@ public:
 	}
 	void appendGeomMatrix(const matrix& gm)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		gm.write(mFile);
 	}
 	void endGeomMatrix()const
@@ -369,7 +369,7 @@ enum ConnectableType
     #define connectAttr(file, src, dst) {   		\
     fprintf(file, "connectAttr ");      		\
     src;                                			\
-    fprintf(file, " ");                 		\
+    fputc(' ', file);                 		\
     dst;                                			\
     fprintf(file, ";\n"); }
 
@@ -377,7 +377,7 @@ enum ConnectableType
     #define connectNextAttr(file, src, dst) {   \
     fprintf(file, "connectAttr ");      		\
     src;                                		\
-    fprintf(file, " ");                 		\
+    fputc(' ', file);                 		\
     dst;                                		\
     fprintf(file, " -na"); 		\
     fprintf(file, ";\n"); }
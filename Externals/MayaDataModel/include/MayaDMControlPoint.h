@@ -23,13 +23,13 @@ public:
 		void write(FILE* file) const
 		{
 			uvSetName.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			size_t size = sizeof(uvSetPoints)/sizeof(float2);
 			for(size_t i=0; i<size; ++i)
 			{
 				uvSetPoints[i].write(file);
-				fprintf(file, " ");
-				if(i+1<size) fprintf(file," ");
+				fputc(' ', file);
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -44,23 +44,28 @@ public:
 			float colorSetPointsA;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%f ", colorSetPointsR);
-				fprintf(file,"%f ", colorSetPointsG);
-				fprintf(file,"%f ", colorSetPointsB);
-				fprintf(file,"%f", colorSetPointsA);
+				writeNumber(file,colorSetPointsR);
+				fputc(' ',file);
+				writeNumber(file,colorSetPointsG);
+				fputc(' ',file);
+				writeNumber(file,colorSetPointsB);
+				fputc(' ',file);
+				writeNumber(file,colorSetPointsA);
 			}
 		}* colorSetPoints;
 		void write(FILE* file) const
 		{
 			colorName.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", clamped);
-			fprintf(file,"%i ", representation);
+			fputc(' ', file);
+			writeNumber(file,clamped);
+			fputc(' ',file);
+			writeNumber(file,representation);
+			fputc(' ',file);
 			size_t size = sizeof(colorSetPoints)/sizeof(ColorSetPoints);
 			for(size_t i=0; i<size; ++i)
 			{
 				colorSetPoints[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -93,8 +98,8 @@ public:
 		size_t size = (cp_end-cp_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,cp[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -104,7 +109,7 @@ public:
 	}
 	void appendControlPoints(double cp)const
 	{
-		fprintf(mFile," %f",cp);
+		appendNumber(mFile,cp);
 	}
 	void endControlPoints()const
 	{
@@ -149,7 +154,7 @@ public:
 	}
 	void appendUvSet(const UvSet& uvst)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		uvst.write(mFile);
 	}
 	void endUvSet()const
@@ -175,8 +180,8 @@ public:
 		size_t size = (uvsp_end-uvsp_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uvsp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,uvsp[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -186,7 +191,7 @@ public:
 	}
 	void appendUvSetPoints(float uvsp)const
 	{
-		fprintf(mFile," %f",uvsp);
+		appendNumber(mFile,uvsp);
 	}
 	void endUvSetPoints()const
 	{
@@ -257,7 +262,7 @@ public:
 	}
 	void appendColorSet(const ColorSet& clst)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		clst.write(mFile);
 	}
 	void endColorSet()const
@@ -305,12 +310,12 @@ public:
 	}
 	void appendColorSetPoints(const ColorSet::ColorSetPoints& clsp)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		clsp.write(mFile);
 	}
     void appendColorSetPoints(float clsp)
     {
-        fprintf(mFile," %f",clsp);
+        appendNumber(mFile,clsp);
     }
 	void endColorSetPoints()const
 	{
@@ -35,8 +35,8 @@ public:
 		size_t size = (ei_end-ei_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ei[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ei[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendEdgeIndex(int ei)const
 	{
-		fprintf(mFile," %i",ei);
+		appendNumber(mFile,ei);
 	}
 	void endEdgeIndex()const
 	{
@@ -35,8 +35,8 @@ public:
 		size_t size = (eil_end-eil_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",eil[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,eil[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendEdgeIndexL(int eil)const
 	{
-		fprintf(mFile," %i",eil);
+		appendNumber(mFile,eil);
 	}
 	void endEdgeIndexL()const
 	{
@@ -63,8 +63,8 @@ public:
 		size_t size = (eir_end-eir_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",eir[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,eir[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -74,7 +74,7 @@ public:
 	}
 	void appendEdgeIndexR(int eir)const
 	{
-		fprintf(mFile," %i",eir);
+		appendNumber(mFile,eir);
 	}
 	void endEdgeIndexR()const
 	{
@@ -35,8 +35,8 @@ public:
 		size_t size = (fil_end-fil_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",fil[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,fil[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendFaceIndexL(int fil)const
 	{
-		fprintf(mFile," %i",fil);
+		appendNumber(mFile,fil);
 	}
 	void endFaceIndexL()const
 	{
@@ -63,8 +63,8 @@ public:
 		size_t size = (fir_end-fir_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",fir[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,fir[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -74,7 +74,7 @@ public:
 	}
 	void appendFaceIndexR(int fir)const
 	{
-		fprintf(mFile," %i",fir);
+		appendNumber(mFile,fir);
 	}
 	void endFaceIndexR()const
 	{
@@ -30,9 +30,10 @@ public:
 			void write(FILE* file) const
 			{
 				objectGrpCompList.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%i ", objectGroupId);
-				fprintf(file,"%i", objectGrpColor);
+				fputc(' ', file);
+				writeNumber(file,objectGroupId);
+				fputc(' ',file);
+				writeNumber(file,objectGrpColor);
 			}
 		}* objectGroups;
 		void write(FILE* file) const
@@ -41,7 +42,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				objectGroups[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -56,14 +57,21 @@ public:
 		unsigned char overrideColor;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", overrideDisplayType);
-			fprintf(file,"%i ", overrideLevelOfDetail);
-			fprintf(file,"%i ", overrideShading);
-			fprintf(file,"%i ", overrideTexturing);
-			fprintf(file,"%i ", overridePlayback);
-			fprintf(file,"%i ", overrideEnabled);
-			fprintf(file,"%i ", overrideVisibility);
-			fprintf(file,"%i", overrideColor);
+			writeNumber(file,overrideDisplayType);
+			fputc(' ',file);
+			writeNumber(file,overrideLevelOfDetail);
+			fputc(' ',file);
+			writeNumber(file,overrideShading);
+			fputc(' ',file);
+			writeNumber(file,overrideTexturing);
+			fputc(' ',file);
+			writeNumber(file,overridePlayback);
+			fputc(' ',file);
+			writeNumber(file,overrideEnabled);
+			fputc(' ',file);
+			writeNumber(file,overrideVisibility);
+			fputc(' ',file);
+			writeNumber(file,overrideColor);
 		}
 	};
 	struct RenderInfo{
@@ -72,9 +80,11 @@ public:
 		unsigned char layerOverrideColor;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", identification);
-			fprintf(file,"%i ", layerRenderable);
-			fprintf(file,"%i", layerOverrideColor);
+			writeNumber(file,identification);
+			fputc(' ',file);
+			writeNumber(file,layerRenderable);
+			fputc(' ',file);
+			writeNumber(file,layerOverrideColor);
 		}
 	};
 	struct RenderLayerInfo{
@@ -83,9 +93,11 @@ public:
 		unsigned char renderLayerColor;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", renderLayerId);
-			fprintf(file,"%i ", renderLayerRenderable);
-			fprintf(file,"%i", renderLayerColor);
+			writeNumber(file,renderLayerId);
+			fputc(' ',file);
+			writeNumber(file,renderLayerRenderable);
+			fputc(' ',file);
+			writeNumber(file,renderLayerColor);
 		}
 	};
 	struct GhostCustomSteps{
@@ -94,9 +106,11 @@ public:
 		int ghostStepSize;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", ghostPreSteps);
-			fprintf(file,"%i ", ghostPostSteps);
-			fprintf(file,"%i", ghostStepSize);
+			writeNumber(file,ghostPreSteps);
+			fputc(' ',file);
+			writeNumber(file,ghostPostSteps);
+			fputc(' ',file);
+			writeNumber(file,ghostStepSize);
 		}
 	};
 public:
@@ -150,7 +164,7 @@ public:
 	}
 	void appendInstObjGroups(const InstObjGroups& iog)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		iog.write(mFile);
 	}
 	void endInstObjGroups()const
@@ -181,7 +195,7 @@ public:
 	}
 	void appendObjectGroups(const InstObjGroups::ObjectGroups& og)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		og.write(mFile);
 	}
 	void endObjectGroups()const
@@ -310,7 +324,7 @@ public:
 	}
 	void appendRenderLayerInfo(const RenderLayerInfo& rlio)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		rlio.write(mFile);
 	}
 	void endRenderLayerInfo()const
@@ -49,7 +49,7 @@ public:
 	}
 	void appendWorldMatrix(const matrix& wm)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		wm.write(mFile);
 	}
 	void endWorldMatrix()const
@@ -81,7 +81,7 @@ public:
 	}
 	void appendXformMatrix(const matrix& xm)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		xm.write(mFile);
 	}
 	void endXformMatrix()const
@@ -99,8 +99,8 @@ public:
 		size_t size = (g_end-g_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",g[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,g[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -110,7 +110,7 @@ public:
 	}
 	void appendGlobal(bool g)const
 	{
-		fprintf(mFile," %i",g);
+		appendNumber(mFile,g);
 	}
 	void endGlobal()const
 	{
@@ -40,8 +40,8 @@ public:
 		size_t size = (p_end-p_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",p[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,p[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -51,7 +51,7 @@ public:
 	}
 	void appendParameter(double p)const
 	{
-		fprintf(mFile," %f",p);
+		appendNumber(mFile,p);
 	}
 	void endParameter()const
 	{
@@ -68,8 +68,8 @@ public:
 		size_t size = (k_end-k_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",k[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,k[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -79,7 +79,7 @@ public:
 	}
 	void appendKeep(bool k)const
 	{
-		fprintf(mFile," %i",k);
+		appendNumber(mFile,k);
 	}
 	void endKeep()const
 	{
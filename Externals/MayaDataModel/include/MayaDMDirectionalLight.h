@@ -40,28 +40,45 @@ public:
 		bool smapDetailAlpha;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miExportMrLight);
-			fprintf(file,"%i ", emitPhotons);
+			writeNumber(file,miExportMrLight);
+			fputc(' ',file);
+			writeNumber(file,emitPhotons);
+			fputc(' ',file);
 			energy.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", photonIntensity);
-			fprintf(file,"%f ", exponent);
-			fprintf(file,"%i ", causticPhotons);
-			fprintf(file,"%i ", globIllPhotons);
-			fprintf(file,"%i ", shadowMap);
-			fprintf(file,"%i ", smapResolution);
-			fprintf(file,"%i ", smapSamples);
-			fprintf(file,"%f ", smapSoftness);
-			fprintf(file,"%f ", smapBias);
+			fputc(' ', file);
+			writeNumber(file,photonIntensity);
+			fputc(' ',file);
+			writeNumber(file,exponent);
+			fputc(' ',file);
+			writeNumber(file,causticPhotons);
+			fputc(' ',file);
+			writeNumber(file,globIllPhotons);
+			fputc(' ',file);
+			writeNumber(file,shadowMap);
+			fputc(' ',file);
+			writeNumber(file,smapResolution);
+			fputc(' ',file);
+			writeNumber(file,smapSamples);
+			fputc(' ',file);
+			writeNumber(file,smapSoftness);
+			fputc(' ',file);
+			writeNumber(file,smapBias);
+			fputc(' ',file);
 			smapFilename.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", smapLightName);
-			fprintf(file,"%i ", smapSceneName);
-			fprintf(file,"%i ", smapFrameExt);
-			fprintf(file,"%i ", smapDetail);
-			fprintf(file,"%i ", smapDetailSamples);
-			fprintf(file,"%f ", smapDetailAccuracy);
-			fprintf(file,"%i", smapDetailAlpha);
+			fputc(' ', file);
+			writeNumber(file,smapLightName);
+			fputc(' ',file);
+			writeNumber(file,smapSceneName);
+			fputc(' ',file);
+			writeNumber(file,smapFrameExt);
+			fputc(' ',file);
+			writeNumber(file,smapDetail);
+			fputc(' ',file);
+			writeNumber(file,smapDetailSamples);
+			fputc(' ',file);
+			writeNumber(file,smapDetailAccuracy);
+			fputc(' ',file);
+			writeNumber(file,smapDetailAlpha);
 		}
 	};
 public:
@@ -28,14 +28,21 @@ public:
 		unsigned char color;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", displayType);
-			fprintf(file,"%i ", levelOfDetail);
-			fprintf(file,"%i ", shading);
-			fprintf(file,"%i ", texturing);
-			fprintf(file,"%i ", playback);
-			fprintf(file,"%i ", enabled);
-			fprintf(file,"%i ", visibility);
-			fprintf(file,"%i", color);
+			writeNumber(file,displayType);
+			fputc(' ',file);
+			writeNumber(file,levelOfDetail);
+			fputc(' ',file);
+			writeNumber(file,shading);
+			fputc(' ',file);
+			writeNumber(file,texturing);
+			fputc(' ',file);
+			writeNumber(file,playback);
+			fputc(' ',file);
+			writeNumber(file,enabled);
+			fputc(' ',file);
+			writeNumber(file,visibility);
+			fputc(' ',file);
+			writeNumber(file,color);
 		}
 	};
 public:
@@ -40,8 +40,8 @@ public:
 		size_t size = (dli_end-dli_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",dli[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,dli[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -51,7 +51,7 @@ public:
 	}
 	void appendDisplayLayerId(short dli)const
 	{
-		fprintf(mFile," %i",dli);
+		appendNumber(mFile,dli);
 	}
 	void endDisplayLayerId()const
 	{
@@ -23,9 +23,11 @@ public:
 		unsigned int connectionDensityRange_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", connectionDensityRange_Position);
-			fprintf(file,"%f ", connectionDensityRange_FloatValue);
-			fprintf(file,"%i", connectionDensityRange_Interp);
+			writeNumber(file,connectionDensityRange_Position);
+			fputc(' ',file);
+			writeNumber(file,connectionDensityRange_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,connectionDensityRange_Interp);
 		}
 	};
 	struct StrengthDropoff{
@@ -34,9 +36,11 @@ public:
 		unsigned int strengthDropoff_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", strengthDropoff_Position);
-			fprintf(file,"%f ", strengthDropoff_FloatValue);
-			fprintf(file,"%i", strengthDropoff_Interp);
+			writeNumber(file,strengthDropoff_Position);
+			fputc(' ',file);
+			writeNumber(file,strengthDropoff_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,strengthDropoff_Interp);
 		}
 	};
 public:
@@ -115,7 +119,7 @@ public:
 	}
 	void appendConnectionDensityRange(const ConnectionDensityRange& cdnr)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cdnr.write(mFile);
 	}
 	void endConnectionDensityRange()const
@@ -236,7 +240,7 @@ public:
 	}
 	void appendStrengthDropoff(const StrengthDropoff& sdp)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		sdp.write(mFile);
 	}
 	void endStrengthDropoff()const
@@ -35,8 +35,8 @@ public:
 		size_t size = (in_end-in_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",in[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,in[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendInput(double in)const
 	{
-		fprintf(mFile," %f",in);
+		appendNumber(mFile,in);
 	}
 	void endInput()const
 	{
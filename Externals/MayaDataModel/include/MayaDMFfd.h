@@ -23,7 +23,7 @@ public:
 		void write(FILE* file) const
 		{
 			deformedLatticePoints.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			deformedLatticeMatrix.write(file);
 		}
 	};
@@ -33,7 +33,7 @@ public:
 		void write(FILE* file) const
 		{
 			baseLatticePoints.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			baseLatticeMatrix.write(file);
 		}
 	};
@@ -44,8 +44,8 @@ public:
 			size_t size = sizeof(stuCache)/sizeof(double);
 			for(size_t i=0; i<size; ++i)
 			{
-				fprintf(file,"%f", stuCache[i]);
-				if(i+1<size) fprintf(file," ");
+				writeNumber(file,stuCache[i]);
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -118,7 +118,7 @@ public:
 	}
 	void appendStuCacheList(const StuCacheList& scl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		scl.write(mFile);
 	}
 	void endStuCacheList()const
@@ -136,8 +136,8 @@ public:
 		size_t size = (stu_end-stu_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",stu[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,stu[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -147,7 +147,7 @@ public:
 	}
 	void appendStuCache(double stu)const
 	{
-		fprintf(mFile," %f",stu);
+		appendNumber(mFile,stu);
 	}
 	void endStuCache()const
 	{
@@ -25,12 +25,12 @@ public:
 		void write(FILE* file) const
 		{
 			inputPositions.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			inputVelocities.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			inputMass.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", deltaTime);
+			fputc(' ', file);
+			writeNumber(file,deltaTime);
 		}
 	};
 	struct FalloffCurve{
@@ -39,9 +39,11 @@ public:
 		unsigned int falloffCurve_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", falloffCurve_Position);
-			fprintf(file,"%f ", falloffCurve_FloatValue);
-			fprintf(file,"%i", falloffCurve_Interp);
+			writeNumber(file,falloffCurve_Position);
+			fputc(' ',file);
+			writeNumber(file,falloffCurve_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,falloffCurve_Interp);
 		}
 	};
 public:
@@ -100,7 +102,7 @@ public:
 	}
 	void appendInputData(const InputData& ind)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ind.write(mFile);
 	}
 	void endInputData()const
@@ -198,7 +200,7 @@ public:
 	}
 	void appendFalloffCurve(const FalloffCurve& fc)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		fc.write(mFile);
 	}
 	void endFalloffCurve()const
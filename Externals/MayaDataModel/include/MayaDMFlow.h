@@ -115,8 +115,8 @@ public:
 		size_t size = (ctr_end-ctr_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ctr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ctr[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -126,7 +126,7 @@ public:
 	}
 	void appendCenter(double ctr)const
 	{
-		fprintf(mFile," %f",ctr);
+		appendNumber(mFile,ctr);
 	}
 	void endCenter()const
 	{
@@ -172,7 +172,7 @@ public:
 	}
 	void appendObjectWorldMatrix(const matrix& owmx)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		owmx.write(mFile);
 	}
 	void endObjectWorldMatrix()const
@@ -23,9 +23,11 @@ public:
 		int resolutionD;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", resolutionW);
-			fprintf(file,"%i ", resolutionH);
-			fprintf(file,"%i", resolutionD);
+			writeNumber(file,resolutionW);
+			fputc(' ',file);
+			writeNumber(file,resolutionH);
+			fputc(' ',file);
+			writeNumber(file,resolutionD);
 		}
 	};
 	struct Dimensions{
@@ -34,9 +36,11 @@ public:
 		double dimensionsD;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", dimensionsW);
-			fprintf(file,"%f ", dimensionsH);
-			fprintf(file,"%f", dimensionsD);
+			writeNumber(file,dimensionsW);
+			fputc(' ',file);
+			writeNumber(file,dimensionsH);
+			fputc(' ',file);
+			writeNumber(file,dimensionsD);
 		}
 	};
 	struct FieldData{
@@ -51,8 +55,9 @@ public:
 				short fieldFunction_InmapFrom;
 				void write(FILE* file) const
 				{
-					fprintf(file,"%i ", fieldFunction_InmapTo);
-					fprintf(file,"%i", fieldFunction_InmapFrom);
+					writeNumber(file,fieldFunction_InmapTo);
+					fputc(' ',file);
+					writeNumber(file,fieldFunction_InmapFrom);
 				}
 			}* fieldFunction_Inmap;
 			struct FieldFunction_Outmap{
@@ -60,8 +65,9 @@ public:
 				short fieldFunction_OutmapFrom;
 				void write(FILE* file) const
 				{
-					fprintf(file,"%i ", fieldFunction_OutmapTo);
-					fprintf(file,"%i", fieldFunction_OutmapFrom);
+					writeNumber(file,fieldFunction_OutmapTo);
+					fputc(' ',file);
+					writeNumber(file,fieldFunction_OutmapFrom);
 				}
 			}* fieldFunction_Outmap;
 			void write(FILE* file) const
@@ -70,14 +76,14 @@ public:
 				for(size_t i=0; i<size; ++i)
 				{
 					fieldFunction_Inmap[i].write(file);
-					fprintf(file, " ");
-					if(i+1<size) fprintf(file," ");
+					fputc(' ', file);
+					if(i+1<size) fputc(' ',file);
 				}
 				size = sizeof(fieldFunction_Outmap)/sizeof(FieldFunction_Outmap);
 				for(size_t i=0; i<size; ++i)
 				{
 					fieldFunction_Outmap[i].write(file);
-					if(i+1<size) fprintf(file," ");
+					if(i+1<size) fputc(' ',file);
 				}
 			}
 		} fieldFunction;
@@ -93,8 +99,9 @@ public:
 				short emissionFunction_InmapFrom;
 				void write(FILE* file) const
 				{
-					fprintf(file,"%i ", emissionFunction_InmapTo);
-					fprintf(file,"%i", emissionFunction_InmapFrom);
+					writeNumber(file,emissionFunction_InmapTo);
+					fputc(' ',file);
+					writeNumber(file,emissionFunction_InmapFrom);
 				}
 			}* emissionFunction_Inmap;
 			struct EmissionFunction_Outmap{
@@ -102,8 +109,9 @@ public:
 				short emissionFunction_OutmapFrom;
 				void write(FILE* file) const
 				{
-					fprintf(file,"%i ", emissionFunction_OutmapTo);
-					fprintf(file,"%i", emissionFunction_OutmapFrom);
+					writeNumber(file,emissionFunction_OutmapTo);
+					fputc(' ',file);
+					writeNumber(file,emissionFunction_OutmapFrom);
 				}
 			}* emissionFunction_Outmap;
 			void write(FILE* file) const
@@ -112,14 +120,14 @@ public:
 				for(size_t i=0; i<size; ++i)
 				{
 					emissionFunction_Inmap[i].write(file);
-					fprintf(file, " ");
-					if(i+1<size) fprintf(file," ");
+					fputc(' ', file);
+					if(i+1<size) fputc(' ',file);
 				}
 				size = sizeof(emissionFunction_Outmap)/sizeof(EmissionFunction_Outmap);
 				for(size_t i=0; i<size; ++i)
 				{
 					emissionFunction_Outmap[i].write(file);
-					if(i+1<size) fprintf(file," ");
+					if(i+1<size) fputc(' ',file);
 				}
 			}
 		} emissionFunction;
@@ -134,9 +142,12 @@ public:
 		int subVolumeCenterD;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", subVolumeCenterW);
-			fprintf(file,"%i ", subVolumeCenterH);
-			fprintf(file,"%i ", subVolumeCenterD);
+			writeNumber(file,subVolumeCenterW);
+			fputc(' ',file);
+			writeNumber(file,subVolumeCenterH);
+			fputc(' ',file);
+			writeNumber(file,subVolumeCenterD);
+			fputc(' ',file);
 		}
 	};
 	struct SubVolumeSize{
@@ -145,9 +156,12 @@ public:
 		int subVolumeSizeD;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", subVolumeSizeW);
-			fprintf(file,"%i ", subVolumeSizeH);
-			fprintf(file,"%i ", subVolumeSizeD);
+			writeNumber(file,subVolumeSizeW);
+			fputc(' ',file);
+			writeNumber(file,subVolumeSizeH);
+			fputc(' ',file);
+			writeNumber(file,subVolumeSizeD);
+			fputc(' ',file);
 		}
 	};
 	struct InputData{
@@ -158,12 +172,12 @@ public:
 		void write(FILE* file) const
 		{
 			inputPositions.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			inputVelocities.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			inputMass.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", deltaTime);
+			fputc(' ', file);
+			writeNumber(file,deltaTime);
 		}
 	};
 	struct Color{
@@ -172,10 +186,11 @@ public:
 		unsigned int color_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", color_Position);
+			writeNumber(file,color_Position);
+			fputc(' ',file);
 			color_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", color_Interp);
+			fputc(' ', file);
+			writeNumber(file,color_Interp);
 		}
 	};
 	struct Opacity{
@@ -184,9 +199,11 @@ public:
 		unsigned int opacity_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", opacity_Position);
-			fprintf(file,"%f ", opacity_FloatValue);
-			fprintf(file,"%i", opacity_Interp);
+			writeNumber(file,opacity_Position);
+			fputc(' ',file);
+			writeNumber(file,opacity_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,opacity_Interp);
 		}
 	};
 	struct Incandescence{
@@ -195,10 +212,11 @@ public:
 		unsigned int incandescence_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", incandescence_Position);
+			writeNumber(file,incandescence_Position);
+			fputc(' ',file);
 			incandescence_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", incandescence_Interp);
+			fputc(' ', file);
+			writeNumber(file,incandescence_Interp);
 		}
 	};
 	struct Environment{
@@ -207,10 +225,11 @@ public:
 		unsigned int environment_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", environment_Position);
+			writeNumber(file,environment_Position);
+			fputc(' ',file);
 			environment_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", environment_Interp);
+			fputc(' ', file);
+			writeNumber(file,environment_Interp);
 		}
 	};
 	struct CollisionData{
@@ -236,21 +255,35 @@ public:
 		short miMaxSamples;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i", miMaxSamples);
+			writeNumber(file,miOverrideCaustics);
+			fputc(' ',file);
+			writeNumber(file,miCausticAccuracy);
+			fputc(' ',file);
+			writeNumber(file,miCausticRadius);
+			fputc(' ',file);
+			writeNumber(file,miOverrideGlobalIllumination);
+			fputc(' ',file);
+			writeNumber(file,miGlobillumAccuracy);
+			fputc(' ',file);
+			writeNumber(file,miGlobillumRadius);
+			fputc(' ',file);
+			writeNumber(file,miOverrideFinalGather);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherRays);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherMinRadius);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherMaxRadius);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherFilter);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherView);
+			fputc(' ',file);
+			writeNumber(file,miOverrideSamples);
+			fputc(' ',file);
+			writeNumber(file,miMinSamples);
+			fputc(' ',file);
+			writeNumber(file,miMaxSamples);
 		}
 	};
 public:
@@ -346,7 +379,7 @@ public:
 	}
 	void appendFieldList(const FieldList& fll)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		fll.write(mFile);
 	}
 	void endFieldList()const
@@ -383,7 +416,7 @@ public:
 	}
 	void appendFieldFunction_Inmap(const FieldList::FieldFunction::FieldFunction_Inmap& frfi)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		frfi.write(mFile);
 	}
 	void endFieldFunction_Inmap()const
@@ -424,7 +457,7 @@ public:
 	}
 	void appendFieldFunction_Outmap(const FieldList::FieldFunction::FieldFunction_Outmap& frfo)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		frfo.write(mFile);
 	}
 	void endFieldFunction_Outmap()const
@@ -462,8 +495,8 @@ public:
 		size_t size = (sd_end-sd_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",sd[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,sd[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -473,7 +506,7 @@ public:
 	}
 	void appendSeed(int sd)const
 	{
-		fprintf(mFile," %i",sd);
+		appendNumber(mFile,sd);
 	}
 	void endSeed()const
 	{
@@ -503,7 +536,7 @@ public:
 	}
 	void appendEmissionList(const EmissionList& eml)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		eml.write(mFile);
 	}
 	void endEmissionList()const
@@ -540,7 +573,7 @@ public:
 	}
 	void appendEmissionFunction_Inmap(const EmissionList::EmissionFunction::EmissionFunction_Inmap& emfi)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		emfi.write(mFile);
 	}
 	void endEmissionFunction_Inmap()const
@@ -581,7 +614,7 @@ public:
 	}
 	void appendEmissionFunction_Outmap(const EmissionList::EmissionFunction::EmissionFunction_Outmap& emfo)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		emfo.write(mFile);
 	}
 	void endEmissionFunction_Outmap()const
@@ -1032,7 +1065,7 @@ public:
 	}
 	void appendInputData(const InputData& ind)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ind.write(mFile);
 	}
 	void endInputData()const
@@ -1114,7 +1147,7 @@ public:
 	}
 	void appendColor(const Color& cl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cl.write(mFile);
 	}
 	void endColor()const
@@ -1186,7 +1219,7 @@ public:
 	}
 	void appendOpacity(const Opacity& opa)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		opa.write(mFile);
 	}
 	void endOpacity()const
@@ -1268,7 +1301,7 @@ public:
 	}
 	void appendIncandescence(const Incandescence& i)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		i.write(mFile);
 	}
 	void endIncandescence()const
@@ -1371,7 +1404,7 @@ public:
 	}
 	void appendEnvironment(const Environment& env)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		env.write(mFile);
 	}
 	void endEnvironment()const
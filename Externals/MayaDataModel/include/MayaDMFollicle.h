@@ -23,9 +23,11 @@ public:
 		unsigned int stiffnessScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", stiffnessScale_Position);
-			fprintf(file,"%f ", stiffnessScale_FloatValue);
-			fprintf(file,"%i", stiffnessScale_Interp);
+			writeNumber(file,stiffnessScale_Position);
+			fputc(' ',file);
+			writeNumber(file,stiffnessScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,stiffnessScale_Interp);
 		}
 	};
 	struct ClumpWidthScale{
@@ -34,9 +36,11 @@ public:
 		unsigned int clumpWidthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", clumpWidthScale_Position);
-			fprintf(file,"%f ", clumpWidthScale_FloatValue);
-			fprintf(file,"%i", clumpWidthScale_Interp);
+			writeNumber(file,clumpWidthScale_Position);
+			fputc(' ',file);
+			writeNumber(file,clumpWidthScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,clumpWidthScale_Interp);
 		}
 	};
 	struct AttractionScale{
@@ -45,9 +49,11 @@ public:
 		unsigned int attractionScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", attractionScale_Position);
-			fprintf(file,"%f ", attractionScale_FloatValue);
-			fprintf(file,"%i", attractionScale_Interp);
+			writeNumber(file,attractionScale_Position);
+			fputc(' ',file);
+			writeNumber(file,attractionScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,attractionScale_Interp);
 		}
 	};
 public:
@@ -146,7 +152,7 @@ public:
 	}
 	void appendStiffnessScale(const StiffnessScale& sts)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		sts.write(mFile);
 	}
 	void endStiffnessScale()const
@@ -202,7 +208,7 @@ public:
 	}
 	void appendClumpWidthScale(const ClumpWidthScale& cws)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cws.write(mFile);
 	}
 	void endClumpWidthScale()const
@@ -253,7 +259,7 @@ public:
 	}
 	void appendAttractionScale(const AttractionScale& ats)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ats.write(mFile);
 	}
 	void endAttractionScale()const
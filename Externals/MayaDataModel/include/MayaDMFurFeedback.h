@@ -41,25 +41,43 @@ public:
 		bool miTransparencyReceive;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i ", miMaxSamples);
-			fprintf(file,"%i ", miFinalGatherCast);
-			fprintf(file,"%i ", miFinalGatherReceive);
-			fprintf(file,"%i ", miTransparencyCast);
-			fprintf(file,"%i", miTransparencyReceive);
+			writeNumber(file,miOverrideCaustics);
+			fputc(' ',file);
+			writeNumber(file,miCausticAccuracy);
+			fputc(' ',file);
+			writeNumber(file,miCausticRadius);
+			fputc(' ',file);
+			writeNumber(file,miOverrideGlobalIllumination);
+			fputc(' ',file);
+			writeNumber(file,miGlobillumAccuracy);
+			fputc(' ',file);
+			writeNumber(file,miGlobillumRadius);
+			fputc(' ',file);
+			writeNumber(file,miOverrideFinalGather);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherRays);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherMinRadius);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherMaxRadius);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherFilter);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherView);
+			fputc(' ',file);
+			writeNumber(file,miOverrideSamples);
+			fputc(' ',file);
+			writeNumber(file,miMinSamples);
+			fputc(' ',file);
+			writeNumber(file,miMaxSamples);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherCast);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherReceive);
+			fputc(' ',file);
+			writeNumber(file,miTransparencyCast);
+			fputc(' ',file);
+			writeNumber(file,miTransparencyReceive);
 		}
 	};
 public:
@@ -187,8 +205,8 @@ public:
 		size_t size = (ls_end-ls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ls[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ls[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -198,7 +216,7 @@ public:
 	}
 	void appendLengthSamples(double ls)const
 	{
-		fprintf(mFile," %f",ls);
+		appendNumber(mFile,ls);
 	}
 	void endLengthSamples()const
 	{
@@ -257,8 +275,8 @@ public:
 		size_t size = (ins_end-ins_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ins[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ins[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -268,7 +286,7 @@ public:
 	}
 	void appendInclinationSamples(double ins)const
 	{
-		fprintf(mFile," %f",ins);
+		appendNumber(mFile,ins);
 	}
 	void endInclinationSamples()const
 	{
@@ -327,8 +345,8 @@ public:
 		size_t size = (rls_end-rls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",rls[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,rls[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -338,7 +356,7 @@ public:
 	}
 	void appendRollSamples(double rls)const
 	{
-		fprintf(mFile," %f",rls);
+		appendNumber(mFile,rls);
 	}
 	void endRollSamples()const
 	{
@@ -397,8 +415,8 @@ public:
 		size_t size = (pos_end-pos_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",pos[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,pos[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -408,7 +426,7 @@ public:
 	}
 	void appendPolarSamples(double pos)const
 	{
-		fprintf(mFile," %f",pos);
+		appendNumber(mFile,pos);
 	}
 	void endPolarSamples()const
 	{
@@ -467,8 +485,8 @@ public:
 		size_t size = (bs_end-bs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",bs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,bs[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -478,7 +496,7 @@ public:
 	}
 	void appendBaldnessSamples(double bs)const
 	{
-		fprintf(mFile," %f",bs);
+		appendNumber(mFile,bs);
 	}
 	void endBaldnessSamples()const
 	{
@@ -537,8 +555,8 @@ public:
 		size_t size = (bos_end-bos_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",bos[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,bos[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -548,7 +566,7 @@ public:
 	}
 	void appendBaseOpacitySamples(double bos)const
 	{
-		fprintf(mFile," %f",bos);
+		appendNumber(mFile,bos);
 	}
 	void endBaseOpacitySamples()const
 	{
@@ -607,8 +625,8 @@ public:
 		size_t size = (tos_end-tos_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tos[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,tos[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -618,7 +636,7 @@ public:
 	}
 	void appendTipOpacitySamples(double tos)const
 	{
-		fprintf(mFile," %f",tos);
+		appendNumber(mFile,tos);
 	}
 	void endTipOpacitySamples()const
 	{
@@ -677,8 +695,8 @@ public:
 		size_t size = (bcls_end-bcls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",bcls[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,bcls[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -688,7 +706,7 @@ public:
 	}
 	void appendBaseCurlSamples(double bcls)const
 	{
-		fprintf(mFile," %f",bcls);
+		appendNumber(mFile,bcls);
 	}
 	void endBaseCurlSamples()const
 	{
@@ -747,8 +765,8 @@ public:
 		size_t size = (tcls_end-tcls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tcls[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,tcls[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -758,7 +776,7 @@ public:
 	}
 	void appendTipCurlSamples(double tcls)const
 	{
-		fprintf(mFile," %f",tcls);
+		appendNumber(mFile,tcls);
 	}
 	void endTipCurlSamples()const
 	{
@@ -817,8 +835,8 @@ public:
 		size_t size = (bws_end-bws_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",bws[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,bws[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -828,7 +846,7 @@ public:
 	}
 	void appendBaseWidthSamples(double bws)const
 	{
-		fprintf(mFile," %f",bws);
+		appendNumber(mFile,bws);
 	}
 	void endBaseWidthSamples()const
 	{
@@ -887,8 +905,8 @@ public:
 		size_t size = (tws_end-tws_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tws[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,tws[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -898,7 +916,7 @@ public:
 	}
 	void appendTipWidthSamples(double tws)const
 	{
-		fprintf(mFile," %f",tws);
+		appendNumber(mFile,tws);
 	}
 	void endTipWidthSamples()const
 	{
@@ -957,8 +975,8 @@ public:
 		size_t size = (ss_end-ss_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ss[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ss[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -968,7 +986,7 @@ public:
 	}
 	void appendScraggleSamples(double ss)const
 	{
-		fprintf(mFile," %f",ss);
+		appendNumber(mFile,ss);
 	}
 	void endScraggleSamples()const
 	{
@@ -1027,8 +1045,8 @@ public:
 		size_t size = (scos_end-scos_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",scos[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,scos[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1038,7 +1056,7 @@ public:
 	}
 	void appendScraggleCorrelationSamples(double scos)const
 	{
-		fprintf(mFile," %f",scos);
+		appendNumber(mFile,scos);
 	}
 	void endScraggleCorrelationSamples()const
 	{
@@ -1097,8 +1115,8 @@ public:
 		size_t size = (scfs_end-scfs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",scfs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,scfs[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1108,7 +1126,7 @@ public:
 	}
 	void appendScraggleFrequencySamples(double scfs)const
 	{
-		fprintf(mFile," %f",scfs);
+		appendNumber(mFile,scfs);
 	}
 	void endScraggleFrequencySamples()const
 	{
@@ -1167,8 +1185,8 @@ public:
 		size_t size = (segs_end-segs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",segs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,segs[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1178,7 +1196,7 @@ public:
 	}
 	void appendSegmentsSamples(double segs)const
 	{
-		fprintf(mFile," %f",segs);
+		appendNumber(mFile,segs);
 	}
 	void endSegmentsSamples()const
 	{
@@ -1237,8 +1255,8 @@ public:
 		size_t size = (ats_end-ats_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ats[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ats[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1248,7 +1266,7 @@ public:
 	}
 	void appendAttractionSamples(double ats)const
 	{
-		fprintf(mFile," %f",ats);
+		appendNumber(mFile,ats);
 	}
 	void endAttractionSamples()const
 	{
@@ -1307,8 +1325,8 @@ public:
 		size_t size = (ofss_end-ofss_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ofss[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ofss[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1318,7 +1336,7 @@ public:
 	}
 	void appendOffsetSamples(double ofss)const
 	{
-		fprintf(mFile," %f",ofss);
+		appendNumber(mFile,ofss);
 	}
 	void endOffsetSamples()const
 	{
@@ -1377,8 +1395,8 @@ public:
 		size_t size = (cs_end-cs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,cs[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1388,7 +1406,7 @@ public:
 	}
 	void appendClumpingSamples(double cs)const
 	{
-		fprintf(mFile," %f",cs);
+		appendNumber(mFile,cs);
 	}
 	void endClumpingSamples()const
 	{
@@ -1447,8 +1465,8 @@ public:
 		size_t size = (cfs_end-cfs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cfs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,cfs[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1458,7 +1476,7 @@ public:
 	}
 	void appendClumpingFrequencySamples(double cfs)const
 	{
-		fprintf(mFile," %f",cfs);
+		appendNumber(mFile,cfs);
 	}
 	void endClumpingFrequencySamples()const
 	{
@@ -1517,8 +1535,8 @@ public:
 		size_t size = (css_end-css_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",css[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,css[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1528,7 +1546,7 @@ public:
 	}
 	void appendClumpingShapeSamples(double css)const
 	{
-		fprintf(mFile," %f",css);
+		appendNumber(mFile,css);
 	}
 	void endClumpingShapeSamples()const
 	{
@@ -1604,8 +1622,8 @@ public:
 		size_t size = (bcs_end-bcs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",bcs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,bcs[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1615,7 +1633,7 @@ public:
 	}
 	void appendBaseColorSamples(double bcs)const
 	{
-		fprintf(mFile," %f",bcs);
+		appendNumber(mFile,bcs);
 	}
 	void endBaseColorSamples()const
 	{
@@ -1681,8 +1699,8 @@ public:
 		size_t size = (tcs_end-tcs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tcs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,tcs[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1692,7 +1710,7 @@ public:
 	}
 	void appendTipColorSamples(double tcs)const
 	{
-		fprintf(mFile," %f",tcs);
+		appendNumber(mFile,tcs);
 	}
 	void endTipColorSamples()const
 	{
@@ -1741,8 +1759,8 @@ public:
 		size_t size = (ars_end-ars_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ars[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ars[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1752,7 +1770,7 @@ public:
 	}
 	void appendRadiusSamples(double ars)const
 	{
-		fprintf(mFile," %f",ars);
+		appendNumber(mFile,ars);
 	}
 	void endRadiusSamples()const
 	{
@@ -1811,8 +1829,8 @@ public:
 		size_t size = (aps_end-aps_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",aps[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,aps[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1822,7 +1840,7 @@ public:
 	}
 	void appendPowerSamples(double aps)const
 	{
-		fprintf(mFile," %f",aps);
+		appendNumber(mFile,aps);
 	}
 	void endPowerSamples()const
 	{
@@ -1881,8 +1899,8 @@ public:
 		size_t size = (ais_end-ais_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ais[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ais[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1892,7 +1910,7 @@ public:
 	}
 	void appendInfluenceSamples(double ais)const
 	{
-		fprintf(mFile," %f",ais);
+		appendNumber(mFile,ais);
 	}
 	void endInfluenceSamples()const
 	{
@@ -1951,8 +1969,8 @@ public:
 		size_t size = (asls_end-asls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",asls[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,asls[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1962,7 +1980,7 @@ public:
 	}
 	void appendStartLengthSamples(double asls)const
 	{
-		fprintf(mFile," %f",asls);
+		appendNumber(mFile,asls);
 	}
 	void endStartLengthSamples()const
 	{
@@ -2021,8 +2039,8 @@ public:
 		size_t size = (aels_end-aels_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",aels[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,aels[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -2032,7 +2050,7 @@ public:
 	}
 	void appendEndLengthSamples(double aels)const
 	{
-		fprintf(mFile," %f",aels);
+		appendNumber(mFile,aels);
 	}
 	void endEndLengthSamples()const
 	{
@@ -2091,8 +2109,8 @@ public:
 		size_t size = (atls_end-atls_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",atls[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,atls[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -2102,7 +2120,7 @@ public:
 	}
 	void appendThresholdLengthSamples(double atls)const
 	{
-		fprintf(mFile," %f",atls);
+		appendNumber(mFile,atls);
 	}
 	void endThresholdLengthSamples()const
 	{
@@ -2161,8 +2179,8 @@ public:
 		size_t size = (uns_end-uns_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uns[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,uns[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -2172,7 +2190,7 @@ public:
 	}
 	void appendUnusedSamples(double uns)const
 	{
-		fprintf(mFile," %f",uns);
+		appendNumber(mFile,uns);
 	}
 	void endUnusedSamples()const
 	{
@@ -2231,8 +2249,8 @@ public:
 		size_t size = (ems_end-ems_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ems[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ems[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -2242,7 +2260,7 @@ public:
 	}
 	void appendEqualizerSamples(double ems)const
 	{
-		fprintf(mFile," %f",ems);
+		appendNumber(mFile,ems);
 	}
 	void endEqualizerSamples()const
 	{
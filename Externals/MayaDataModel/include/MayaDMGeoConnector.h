@@ -47,8 +47,8 @@ public:
 		size_t size = (gri_end-gri_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",gri[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,gri[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -58,7 +58,7 @@ public:
 	}
 	void appendGroupId(int gri)const
 	{
-		fprintf(mFile," %i",gri);
+		appendNumber(mFile,gri);
 	}
 	void endGroupId()const
 	{
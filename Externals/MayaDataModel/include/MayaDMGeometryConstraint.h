@@ -21,7 +21,7 @@ public:
 		double targetWeight;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f", targetWeight);
+			writeNumber(file,targetWeight);
 		}
 	};
 public:
@@ -55,7 +55,7 @@ public:
 	}
 	void appendTarget(const Target& tg)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		tg.write(mFile);
 	}
 	void endTarget()const
@@ -21,7 +21,7 @@ public:
 		int groupId;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i", groupId);
+			writeNumber(file,groupId);
 		}
 	};
 public:
@@ -55,7 +55,7 @@ public:
 	}
 	void appendInput(const Input& ip)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ip.write(mFile);
 	}
 	void endInput()const
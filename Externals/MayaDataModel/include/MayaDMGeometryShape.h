@@ -24,8 +24,8 @@ public:
 			void write(FILE* file) const
 			{
 				compObjectGrpCompList.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%i", compObjectGroupId);
+				fputc(' ', file);
+				writeNumber(file,compObjectGroupId);
 			}
 		}* compObjectGroups;
 		void write(FILE* file) const
@@ -34,7 +34,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				compObjectGroups[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -169,7 +169,7 @@ public:
 	}
 	void appendCompInstObjGroups(const CompInstObjGroups& ciog)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ciog.write(mFile);
 	}
 	void endCompInstObjGroups()const
@@ -200,7 +200,7 @@ public:
 	}
 	void appendCompObjectGroups(const CompInstObjGroups::CompObjectGroups& cog)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cog.write(mFile);
 	}
 	void endCompObjectGroups()const
@@ -70,8 +70,8 @@ public:
 		size_t size = (lk_end-lk_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",lk[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,lk[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -81,7 +81,7 @@ public:
 	}
 	void appendLockSurface(bool lk)const
 	{
-		fprintf(mFile," %i",lk);
+		appendNumber(mFile,lk);
 	}
 	void endLockSurface()const
 	{
@@ -35,8 +35,8 @@ public:
 		size_t size = (cin_end-cin_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",cin[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,cin[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendCurveIndices(int cin)const
 	{
-		fprintf(mFile," %i",cin);
+		appendNumber(mFile,cin);
 	}
 	void endCurveIndices()const
 	{
@@ -23,9 +23,11 @@ public:
 		unsigned int stiffnessScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", stiffnessScale_Position);
-			fprintf(file,"%f ", stiffnessScale_FloatValue);
-			fprintf(file,"%i", stiffnessScale_Interp);
+			writeNumber(file,stiffnessScale_Position);
+			fputc(' ',file);
+			writeNumber(file,stiffnessScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,stiffnessScale_Interp);
 		}
 	};
 	struct AttractionScale{
@@ -34,9 +36,11 @@ public:
 		unsigned int attractionScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", attractionScale_Position);
-			fprintf(file,"%f ", attractionScale_FloatValue);
-			fprintf(file,"%i", attractionScale_Interp);
+			writeNumber(file,attractionScale_Position);
+			fputc(' ',file);
+			writeNumber(file,attractionScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,attractionScale_Interp);
 		}
 	};
 	struct ClumpWidthScale{
@@ -45,9 +49,11 @@ public:
 		unsigned int clumpWidthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", clumpWidthScale_Position);
-			fprintf(file,"%f ", clumpWidthScale_FloatValue);
-			fprintf(file,"%i", clumpWidthScale_Interp);
+			writeNumber(file,clumpWidthScale_Position);
+			fputc(' ',file);
+			writeNumber(file,clumpWidthScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,clumpWidthScale_Interp);
 		}
 	};
 	struct ClumpCurl{
@@ -56,9 +62,11 @@ public:
 		unsigned int clumpCurl_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", clumpCurl_Position);
-			fprintf(file,"%f ", clumpCurl_FloatValue);
-			fprintf(file,"%i", clumpCurl_Interp);
+			writeNumber(file,clumpCurl_Position);
+			fputc(' ',file);
+			writeNumber(file,clumpCurl_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,clumpCurl_Interp);
 		}
 	};
 	struct ClumpFlatness{
@@ -67,9 +75,11 @@ public:
 		unsigned int clumpFlatness_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", clumpFlatness_Position);
-			fprintf(file,"%f ", clumpFlatness_FloatValue);
-			fprintf(file,"%i", clumpFlatness_Interp);
+			writeNumber(file,clumpFlatness_Position);
+			fputc(' ',file);
+			writeNumber(file,clumpFlatness_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,clumpFlatness_Interp);
 		}
 	};
 	struct HairWidthScale{
@@ -78,9 +88,11 @@ public:
 		unsigned int hairWidthScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", hairWidthScale_Position);
-			fprintf(file,"%f ", hairWidthScale_FloatValue);
-			fprintf(file,"%i", hairWidthScale_Interp);
+			writeNumber(file,hairWidthScale_Position);
+			fputc(' ',file);
+			writeNumber(file,hairWidthScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,hairWidthScale_Interp);
 		}
 	};
 	struct HairColorScale{
@@ -89,10 +101,11 @@ public:
 		unsigned int hairColorScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", hairColorScale_Position);
+			writeNumber(file,hairColorScale_Position);
+			fputc(' ',file);
 			hairColorScale_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", hairColorScale_Interp);
+			fputc(' ', file);
+			writeNumber(file,hairColorScale_Interp);
 		}
 	};
 	struct DisplacementScale{
@@ -101,9 +114,11 @@ public:
 		unsigned int displacementScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", displacementScale_Position);
-			fprintf(file,"%f ", displacementScale_FloatValue);
-			fprintf(file,"%i", displacementScale_Interp);
+			writeNumber(file,displacementScale_Position);
+			fputc(' ',file);
+			writeNumber(file,displacementScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,displacementScale_Interp);
 		}
 	};
 	struct FieldData{
@@ -138,25 +153,43 @@ public:
 		bool miTransparencyReceive;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i ", miMaxSamples);
-			fprintf(file,"%i ", miFinalGatherCast);
-			fprintf(file,"%i ", miFinalGatherReceive);
-			fprintf(file,"%i ", miTransparencyCast);
-			fprintf(file,"%i", miTransparencyReceive);
+			writeNumber(file,miOverrideCaustics);
+			fputc(' ',file);
+			writeNumber(file,miCausticAccuracy);
+			fputc(' ',file);
+			writeNumber(file,miCausticRadius);
+			fputc(' ',file);
+			writeNumber(file,miOverrideGlobalIllumination);
+			fputc(' ',file);
+			writeNumber(file,miGlobillumAccuracy);
+			fputc(' ',file);
+			writeNumber(file,miGlobillumRadius);
+			fputc(' ',file);
+			writeNumber(file,miOverrideFinalGather);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherRays);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherMinRadius);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherMaxRadius);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherFilter);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherView);
+			fputc(' ',file);
+			writeNumber(file,miOverrideSamples);
+			fputc(' ',file);
+			writeNumber(file,miMinSamples);
+			fputc(' ',file);
+			writeNumber(file,miMaxSamples);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherCast);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherReceive);
+			fputc(' ',file);
+			writeNumber(file,miTransparencyCast);
+			fputc(' ',file);
+			writeNumber(file,miTransparencyReceive);
 		}
 	};
 public:
@@ -225,7 +258,7 @@ public:
 	}
 	void appendStiffnessScale(const StiffnessScale& sts)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		sts.write(mFile);
 	}
 	void endStiffnessScale()const
@@ -366,7 +399,7 @@ public:
 	}
 	void appendAttractionScale(const AttractionScale& ats)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ats.write(mFile);
 	}
 	void endAttractionScale()const
@@ -437,7 +470,7 @@ public:
 	}
 	void appendClumpWidthScale(const ClumpWidthScale& cws)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cws.write(mFile);
 	}
 	void endClumpWidthScale()const
@@ -488,7 +521,7 @@ public:
 	}
 	void appendClumpCurl(const ClumpCurl& clc)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		clc.write(mFile);
 	}
 	void endClumpCurl()const
@@ -534,7 +567,7 @@ public:
 	}
 	void appendClumpFlatness(const ClumpFlatness& cfl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cfl.write(mFile);
 	}
 	void endClumpFlatness()const
@@ -590,7 +623,7 @@ public:
 	}
 	void appendHairWidthScale(const HairWidthScale& hws)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		hws.write(mFile);
 	}
 	void endHairWidthScale()const
@@ -667,7 +700,7 @@ public:
 	}
 	void appendHairColorScale(const HairColorScale& hcs)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		hcs.write(mFile);
 	}
 	void endHairColorScale()const
@@ -820,7 +853,7 @@ public:
 	}
 	void appendDisplacementScale(const DisplacementScale& dsc)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		dsc.write(mFile);
 	}
 	void endDisplacementScale()const
@@ -1073,7 +1106,7 @@ public:
 	}
 	void appendOutputHair(const vectorArray& oh)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		oh.write(mFile);
 	}
 	void endOutputHair()const
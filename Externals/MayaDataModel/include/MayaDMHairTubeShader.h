@@ -23,10 +23,11 @@ public:
 		unsigned int colorScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", colorScale_Position);
+			writeNumber(file,colorScale_Position);
+			fputc(' ',file);
 			colorScale_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", colorScale_Interp);
+			fputc(' ', file);
+			writeNumber(file,colorScale_Interp);
 		}
 	};
 public:
@@ -65,7 +66,7 @@ public:
 	}
 	void appendColorScale(const ColorScale& cls)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cls.write(mFile);
 	}
 	void endColorScale()const
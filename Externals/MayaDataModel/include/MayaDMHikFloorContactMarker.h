@@ -26,12 +26,17 @@ public:
 		bool toesContact;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", drawHandContact);
-			fprintf(file,"%i ", handsContact);
-			fprintf(file,"%i ", drawFeetContact);
-			fprintf(file,"%i ", feetContact);
-			fprintf(file,"%i ", fingersContact);
-			fprintf(file,"%i", toesContact);
+			writeNumber(file,drawHandContact);
+			fputc(' ',file);
+			writeNumber(file,handsContact);
+			fputc(' ',file);
+			writeNumber(file,drawFeetContact);
+			fputc(' ',file);
+			writeNumber(file,feetContact);
+			fputc(' ',file);
+			writeNumber(file,fingersContact);
+			fputc(' ',file);
+			writeNumber(file,toesContact);
 		}
 	};
 	struct HandsFloorContactSetup{
@@ -40,9 +45,11 @@ public:
 		float handsContactStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", handsFloorPivot);
-			fprintf(file,"%i ", handsContactType);
-			fprintf(file,"%f", handsContactStiffness);
+			writeNumber(file,handsFloorPivot);
+			fputc(' ',file);
+			writeNumber(file,handsContactType);
+			fputc(' ',file);
+			writeNumber(file,handsContactStiffness);
 		}
 	};
 	struct ContactsPosition{
@@ -54,12 +61,17 @@ public:
 		float handOutSide;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", handHeight);
-			fprintf(file,"%f ", handBack);
-			fprintf(file,"%f ", handMiddle);
-			fprintf(file,"%f ", handFront);
-			fprintf(file,"%f ", handInSide);
-			fprintf(file,"%f", handOutSide);
+			writeNumber(file,handHeight);
+			fputc(' ',file);
+			writeNumber(file,handBack);
+			fputc(' ',file);
+			writeNumber(file,handMiddle);
+			fputc(' ',file);
+			writeNumber(file,handFront);
+			fputc(' ',file);
+			writeNumber(file,handInSide);
+			fputc(' ',file);
+			writeNumber(file,handOutSide);
 		}
 	};
 	struct FeetFloorContactSetup{
@@ -68,9 +80,11 @@ public:
 		float feetContactStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", feetFloorPivot);
-			fprintf(file,"%i ", feetContactType);
-			fprintf(file,"%f", feetContactStiffness);
+			writeNumber(file,feetFloorPivot);
+			fputc(' ',file);
+			writeNumber(file,feetContactType);
+			fputc(' ',file);
+			writeNumber(file,feetContactStiffness);
 		}
 	};
 	struct FeetContactPosition{
@@ -82,12 +96,17 @@ public:
 		float footOutSide;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", footHeight);
-			fprintf(file,"%f ", footBack);
-			fprintf(file,"%f ", footMiddle);
-			fprintf(file,"%f ", footFront);
-			fprintf(file,"%f ", footInSide);
-			fprintf(file,"%f", footOutSide);
+			writeNumber(file,footHeight);
+			fputc(' ',file);
+			writeNumber(file,footBack);
+			fputc(' ',file);
+			writeNumber(file,footMiddle);
+			fputc(' ',file);
+			writeNumber(file,footFront);
+			fputc(' ',file);
+			writeNumber(file,footInSide);
+			fputc(' ',file);
+			writeNumber(file,footOutSide);
 		}
 	};
 	struct FingersFloorContactSetup{
@@ -95,8 +114,9 @@ public:
 		float fingersContactRollStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", fingersContactType);
-			fprintf(file,"%f", fingersContactRollStiffness);
+			writeNumber(file,fingersContactType);
+			fputc(' ',file);
+			writeNumber(file,fingersContactRollStiffness);
 		}
 	};
 	struct ToesFloorContactSetup{
@@ -104,8 +124,9 @@ public:
 		float toesContactRollStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", toesContactType);
-			fprintf(file,"%f", toesContactRollStiffness);
+			writeNumber(file,toesContactType);
+			fputc(' ',file);
+			writeNumber(file,toesContactRollStiffness);
 		}
 	};
 public:
@@ -25,11 +25,15 @@ public:
 		unsigned int hipTranslationMode;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", postureType);
-			fprintf(file,"%i ", expertMode);
-			fprintf(file,"%f ", realisticShoulderSolving);
-			fprintf(file,"%i ", solveFingers);
-			fprintf(file,"%i", hipTranslationMode);
+			writeNumber(file,postureType);
+			fputc(' ',file);
+			writeNumber(file,expertMode);
+			fputc(' ',file);
+			writeNumber(file,realisticShoulderSolving);
+			fputc(' ',file);
+			writeNumber(file,solveFingers);
+			fputc(' ',file);
+			writeNumber(file,hipTranslationMode);
 		}
 	};
 	struct FloorContacts{
@@ -39,10 +43,13 @@ public:
 		bool toesFloorContact;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", handsFloorContact);
-			fprintf(file,"%i ", feetFloorContact);
-			fprintf(file,"%i ", fingersFloorContact);
-			fprintf(file,"%i", toesFloorContact);
+			writeNumber(file,handsFloorContact);
+			fputc(' ',file);
+			writeNumber(file,feetFloorContact);
+			fputc(' ',file);
+			writeNumber(file,fingersFloorContact);
+			fputc(' ',file);
+			writeNumber(file,toesFloorContact);
 		}
 	};
 	struct HandsFloorContactSetup{
@@ -51,9 +58,11 @@ public:
 		float handsContactStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", handsFloorPivot);
-			fprintf(file,"%i ", handsContactType);
-			fprintf(file,"%f", handsContactStiffness);
+			writeNumber(file,handsFloorPivot);
+			fputc(' ',file);
+			writeNumber(file,handsContactType);
+			fputc(' ',file);
+			writeNumber(file,handsContactStiffness);
 		}
 	};
 	struct ContactsPosition{
@@ -65,12 +74,17 @@ public:
 		float handOutSide;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", handHeight);
-			fprintf(file,"%f ", handBack);
-			fprintf(file,"%f ", handMiddle);
-			fprintf(file,"%f ", handFront);
-			fprintf(file,"%f ", handInSide);
-			fprintf(file,"%f", handOutSide);
+			writeNumber(file,handHeight);
+			fputc(' ',file);
+			writeNumber(file,handBack);
+			fputc(' ',file);
+			writeNumber(file,handMiddle);
+			fputc(' ',file);
+			writeNumber(file,handFront);
+			fputc(' ',file);
+			writeNumber(file,handInSide);
+			fputc(' ',file);
+			writeNumber(file,handOutSide);
 		}
 	};
 	struct FeetFloorContactSetup{
@@ -79,9 +93,11 @@ public:
 		float feetContactStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", feetFloorPivot);
-			fprintf(file,"%i ", feetContactType);
-			fprintf(file,"%f", feetContactStiffness);
+			writeNumber(file,feetFloorPivot);
+			fputc(' ',file);
+			writeNumber(file,feetContactType);
+			fputc(' ',file);
+			writeNumber(file,feetContactStiffness);
 		}
 	};
 	struct FeetContactPosition{
@@ -93,12 +109,17 @@ public:
 		float footOutSide;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", footHeight);
-			fprintf(file,"%f ", footBack);
-			fprintf(file,"%f ", footMiddle);
-			fprintf(file,"%f ", footFront);
-			fprintf(file,"%f ", footInSide);
-			fprintf(file,"%f", footOutSide);
+			writeNumber(file,footHeight);
+			fputc(' ',file);
+			writeNumber(file,footBack);
+			fputc(' ',file);
+			writeNumber(file,footMiddle);
+			fputc(' ',file);
+			writeNumber(file,footFront);
+			fputc(' ',file);
+			writeNumber(file,footInSide);
+			fputc(' ',file);
+			writeNumber(file,footOutSide);
 		}
 	};
 	struct FingersFloorContactSetup{
@@ -106,8 +127,9 @@ public:
 		float fingersContactRollStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", fingersContactType);
-			fprintf(file,"%f", fingersContactRollStiffness);
+			writeNumber(file,fingersContactType);
+			fputc(' ',file);
+			writeNumber(file,fingersContactRollStiffness);
 		}
 	};
 	struct FingerTipsSizes{
@@ -125,18 +147,29 @@ public:
 		float rightHandExtraFingerTip;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", leftHandThumbTip);
-			fprintf(file,"%f ", leftHandIndexTip);
-			fprintf(file,"%f ", leftHandMiddleTip);
-			fprintf(file,"%f ", leftHandRingTip);
-			fprintf(file,"%f ", leftHandPinkyTip);
-			fprintf(file,"%f ", leftHandExtraFingerTip);
-			fprintf(file,"%f ", rightHandThumbTip);
-			fprintf(file,"%f ", rightHandIndexTip);
-			fprintf(file,"%f ", rightHandMiddleTip);
-			fprintf(file,"%f ", rightHandRingTip);
-			fprintf(file,"%f ", rightHandPinkyTip);
-			fprintf(file,"%f", rightHandExtraFingerTip);
+			writeNumber(file,leftHandThumbTip);
+			fputc(' ',file);
+			writeNumber(file,leftHandIndexTip);
+			fputc(' ',file);
+			writeNumber(file,leftHandMiddleTip);
+			fputc(' ',file);
+			writeNumber(file,leftHandRingTip);
+			fputc(' ',file);
+			writeNumber(file,leftHandPinkyTip);
+			fputc(' ',file);
+			writeNumber(file,leftHandExtraFingerTip);
+			fputc(' ',file);
+			writeNumber(file,rightHandThumbTip);
+			fputc(' ',file);
+			writeNumber(file,rightHandIndexTip);
+			fputc(' ',file);
+			writeNumber(file,rightHandMiddleTip);
+			fputc(' ',file);
+			writeNumber(file,rightHandRingTip);
+			fputc(' ',file);
+			writeNumber(file,rightHandPinkyTip);
+			fputc(' ',file);
+			writeNumber(file,rightHandExtraFingerTip);
 		}
 	};
 	struct ToesFloorContactSetup{
@@ -144,8 +177,9 @@ public:
 		float toesContactRollStiffness;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", toesContactType);
-			fprintf(file,"%f", toesContactRollStiffness);
+			writeNumber(file,toesContactType);
+			fputc(' ',file);
+			writeNumber(file,toesContactRollStiffness);
 		}
 	};
 	struct ToeTipsSizes{
@@ -163,25 +197,36 @@ public:
 		float rightFootExtraFingerTip;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", leftFootThumbTip);
-			fprintf(file,"%f ", leftFootIndexTip);
-			fprintf(file,"%f ", leftFootMiddleTip);
-			fprintf(file,"%f ", leftFootRingTip);
-			fprintf(file,"%f ", leftFootPinkyTip);
-			fprintf(file,"%f ", leftFootExtraFingerTip);
-			fprintf(file,"%f ", rightFootThumbTip);
-			fprintf(file,"%f ", rightFootIndexTip);
-			fprintf(file,"%f ", rightFootMiddleTip);
-			fprintf(file,"%f ", rightFootRingTip);
-			fprintf(file,"%f ", rightFootPinkyTip);
-			fprintf(file,"%f", rightFootExtraFingerTip);
+			writeNumber(file,leftFootThumbTip);
+			fputc(' ',file);
+			writeNumber(file,leftFootIndexTip);
+			fputc(' ',file);
+			writeNumber(file,leftFootMiddleTip);
+			fputc(' ',file);
+			writeNumber(file,leftFootRingTip);
+			fputc(' ',file);
+			writeNumber(file,leftFootPinkyTip);
+			fputc(' ',file);
+			writeNumber(file,leftFootExtraFingerTip);
+			fputc(' ',file);
+			writeNumber(file,rightFootThumbTip);
+			fputc(' ',file);
+			writeNumber(file,rightFootIndexTip);
+			fputc(' ',file);
+			writeNumber(file,rightFootMiddleTip);
+			fputc(' ',file);
+			writeNumber(file,rightFootRingTip);
+			fputc(' ',file);
+			writeNumber(file,rightFootPinkyTip);
+			fputc(' ',file);
+			writeNumber(file,rightFootExtraFingerTip);
 		}
 	};
 	struct Head{
 		float headPull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f", headPull);
+			writeNumber(file,headPull);
 		}
 	};
 	struct LeftArm{
@@ -191,10 +236,13 @@ public:
 		float leftFingerBasePull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", leftElbowPull);
-			fprintf(file,"%f ", leftHandPullChest);
-			fprintf(file,"%f ", leftHandPullHips);
-			fprintf(file,"%f", leftFingerBasePull);
+			writeNumber(file,leftElbowPull);
+			fputc(' ',file);
+			writeNumber(file,leftHandPullChest);
+			fputc(' ',file);
+			writeNumber(file,leftHandPullHips);
+			fputc(' ',file);
+			writeNumber(file,leftFingerBasePull);
 		}
 	};
 	struct RightArm{
@@ -204,24 +252,27 @@ public:
 		float rightFingerBasePull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", rightElbowPull);
-			fprintf(file,"%f ", rightHandPullChest);
-			fprintf(file,"%f ", rightHandPullHips);
-			fprintf(file,"%f", rightFingerBasePull);
+			writeNumber(file,rightElbowPull);
+			fputc(' ',file);
+			writeNumber(file,rightHandPullChest);
+			fputc(' ',file);
+			writeNumber(file,rightHandPullHips);
+			fputc(' ',file);
+			writeNumber(file,rightFingerBasePull);
 		}
 	};
 	struct Chest{
 		float chestPull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f", chestPull);
+			writeNumber(file,chestPull);
 		}
 	};
 	struct Hips{
 		float hipsPull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f", hipsPull);
+			writeNumber(file,hipsPull);
 		}
 	};
 	struct LeftLeg{
@@ -230,9 +281,11 @@ public:
 		float leftToeBasePull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", leftKneePull);
-			fprintf(file,"%f ", leftFootPull);
-			fprintf(file,"%f", leftToeBasePull);
+			writeNumber(file,leftKneePull);
+			fputc(' ',file);
+			writeNumber(file,leftFootPull);
+			fputc(' ',file);
+			writeNumber(file,leftToeBasePull);
 		}
 	};
 	struct RightLeg{
@@ -241,16 +294,18 @@ public:
 		float rightToeBasePull;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", rightKneePull);
-			fprintf(file,"%f ", rightFootPull);
-			fprintf(file,"%f", rightToeBasePull);
+			writeNumber(file,rightKneePull);
+			fputc(' ',file);
+			writeNumber(file,rightFootPull);
+			fputc(' ',file);
+			writeNumber(file,rightToeBasePull);
 		}
 	};
 	struct Extra{
 		float pullIterationCount;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f", pullIterationCount);
+			writeNumber(file,pullIterationCount);
 		}
 	};
 	struct Stiffness{
@@ -275,25 +330,43 @@ public:
 		float rightKneeCompressionFactor;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", neckStiffness);
-			fprintf(file,"%f ", leftShoulderStiffness);
-			fprintf(file,"%f ", leftArmStiffness);
-			fprintf(file,"%f ", leftElbowMaxExtension);
-			fprintf(file,"%f ", leftElbowCompressionFactor);
-			fprintf(file,"%f ", rightShoulderStiffness);
-			fprintf(file,"%f ", rightArmStiffness);
-			fprintf(file,"%f ", rightElbowMaxExtension);
-			fprintf(file,"%f ", rightElbowCompressionFactor);
-			fprintf(file,"%f ", hipsEnforceGravity);
-			fprintf(file,"%f ", chestStiffness);
-			fprintf(file,"%f ", spineStiffness);
-			fprintf(file,"%f ", hipsStiffness);
-			fprintf(file,"%f ", leftKneeMaxExtension);
-			fprintf(file,"%f ", leftLegStiffness);
-			fprintf(file,"%f ", leftKneeCompressionFactor);
-			fprintf(file,"%f ", rightLegStiffness);
-			fprintf(file,"%f ", rightKneeMaxExtension);
-			fprintf(file,"%f", rightKneeCompressionFactor);
+			writeNumber(file,neckStiffness);
+			fputc(' ',file);
+			writeNumber(file,leftShoulderStiffness);
+			fputc(' ',file);
+			writeNumber(file,leftArmStiffness);
+			fputc(' ',file);
+			writeNumber(file,leftElbowMaxExtension);
+			fputc(' ',file);
+			writeNumber(file,leftElbowCompressionFactor);
+			fputc(' ',file);
+			writeNumber(file,rightShoulderStiffness);
+			fputc(' ',file);
+			writeNumber(file,rightArmStiffness);
+			fputc(' ',file);
+			writeNumber(file,rightElbowMaxExtension);
+			fputc(' ',file);
+			writeNumber(file,rightElbowCompressionFactor);
+			fputc(' ',file);
+			writeNumber(file,hipsEnforceGravity);
+			fputc(' ',file);
+			writeNumber(file,chestStiffness);
+			fputc(' ',file);
+			writeNumber(file,spineStiffness);
+			fputc(' ',file);
+			writeNumber(file,hipsStiffness);
+			fputc(' ',file);
+			writeNumber(file,leftKneeMaxExtension);
+			fputc(' ',file);
+			writeNumber(file,leftLegStiffness);
+			fputc(' ',file);
+			writeNumber(file,leftKneeCompressionFactor);
+			fputc(' ',file);
+			writeNumber(file,rightLegStiffness);
+			fputc(' ',file);
+			writeNumber(file,rightKneeMaxExtension);
+			fputc(' ',file);
+			writeNumber(file,rightKneeCompressionFactor);
 		}
 	};
 	struct KillPitch{
@@ -303,10 +376,13 @@ public:
 		bool rightKneeKillPitch;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", leftElbowKillPitch);
-			fprintf(file,"%i ", rightElbowKillPitch);
-			fprintf(file,"%i ", leftKneeKillPitch);
-			fprintf(file,"%i", rightKneeKillPitch);
+			writeNumber(file,leftElbowKillPitch);
+			fputc(' ',file);
+			writeNumber(file,rightElbowKillPitch);
+			fputc(' ',file);
+			writeNumber(file,leftKneeKillPitch);
+			fputc(' ',file);
+			writeNumber(file,rightKneeKillPitch);
 		}
 	};
 	struct RollExtraction{
@@ -329,23 +405,39 @@ public:
 		float rightLegRoll;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", rollExtractionMode);
-			fprintf(file,"%i ", leftArmRollMode);
-			fprintf(file,"%f ", leftArmRoll);
-			fprintf(file,"%i ", leftForeArmRollMode);
-			fprintf(file,"%f ", leftForeArmRoll);
-			fprintf(file,"%i ", rightArmRollMode);
-			fprintf(file,"%f ", rightArmRoll);
-			fprintf(file,"%i ", rightForeArmRollMode);
-			fprintf(file,"%f ", rightForeArmRoll);
-			fprintf(file,"%i ", leftUpLegRollMode);
-			fprintf(file,"%f ", leftUpLegRoll);
-			fprintf(file,"%i ", leftLegRollMode);
-			fprintf(file,"%f ", leftLegRoll);
-			fprintf(file,"%i ", rightUpLegRollMode);
-			fprintf(file,"%f ", rightUpLegRoll);
-			fprintf(file,"%i ", rightLegRollMode);
-			fprintf(file,"%f", rightLegRoll);
+			writeNumber(file,rollExtractionMode);
+			fputc(' ',file);
+			writeNumber(file,leftArmRollMode);
+			fputc(' ',file);
+			writeNumber(file,leftArmRoll);
+			fputc(' ',file);
+			writeNumber(file,leftForeArmRollMode);
+			fputc(' ',file);
+			writeNumber(file,leftForeArmRoll);
+			fputc(' ',file);
+			writeNumber(file,rightArmRollMode);
+			fputc(' ',file);
+			writeNumber(file,rightArmRoll);
+			fputc(' ',file);
+			writeNumber(file,rightForeArmRollMode);
+			fputc(' ',file);
+			writeNumber(file,rightForeArmRoll);
+			fputc(' ',file);
+			writeNumber(file,leftUpLegRollMode);
+			fputc(' ',file);
+			writeNumber(file,leftUpLegRoll);
+			fputc(' ',file);
+			writeNumber(file,leftLegRollMode);
+			fputc(' ',file);
+			writeNumber(file,leftLegRoll);
+			fputc(' ',file);
+			writeNumber(file,rightUpLegRollMode);
+			fputc(' ',file);
+			writeNumber(file,rightUpLegRoll);
+			fputc(' ',file);
+			writeNumber(file,rightLegRollMode);
+			fputc(' ',file);
+			writeNumber(file,rightLegRoll);
 		}
 	};
 public:
@@ -385,7 +477,7 @@ public:
 	}
 	void appendDefaultMatrix(const matrix& dm)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		dm.write(mFile);
 	}
 	void endDefaultMatrix()const
@@ -417,7 +509,7 @@ public:
 	}
 	void appendStancePoseMatrix(const matrix& sm)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		sm.write(mFile);
 	}
 	void endStancePoseMatrix()const
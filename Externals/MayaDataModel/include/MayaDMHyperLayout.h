@@ -24,10 +24,14 @@ public:
 		bool isFreeform;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", positionX);
-			fprintf(file,"%f ", positionY);
-			fprintf(file,"%i ", isCollapsed);
-			fprintf(file,"%i ", isFreeform);
+			writeNumber(file,positionX);
+			fputc(' ',file);
+			writeNumber(file,positionY);
+			fputc(' ',file);
+			writeNumber(file,isCollapsed);
+			fputc(' ',file);
+			writeNumber(file,isFreeform);
+			fputc(' ',file);
 		}
 	};
 public:
@@ -61,7 +65,7 @@ public:
 	}
 	void appendHyperPosition(const HyperPosition& hyp)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		hyp.write(mFile);
 	}
 	void endHyperPosition()const
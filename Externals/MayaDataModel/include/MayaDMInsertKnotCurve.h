@@ -35,8 +35,8 @@ public:
 		size_t size = (p_end-p_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",p[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,p[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendParameter(double p)const
 	{
-		fprintf(mFile," %f",p);
+		appendNumber(mFile,p);
 	}
 	void endParameter()const
 	{
@@ -63,8 +63,8 @@ public:
 		size_t size = (nk_end-nk_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",nk[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,nk[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -74,7 +74,7 @@ public:
 	}
 	void appendNumberOfKnots(int nk)const
 	{
-		fprintf(mFile," %i",nk);
+		appendNumber(mFile,nk);
 	}
 	void endNumberOfKnots()const
 	{
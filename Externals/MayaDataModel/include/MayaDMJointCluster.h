@@ -50,8 +50,8 @@ public:
 		size_t size = (che_end-che_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",che[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,che[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -61,7 +61,7 @@ public:
 	}
 	void appendChildEnabled(bool che)const
 	{
-		fprintf(mFile," %i",che);
+		appendNumber(mFile,che);
 	}
 	void endChildEnabled()const
 	{
@@ -100,8 +100,8 @@ public:
 		size_t size = (cjm_end-cjm_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cjm[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,cjm[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -111,7 +111,7 @@ public:
 	}
 	void appendChildJointMidplaneAxis(double cjm)const
 	{
-		fprintf(mFile," %f",cjm);
+		appendNumber(mFile,cjm);
 	}
 	void endChildJointMidplaneAxis()const
 	{
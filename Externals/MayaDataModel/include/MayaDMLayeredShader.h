@@ -24,9 +24,9 @@ public:
 		void write(FILE* file) const
 		{
 			color.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			transparency.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			glowColor.write(file);
 		}
 	};
@@ -66,7 +66,7 @@ public:
 	}
 	void appendInputs(const Inputs& cs)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cs.write(mFile);
 	}
 	void endInputs()const
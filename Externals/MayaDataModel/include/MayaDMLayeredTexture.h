@@ -25,10 +25,12 @@ public:
 		void write(FILE* file) const
 		{
 			color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", alpha);
-			fprintf(file,"%i ", blendMode);
-			fprintf(file,"%i", isVisible);
+			fputc(' ', file);
+			writeNumber(file,alpha);
+			fputc(' ',file);
+			writeNumber(file,blendMode);
+			fputc(' ',file);
+			writeNumber(file,isVisible);
 		}
 	};
 public:
@@ -62,7 +64,7 @@ public:
 	}
 	void appendInputs(const Inputs& cs)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cs.write(mFile);
 	}
 	void endInputs()const
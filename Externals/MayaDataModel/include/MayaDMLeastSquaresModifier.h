@@ -26,22 +26,22 @@ public:
 			void write(FILE* file) const
 			{
 				pointPositionXYZ.write(file);
-				fprintf(file, " ");
+				fputc(' ', file);
 				pointConstraintUVW.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%f", pointWeight);
+				fputc(' ', file);
+				writeNumber(file,pointWeight);
 			}
 		}* pointConstraint;
 		void write(FILE* file) const
 		{
 			worldSpaceToObjectSpace.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			size_t size = sizeof(pointConstraint)/sizeof(PointConstraint);
 			for(size_t i=0; i<size; ++i)
 			{
 				pointConstraint[i].write(file);
-				fprintf(file, " ");
-				if(i+1<size) fprintf(file," ");
+				fputc(' ', file);
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -91,7 +91,7 @@ public:
 	}
 	void appendPointConstraint(const AttributeCollection::PointConstraint& pc)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		pc.write(mFile);
 	}
 	void endPointConstraint()const
@@ -23,9 +23,11 @@ public:
 		unsigned int dropoff_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", dropoff_Position);
-			fprintf(file,"%f ", dropoff_FloatValue);
-			fprintf(file,"%i", dropoff_Interp);
+			writeNumber(file,dropoff_Position);
+			fputc(' ',file);
+			writeNumber(file,dropoff_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,dropoff_Interp);
 		}
 	};
 public:
@@ -190,7 +192,7 @@ public:
 	}
 	void appendDropoff(const Dropoff& drp)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		drp.write(mFile);
 	}
 	void endDropoff()const
@@ -42,8 +42,8 @@ public:
 		size_t size = (th_end-th_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",th[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,th[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -53,7 +53,7 @@ public:
 	}
 	void appendThreshold(double th)const
 	{
-		fprintf(mFile," %f",th);
+		appendNumber(mFile,th);
 	}
 	void endThreshold()const
 	{
@@ -70,8 +70,8 @@ public:
 		size_t size = (dl_end-dl_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",dl[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,dl[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -81,7 +81,7 @@ public:
 	}
 	void appendDisplayLevel(unsigned int dl)const
 	{
-		fprintf(mFile," %i",dl);
+		appendNumber(mFile,dl);
 	}
 	void endDisplayLevel()const
 	{
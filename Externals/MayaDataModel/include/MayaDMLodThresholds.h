@@ -98,8 +98,8 @@ public:
 		size_t size = (th_end-th_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",th[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,th[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -109,7 +109,7 @@ public:
 	}
 	void appendThreshold(double th)const
 	{
-		fprintf(mFile," %f",th);
+		appendNumber(mFile,th);
 	}
 	void endThreshold()const
 	{
@@ -55,8 +55,8 @@ public:
 		size_t size = (r_end-r_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",r[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,r[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -66,7 +66,7 @@ public:
 	}
 	void appendReverse(bool r)const
 	{
-		fprintf(mFile," %i",r);
+		appendNumber(mFile,r);
 	}
 	void endReverse()const
 	{
@@ -93,8 +93,8 @@ public:
 		size_t size = (cc_end-cc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",cc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,cc[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -104,7 +104,7 @@ public:
 	}
 	void appendCreateCusp(bool cc)const
 	{
-		fprintf(mFile," %i",cc);
+		appendNumber(mFile,cc);
 	}
 	void endCreateCusp()const
 	{
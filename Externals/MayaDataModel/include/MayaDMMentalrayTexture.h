@@ -23,9 +23,11 @@ public:
 		unsigned int miDepth;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miWidth);
-			fprintf(file,"%i ", miHeight);
-			fprintf(file,"%i", miDepth);
+			writeNumber(file,miWidth);
+			fputc(' ',file);
+			writeNumber(file,miHeight);
+			fputc(' ',file);
+			writeNumber(file,miDepth);
 		}
 	};
 public:
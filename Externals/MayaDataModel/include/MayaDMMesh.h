@@ -24,10 +24,13 @@ public:
 		float colorA;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", colorR);
-			fprintf(file,"%f ", colorG);
-			fprintf(file,"%f ", colorB);
-			fprintf(file,"%f", colorA);
+			writeNumber(file,colorR);
+			fputc(' ',file);
+			writeNumber(file,colorG);
+			fputc(' ',file);
+			writeNumber(file,colorB);
+			fputc(' ',file);
+			writeNumber(file,colorA);
 		}
 	};
 	struct ColorPerVertex{
@@ -40,20 +43,21 @@ public:
 				void write(FILE* file) const
 				{
 					vertexFaceColorRGB.write(file);
-					fprintf(file, " ");
-					fprintf(file,"%f", vertexFaceAlpha);
+					fputc(' ', file);
+					writeNumber(file,vertexFaceAlpha);
 				}
 			}* vertexFaceColor;
 			void write(FILE* file) const
 			{
 				vertexColorRGB.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%f ", vertexAlpha);
+				fputc(' ', file);
+				writeNumber(file,vertexAlpha);
+				fputc(' ',file);
 				size_t size = sizeof(vertexFaceColor)/sizeof(VertexFaceColor);
 				for(size_t i=0; i<size; ++i)
 				{
 					vertexFaceColor[i].write(file);
-					if(i+1<size) fprintf(file," ");
+					if(i+1<size) fputc(' ',file);
 				}
 			}
 		}* vertexColor;
@@ -63,7 +67,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				vertexColor[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -80,12 +84,12 @@ public:
 			void write(FILE* file) const
 			{
 				vertexNormalXYZ.write(file);
-				fprintf(file, " ");
+				fputc(' ', file);
 				size_t size = sizeof(vertexFaceNormal)/sizeof(VertexFaceNormal);
 				for(size_t i=0; i<size; ++i)
 				{
 					vertexFaceNormal[i].write(file);
-					if(i+1<size) fprintf(file," ");
+					if(i+1<size) fputc(' ',file);
 				}
 			}
 		}* vertexNormal;
@@ -95,7 +99,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				vertexNormal[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -123,27 +127,47 @@ public:
 		bool miRefractionReceive;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i ", miMaxSamples);
-			fprintf(file,"%i ", miFinalGatherCast);
-			fprintf(file,"%i ", miFinalGatherReceive);
-			fprintf(file,"%i ", miTransparencyCast);
-			fprintf(file,"%i ", miTransparencyReceive);
-			fprintf(file,"%i ", miReflectionReceive);
-			fprintf(file,"%i", miRefractionReceive);
+			writeNumber(file,miOverrideCaustics);
+			fputc(' ',file);
+			writeNumber(file,miCausticAccuracy);
+			fputc(' ',file);
+			writeNumber(file,miCausticRadius);
+			fputc(' ',file);
+			writeNumber(file,miOverrideGlobalIllumination);
+			fputc(' ',file);
+			writeNumber(file,miGlobillumAccuracy);
+			fputc(' ',file);
+			writeNumber(file,miGlobillumRadius);
+			fputc(' ',file);
+			writeNumber(file,miOverrideFinalGather);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherRays);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherMinRadius);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherMaxRadius);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherFilter);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherView);
+			fputc(' ',file);
+			writeNumber(file,miOverrideSamples);
+			fputc(' ',file);
+			writeNumber(file,miMinSamples);
+			fputc(' ',file);
+			writeNumber(file,miMaxSamples);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherCast);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherReceive);
+			fputc(' ',file);
+			writeNumber(file,miTransparencyCast);
+			fputc(' ',file);
+			writeNumber(file,miTransparencyReceive);
+			fputc(' ',file);
+			writeNumber(file,miReflectionReceive);
+			fputc(' ',file);
+			writeNumber(file,miRefractionReceive);
 		}
 	};
 public:
@@ -308,8 +332,8 @@ public:
 		size_t size = (pt_end-pt_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",pt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,pt[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -319,7 +343,7 @@ public:
 	}
 	void appendPnts(float pt)const
 	{
-		fprintf(mFile," %f",pt);
+		appendNumber(mFile,pt);
 	}
 	void endPnts()const
 	{
@@ -352,8 +376,8 @@ public:
 		size_t size = (vt_end-vt_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",vt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,vt[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -363,7 +387,7 @@ public:
 	}
 	void appendVrts(float vt)const
 	{
-		fprintf(mFile," %f",vt);
+		appendNumber(mFile,vt);
 	}
 	void endVrts()const
 	{
@@ -396,8 +420,8 @@ public:
 		size_t size = (ed_end-ed_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ed[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ed[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -407,7 +431,7 @@ public:
 	}
 	void appendEdge(int ed)const
 	{
-		fprintf(mFile," %i",ed);
+		appendNumber(mFile,ed);
 	}
 	void endEdge()const
 	{
@@ -440,8 +464,8 @@ public:
 		size_t size = (uv_end-uv_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uv[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,uv[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -451,7 +475,7 @@ public:
 	}
 	void appendUvpt(float uv)const
 	{
-		fprintf(mFile," %f",uv);
+		appendNumber(mFile,uv);
 	}
 	void endUvpt()const
 	{
@@ -491,7 +515,7 @@ public:
 	}
 	void appendColors(const Colors& clr)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		clr.write(mFile);
 	}
 	void endColors()const
@@ -530,8 +554,8 @@ public:
 		size_t size = (n_end-n_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",n[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,n[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -541,7 +565,7 @@ public:
 	}
 	void appendNormals(float n)const
 	{
-		fprintf(mFile," %f",n);
+		appendNumber(mFile,n);
 	}
 	void endNormals()const
 	{
@@ -586,7 +610,7 @@ public:
 	}
 	void appendFace(const polyFaces& fc)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		fc.write(mFile);
 	}
 	void endFace()const
@@ -623,7 +647,7 @@ public:
 	}
 	void appendVertexColor(const ColorPerVertex::VertexColor& vclr)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		vclr.write(mFile);
 	}
 	void endVertexColor()const
@@ -680,7 +704,7 @@ public:
 	}
 	void appendVertexFaceColor(const ColorPerVertex::VertexColor::VertexFaceColor& vfcl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		vfcl.write(mFile);
 	}
 	void endVertexFaceColor()const
@@ -743,7 +767,7 @@ public:
 	}
 	void appendVertexNormal(const NormalPerVertex::VertexNormal& vn)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		vn.write(mFile);
 	}
 	void endVertexNormal()const
@@ -795,7 +819,7 @@ public:
 	}
 	void appendVertexFaceNormal(const NormalPerVertex::VertexNormal::VertexFaceNormal& vfnl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		vfnl.write(mFile);
 	}
 	void endVertexFaceNormal()const
@@ -976,8 +1000,8 @@ public:
 		size_t size = (pii_end-pii_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",pii[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,pii[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -987,7 +1011,7 @@ public:
 	}
 	void appendPerInstanceIndex(int pii)const
 	{
-		fprintf(mFile," %i",pii);
+		appendNumber(mFile,pii);
 	}
 	void endPerInstanceIndex()const
 	{
@@ -1004,8 +1028,8 @@ public:
 		size_t size = (pit_end-pit_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",pit[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,pit[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -1015,7 +1039,7 @@ public:
 	}
 	void appendPerInstanceTag(int pit)const
 	{
-		fprintf(mFile," %i",pit);
+		appendNumber(mFile,pit);
 	}
 	void endPerInstanceTag()const
 	{
@@ -60,8 +60,8 @@ public:
 		size_t size = (pmt_end-pmt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",pmt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,pmt[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -71,7 +71,7 @@ public:
 	}
 	void appendPositionMarkerTime(double pmt)const
 	{
-		fprintf(mFile," %f",pmt);
+		appendNumber(mFile,pmt);
 	}
 	void endPositionMarkerTime()const
 	{
@@ -88,8 +88,8 @@ public:
 		size_t size = (omt_end-omt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",omt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,omt[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -99,7 +99,7 @@ public:
 	}
 	void appendOrientationMarkerTime(double omt)const
 	{
-		fprintf(mFile," %f",omt);
+		appendNumber(mFile,omt);
 	}
 	void endOrientationMarkerTime()const
 	{
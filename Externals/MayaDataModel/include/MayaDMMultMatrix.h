@@ -49,7 +49,7 @@ public:
 	}
 	void appendMatrixIn(const matrix& i)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		i.write(mFile);
 	}
 	void endMatrixIn()const
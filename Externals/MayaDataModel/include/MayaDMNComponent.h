@@ -106,8 +106,8 @@ public:
 		size_t size = (ci_end-ci_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ci[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ci[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -117,7 +117,7 @@ public:
 	}
 	void appendComponentIndices(int ci)const
 	{
-		fprintf(mFile," %i",ci);
+		appendNumber(mFile,ci);
 	}
 	void endComponentIndices()const
 	{
@@ -23,9 +23,11 @@ public:
 		unsigned int waveHeight_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", waveHeight_Position);
-			fprintf(file,"%f ", waveHeight_FloatValue);
-			fprintf(file,"%i", waveHeight_Interp);
+			writeNumber(file,waveHeight_Position);
+			fputc(' ',file);
+			writeNumber(file,waveHeight_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,waveHeight_Interp);
 		}
 	};
 	struct WaveTurbulence{
@@ -34,9 +36,11 @@ public:
 		unsigned int waveTurbulence_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", waveTurbulence_Position);
-			fprintf(file,"%f ", waveTurbulence_FloatValue);
-			fprintf(file,"%i", waveTurbulence_Interp);
+			writeNumber(file,waveTurbulence_Position);
+			fputc(' ',file);
+			writeNumber(file,waveTurbulence_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,waveTurbulence_Interp);
 		}
 	};
 	struct WavePeaking{
@@ -45,9 +49,11 @@ public:
 		unsigned int wavePeaking_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", wavePeaking_Position);
-			fprintf(file,"%f ", wavePeaking_FloatValue);
-			fprintf(file,"%i", wavePeaking_Interp);
+			writeNumber(file,wavePeaking_Position);
+			fputc(' ',file);
+			writeNumber(file,wavePeaking_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,wavePeaking_Interp);
 		}
 	};
 public:
@@ -133,7 +139,7 @@ public:
 	}
 	void appendWaveHeight(const WaveHeight& wh)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		wh.write(mFile);
 	}
 	void endWaveHeight()const
@@ -179,7 +185,7 @@ public:
 	}
 	void appendWaveTurbulence(const WaveTurbulence& wtb)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		wtb.write(mFile);
 	}
 	void endWaveTurbulence()const
@@ -225,7 +231,7 @@ public:
 	}
 	void appendWavePeaking(const WavePeaking& wp)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		wp.write(mFile);
 	}
 	void endWavePeaking()const
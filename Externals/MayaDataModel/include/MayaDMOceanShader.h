@@ -23,10 +23,11 @@ public:
 		unsigned int environment_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", environment_Position);
+			writeNumber(file,environment_Position);
+			fputc(' ',file);
 			environment_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", environment_Interp);
+			fputc(' ', file);
+			writeNumber(file,environment_Interp);
 		}
 	};
 	struct WaveHeight{
@@ -35,9 +36,11 @@ public:
 		unsigned int waveHeight_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", waveHeight_Position);
-			fprintf(file,"%f ", waveHeight_FloatValue);
-			fprintf(file,"%i", waveHeight_Interp);
+			writeNumber(file,waveHeight_Position);
+			fputc(' ',file);
+			writeNumber(file,waveHeight_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,waveHeight_Interp);
 		}
 	};
 	struct WaveTurbulence{
@@ -46,9 +49,11 @@ public:
 		unsigned int waveTurbulence_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", waveTurbulence_Position);
-			fprintf(file,"%f ", waveTurbulence_FloatValue);
-			fprintf(file,"%i", waveTurbulence_Interp);
+			writeNumber(file,waveTurbulence_Position);
+			fputc(' ',file);
+			writeNumber(file,waveTurbulence_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,waveTurbulence_Interp);
 		}
 	};
 	struct WavePeaking{
@@ -57,9 +62,11 @@ public:
 		unsigned int wavePeaking_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", wavePeaking_Position);
-			fprintf(file,"%f ", wavePeaking_FloatValue);
-			fprintf(file,"%i", wavePeaking_Interp);
+			writeNumber(file,wavePeaking_Position);
+			fputc(' ',file);
+			writeNumber(file,wavePeaking_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,wavePeaking_Interp);
 		}
 	};
 public:
@@ -273,7 +280,7 @@ public:
 	}
 	void appendEnvironment(const Environment& env)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		env.write(mFile);
 	}
 	void endEnvironment()const
@@ -423,7 +430,7 @@ public:
 	}
 	void appendWaveHeight(const WaveHeight& wh)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		wh.write(mFile);
 	}
 	void endWaveHeight()const
@@ -469,7 +476,7 @@ public:
 	}
 	void appendWaveTurbulence(const WaveTurbulence& wtb)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		wtb.write(mFile);
 	}
 	void endWaveTurbulence()const
@@ -515,7 +522,7 @@ public:
 	}
 	void appendWavePeaking(const WavePeaking& wp)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		wp.write(mFile);
 	}
 	void endWavePeaking()const
@@ -27,13 +27,15 @@ public:
 		void write(FILE* file) const
 		{
 			targetRotate.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", targetRotateOrder);
+			fputc(' ', file);
+			writeNumber(file,targetRotateOrder);
+			fputc(' ',file);
 			targetJointOrient.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			targetParentMatrix.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", targetWeight);
+			fputc(' ', file);
+			writeNumber(file,targetWeight);
+			fputc(' ',file);
 			targetRotateCached.write(file);
 		}
 	};
@@ -68,7 +70,7 @@ public:
 	}
 	void appendTarget(const Target& tg)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		tg.write(mFile);
 	}
 	void endTarget()const
@@ -33,25 +33,27 @@ public:
 		void write(FILE* file) const
 		{
 			targetParentMatrix.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f ", targetWeight);
+			fputc(' ', file);
+			writeNumber(file,targetWeight);
+			fputc(' ',file);
 			targetRotateCached.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			targetTranslate.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			targetRotatePivot.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			targetRotateTranslate.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			targetOffsetTranslate.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			targetRotate.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i ", targetRotateOrder);
+			fputc(' ', file);
+			writeNumber(file,targetRotateOrder);
+			fputc(' ',file);
 			targetJointOrient.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			targetOffsetRotate.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			targetScale.write(file);
 		}
 	};
@@ -86,7 +88,7 @@ public:
 	}
 	void appendTarget(const Target& tg)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		tg.write(mFile);
 	}
 	void endTarget()const
@@ -42,7 +42,7 @@ public:
 		void write(FILE* file) const
 		{
 			instanceAttributeMapping.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 		}
 	};
 	struct MentalRayControls{
@@ -63,21 +63,35 @@ public:
 		short miMaxSamples;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i", miMaxSamples);
+			writeNumber(file,miOverrideCaustics);
+			fputc(' ',file);
+			writeNumber(file,miCausticAccuracy);
+			fputc(' ',file);
+			writeNumber(file,miCausticRadius);
+			fputc(' ',file);
+			writeNumber(file,miOverrideGlobalIllumination);
+			fputc(' ',file);
+			writeNumber(file,miGlobillumAccuracy);
+			fputc(' ',file);
+			writeNumber(file,miGlobillumRadius);
+			fputc(' ',file);
+			writeNumber(file,miOverrideFinalGather);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherRays);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherMinRadius);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherMaxRadius);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherFilter);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherView);
+			fputc(' ',file);
+			writeNumber(file,miOverrideSamples);
+			fputc(' ',file);
+			writeNumber(file,miMinSamples);
+			fputc(' ',file);
+			writeNumber(file,miMaxSamples);
 		}
 	};
 public:
@@ -255,8 +269,8 @@ public:
 		size_t size = (sd_end-sd_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",sd[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,sd[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -266,7 +280,7 @@ public:
 	}
 	void appendSeed(int sd)const
 	{
-		fprintf(mFile," %i",sd);
+		appendNumber(mFile,sd);
 	}
 	void endSeed()const
 	{
@@ -313,8 +327,8 @@ public:
 		size_t size = (gw_end-gw_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",gw[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,gw[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -324,7 +338,7 @@ public:
 	}
 	void appendGoalWeight(double gw)const
 	{
-		fprintf(mFile," %f",gw);
+		appendNumber(mFile,gw);
 	}
 	void endGoalWeight()const
 	{
@@ -341,8 +355,8 @@ public:
 		size_t size = (ga_end-ga_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ga[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ga[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -352,7 +366,7 @@ public:
 	}
 	void appendGoalActive(bool ga)const
 	{
-		fprintf(mFile," %i",ga);
+		appendNumber(mFile,ga);
 	}
 	void endGoalActive()const
 	{
@@ -383,7 +397,7 @@ public:
 	}
 	void appendGoalUvSetName(const string& guv)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		guv.write(mFile);
 	}
 	void endGoalUvSetName()const
@@ -430,7 +444,7 @@ public:
 	}
 	void appendEventName(const string& evn)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		evn.write(mFile);
 	}
 	void endEventName()const
@@ -448,8 +462,8 @@ public:
 		size_t size = (evv_end-evv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",evv[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,evv[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -459,7 +473,7 @@ public:
 	}
 	void appendEventValid(int evv)const
 	{
-		fprintf(mFile," %i",evv);
+		appendNumber(mFile,evv);
 	}
 	void endEventValid()const
 	{
@@ -476,8 +490,8 @@ public:
 		size_t size = (ecp_end-ecp_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ecp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ecp[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -487,7 +501,7 @@ public:
 	}
 	void appendEventCount(short ecp)const
 	{
-		fprintf(mFile," %i",ecp);
+		appendNumber(mFile,ecp);
 	}
 	void endEventCount()const
 	{
@@ -504,8 +518,8 @@ public:
 		size_t size = (eve_end-eve_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",eve[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,eve[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -515,7 +529,7 @@ public:
 	}
 	void appendEventEmit(short eve)const
 	{
-		fprintf(mFile," %i",eve);
+		appendNumber(mFile,eve);
 	}
 	void endEventEmit()const
 	{
@@ -532,8 +546,8 @@ public:
 		size_t size = (evs_end-evs_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",evs[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,evs[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -543,7 +557,7 @@ public:
 	}
 	void appendEventSplit(short evs)const
 	{
-		fprintf(mFile," %i",evs);
+		appendNumber(mFile,evs);
 	}
 	void endEventSplit()const
 	{
@@ -560,8 +574,8 @@ public:
 		size_t size = (evd_end-evd_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",evd[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,evd[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -571,7 +585,7 @@ public:
 	}
 	void appendEventDie(short evd)const
 	{
-		fprintf(mFile," %i",evd);
+		appendNumber(mFile,evd);
 	}
 	void endEventDie()const
 	{
@@ -588,8 +602,8 @@ public:
 		size_t size = (evr_end-evr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",evr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,evr[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -599,7 +613,7 @@ public:
 	}
 	void appendEventRandom(short evr)const
 	{
-		fprintf(mFile," %i",evr);
+		appendNumber(mFile,evr);
 	}
 	void endEventRandom()const
 	{
@@ -616,8 +630,8 @@ public:
 		size_t size = (esp_end-esp_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",esp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,esp[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -627,7 +641,7 @@ public:
 	}
 	void appendEventSpread(double esp)const
 	{
-		fprintf(mFile," %f",esp);
+		appendNumber(mFile,esp);
 	}
 	void endEventSpread()const
 	{
@@ -658,7 +672,7 @@ public:
 	}
 	void appendEventProc(const string& epr)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		epr.write(mFile);
 	}
 	void endEventProc()const
@@ -689,7 +703,7 @@ public:
 	}
 	void appendInstanceData(const InstanceData& idt)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		idt.write(mFile);
 	}
 	void endInstanceData()const
@@ -28,9 +28,11 @@ public:
 		unsigned int curvatureWidth_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", curvatureWidth_Position);
-			fprintf(file,"%f ", curvatureWidth_FloatValue);
-			fprintf(file,"%i", curvatureWidth_Interp);
+			writeNumber(file,curvatureWidth_Position);
+			fputc(' ',file);
+			writeNumber(file,curvatureWidth_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,curvatureWidth_Interp);
 		}
 	};
 public:
@@ -219,7 +221,7 @@ public:
 	}
 	void appendCurvatureWidth(const CurvatureWidth& cwd)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cwd.write(mFile);
 	}
 	void endCurvatureWidth()const
@@ -40,8 +40,8 @@ public:
 		size_t size = (i1_end-i1_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",i1[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,i1[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -51,7 +51,7 @@ public:
 	}
 	void appendInput1D(float i1)const
 	{
-		fprintf(mFile," %f",i1);
+		appendNumber(mFile,i1);
 	}
 	void endInput1D()const
 	{
@@ -70,8 +70,8 @@ public:
 		size_t size = (i2_end-i2_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",i2[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,i2[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -81,7 +81,7 @@ public:
 	}
 	void appendInput2D(float i2)const
 	{
-		fprintf(mFile," %f",i2);
+		appendNumber(mFile,i2);
 	}
 	void endInput2D()const
 	{
@@ -110,8 +110,8 @@ public:
 		size_t size = (i3_end-i3_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",i3[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,i3[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -121,7 +121,7 @@ public:
 	}
 	void appendInput3D(float i3)const
 	{
-		fprintf(mFile," %f",i3);
+		appendNumber(mFile,i3);
 	}
 	void endInput3D()const
 	{
@@ -26,14 +26,14 @@ public:
 		void write(FILE* file) const
 		{
 			targetTranslate.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			targetRotatePivot.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			targetRotateTranslate.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			targetParentMatrix.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", targetWeight);
+			fputc(' ', file);
+			writeNumber(file,targetWeight);
 		}
 	};
 public:
@@ -67,7 +67,7 @@ public:
 	}
 	void appendTarget(const Target& tg)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		tg.write(mFile);
 	}
 	void endTarget()const
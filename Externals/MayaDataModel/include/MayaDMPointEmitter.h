@@ -70,8 +70,8 @@ public:
 		size_t size = (dtc_end-dtc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",dtc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,dtc[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -81,7 +81,7 @@ public:
 	}
 	void appendDeltaTimeCycle(double dtc)const
 	{
-		fprintf(mFile," %f",dtc);
+		appendNumber(mFile,dtc);
 	}
 	void endDeltaTimeCycle()const
 	{
@@ -154,8 +154,8 @@ public:
 		size_t size = (inh_end-inh_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",inh[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,inh[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -165,7 +165,7 @@ public:
 	}
 	void appendInheritFactor(double inh)const
 	{
-		fprintf(mFile," %f",inh);
+		appendNumber(mFile,inh);
 	}
 	void endInheritFactor()const
 	{
@@ -182,8 +182,8 @@ public:
 		size_t size = (full_end-full_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",full[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,full[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -193,7 +193,7 @@ public:
 	}
 	void appendIsFull(bool full)const
 	{
-		fprintf(mFile," %i",full);
+		appendNumber(mFile,full);
 	}
 	void endIsFull()const
 	{
@@ -23,9 +23,11 @@ public:
 		unsigned int taperCurve_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", taperCurve_Position);
-			fprintf(file,"%f ", taperCurve_FloatValue);
-			fprintf(file,"%i", taperCurve_Interp);
+			writeNumber(file,taperCurve_Position);
+			fputc(' ',file);
+			writeNumber(file,taperCurve_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,taperCurve_Interp);
 		}
 	};
 public:
@@ -69,7 +71,7 @@ public:
 	}
 	void appendTaperCurve(const TaperCurve& c)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		c.write(mFile);
 	}
 	void endTaperCurve()const
@@ -23,9 +23,11 @@ public:
 		unsigned int redScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", redScale_Position);
-			fprintf(file,"%f ", redScale_FloatValue);
-			fprintf(file,"%i", redScale_Interp);
+			writeNumber(file,redScale_Position);
+			fputc(' ',file);
+			writeNumber(file,redScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,redScale_Interp);
 		}
 	};
 	struct GreenScale{
@@ -34,9 +36,11 @@ public:
 		unsigned int greenScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", greenScale_Position);
-			fprintf(file,"%f ", greenScale_FloatValue);
-			fprintf(file,"%i", greenScale_Interp);
+			writeNumber(file,greenScale_Position);
+			fputc(' ',file);
+			writeNumber(file,greenScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,greenScale_Interp);
 		}
 	};
 	struct BlueScale{
@@ -45,9 +49,11 @@ public:
 		unsigned int blueScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", blueScale_Position);
-			fprintf(file,"%f ", blueScale_FloatValue);
-			fprintf(file,"%i", blueScale_Interp);
+			writeNumber(file,blueScale_Position);
+			fputc(' ',file);
+			writeNumber(file,blueScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,blueScale_Interp);
 		}
 	};
 	struct AlphaScale{
@@ -56,9 +62,11 @@ public:
 		unsigned int alphaScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", alphaScale_Position);
-			fprintf(file,"%f ", alphaScale_FloatValue);
-			fprintf(file,"%i", alphaScale_Interp);
+			writeNumber(file,alphaScale_Position);
+			fputc(' ',file);
+			writeNumber(file,alphaScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,alphaScale_Interp);
 		}
 	};
 	struct IntensityScale{
@@ -67,9 +75,11 @@ public:
 		unsigned int intensityScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", intensityScale_Position);
-			fprintf(file,"%f ", intensityScale_FloatValue);
-			fprintf(file,"%i", intensityScale_Interp);
+			writeNumber(file,intensityScale_Position);
+			fputc(' ',file);
+			writeNumber(file,intensityScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,intensityScale_Interp);
 		}
 	};
 public:
@@ -110,7 +120,7 @@ public:
 	}
 	void appendRedScale(const RedScale& r)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		r.write(mFile);
 	}
 	void endRedScale()const
@@ -156,7 +166,7 @@ public:
 	}
 	void appendGreenScale(const GreenScale& g)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		g.write(mFile);
 	}
 	void endGreenScale()const
@@ -202,7 +212,7 @@ public:
 	}
 	void appendBlueScale(const BlueScale& b)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		b.write(mFile);
 	}
 	void endBlueScale()const
@@ -248,7 +258,7 @@ public:
 	}
 	void appendAlphaScale(const AlphaScale& a)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		a.write(mFile);
 	}
 	void endAlphaScale()const
@@ -294,7 +304,7 @@ public:
 	}
 	void appendIntensityScale(const IntensityScale& n)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		n.write(mFile);
 	}
 	void endIntensityScale()const
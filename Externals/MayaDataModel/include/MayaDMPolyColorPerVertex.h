@@ -27,20 +27,21 @@ public:
 				void write(FILE* file) const
 				{
 					vertexFaceColorRGB.write(file);
-					fprintf(file, " ");
-					fprintf(file,"%f", vertexFaceAlpha);
+					fputc(' ', file);
+					writeNumber(file,vertexFaceAlpha);
 				}
 			}* vertexFaceColor;
 			void write(FILE* file) const
 			{
 				vertexColorRGB.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%f ", vertexAlpha);
+				fputc(' ', file);
+				writeNumber(file,vertexAlpha);
+				fputc(' ',file);
 				size_t size = sizeof(vertexFaceColor)/sizeof(VertexFaceColor);
 				for(size_t i=0; i<size; ++i)
 				{
 					vertexFaceColor[i].write(file);
-					if(i+1<size) fprintf(file," ");
+					if(i+1<size) fputc(' ',file);
 				}
 			}
 		}* vertexColor;
@@ -50,7 +51,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				vertexColor[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -91,7 +92,7 @@ public:
 	}
 	void appendVertexColor(const ColorPerVertex::VertexColor& vclr)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		vclr.write(mFile);
 	}
 	void endVertexColor()const
@@ -148,7 +149,7 @@ public:
 	}
 	void appendVertexFaceColor(const ColorPerVertex::VertexColor::VertexFaceColor& vfcl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		vfcl.write(mFile);
 	}
 	void endVertexFaceColor()const
@@ -35,8 +35,8 @@ public:
 		size_t size = (cr_end-cr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,cr[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendCrease(float cr)const
 	{
-		fprintf(mFile," %f",cr);
+		appendNumber(mFile,cr);
 	}
 	void endCrease()const
 	{
@@ -69,8 +69,8 @@ public:
 		size_t size = (crv_end-crv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",crv[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,crv[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -80,7 +80,7 @@ public:
 	}
 	void appendCreaseVertex(float crv)const
 	{
-		fprintf(mFile," %f",crv);
+		appendNumber(mFile,crv);
 	}
 	void endCreaseVertex()const
 	{
@@ -36,8 +36,8 @@ public:
 		size_t size = (v_end-v_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,v[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -47,7 +47,7 @@ public:
 	}
 	void appendVertices(float v)const
 	{
-		fprintf(mFile," %f",v);
+		appendNumber(mFile,v);
 	}
 	void endVertices()const
 	{
@@ -79,8 +79,8 @@ public:
 		size_t size = (l_end-l_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",l[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,l[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -90,7 +90,7 @@ public:
 	}
 	void appendLoop(int l)const
 	{
-		fprintf(mFile," %i",l);
+		appendNumber(mFile,l);
 	}
 	void endLoop()const
 	{
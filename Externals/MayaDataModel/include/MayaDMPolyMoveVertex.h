@@ -177,8 +177,8 @@ public:
 		size_t size = (ga_end-ga_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ga[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ga[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -188,7 +188,7 @@ public:
 	}
 	void appendGain(float ga)const
 	{
-		fprintf(mFile," %f",ga);
+		appendNumber(mFile,ga);
 	}
 	void endGain()const
 	{
@@ -30,12 +30,12 @@ public:
 			void write(FILE* file) const
 			{
 				vertexNormalXYZ.write(file);
-				fprintf(file, " ");
+				fputc(' ', file);
 				size_t size = sizeof(vertexFaceNormal)/sizeof(VertexFaceNormal);
 				for(size_t i=0; i<size; ++i)
 				{
 					vertexFaceNormal[i].write(file);
-					if(i+1<size) fprintf(file," ");
+					if(i+1<size) fputc(' ',file);
 				}
 			}
 		}* vertexNormal;
@@ -45,7 +45,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				vertexNormal[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -86,7 +86,7 @@ public:
 	}
 	void appendVertexNormal(const NormalPerVertex::VertexNormal& vn)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		vn.write(mFile);
 	}
 	void endVertexNormal()const
@@ -138,7 +138,7 @@ public:
 	}
 	void appendVertexFaceNormal(const NormalPerVertex::VertexNormal::VertexFaceNormal& vfnl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		vfnl.write(mFile);
 	}
 	void endVertexFaceNormal()const
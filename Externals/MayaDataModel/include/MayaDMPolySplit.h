@@ -36,8 +36,8 @@ public:
 		size_t size = (v_end-v_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,v[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -47,7 +47,7 @@ public:
 	}
 	void appendVertices(float v)const
 	{
-		fprintf(mFile," %f",v);
+		appendNumber(mFile,v);
 	}
 	void endVertices()const
 	{
@@ -79,8 +79,8 @@ public:
 		size_t size = (e_end-e_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",e[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,e[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -90,7 +90,7 @@ public:
 	}
 	void appendEdge(float e)const
 	{
-		fprintf(mFile," %f",e);
+		appendNumber(mFile,e);
 	}
 	void endEdge()const
 	{
@@ -107,8 +107,8 @@ public:
 		size_t size = (d_end-d_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",d[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,d[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -118,7 +118,7 @@ public:
 	}
 	void appendDesc(int d)const
 	{
-		fprintf(mFile," %i",d);
+		appendNumber(mFile,d);
 	}
 	void endDesc()const
 	{
@@ -23,9 +23,11 @@ public:
 		unsigned int profileCurve_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", profileCurve_Position);
-			fprintf(file,"%f ", profileCurve_FloatValue);
-			fprintf(file,"%i", profileCurve_Interp);
+			writeNumber(file,profileCurve_Position);
+			fputc(' ',file);
+			writeNumber(file,profileCurve_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,profileCurve_Interp);
 		}
 	};
 public:
@@ -94,7 +96,7 @@ public:
 	}
 	void appendProfileCurve(const ProfileCurve& p)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		p.write(mFile);
 	}
 	void endProfileCurve()const
@@ -25,7 +25,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				uvPoints[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -91,7 +91,7 @@ public:
 	}
 	void appendCachedUVs(const CachedUVs& cuv)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cuv.write(mFile);
 	}
 	void endCachedUVs()const
@@ -110,8 +110,8 @@ public:
 		size_t size = (uvp_end-uvp_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uvp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,uvp[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -121,7 +121,7 @@ public:
 	}
 	void appendUvPoints(float uvp)const
 	{
-		fprintf(mFile," %f",uvp);
+		appendNumber(mFile,uvp);
 	}
 	void endUvPoints()const
 	{
@@ -37,8 +37,8 @@ public:
 		size_t size = (tk_end-tk_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tk[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,tk[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -48,7 +48,7 @@ public:
 	}
 	void appendTweak(float tk)const
 	{
-		fprintf(mFile," %f",tk);
+		appendNumber(mFile,tk);
 	}
 	void endTweak()const
 	{
@@ -24,10 +24,13 @@ public:
 		float newVValue;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", faceId);
-			fprintf(file,"%i ", vertexId);
-			fprintf(file,"%f ", newUValue);
-			fprintf(file,"%f", newVValue);
+			writeNumber(file,faceId);
+			fputc(' ',file);
+			writeNumber(file,vertexId);
+			fputc(' ',file);
+			writeNumber(file,newUValue);
+			fputc(' ',file);
+			writeNumber(file,newVValue);
 		}
 	};
 public:
@@ -50,8 +53,8 @@ public:
 		size_t size = (uvtk_end-uvtk_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uvtk[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,uvtk[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -61,7 +64,7 @@ public:
 	}
 	void appendUvTweak(float uvtk)const
 	{
-		fprintf(mFile," %f",uvtk);
+		appendNumber(mFile,uvtk);
 	}
 	void endUvTweak()const
 	{
@@ -101,7 +104,7 @@ public:
 	}
 	void appendNewUV(const NewUV& nuv)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		nuv.write(mFile);
 	}
 	void endNewUV()const
@@ -45,8 +45,8 @@ public:
 		size_t size = (ed_end-ed_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ed[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ed[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -56,7 +56,7 @@ public:
 	}
 	void appendEdge(int ed)const
 	{
-		fprintf(mFile," %i",ed);
+		appendNumber(mFile,ed);
 	}
 	void endEdge()const
 	{
@@ -24,14 +24,14 @@ public:
 			void write(FILE* file) const
 			{
 				inTriple.write(file);
-				fprintf(file, " ");
-				fprintf(file,"%f", inSingle);
+				fputc(' ', file);
+				writeNumber(file,inSingle);
 			}
 		} inQuad;
 		void write(FILE* file) const
 		{
 			inQuad.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 		}
 	};
 	struct Default{
@@ -40,8 +40,8 @@ public:
 		void write(FILE* file) const
 		{
 			defTriple.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", defSingle);
+			fputc(' ', file);
+			writeNumber(file,defSingle);
 		}
 	};
 	struct Output{
@@ -80,7 +80,7 @@ public:
 	}
 	void appendInput(const Input& i)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		i.write(mFile);
 	}
 	void endInput()const
@@ -22,7 +22,8 @@ public:
 		float3 color;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", position);
+			writeNumber(file,position);
+			fputc(' ',file);
 			color.write(file);
 		}
 	};
@@ -67,7 +68,7 @@ public:
 	}
 	void appendColorEntryList(const ColorEntryList& cel)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cel.write(mFile);
 	}
 	void endColorEntryList()const
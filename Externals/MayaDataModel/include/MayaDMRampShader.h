@@ -23,10 +23,11 @@ public:
 		unsigned int color_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", color_Position);
+			writeNumber(file,color_Position);
+			fputc(' ',file);
 			color_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", color_Interp);
+			fputc(' ', file);
+			writeNumber(file,color_Interp);
 		}
 	};
 	struct Transparency{
@@ -35,10 +36,11 @@ public:
 		unsigned int transparency_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", transparency_Position);
+			writeNumber(file,transparency_Position);
+			fputc(' ',file);
 			transparency_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", transparency_Interp);
+			fputc(' ', file);
+			writeNumber(file,transparency_Interp);
 		}
 	};
 	struct Incandescence{
@@ -47,10 +49,11 @@ public:
 		unsigned int incandescence_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", incandescence_Position);
+			writeNumber(file,incandescence_Position);
+			fputc(' ',file);
 			incandescence_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", incandescence_Interp);
+			fputc(' ', file);
+			writeNumber(file,incandescence_Interp);
 		}
 	};
 	struct SpecularRollOff{
@@ -59,9 +62,11 @@ public:
 		unsigned int specularRollOff_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", specularRollOff_Position);
-			fprintf(file,"%f ", specularRollOff_FloatValue);
-			fprintf(file,"%i", specularRollOff_Interp);
+			writeNumber(file,specularRollOff_Position);
+			fputc(' ',file);
+			writeNumber(file,specularRollOff_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,specularRollOff_Interp);
 		}
 	};
 	struct SpecularColor{
@@ -70,10 +75,11 @@ public:
 		unsigned int specularColor_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", specularColor_Position);
+			writeNumber(file,specularColor_Position);
+			fputc(' ',file);
 			specularColor_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", specularColor_Interp);
+			fputc(' ', file);
+			writeNumber(file,specularColor_Interp);
 		}
 	};
 	struct Reflectivity{
@@ -82,9 +88,11 @@ public:
 		unsigned int reflectivity_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", reflectivity_Position);
-			fprintf(file,"%f ", reflectivity_FloatValue);
-			fprintf(file,"%i", reflectivity_Interp);
+			writeNumber(file,reflectivity_Position);
+			fputc(' ',file);
+			writeNumber(file,reflectivity_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,reflectivity_Interp);
 		}
 	};
 	struct Environment{
@@ -93,10 +101,11 @@ public:
 		unsigned int environment_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", environment_Position);
+			writeNumber(file,environment_Position);
+			fputc(' ',file);
 			environment_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", environment_Interp);
+			fputc(' ', file);
+			writeNumber(file,environment_Interp);
 		}
 	};
 public:
@@ -155,7 +164,7 @@ public:
 	}
 	void appendColor(const Color& clr)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		clr.write(mFile);
 	}
 	void endColor()const
@@ -253,7 +262,7 @@ public:
 	}
 	void appendTransparency(const Transparency& it)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		it.write(mFile);
 	}
 	void endTransparency()const
@@ -336,7 +345,7 @@ public:
 	}
 	void appendIncandescence(const Incandescence& ic)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ic.write(mFile);
 	}
 	void endIncandescence()const
@@ -468,7 +477,7 @@ public:
 	}
 	void appendSpecularRollOff(const SpecularRollOff& sro)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		sro.write(mFile);
 	}
 	void endSpecularRollOff()const
@@ -519,7 +528,7 @@ public:
 	}
 	void appendSpecularColor(const SpecularColor& sc)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		sc.write(mFile);
 	}
 	void endSpecularColor()const
@@ -581,7 +590,7 @@ public:
 	}
 	void appendReflectivity(const Reflectivity& rfl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		rfl.write(mFile);
 	}
 	void endReflectivity()const
@@ -627,7 +636,7 @@ public:
 	}
 	void appendEnvironment(const Environment& env)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		env.write(mFile);
 	}
 	void endEnvironment()const
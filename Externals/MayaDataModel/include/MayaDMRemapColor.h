@@ -23,9 +23,11 @@ public:
 		unsigned int red_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", red_Position);
-			fprintf(file,"%f ", red_FloatValue);
-			fprintf(file,"%i", red_Interp);
+			writeNumber(file,red_Position);
+			fputc(' ',file);
+			writeNumber(file,red_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,red_Interp);
 		}
 	};
 	struct Green{
@@ -34,9 +36,11 @@ public:
 		unsigned int green_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", green_Position);
-			fprintf(file,"%f ", green_FloatValue);
-			fprintf(file,"%i", green_Interp);
+			writeNumber(file,green_Position);
+			fputc(' ',file);
+			writeNumber(file,green_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,green_Interp);
 		}
 	};
 	struct Blue{
@@ -45,9 +49,11 @@ public:
 		unsigned int blue_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", blue_Position);
-			fprintf(file,"%f ", blue_FloatValue);
-			fprintf(file,"%i", blue_Interp);
+			writeNumber(file,blue_Position);
+			fputc(' ',file);
+			writeNumber(file,blue_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,blue_Interp);
 		}
 	};
 public:
@@ -122,7 +128,7 @@ public:
 	}
 	void appendRed(const Red& r)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		r.write(mFile);
 	}
 	void endRed()const
@@ -168,7 +174,7 @@ public:
 	}
 	void appendGreen(const Green& g)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		g.write(mFile);
 	}
 	void endGreen()const
@@ -214,7 +220,7 @@ public:
 	}
 	void appendBlue(const Blue& b)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		b.write(mFile);
 	}
 	void endBlue()const
@@ -23,9 +23,11 @@ public:
 		unsigned int hue_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", hue_Position);
-			fprintf(file,"%f ", hue_FloatValue);
-			fprintf(file,"%i", hue_Interp);
+			writeNumber(file,hue_Position);
+			fputc(' ',file);
+			writeNumber(file,hue_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,hue_Interp);
 		}
 	};
 	struct Saturation{
@@ -34,9 +36,11 @@ public:
 		unsigned int saturation_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", saturation_Position);
-			fprintf(file,"%f ", saturation_FloatValue);
-			fprintf(file,"%i", saturation_Interp);
+			writeNumber(file,saturation_Position);
+			fputc(' ',file);
+			writeNumber(file,saturation_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,saturation_Interp);
 		}
 	};
 	struct Value{
@@ -45,9 +49,11 @@ public:
 		unsigned int value_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", value_Position);
-			fprintf(file,"%f ", value_FloatValue);
-			fprintf(file,"%i", value_Interp);
+			writeNumber(file,value_Position);
+			fputc(' ',file);
+			writeNumber(file,value_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,value_Interp);
 		}
 	};
 public:
@@ -122,7 +128,7 @@ public:
 	}
 	void appendHue(const Hue& h)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		h.write(mFile);
 	}
 	void endHue()const
@@ -168,7 +174,7 @@ public:
 	}
 	void appendSaturation(const Saturation& s)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		s.write(mFile);
 	}
 	void endSaturation()const
@@ -214,7 +220,7 @@ public:
 	}
 	void appendValue(const Value& v)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		v.write(mFile);
 	}
 	void endValue()const
@@ -23,9 +23,11 @@ public:
 		unsigned int value_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", value_Position);
-			fprintf(file,"%f ", value_FloatValue);
-			fprintf(file,"%i", value_Interp);
+			writeNumber(file,value_Position);
+			fputc(' ',file);
+			writeNumber(file,value_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,value_Interp);
 		}
 	};
 	struct Color{
@@ -34,10 +36,11 @@ public:
 		unsigned int color_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", color_Position);
+			writeNumber(file,color_Position);
+			fputc(' ',file);
 			color_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", color_Interp);
+			fputc(' ', file);
+			writeNumber(file,color_Interp);
 		}
 	};
 public:
@@ -96,7 +99,7 @@ public:
 	}
 	void appendValue(const Value& vl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		vl.write(mFile);
 	}
 	void endValue()const
@@ -142,7 +145,7 @@ public:
 	}
 	void appendColor(const Color& cl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cl.write(mFile);
 	}
 	void endColor()const
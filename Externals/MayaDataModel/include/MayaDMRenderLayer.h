@@ -23,9 +23,11 @@ public:
 		unsigned char drawColor;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", identification);
-			fprintf(file,"%i ", renderable);
-			fprintf(file,"%i", drawColor);
+			writeNumber(file,identification);
+			fputc(' ',file);
+			writeNumber(file,renderable);
+			fputc(' ',file);
+			writeNumber(file,drawColor);
 		}
 	};
 	struct RenderPassInfo{
@@ -37,19 +39,24 @@ public:
 		bool shadow;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", beauty);
-			fprintf(file,"%i ", color);
-			fprintf(file,"%i ", ambient);
-			fprintf(file,"%i ", diffuse);
-			fprintf(file,"%i ", specular);
-			fprintf(file,"%i", shadow);
+			writeNumber(file,beauty);
+			fputc(' ',file);
+			writeNumber(file,color);
+			fputc(' ',file);
+			writeNumber(file,ambient);
+			fputc(' ',file);
+			writeNumber(file,diffuse);
+			fputc(' ',file);
+			writeNumber(file,specular);
+			fputc(' ',file);
+			writeNumber(file,shadow);
 		}
 	};
 	struct MentalRayControls{
 		bool globalIllum;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i", globalIllum);
+			writeNumber(file,globalIllum);
 		}
 	};
 	struct Adjustments{
@@ -111,8 +118,8 @@ public:
 		size_t size = (rlc_end-rlc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",rlc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,rlc[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -122,7 +129,7 @@ public:
 	}
 	void appendLayerChildren(short rlc)const
 	{
-		fprintf(mFile," %i",rlc);
+		appendNumber(mFile,rlc);
 	}
 	void endLayerChildren()const
 	{
@@ -199,7 +206,7 @@ public:
 	}
 	void appendAdjustments(const Adjustments& adjs)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		adjs.write(mFile);
 	}
 	void endAdjustments()const
@@ -230,7 +237,7 @@ public:
 	}
 	void appendOutAdjustments(const OutAdjustments& oajs)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		oajs.write(mFile);
 	}
 	void endOutAdjustments()const
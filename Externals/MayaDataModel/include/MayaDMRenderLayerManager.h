@@ -40,8 +40,8 @@ public:
 		size_t size = (rlmi_end-rlmi_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",rlmi[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,rlmi[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -51,7 +51,7 @@ public:
 	}
 	void appendRenderLayerId(short rlmi)const
 	{
-		fprintf(mFile," %i",rlmi);
+		appendNumber(mFile,rlmi);
 	}
 	void endRenderLayerId()const
 	{
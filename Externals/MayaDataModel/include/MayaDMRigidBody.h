@@ -340,8 +340,8 @@ public:
 		size_t size = (ift_end-ift_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ift[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ift[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -351,7 +351,7 @@ public:
 	}
 	void appendInputForceType(bool ift)const
 	{
-		fprintf(mFile," %i",ift);
+		appendNumber(mFile,ift);
 	}
 	void endInputForceType()const
 	{
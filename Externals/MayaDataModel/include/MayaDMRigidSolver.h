@@ -23,7 +23,7 @@ public:
 		void write(FILE* file) const
 		{
 			inputForce.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			inputTorque.write(file);
 		}
 	};
@@ -63,7 +63,7 @@ public:
 	}
 	void appendGeneralForce(const GeneralForce& gfr)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		gfr.write(mFile);
 	}
 	void endGeneralForce()const
@@ -96,8 +96,8 @@ public:
 		size_t size = (t_end-t_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",t[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,t[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -107,7 +107,7 @@ public:
 	}
 	void appendTranslate(double t)const
 	{
-		fprintf(mFile," %f",t);
+		appendNumber(mFile,t);
 	}
 	void endTranslate()const
 	{
@@ -140,8 +140,8 @@ public:
 		size_t size = (r_end-r_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",r[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,r[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -151,7 +151,7 @@ public:
 	}
 	void appendRotate(double r)const
 	{
-		fprintf(mFile," %f",r);
+		appendNumber(mFile,r);
 	}
 	void endRotate()const
 	{
@@ -184,8 +184,8 @@ public:
 		size_t size = (ctr_end-ctr_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",ctr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ctr[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -195,7 +195,7 @@ public:
 	}
 	void appendConstraintTranslate(double ctr)const
 	{
-		fprintf(mFile," %f",ctr);
+		appendNumber(mFile,ctr);
 	}
 	void endConstraintTranslate()const
 	{
@@ -228,8 +228,8 @@ public:
 		size_t size = (cr_end-cr_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,cr[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -239,7 +239,7 @@ public:
 	}
 	void appendConstraintRotate(double cr)const
 	{
-		fprintf(mFile," %f",cr);
+		appendNumber(mFile,cr);
 	}
 	void endConstraintRotate()const
 	{
@@ -29,29 +29,31 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				inputCurveA[i].write(file);
-				fprintf(file, " ");
-				if(i+1<size) fprintf(file," ");
+				fputc(' ', file);
+				if(i+1<size) fputc(' ',file);
 			}
 			size = sizeof(inputCurveB)/sizeof(nurbsCurve);
 			for(size_t i=0; i<size; ++i)
 			{
 				inputCurveB[i].write(file);
-				fprintf(file, " ");
-				if(i+1<size) fprintf(file," ");
+				fputc(' ', file);
+				if(i+1<size) fputc(' ',file);
 			}
 			size = sizeof(inSurfIdxA)/sizeof(int);
 			for(size_t i=0; i<size; ++i)
 			{
-				fprintf(file,"%i ", inSurfIdxA[i]);
-				if(i+1<size) fprintf(file," ");
+				writeNumber(file,inSurfIdxA[i]);
+				fputc(' ',file);
+				if(i+1<size) fputc(' ',file);
 			}
 			size = sizeof(inSurfIdxB)/sizeof(int);
 			for(size_t i=0; i<size; ++i)
 			{
-				fprintf(file,"%i ", inSurfIdxB[i]);
-				if(i+1<size) fprintf(file," ");
+				writeNumber(file,inSurfIdxB[i]);
+				fputc(' ',file);
+				if(i+1<size) fputc(' ',file);
 			}
-			fprintf(file,"%i", edgeValid);
+			writeNumber(file,edgeValid);
 		}
 	};
 public:
@@ -85,7 +87,7 @@ public:
 	}
 	void appendInputSurface(const nurbsSurface& is)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		is.write(mFile);
 	}
 	void endInputSurface()const
@@ -103,8 +105,8 @@ public:
 		size_t size = (r_end-r_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",r[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,r[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -114,7 +116,7 @@ public:
 	}
 	void appendRadius(double r)const
 	{
-		fprintf(mFile," %f",r);
+		appendNumber(mFile,r);
 	}
 	void endRadius()const
 	{
@@ -144,7 +146,7 @@ public:
 	}
 	void appendEdge(const Edge& e)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		e.write(mFile);
 	}
 	void endEdge()const
@@ -175,7 +177,7 @@ public:
 	}
 	void appendInputCurveA(const nurbsCurve& ica)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ica.write(mFile);
 	}
 	void endInputCurveA()const
@@ -206,7 +208,7 @@ public:
 	}
 	void appendInputCurveB(const nurbsCurve& icb)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		icb.write(mFile);
 	}
 	void endInputCurveB()const
@@ -224,8 +226,8 @@ public:
 		size_t size = (isa_end-isa_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",isa[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,isa[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -235,7 +237,7 @@ public:
 	}
 	void appendInSurfIdxA(int isa)const
 	{
-		fprintf(mFile," %i",isa);
+		appendNumber(mFile,isa);
 	}
 	void endInSurfIdxA()const
 	{
@@ -252,8 +254,8 @@ public:
 		size_t size = (isb_end-isb_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",isb[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,isb[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -263,7 +265,7 @@ public:
 	}
 	void appendInSurfIdxB(int isb)const
 	{
-		fprintf(mFile," %i",isb);
+		appendNumber(mFile,isb);
 	}
 	void endInSurfIdxB()const
 	{
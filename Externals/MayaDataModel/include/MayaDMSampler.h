@@ -23,8 +23,9 @@ public:
 			short function_InmapFrom;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", function_InmapTo);
-				fprintf(file,"%i", function_InmapFrom);
+				writeNumber(file,function_InmapTo);
+				fputc(' ',file);
+				writeNumber(file,function_InmapFrom);
 			}
 		}* function_Inmap;
 		struct Function_Outmap{
@@ -32,8 +33,9 @@ public:
 			short function_OutmapFrom;
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", function_OutmapTo);
-				fprintf(file,"%i", function_OutmapFrom);
+				writeNumber(file,function_OutmapTo);
+				fputc(' ',file);
+				writeNumber(file,function_OutmapFrom);
 			}
 		}* function_Outmap;
 		double function_Default;
@@ -43,17 +45,17 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				function_Inmap[i].write(file);
-				fprintf(file, " ");
-				if(i+1<size) fprintf(file," ");
+				fputc(' ', file);
+				if(i+1<size) fputc(' ',file);
 			}
 			size = sizeof(function_Outmap)/sizeof(Function_Outmap);
 			for(size_t i=0; i<size; ++i)
 			{
 				function_Outmap[i].write(file);
-				fprintf(file, " ");
-				if(i+1<size) fprintf(file," ");
+				fputc(' ', file);
+				if(i+1<size) fputc(' ',file);
 			}
-			fprintf(file,"%f", function_Default);
+			writeNumber(file,function_Default);
 		}
 	};
 public:
@@ -113,7 +115,7 @@ public:
 	}
 	void appendFunction_Inmap(const Function::Function_Inmap& fi)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		fi.write(mFile);
 	}
 	void endFunction_Inmap()const
@@ -154,7 +156,7 @@ public:
 	}
 	void appendFunction_Outmap(const Function::Function_Outmap& fo)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		fo.write(mFile);
 	}
 	void endFunction_Outmap()const
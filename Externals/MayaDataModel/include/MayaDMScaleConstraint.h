@@ -24,10 +24,10 @@ public:
 		void write(FILE* file) const
 		{
 			targetScale.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 			targetParentMatrix.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", targetWeight);
+			fputc(' ', file);
+			writeNumber(file,targetWeight);
 		}
 	};
 public:
@@ -61,7 +61,7 @@ public:
 	}
 	void appendTarget(const Target& tg)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		tg.write(mFile);
 	}
 	void endTarget()const
@@ -21,7 +21,8 @@ public:
 		float inSingle;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", inSingle);
+			writeNumber(file,inSingle);
+			fputc(' ',file);
 		}
 	};
 public:
@@ -55,7 +56,7 @@ public:
 	}
 	void appendInput(const Input& i)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		i.write(mFile);
 	}
 	void endInput()const
@@ -24,8 +24,8 @@ public:
 			size_t size = sizeof(weights)/sizeof(double);
 			for(size_t i=0; i<size; ++i)
 			{
-				fprintf(file,"%f", weights[i]);
-				if(i+1<size) fprintf(file," ");
+				writeNumber(file,weights[i]);
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -60,7 +60,7 @@ public:
 	}
 	void appendWeightList(const WeightList& wl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		wl.write(mFile);
 	}
 	void endWeightList()const
@@ -78,8 +78,8 @@ public:
 		size_t size = (w_end-w_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,w[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -89,7 +89,7 @@ public:
 	}
 	void appendWeights(double w)const
 	{
-		fprintf(mFile," %f",w);
+		appendNumber(mFile,w);
 	}
 	void endWeights()const
 	{
@@ -120,7 +120,7 @@ public:
 	}
 	void appendBindPreMatrix(const matrix& pm)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		pm.write(mFile);
 	}
 	void endBindPreMatrix()const
@@ -159,7 +159,7 @@ public:
 	}
 	void appendMatrix(const matrix& ma)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ma.write(mFile);
 	}
 	void endMatrix()const
@@ -177,8 +177,8 @@ public:
 		size_t size = (dpf_end-dpf_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",dpf[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,dpf[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -188,7 +188,7 @@ public:
 	}
 	void appendDropoff(double dpf)const
 	{
-		fprintf(mFile," %f",dpf);
+		appendNumber(mFile,dpf);
 	}
 	void endDropoff()const
 	{
@@ -205,8 +205,8 @@ public:
 		size_t size = (smt_end-smt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",smt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,smt[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -216,7 +216,7 @@ public:
 	}
 	void appendSmoothness(double smt)const
 	{
-		fprintf(mFile," %f",smt);
+		appendNumber(mFile,smt);
 	}
 	void endSmoothness()const
 	{
@@ -233,8 +233,8 @@ public:
 		size_t size = (lw_end-lw_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",lw[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,lw[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -244,7 +244,7 @@ public:
 	}
 	void appendLockWeights(bool lw)const
 	{
-		fprintf(mFile," %i",lw);
+		appendNumber(mFile,lw);
 	}
 	void endLockWeights()const
 	{
@@ -288,8 +288,8 @@ public:
 		size_t size = (ns_end-ns_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ns[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ns[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -299,7 +299,7 @@ public:
 	}
 	void appendNurbsSamples(int ns)const
 	{
-		fprintf(mFile," %i",ns);
+		appendNumber(mFile,ns);
 	}
 	void endNurbsSamples()const
 	{
@@ -28,9 +28,11 @@ public:
 		unsigned int falloffCurve_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", falloffCurve_Position);
-			fprintf(file,"%f ", falloffCurve_FloatValue);
-			fprintf(file,"%i", falloffCurve_Interp);
+			writeNumber(file,falloffCurve_Position);
+			fputc(' ',file);
+			writeNumber(file,falloffCurve_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,falloffCurve_Interp);
 		}
 	};
 public:
@@ -87,7 +89,7 @@ public:
 	}
 	void appendGeomMatrix(const matrix& gm)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		gm.write(mFile);
 	}
 	void endGeomMatrix()const
@@ -132,7 +134,7 @@ public:
 	}
 	void appendFalloffCurve(const FalloffCurve& fc)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		fc.write(mFile);
 	}
 	void endFalloffCurve()const
@@ -115,7 +115,7 @@ public:
 	}
 	void appendObjectPositions(const vectorArray& opos)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		opos.write(mFile);
 	}
 	void endObjectPositions()const
@@ -147,7 +147,7 @@ public:
 	}
 	void appendObjectVelocities(const vectorArray& ovel)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		ovel.write(mFile);
 	}
 	void endObjectVelocities()const
@@ -179,7 +179,7 @@ public:
 	}
 	void appendObjectMass(const doubleArray& omas)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		omas.write(mFile);
 	}
 	void endObjectMass()const
@@ -197,8 +197,8 @@ public:
 		size_t size = (dt_end-dt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",dt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,dt[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -208,7 +208,7 @@ public:
 	}
 	void appendDeltaTime(double dt)const
 	{
-		fprintf(mFile," %f",dt);
+		appendNumber(mFile,dt);
 	}
 	void endDeltaTime()const
 	{
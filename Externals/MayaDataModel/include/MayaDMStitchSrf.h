@@ -35,8 +35,8 @@ public:
 		size_t size = (pc_end-pc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",pc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,pc[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendPositionalContinuity(bool pc)const
 	{
-		fprintf(mFile," %i",pc);
+		appendNumber(mFile,pc);
 	}
 	void endPositionalContinuity()const
 	{
@@ -63,8 +63,8 @@ public:
 		size_t size = (tc_end-tc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",tc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,tc[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -74,7 +74,7 @@ public:
 	}
 	void appendTangentialContinuity(bool tc)const
 	{
-		fprintf(mFile," %i",tc);
+		appendNumber(mFile,tc);
 	}
 	void endTangentialContinuity()const
 	{
@@ -91,8 +91,8 @@ public:
 		size_t size = (tt_end-tt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",tt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,tt[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -102,7 +102,7 @@ public:
 	}
 	void appendToggleTolerance(bool tt)const
 	{
-		fprintf(mFile," %i",tt);
+		appendNumber(mFile,tt);
 	}
 	void endToggleTolerance()const
 	{
@@ -119,8 +119,8 @@ public:
 		size_t size = (tol_end-tol_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",tol[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,tol[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -130,7 +130,7 @@ public:
 	}
 	void appendTolerance(double tol)const
 	{
-		fprintf(mFile," %f",tol);
+		appendNumber(mFile,tol);
 	}
 	void endTolerance()const
 	{
@@ -147,8 +147,8 @@ public:
 		size_t size = (sc_end-sc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",sc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,sc[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -158,7 +158,7 @@ public:
 	}
 	void appendStepCount(int sc)const
 	{
-		fprintf(mFile," %i",sc);
+		appendNumber(mFile,sc);
 	}
 	void endStepCount()const
 	{
@@ -175,8 +175,8 @@ public:
 		size_t size = (u_end-u_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",u[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,u[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -186,7 +186,7 @@ public:
 	}
 	void appendParameterU(double u)const
 	{
-		fprintf(mFile," %f",u);
+		appendNumber(mFile,u);
 	}
 	void endParameterU()const
 	{
@@ -203,8 +203,8 @@ public:
 		size_t size = (v_end-v_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",v[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,v[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -214,7 +214,7 @@ public:
 	}
 	void appendParameterV(double v)const
 	{
-		fprintf(mFile," %f",v);
+		appendNumber(mFile,v);
 	}
 	void endParameterV()const
 	{
@@ -241,8 +241,8 @@ public:
 		size_t size = (ci_end-ci_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ci[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ci[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -252,7 +252,7 @@ public:
 	}
 	void appendCvIthIndex(int ci)const
 	{
-		fprintf(mFile," %i",ci);
+		appendNumber(mFile,ci);
 	}
 	void endCvIthIndex()const
 	{
@@ -269,8 +269,8 @@ public:
 		size_t size = (cj_end-cj_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",cj[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,cj[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -280,7 +280,7 @@ public:
 	}
 	void appendCvJthIndex(int cj)const
 	{
-		fprintf(mFile," %i",cj);
+		appendNumber(mFile,cj);
 	}
 	void endCvJthIndex()const
 	{
@@ -22,8 +22,9 @@ public:
 		bool opposite;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", samples);
-			fprintf(file,"%i", opposite);
+			writeNumber(file,samples);
+			fputc(' ',file);
+			writeNumber(file,opposite);
 		}
 	};
 	struct PressureScale{
@@ -32,9 +33,11 @@ public:
 		unsigned int pressureScale_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", pressureScale_Position);
-			fprintf(file,"%f ", pressureScale_FloatValue);
-			fprintf(file,"%i", pressureScale_Interp);
+			writeNumber(file,pressureScale_Position);
+			fputc(' ',file);
+			writeNumber(file,pressureScale_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,pressureScale_Interp);
 		}
 	};
 public:
@@ -119,7 +122,7 @@ public:
 	}
 	void appendPathCurve(const PathCurve& pcv)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		pcv.write(mFile);
 	}
 	void endPathCurve()const
@@ -148,8 +151,8 @@ public:
 		size_t size = (opt_end-opt_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",opt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,opt[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -159,7 +162,7 @@ public:
 	}
 	void appendOutPoint(double opt)const
 	{
-		fprintf(mFile," %f",opt);
+		appendNumber(mFile,opt);
 	}
 	void endOutPoint()const
 	{
@@ -249,7 +252,7 @@ public:
 	}
 	void appendPressureScale(const PressureScale& psc)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		psc.write(mFile);
 	}
 	void endPressureScale()const
@@ -282,8 +285,8 @@ public:
 		size_t size = (psr_end-psr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",psr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,psr[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -293,7 +296,7 @@ public:
 	}
 	void appendPressure(double psr)const
 	{
-		fprintf(mFile," %f",psr);
+		appendNumber(mFile,psr);
 	}
 	void endPressure()const
 	{
@@ -37,8 +37,8 @@ public:
 		size_t size = (uvtk_end-uvtk_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",uvtk[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,uvtk[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -48,7 +48,7 @@ public:
 	}
 	void appendUvTweak(float uvtk)const
 	{
-		fprintf(mFile," %f",uvtk);
+		appendNumber(mFile,uvtk);
 	}
 	void endUvTweak()const
 	{
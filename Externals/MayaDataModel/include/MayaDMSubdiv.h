@@ -30,7 +30,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				singleVertexTweak[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -58,27 +58,47 @@ public:
 		bool miRefractionReceive;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miOverrideCaustics);
-			fprintf(file,"%i ", miCausticAccuracy);
-			fprintf(file,"%f ", miCausticRadius);
-			fprintf(file,"%i ", miOverrideGlobalIllumination);
-			fprintf(file,"%i ", miGlobillumAccuracy);
-			fprintf(file,"%f ", miGlobillumRadius);
-			fprintf(file,"%i ", miOverrideFinalGather);
-			fprintf(file,"%i ", miFinalGatherRays);
-			fprintf(file,"%f ", miFinalGatherMinRadius);
-			fprintf(file,"%f ", miFinalGatherMaxRadius);
-			fprintf(file,"%i ", miFinalGatherFilter);
-			fprintf(file,"%i ", miFinalGatherView);
-			fprintf(file,"%i ", miOverrideSamples);
-			fprintf(file,"%i ", miMinSamples);
-			fprintf(file,"%i ", miMaxSamples);
-			fprintf(file,"%i ", miFinalGatherCast);
-			fprintf(file,"%i ", miFinalGatherReceive);
-			fprintf(file,"%i ", miTransparencyCast);
-			fprintf(file,"%i ", miTransparencyReceive);
-			fprintf(file,"%i ", miReflectionReceive);
-			fprintf(file,"%i", miRefractionReceive);
+			writeNumber(file,miOverrideCaustics);
+			fputc(' ',file);
+			writeNumber(file,miCausticAccuracy);
+			fputc(' ',file);
+			writeNumber(file,miCausticRadius);
+			fputc(' ',file);
+			writeNumber(file,miOverrideGlobalIllumination);
+			fputc(' ',file);
+			writeNumber(file,miGlobillumAccuracy);
+			fputc(' ',file);
+			writeNumber(file,miGlobillumRadius);
+			fputc(' ',file);
+			writeNumber(file,miOverrideFinalGather);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherRays);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherMinRadius);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherMaxRadius);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherFilter);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherView);
+			fputc(' ',file);
+			writeNumber(file,miOverrideSamples);
+			fputc(' ',file);
+			writeNumber(file,miMinSamples);
+			fputc(' ',file);
+			writeNumber(file,miMaxSamples);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherCast);
+			fputc(' ',file);
+			writeNumber(file,miFinalGatherReceive);
+			fputc(' ',file);
+			writeNumber(file,miTransparencyCast);
+			fputc(' ',file);
+			writeNumber(file,miTransparencyReceive);
+			fputc(' ',file);
+			writeNumber(file,miReflectionReceive);
+			fputc(' ',file);
+			writeNumber(file,miRefractionReceive);
 		}
 	};
 public:
@@ -152,7 +172,7 @@ public:
 	}
 	void appendVertexTweak(const VertexTweak& vtw)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		vtw.write(mFile);
 	}
 	void endVertexTweak()const
@@ -171,8 +191,8 @@ public:
 		size_t size = (stw_end-stw_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",stw[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,stw[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -182,7 +202,7 @@ public:
 	}
 	void appendSingleVertexTweak(double stw)const
 	{
-		fprintf(mFile," %f",stw);
+		appendNumber(mFile,stw);
 	}
 	void endSingleVertexTweak()const
 	{
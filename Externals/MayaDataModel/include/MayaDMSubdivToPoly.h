@@ -91,8 +91,8 @@ public:
 		size_t size = (os_end-os_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",os[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,os[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -102,7 +102,7 @@ public:
 	}
 	void appendOutSubdCVId(int os)const
 	{
-		fprintf(mFile," %i",os);
+		appendNumber(mFile,os);
 	}
 	void endOutSubdCVId()const
 	{
@@ -130,8 +130,8 @@ public:
 		size_t size = (is_end-is_start)*2+2;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",is[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,is[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -141,7 +141,7 @@ public:
 	}
 	void appendInSubdCVId(int is)const
 	{
-		fprintf(mFile," %i",is);
+		appendNumber(mFile,is);
 	}
 	void endInSubdCVId()const
 	{
@@ -173,8 +173,8 @@ public:
 		size_t size = (ov_end-ov_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ov[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ov[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -184,7 +184,7 @@ public:
 	}
 	void appendOutv(int ov)const
 	{
-		fprintf(mFile," %i",ov);
+		appendNumber(mFile,ov);
 	}
 	void endOutv()const
 	{
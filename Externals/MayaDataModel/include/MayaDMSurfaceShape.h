@@ -23,9 +23,11 @@ public:
 		unsigned int collisionOffsetVelocityIncrement_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", collisionOffsetVelocityIncrement_Position);
-			fprintf(file,"%f ", collisionOffsetVelocityIncrement_FloatValue);
-			fprintf(file,"%i", collisionOffsetVelocityIncrement_Interp);
+			writeNumber(file,collisionOffsetVelocityIncrement_Position);
+			fputc(' ',file);
+			writeNumber(file,collisionOffsetVelocityIncrement_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,collisionOffsetVelocityIncrement_Interp);
 		}
 	};
 	struct CollisionDepthVelocityIncrement{
@@ -34,9 +36,11 @@ public:
 		unsigned int collisionDepthVelocityIncrement_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", collisionDepthVelocityIncrement_Position);
-			fprintf(file,"%f ", collisionDepthVelocityIncrement_FloatValue);
-			fprintf(file,"%i", collisionDepthVelocityIncrement_Interp);
+			writeNumber(file,collisionDepthVelocityIncrement_Position);
+			fputc(' ',file);
+			writeNumber(file,collisionDepthVelocityIncrement_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,collisionDepthVelocityIncrement_Interp);
 		}
 	};
 	struct CollisionOffsetVelocityMultiplier{
@@ -45,9 +49,11 @@ public:
 		unsigned int collisionOffsetVelocityMultiplier_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", collisionOffsetVelocityMultiplier_Position);
-			fprintf(file,"%f ", collisionOffsetVelocityMultiplier_FloatValue);
-			fprintf(file,"%i", collisionOffsetVelocityMultiplier_Interp);
+			writeNumber(file,collisionOffsetVelocityMultiplier_Position);
+			fputc(' ',file);
+			writeNumber(file,collisionOffsetVelocityMultiplier_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,collisionOffsetVelocityMultiplier_Interp);
 		}
 	};
 	struct CollisionDepthVelocityMultiplier{
@@ -56,9 +62,11 @@ public:
 		unsigned int collisionDepthVelocityMultiplier_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", collisionDepthVelocityMultiplier_Position);
-			fprintf(file,"%f ", collisionDepthVelocityMultiplier_FloatValue);
-			fprintf(file,"%i", collisionDepthVelocityMultiplier_Interp);
+			writeNumber(file,collisionDepthVelocityMultiplier_Position);
+			fputc(' ',file);
+			writeNumber(file,collisionDepthVelocityMultiplier_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,collisionDepthVelocityMultiplier_Interp);
 		}
 	};
 public:
@@ -163,7 +171,7 @@ public:
 	}
 	void appendCollisionOffsetVelocityIncrement(const CollisionOffsetVelocityIncrement& covi)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		covi.write(mFile);
 	}
 	void endCollisionOffsetVelocityIncrement()const
@@ -209,7 +217,7 @@ public:
 	}
 	void appendCollisionDepthVelocityIncrement(const CollisionDepthVelocityIncrement& cdvi)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cdvi.write(mFile);
 	}
 	void endCollisionDepthVelocityIncrement()const
@@ -255,7 +263,7 @@ public:
 	}
 	void appendCollisionOffsetVelocityMultiplier(const CollisionOffsetVelocityMultiplier& covm)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		covm.write(mFile);
 	}
 	void endCollisionOffsetVelocityMultiplier()const
@@ -301,7 +309,7 @@ public:
 	}
 	void appendCollisionDepthVelocityMultiplier(const CollisionDepthVelocityMultiplier& cdvm)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		cdvm.write(mFile);
 	}
 	void endCollisionDepthVelocityMultiplier()const
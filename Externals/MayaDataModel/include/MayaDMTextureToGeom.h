@@ -40,8 +40,8 @@ public:
 		size_t size = (sgi_end-sgi_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",sgi[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,sgi[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -51,7 +51,7 @@ public:
 	}
 	void appendSegGroupIds(int sgi)const
 	{
-		fprintf(mFile," %i",sgi);
+		appendNumber(mFile,sgi);
 	}
 	void endSegGroupIds()const
 	{
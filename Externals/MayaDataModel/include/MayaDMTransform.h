@@ -23,9 +23,11 @@ public:
 		bool minTransZLimitEnable;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", minTransXLimitEnable);
-			fprintf(file,"%i ", minTransYLimitEnable);
-			fprintf(file,"%i", minTransZLimitEnable);
+			writeNumber(file,minTransXLimitEnable);
+			fputc(' ',file);
+			writeNumber(file,minTransYLimitEnable);
+			fputc(' ',file);
+			writeNumber(file,minTransZLimitEnable);
 		}
 	};
 	struct MaxTransLimitEnable{
@@ -34,9 +36,11 @@ public:
 		bool maxTransZLimitEnable;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", maxTransXLimitEnable);
-			fprintf(file,"%i ", maxTransYLimitEnable);
-			fprintf(file,"%i", maxTransZLimitEnable);
+			writeNumber(file,maxTransXLimitEnable);
+			fputc(' ',file);
+			writeNumber(file,maxTransYLimitEnable);
+			fputc(' ',file);
+			writeNumber(file,maxTransZLimitEnable);
 		}
 	};
 	struct MinRotLimitEnable{
@@ -45,9 +49,11 @@ public:
 		bool minRotZLimitEnable;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", minRotXLimitEnable);
-			fprintf(file,"%i ", minRotYLimitEnable);
-			fprintf(file,"%i", minRotZLimitEnable);
+			writeNumber(file,minRotXLimitEnable);
+			fputc(' ',file);
+			writeNumber(file,minRotYLimitEnable);
+			fputc(' ',file);
+			writeNumber(file,minRotZLimitEnable);
 		}
 	};
 	struct MaxRotLimitEnable{
@@ -56,9 +62,11 @@ public:
 		bool maxRotZLimitEnable;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", maxRotXLimitEnable);
-			fprintf(file,"%i ", maxRotYLimitEnable);
-			fprintf(file,"%i", maxRotZLimitEnable);
+			writeNumber(file,maxRotXLimitEnable);
+			fputc(' ',file);
+			writeNumber(file,maxRotYLimitEnable);
+			fputc(' ',file);
+			writeNumber(file,maxRotZLimitEnable);
 		}
 	};
 	struct MinScaleLimitEnable{
@@ -67,9 +75,11 @@ public:
 		bool minScaleZLimitEnable;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", minScaleXLimitEnable);
-			fprintf(file,"%i ", minScaleYLimitEnable);
-			fprintf(file,"%i", minScaleZLimitEnable);
+			writeNumber(file,minScaleXLimitEnable);
+			fputc(' ',file);
+			writeNumber(file,minScaleYLimitEnable);
+			fputc(' ',file);
+			writeNumber(file,minScaleZLimitEnable);
 		}
 	};
 	struct MaxScaleLimitEnable{
@@ -78,9 +88,11 @@ public:
 		bool maxScaleZLimitEnable;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", maxScaleXLimitEnable);
-			fprintf(file,"%i ", maxScaleYLimitEnable);
-			fprintf(file,"%i", maxScaleZLimitEnable);
+			writeNumber(file,maxScaleXLimitEnable);
+			fputc(' ',file);
+			writeNumber(file,maxScaleYLimitEnable);
+			fputc(' ',file);
+			writeNumber(file,maxScaleZLimitEnable);
 		}
 	};
 	struct MentalRayControls{
@@ -94,14 +106,22 @@ public:
 		bool miExportGeoShader;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%i ", miDeriveFromMaya);
-			fprintf(file,"%i ", miHide);
-			fprintf(file,"%i ", miVisible);
-			fprintf(file,"%i ", miTrace);
-			fprintf(file,"%i ", miShadow);
-			fprintf(file,"%i ", miCaustic);
-			fprintf(file,"%i ", miGlobillum);
-			fprintf(file,"%i ", miExportGeoShader);
+			writeNumber(file,miDeriveFromMaya);
+			fputc(' ',file);
+			writeNumber(file,miHide);
+			fputc(' ',file);
+			writeNumber(file,miVisible);
+			fputc(' ',file);
+			writeNumber(file,miTrace);
+			fputc(' ',file);
+			writeNumber(file,miShadow);
+			fputc(' ',file);
+			writeNumber(file,miCaustic);
+			fputc(' ',file);
+			writeNumber(file,miGlobillum);
+			fputc(' ',file);
+			writeNumber(file,miExportGeoShader);
+			fputc(' ',file);
 		}
 	};
 public:
@@ -35,8 +35,8 @@ public:
 		size_t size = (lu_end-lu_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",lu[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,lu[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -46,7 +46,7 @@ public:
 	}
 	void appendLocatorU(double lu)const
 	{
-		fprintf(mFile," %f",lu);
+		appendNumber(mFile,lu);
 	}
 	void endLocatorU()const
 	{
@@ -63,8 +63,8 @@ public:
 		size_t size = (lv_end-lv_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",lv[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,lv[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -74,7 +74,7 @@ public:
 	}
 	void appendLocatorV(double lv)const
 	{
-		fprintf(mFile," %f",lv);
+		appendNumber(mFile,lv);
 	}
 	void endLocatorV()const
 	{
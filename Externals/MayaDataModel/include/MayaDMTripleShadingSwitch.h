@@ -22,7 +22,7 @@ public:
 		void write(FILE* file) const
 		{
 			inTriple.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 		}
 	};
 public:
@@ -56,7 +56,7 @@ public:
 	}
 	void appendInput(const Input& i)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		i.write(mFile);
 	}
 	void endInput()const
@@ -25,7 +25,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				controlPoints[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -37,7 +37,7 @@ public:
 			for(size_t i=0; i<size; ++i)
 			{
 				vertex[i].write(file);
-				if(i+1<size) fprintf(file," ");
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -77,7 +77,7 @@ public:
 	}
 	void appendPlist(const Plist& pl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		pl.write(mFile);
 	}
 	void endPlist()const
@@ -96,8 +96,8 @@ public:
 		size_t size = (cp_end-cp_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",cp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,cp[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -107,7 +107,7 @@ public:
 	}
 	void appendControlPoints(double cp)const
 	{
-		fprintf(mFile," %f",cp);
+		appendNumber(mFile,cp);
 	}
 	void endControlPoints()const
 	{
@@ -152,7 +152,7 @@ public:
 	}
 	void appendVlist(const Vlist& vl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		vl.write(mFile);
 	}
 	void endVlist()const
@@ -171,8 +171,8 @@ public:
 		size_t size = (vt_end-vt_start)*3+3;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",vt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,vt[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -182,7 +182,7 @@ public:
 	}
 	void appendVertex(float vt)const
 	{
-		fprintf(mFile," %f",vt);
+		appendNumber(mFile,vt);
 	}
 	void endVertex()const
 	{
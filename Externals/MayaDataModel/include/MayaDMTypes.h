@@ -11,9 +11,14 @@
 #define __MayaDM_TYPES_H__
 
 #include <assert.h>
+#include <float.h>
+#include <stdio.h>
 #include <string>
 #include <vector>
 
+#include "Commonitoa.h"
+#include "Commonrtoa.h"
+
 // from ogre OgrePlatform.h
 // Win32 compilers use _DEBUG for specifying debug builds.
 // Unlike the Win32 compilers, Linux compilers seem to use DEBUG for when
@@ -33,6 +38,58 @@
 namespace MayaDM
 {
 
+/*
+Functions used instead of fprintf to write numbers, mostly the elements of large arrays.
+The numbers are converted by libftoa without parsing a format string, integers exactly and
+floating point numbers with the shortest notation that is read back as the same value.
+Each number is passed with a single fwrite to the buffer of the file.
+Infinity and NaN are not changed. They are written with sprintf("%f") as before libftoa was used.
+*/
+
+inline size_t formatNumber(int value, char* buffer) { return Common::itoa(value, buffer, 10); }
+inline size_t formatNumber(unsigned int value, char* buffer) { return Common::itoa(value, buffer, 10); }
+
+/** Returns true, if @a value is neither infinite nor NaN. @a maxValue is the largest finite number of type T.*/
+template<class T>
+inline bool isFinite(T value, T maxValue)
+{
+	return (value >= -maxValue) && (value <= maxValue);
+}
+
+inline size_t formatNumber(float value, char* buffer)
+{
+	if (!isFinite(value, FLT_MAX))
+		return (size_t)sprintf(buffer, "%f", value);
+	return (size_t)Common::ftoaShortest(value, buffer);
+}
+
+inline size_t formatNumber(double value, char* buffer)
+{
+	if (!isFinite(value, DBL_MAX))
+		return (size_t)sprintf(buffer, "%f", value);
+	return (size_t)Common::dtoaShortest(value, buffer);
+}
+
+/** Size of a buffer large enough for a blank and any number written by formatNumber().*/
+static const size_t NUMBER_BUFFERSIZE = Common::RTOA_BUFFERSIZE + 1;
+
+/** Writes @a value to @a file as formatNumber() converts it.*/
+template<class T>
+inline void writeNumber(FILE* file, T value)
+{
+	char buffer[NUMBER_BUFFERSIZE];
+	fwrite(buffer, 1, formatNumber(value, buffer), file);
+}
+
+/** Writes a blank followed by @a value to @a file as formatNumber() converts it.*/
+template<class T>
+inline void appendNumber(FILE* file, T value)
+{
+	char buffer[NUMBER_BUFFERSIZE];
+	buffer[0] = ' ';
+	fwrite(buffer, 1, formatNumber(value, buffer + 1) + 1, file);
+}
+
 /**
 Array of two short integers
 Value Syntax 	short short
@@ -214,8 +271,8 @@ struct int32Array
 	{
 		for(size_t i=0; i<size; ++i)
 		{
-			fprintf(file, "%i", values[i]);
-			if(i+1<size) fprintf(file, " ");
+			writeNumber(file, values[i]);
+			if(i+1<size) fputc(' ', file);
 		}		
 	}
 };
@@ -248,7 +305,8 @@ struct float2
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file, "%f %f", values[0], values[1]);
+		writeNumber(file, values[0]);
+		appendNumber(file, values[1]);
 	}
 };
 
@@ -288,7 +346,9 @@ struct float3
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file, "%f %f %f", values[0], values[1], values[2]);
+		writeNumber(file, values[0]);
+		appendNumber(file, values[1]);
+		appendNumber(file, values[2]);
 	}
 };
 
@@ -329,7 +389,8 @@ struct double2
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file, "%f %f", values[0], values[1]);
+		writeNumber(file, values[0]);
+		appendNumber(file, values[1]);
 	}
 };
 
@@ -369,7 +430,9 @@ struct double3
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file,"%f %f %f", values[0], values[1], values[2]);
+		writeNumber(file, values[0]);
+		appendNumber(file, values[1]);
+		appendNumber(file, values[2]);
 	}
 };
 
@@ -415,7 +478,10 @@ struct double4
 	}
 	void write(FILE* file) const
 	{
-		fprintf(file,"%f %f %f %f", values[0], values[1], values[2], values[3]);
+		writeNumber(file, values[0]);
+		appendNumber(file, values[1]);
+		appendNumber(file, values[2]);
+		appendNumber(file, values[3]);
 	}
 };
 
@@ -460,8 +526,8 @@ struct doubleArray
 	{
 		for(size_t i=0; i<size; ++i)
 		{
-			fprintf(file,"%f", values[i]);
-			if(i+1<size) fprintf(file," ");
+			writeNumber(file,values[i]);
+			if(i+1<size) fputc(' ',file);
 		}		
 	}
 };
@@ -573,10 +639,9 @@ struct matrix
 
 	void write(FILE* file) const
 	{
-		fprintf(file,"%f %f %f %f ", m[0][0], m[0][1], m[0][2], m[0][3]);
-		fprintf(file,"%f %f %f %f ", m[1][0], m[1][1], m[1][2], m[1][3]);
-		fprintf(file,"%f %f %f %f ", m[2][0], m[2][1], m[2][2], m[2][3]);
-		fprintf(file,"%f %f %f %f", m[3][0], m[3][1], m[3][2], m[3][3]);
+		writeNumber(file, m[0][0]);
+		for(size_t i=1; i<16; ++i)
+			appendNumber(file, m[i/4][i%4]);
 	}
 };
 
@@ -612,7 +677,10 @@ struct point
 	double w;
 	void write(FILE* file) const
 	{
-		fprintf(file,"%f %f %f %f", x, y, z, w);
+		writeNumber(file, x);
+		appendNumber(file, y);
+		appendNumber(file, z);
+		appendNumber(file, w);
 	}
 };
 struct pointArray
@@ -636,7 +704,7 @@ struct pointArray
 		for(size_t i=0; i<size; ++i)
 		{
 			values[i].write(file);
-			if(i+1<size) fprintf(file," ");
+			if(i+1<size) fputc(' ',file);
 		}		
 	}
 };
@@ -654,7 +722,9 @@ struct vector
 	double z;
 	void write(FILE* file) const
 	{
-		fprintf(file,"%f %f %f %f", x, y, z);
+		writeNumber(file, x);
+		appendNumber(file, y);
+		appendNumber(file, z);
 	}
 };
 struct vectorArray
@@ -678,7 +748,7 @@ struct vectorArray
 		for(size_t i=0; i<size; ++i)
 		{
 			values[i].write(file);
-			if(i+1<size) fprintf(file," ");
+			if(i+1<size) fputc(' ',file);
 		}		
 	}
 };
@@ -748,7 +818,7 @@ struct stringArray
 		for(size_t i=0; i<size; ++i)
 		{
 			values[i].write(file);
-			if(i+1<size) fprintf(file," ");
+			if(i+1<size) fputc(' ',file);
 		}		
 	}
 };
@@ -764,7 +834,7 @@ struct sphere
 	double radius;
 	void write(FILE* file) const
 	{
-		fprintf(file,"%f", radius);
+		writeNumber(file,radius);
 	}
 };
 
@@ -780,7 +850,8 @@ struct cone
 	double coneCap;
 	void write(FILE* file) const
 	{
-		fprintf(file, "%f %f", coneAngle, coneCap);
+		writeNumber(file, coneAngle);
+		appendNumber(file, coneCap);
 	}
 };
 
@@ -797,7 +868,9 @@ struct reflectanceRGB
 	double blueReflect;
 	void write(FILE* file) const
 	{
-		fprintf(file, "%f %f %f", redReflect, greenReflect, blueReflect);
+		writeNumber(file, redReflect);
+		appendNumber(file, greenReflect);
+		appendNumber(file, blueReflect);
 	}
 };
 
@@ -814,7 +887,9 @@ struct spectrumRGB
 	double blueSpectrum;
 	void write(FILE* file) const
 	{
-		fprintf(file, "%f %f %f", redSpectrum, greenSpectrum, blueSpectrum);
+		writeNumber(file, redSpectrum);
+		appendNumber(file, greenSpectrum);
+		appendNumber(file, blueSpectrum);
 	}
 };
 
@@ -832,11 +907,12 @@ public:
 	~componentList(){}
 	void write(FILE* file) const
 	{
-		fprintf(file,"%i ", size());
+		writeNumber(file,(int)size());
+		fputc(' ',file);
 		for(size_t i=0; i<size(); ++i)
 		{
 			at(i).write(file);
-			if(i+1<size()) fprintf(file," ");
+			if(i+1<size()) fputc(' ',file);
 		}		
 	}
 };
@@ -903,17 +979,19 @@ struct nurbsCurve
 		fprintf(file,"%i %i %i %i %i %i ", degree, spans, form, isRational, dimension, knotCount);
 		for(int i=0; i<knotCount; ++i)
 		{
-			fprintf(file, "%f ", knotValues[i]);
+			writeNumber(file, knotValues[i]);
+			fputc(' ', file);
 		}
-		fprintf(file, "%i ", cvCount);
+		writeNumber(file, cvCount);
+		fputc(' ', file);
 		size_t numElements = 2;		
 		if(dimension == 3) numElements++;
 		if(isRational) 	numElements++;
 		size_t size = cvCount * numElements;
 		for(size_t i=0; i<size; ++i)
 		{
-			fprintf(file, "%f", cvValues[i]);
-			if(i+1<size) fprintf(file," ");
+			writeNumber(file, cvValues[i]);
+			if(i+1<size) fputc(' ',file);
 		}
 	}
 };
@@ -990,12 +1068,15 @@ struct nurbsSurface
 		fprintf(file,"%i %i %i %i %i %i ", uDegree, vDegree, uForm, vForm, isRational, uKnotCount);
 		for(int i=0; i<uKnotCount; ++i)
 		{
-			fprintf(file, "%f ", uKnotValues[i]);
+			writeNumber(file, uKnotValues[i]);
+			fputc(' ', file);
 		}
-		fprintf(file,"%i ", vKnotCount);
+		writeNumber(file,vKnotCount);
+		fputc(' ',file);
 		for(int i=0; i<uKnotCount; ++i)
 		{
-			fprintf(file, "%f ", uKnotValues[i]);
+			writeNumber(file, uKnotValues[i]);
+			fputc(' ', file);
 		}	
 		if(trim == TRIM){
 			fprintf(file, "\"%s\" ", "TRIM");
@@ -1003,14 +1084,15 @@ struct nurbsSurface
 		{
 			fprintf(file, "\"%s\" ", "NOTRIM");
 		}
-		fprintf(file, "%i ", cvCount);
+		writeNumber(file, cvCount);
+		fputc(' ', file);
 		size_t numElements = 3;		
 		if(isRational) 	numElements++;
 		size_t size = cvCount * numElements;
 		for(size_t i=0; i<size; ++i)
 		{
-			fprintf(file, "%f", cvValues[i]);
-			if(i+1<size) fprintf(file," ");
+			writeNumber(file, cvValues[i]);
+			if(i+1<size) fputc(' ',file);
 		}
 	}
 };
@@ -1079,17 +1161,19 @@ struct nurbsTrimface
 
 			void write(FILE* file) const
 			{
-				fprintf(file,"%i ", splineCountOnEdge);
+				writeNumber(file,splineCountOnEdge);
+				fputc(' ',file);
 				for(int i=0; i<splineCountOnEdge; ++i)
 				{
 					splinesOnEdge[i].write(file);
-					if(i+1<splineCountOnEdge) fprintf(file, " ");
+					if(i+1<splineCountOnEdge) fputc(' ', file);
 				}
-				fprintf(file,"%i ", splineCountOnPedge);
+				writeNumber(file,splineCountOnPedge);
+				fputc(' ',file);
 				for(int i=0; i<splineCountOnPedge; ++i)
 				{
 					splinesOnPedge[i].write(file);
-					if(i+1<splineCountOnPedge) fprintf(file, " ");
+					if(i+1<splineCountOnPedge) fputc(' ', file);
 				}
 			}
 		} *edges;
@@ -1109,7 +1193,7 @@ struct nurbsTrimface
 			for(int i=0; i<tedgeCountOnBoundary; ++i)
 			{
 				edges[i].write(file);
-				if(i+1<tedgeCountOnBoundary) fprintf(file, " ");
+				if(i+1<tedgeCountOnBoundary) fputc(' ', file);
 			}
 		}
 	} *boundaries;
@@ -1129,7 +1213,7 @@ struct nurbsTrimface
 		for(int i=0; i<boundaryCount; ++i)
 		{
 			boundaries[i].write(file);
-			if(i+1<boundaryCount) fprintf(file, " ");
+			if(i+1<boundaryCount) fputc(' ', file);
 		}
 	}
 };
@@ -1193,8 +1277,8 @@ struct polyFaces
 			fprintf(file,"\t\tf %i ", faceEdgeCount);
 			for(int i=0; i<faceEdgeCount; ++i)
 			{
-				fprintf(file,"%i", edgeIdValue[i]);
-				if(i+1<faceEdgeCount) fprintf(file, " ");
+				writeNumber(file,edgeIdValue[i]);
+				if(i+1<faceEdgeCount) fputc(' ', file);
 			}
 		}
 	}f;
@@ -1225,8 +1309,8 @@ struct polyFaces
 			fprintf(file,"\t\th %i ", holeEdgeCount);
 			for(int i=0; i<holeEdgeCount; ++i)
 			{
-				fprintf(file,"%i", edgeIdValue[i]);
-				if(i+1<holeEdgeCount) fprintf(file, " ");
+				writeNumber(file,edgeIdValue[i]);
+				if(i+1<holeEdgeCount) fputc(' ', file);
 			}
 		}
 	}h;
@@ -1257,8 +1341,8 @@ struct polyFaces
 			fprintf(file,"\t\tmf %i ", faceUVCount);
 			for(int i=0; i<faceUVCount; ++i)
 			{
-				fprintf(file,"%i", uvIdValue[i]);
-				if(i+1<faceUVCount) fprintf(file, " ");
+				writeNumber(file,uvIdValue[i]);
+				if(i+1<faceUVCount) fputc(' ', file);
 			}
 		}
 	}mf;
@@ -1289,8 +1373,8 @@ struct polyFaces
 			fprintf(file,"\t\tmh %i ", holeUVCount);
 			for(int i=0; i<holeUVCount; ++i)
 			{
-				fprintf(file,"%i", uvIdValue[i]);
-				if(i+1<holeUVCount) fprintf(file, " ");
+				writeNumber(file,uvIdValue[i]);
+				if(i+1<holeUVCount) fputc(' ', file);
 			}
 		}
 	}mh;
@@ -1327,11 +1411,12 @@ struct polyFaces
 		void write(FILE* file) const
 		{
 			fprintf(file,"\t\tmu %i ", uvSet);
-			fprintf(file,"%i ", faceUVCount);
+			writeNumber(file,faceUVCount);
+			fputc(' ',file);
 			for(int i=0; i<faceUVCount; ++i)
 			{
-				fprintf(file,"%i", uvIdValue[i]);
-				if(i+1<faceUVCount) fprintf(file, " ");
+				writeNumber(file,uvIdValue[i]);
+				if(i+1<faceUVCount) fputc(' ', file);
 			}
 		}
 	};
@@ -1370,11 +1455,12 @@ struct polyFaces
         void write(FILE* file) const
         {
             fprintf(file,"\t\tmc %i ", colorSet);
-            fprintf(file,"%i ", faceColorCount);
+            writeNumber(file,faceColorCount);
+            fputc(' ',file);
             for(int i=0; i<faceColorCount; ++i)
             {
-                fprintf(file,"%i", colorIdValue[i]);
-                if(i+1<faceColorCount) fprintf(file, " ");
+                writeNumber(file,colorIdValue[i]);
+                if(i+1<faceColorCount) fputc(' ', file);
             }
         }
     };
@@ -1407,8 +1493,8 @@ struct polyFaces
 			fprintf(file,"\t\tfc %i ", faceColorCount);
 			for(int i=0; i<faceColorCount; ++i)
 			{
-				fprintf(file,"%i", colorIndexValue[i]);
-				if(i+1<faceColorCount) fprintf(file, " ");
+				writeNumber(file,colorIndexValue[i]);
+				if(i+1<faceColorCount) fputc(' ', file);
 			}
 		}
 	}fc;
@@ -1529,8 +1615,8 @@ struct mesh
 			size_t size = vertexCount * 3;
 			for(size_t i=0; i<size; ++i)
 			{
-				fprintf(file,"%f", vertices[i]);
-				if(i+1<size) fprintf(file," ");
+				writeNumber(file,vertices[i]);
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	}v;
@@ -1559,8 +1645,8 @@ struct mesh
 			size_t size = normalCount * 3;
 			for(size_t i=0; i<size; ++i)
 			{
-				fprintf(file,"%f", normals[i]);
-				if(i+1<size) fprintf(file," ");
+				writeNumber(file,normals[i]);
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	}vn;
@@ -1589,8 +1675,8 @@ struct mesh
 			size_t size = uvCount * 2;
 			for(size_t i=0; i<size; ++i)
 			{
-				fprintf(file,"%f", uvValues[i]);
-				if(i+1<size) fprintf(file," ");
+				writeNumber(file,uvValues[i]);
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	}vt;
@@ -1611,7 +1697,9 @@ struct mesh
 
 			void write(FILE* file) const
 			{
-				fprintf(file, "%f %f ", startVertex, endVertex);
+				writeNumber(file, startVertex);
+				appendNumber(file, endVertex);
+				fputc(' ', file);
 				if(type == HARD)
 				{
 					fprintf(file, "\"hard\"");	
@@ -1640,7 +1728,7 @@ struct mesh
 			for(int i=0; i<edgeCount; ++i)
 			{
 				edges[i].write(file);
-				if(i+1<edgeCount) fprintf(file," ");
+				if(i+1<edgeCount) fputc(' ',file);
 			}
 		}
 	}e;
@@ -1650,22 +1738,22 @@ struct mesh
 		if(v.vertexCount)
 		{
 			v.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 		}
 		if(vn.normalCount)
 		{
 			vn.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 		}
 		if(vt.uvCount)
 		{
 			vt.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 		}
 		if(e.edgeCount)
 		{
 			v.write(file);
-			fprintf(file, " ");
+			fputc(' ', file);
 		}
 	}
 };
@@ -1727,8 +1815,8 @@ struct lattice
 		size_t size = pointCount*3;
 		for(size_t i; i<size; ++i)
 		{
-			fprintf(file, "%f", points[i]);
-			if(i+1<size) fprintf(file, " ");
+			writeNumber(file, points[i]);
+			if(i+1<size) fputc(' ', file);
 		}
 	}
 };
@@ -23,10 +23,11 @@ public:
 		unsigned int colorRamp_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", colorRamp_Position);
+			writeNumber(file,colorRamp_Position);
+			fputc(' ',file);
 			colorRamp_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", colorRamp_Interp);
+			fputc(' ', file);
+			writeNumber(file,colorRamp_Interp);
 		}
 	};
 public:
@@ -86,7 +87,7 @@ public:
 	}
 	void appendColorRamp(const ColorRamp& crm)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		crm.write(mFile);
 	}
 	void endColorRamp()const
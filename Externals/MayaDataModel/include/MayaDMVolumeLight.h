@@ -23,10 +23,11 @@ public:
 		unsigned int colorRange_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", colorRange_Position);
+			writeNumber(file,colorRange_Position);
+			fputc(' ',file);
 			colorRange_Color.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%i", colorRange_Interp);
+			fputc(' ', file);
+			writeNumber(file,colorRange_Interp);
 		}
 	};
 	struct Penumbra{
@@ -35,9 +36,11 @@ public:
 		unsigned int penumbra_Interp;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", penumbra_Position);
-			fprintf(file,"%f ", penumbra_FloatValue);
-			fprintf(file,"%i", penumbra_Interp);
+			writeNumber(file,penumbra_Position);
+			fputc(' ',file);
+			writeNumber(file,penumbra_FloatValue);
+			fputc(' ',file);
+			writeNumber(file,penumbra_Interp);
 		}
 	};
 public:
@@ -91,7 +94,7 @@ public:
 	}
 	void appendColorRange(const ColorRange& crg)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		crg.write(mFile);
 	}
 	void endColorRange()const
@@ -153,7 +156,7 @@ public:
 	}
 	void appendPenumbra(const Penumbra& pen)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		pen.write(mFile);
 	}
 	void endPenumbra()const
@@ -23,9 +23,11 @@ public:
 		double axisZ;
 		void write(FILE* file) const
 		{
-			fprintf(file,"%f ", axisX);
-			fprintf(file,"%f ", axisY);
-			fprintf(file,"%f", axisZ);
+			writeNumber(file,axisX);
+			fputc(' ',file);
+			writeNumber(file,axisY);
+			fputc(' ',file);
+			writeNumber(file,axisZ);
 		}
 	};
 public:
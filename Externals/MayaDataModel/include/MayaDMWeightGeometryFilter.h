@@ -24,8 +24,8 @@ public:
 			size_t size = sizeof(weights)/sizeof(float);
 			for(size_t i=0; i<size; ++i)
 			{
-				fprintf(file,"%f", weights[i]);
-				if(i+1<size) fprintf(file," ");
+				writeNumber(file,weights[i]);
+				if(i+1<size) fputc(' ',file);
 			}
 		}
 	};
@@ -60,7 +60,7 @@ public:
 	}
 	void appendWeightList(const WeightList& wl)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		wl.write(mFile);
 	}
 	void endWeightList()const
@@ -78,8 +78,8 @@ public:
 		size_t size = (w_end-w_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",w[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,w[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -89,7 +89,7 @@ public:
 	}
 	void appendWeights(float w)const
 	{
-		fprintf(mFile," %f",w);
+		appendNumber(mFile,w);
 	}
 	void endWeights()const
 	{
@@ -60,8 +60,8 @@ public:
 		size_t size = (dds_end-dds_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",dds[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,dds[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -71,7 +71,7 @@ public:
 	}
 	void appendDropoffDistance(float dds)const
 	{
-		fprintf(mFile," %f",dds);
+		appendNumber(mFile,dds);
 	}
 	void endDropoffDistance()const
 	{
@@ -88,8 +88,8 @@ public:
 		size_t size = (sc_end-sc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",sc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,sc[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -99,7 +99,7 @@ public:
 	}
 	void appendScale(float sc)const
 	{
-		fprintf(mFile," %f",sc);
+		appendNumber(mFile,sc);
 	}
 	void endScale()const
 	{
@@ -116,8 +116,8 @@ public:
 		size_t size = (wlpc_end-wlpc_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",wlpc[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,wlpc[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -127,7 +127,7 @@ public:
 	}
 	void appendWireLocatorPercentage(float wlpc)const
 	{
-		fprintf(mFile," %f",wlpc);
+		appendNumber(mFile,wlpc);
 	}
 	void endWireLocatorPercentage()const
 	{
@@ -144,8 +144,8 @@ public:
 		size_t size = (wlp_end-wlp_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",wlp[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,wlp[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -155,7 +155,7 @@ public:
 	}
 	void appendWireLocatorParameter(float wlp)const
 	{
-		fprintf(mFile," %f",wlp);
+		appendNumber(mFile,wlp);
 	}
 	void endWireLocatorParameter()const
 	{
@@ -172,8 +172,8 @@ public:
 		size_t size = (wle_end-wle_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",wle[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,wle[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -183,7 +183,7 @@ public:
 	}
 	void appendWireLocatorEnvelope(float wle)const
 	{
-		fprintf(mFile," %f",wle);
+		appendNumber(mFile,wle);
 	}
 	void endWireLocatorEnvelope()const
 	{
@@ -200,8 +200,8 @@ public:
 		size_t size = (wlt_end-wlt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",wlt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,wlt[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -211,7 +211,7 @@ public:
 	}
 	void appendWireLocatorTwist(float wlt)const
 	{
-		fprintf(mFile," %f",wlt);
+		appendNumber(mFile,wlt);
 	}
 	void endWireLocatorTwist()const
 	{
@@ -241,7 +241,7 @@ public:
 	}
 	void appendDeformedWire(const nurbsCurve& dw)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		dw.write(mFile);
 	}
 	void endDeformedWire()const
@@ -272,7 +272,7 @@ public:
 	}
 	void appendBaseWire(const nurbsCurve& bw)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		bw.write(mFile);
 	}
 	void endBaseWire()const
@@ -42,8 +42,8 @@ public:
 		size_t size = (dr_end-dr_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",dr[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,dr[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -53,7 +53,7 @@ public:
 	}
 	void appendDropoff(double dr)const
 	{
-		fprintf(mFile," %f",dr);
+		appendNumber(mFile,dr);
 	}
 	void endDropoff()const
 	{
@@ -70,8 +70,8 @@ public:
 		size_t size = (smt_end-smt_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%f",smt[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,smt[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -81,7 +81,7 @@ public:
 	}
 	void appendSmoothness(double smt)const
 	{
-		fprintf(mFile," %f",smt);
+		appendNumber(mFile,smt);
 	}
 	void endSmoothness()const
 	{
@@ -98,8 +98,8 @@ public:
 		size_t size = (it_end-it_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",it[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,it[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -109,7 +109,7 @@ public:
 	}
 	void appendInflType(short it)const
 	{
-		fprintf(mFile," %i",it);
+		appendNumber(mFile,it);
 	}
 	void endInflType()const
 	{
@@ -126,8 +126,8 @@ public:
 		size_t size = (ns_end-ns_start)*1+1;
 		for(size_t i=0;i<size;++i)
 		{
-			fprintf(mFile,"%i",ns[i]);
-			if(i+1<size) fprintf(mFile," ");
+			writeNumber(mFile,ns[i]);
+			if(i+1<size) fputc(' ',mFile);
 		}
 		fprintf(mFile,";\n");
 	}
@@ -137,7 +137,7 @@ public:
 	}
 	void appendNurbsSamples(short ns)const
 	{
-		fprintf(mFile," %i",ns);
+		appendNumber(mFile,ns);
 	}
 	void endNurbsSamples()const
 	{
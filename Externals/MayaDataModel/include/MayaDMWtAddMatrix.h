@@ -23,8 +23,8 @@ public:
 		void write(FILE* file) const
 		{
 			matrixIn.write(file);
-			fprintf(file, " ");
-			fprintf(file,"%f", weightIn);
+			fputc(' ', file);
+			writeNumber(file,weightIn);
 		}
 	};
 public:
@@ -58,7 +58,7 @@ public:
 	}
 	void appendWtMatrix(const WtMatrix& i)const
 	{
-		fprintf(mFile," ");
+		fputc(' ',mFile);
 		i.write(mFile);
 	}
 	void endWtMatrix()const
@@ -0,0 +1,83 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_ELEMENTRANGEINDEX_H__
+#define __GENERATEDSAXPARSER_ELEMENTRANGEINDEX_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+
+#include <vector>
+
+
+namespace GeneratedSaxParser
+{
+	/** Index of the byte ranges of all children of the root element of an xml document in memory.
+	The document is not tokenized. Inside the children of the root element only the tags are
+	inspected, to find the end tag that matches the start tag of the child. Character data is skipped,
+	as are comments, CDATA sections and processing instructions.*/
+	class ElementRangeIndex
+	{
+	public:
+		/** The byte range of one child of the root element.*/
+		struct ElementRange
+		{
+			/** The qualified name of the element.*/
+			String name;
+
+			/** Offset of the '<' of the start tag.*/
+			size_t begin;
+
+			/** Offset of the first byte after the end tag.*/
+			size_t end;
+		};
+
+		typedef std::vector<ElementRange> ElementRangeList;
+
+	private:
+		/** The ranges of the children of the root element, in document order.*/
+		ElementRangeList mElementRanges;
+
+	public:
+		ElementRangeIndex();
+
+		~ElementRangeIndex();
+
+		/** Scans the document in @a buffer of length @a length and fills the index.
+		@return True on success, false if the document could not be scanned. The index is empty then.*/
+		bool scan( const char* buffer, size_t length );
+
+		/** The ranges of the children of the root element, in document order.*/
+		const ElementRangeList& getElementRanges() const { return mElementRanges; }
+
+	private:
+		/** Returns the position of the first occurrence of @a pattern in [@a begin, @a end) or 0.*/
+		static const char* find( const char* begin, const char* end, const char* pattern, size_t patternLength );
+
+		/** Returns the position after the processing instruction, comment, CDATA section or document type
+		declaration whose first character after the '<' is at @a begin or 0, if it is not terminated.*/
+		static const char* skipDeclaration( const char* begin, const char* end );
+
+		/** Returns the position after the end tag of the element whose content starts at @a begin or 0, if
+		it is not found. Nested elements, also of the same name, are counted.*/
+		static const char* findElementEnd( const char* begin, const char* end );
+
+		/** Returns the position after the '>' that closes the tag starting at @a begin or 0. Quoted
+		attribute values are skipped.*/
+		static const char* findTagEnd( const char* begin, const char* end );
+
+		/** Disable default copy ctor. */
+		ElementRangeIndex( const ElementRangeIndex& pre );
+		/** Disable default assignment operator. */
+		const ElementRangeIndex& operator= ( const ElementRangeIndex& pre );
+
+	};
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_ELEMENTRANGEINDEX_H__
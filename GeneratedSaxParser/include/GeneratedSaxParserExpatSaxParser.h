@@ -28,6 +28,10 @@ namespace GeneratedSaxParser
 
 	private:
 		typedef char XML_Char;
+	private:
+		/** Maximum number of bytes of a buffer segment passed to XML_Parse at once.*/
+		static const size_t SEGMENT_CHUNK_SIZE = 1024*1024*1024;
+
 	private:
 		XML_Parser mParser;
 		size_t mBufferSize;
@@ -39,6 +43,8 @@ namespace GeneratedSaxParser
 		bool parseFile(const char* fileName);
 		virtual bool parseBuffer(const char* uri, const char* buffer, int length);
 
+		bool parseBufferSegments(const char* uri, const BufferSegment* segments, size_t segmentCount);
+
 		size_t getLineNumer()const;
 		size_t getColumnNumer()const;
 
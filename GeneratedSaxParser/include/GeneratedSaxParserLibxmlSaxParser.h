@@ -14,8 +14,15 @@
 #include "GeneratedSaxParserPrerequisites.h"
 #include "GeneratedSaxParserSaxParser.h"
 #include "GeneratedSaxParserIErrorHandler.h"
+#include "GeneratedSaxParserUtils.h"
+
+#include "COLLADABUhash_map.h"
+
 #include <libxml/parser.h>
 
+#include <list>
+#include <vector>
+
 
 namespace GeneratedSaxParser
 {
@@ -24,11 +31,53 @@ namespace GeneratedSaxParser
 
 	class LibxmlSaxParser  : public SaxParser
 	{
+	private:
+		/** An element or attribute name as passed to the parser, i.e. with prefix, and its hashes.*/
+		struct QualifiedName
+		{
+			/** The prefix as interned by libxml, or null.*/
+			const ::xmlChar* prefix;
+
+			/** The name "prefix:localname" or "localname".*/
+			String name;
+
+			/** The hashes of prefix and local name, as returned by Utils::calculateStringHashWithNamespace().*/
+			StringHashPair hashPair;
+		};
+
+		/** All qualified names with the same local name. Usually only one. A list, to not move the names.*/
+		typedef std::list<QualifiedName> QualifiedNameList;
+
+		/** Maps the local names, as interned by libxml, to the qualified names.*/
+		typedef COLLADABU::hash_map<const ::xmlChar*, QualifiedNameList> LocalNameQualifiedNamesMap;
+
+		typedef std::vector<const ParserChar*> AttributeList;
+
+		/** The error passed to a structured error handler. Constant since libxml 2.12.*/
+#if LIBXML_VERSION >= 21200
+		typedef const xmlError* StructuredError;
+#else
+		typedef xmlErrorPtr StructuredError;
+#endif
+
 	private:
 		static xmlSAXHandler SAXHANDLER;
 
+		/** Number of bytes of a buffer segment passed at once to the push parser.*/
+		static const size_t SEGMENT_CHUNK_SIZE = 1024*1024;
+
 		xmlParserCtxtPtr mParserContext;
 
+		/** The qualified names of all elements and attributes of the current document. libxml interns all 
+		names in the dictionary of the parser context, so the names can be looked up by address.*/
+		LocalNameQualifiedNamesMap mQualifiedNames;
+
+		/** Name value pairs of the attributes of the current element, terminated by a null pointer.*/
+		AttributeList mAttributes;
+
+		/** The zero terminated values of the attributes of the current element.*/
+		std::vector<ParserChar> mAttributeValues;
+
 	public:
 		LibxmlSaxParser(Parser* parser);
 		virtual ~LibxmlSaxParser();
@@ -36,6 +85,8 @@ namespace GeneratedSaxParser
 		bool parseFile(const char* fileName);
 		bool parseBuffer(const char* uri, const char* buffer, int length);
 
+		bool parseBufferSegments(const char* uri, const BufferSegment* segments, size_t segmentCount);
+
 		size_t getLineNumer()const;
 		size_t getColumnNumer()const;
 
@@ -45,15 +96,29 @@ namespace GeneratedSaxParser
         /** Disable default assignment operator. */
 		const LibxmlSaxParser& operator= ( const LibxmlSaxParser& pre );
 
-		static void startElement( void* user_data,	const ::xmlChar* name, const ::xmlChar** attrs);
-		static void endElement( void* user_data, const ::xmlChar* name);
+		static void startElementNs( void* user_data, const ::xmlChar* localname, const ::xmlChar* prefix, const ::xmlChar* URI,
+									int nb_namespaces, const ::xmlChar** namespaces, int nb_attributes, int nb_defaulted, 
+									const ::xmlChar** attributes);
+		static void endElementNs( void* user_data, const ::xmlChar* localname, const ::xmlChar* prefix, const ::xmlChar* URI);
 
 		static void characters( void* user_data, const ::xmlChar* name, int length );
 
 		static void errorFunction (void *ctx,	const char *msg, ...);
 
+		/** Reports the errors of libxml, which are passed to the structured error handler instead of errorFunction,
+		if one is set. Namespace errors are reported as not critical, warnings are ignored.*/
+		static void structuredErrorFunction( void* userData, StructuredError error );
+
 		void initializeParserContext();
 
+		/** Returns the qualified name of @a localname with @a prefix, both interned by libxml.*/
+		const QualifiedName& getQualifiedName( const ::xmlChar* localname, const ::xmlChar* prefix );
+
+		/** Fills mAttributes with the name value pairs of the namespace declarations and the attributes, as
+		passed to startElementNs(), and returns them, or null, if there are none.*/
+		const ParserChar** createAttributeList( int namespaceCount, const ::xmlChar** namespaces, 
+												int attributeCount, const ::xmlChar** attributes );
+
 		void abortParsing();
 
 	};
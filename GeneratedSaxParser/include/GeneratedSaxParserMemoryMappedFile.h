@@ -0,0 +1,81 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_MEMORYMAPPEDFILE_H__
+#define __GENERATEDSAXPARSER_MEMORYMAPPEDFILE_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+
+
+namespace GeneratedSaxParser
+{
+	/** Read only memory mapping of a complete file. The sax parsers use it to parse a file directly
+	from the page cache, without copying it into an intermediate buffer first.*/
+	class MemoryMappedFile
+	{
+	private:
+		/** Pointer to the first byte of the mapped file, or 0 if no file is mapped.*/
+		const char* mData;
+
+		/** The size of the mapped file in bytes.*/
+		size_t mSize;
+
+#if defined(COLLADABU_OS_WIN)
+		/** Handle of the opened file.*/
+		void* mFileHandle;
+
+		/** Handle of the file mapping object.*/
+		void* mMappingHandle;
+#else
+		/** Descriptor of the opened file.*/
+		int mFileDescriptor;
+#endif
+
+	public:
+		MemoryMappedFile();
+
+		/** Closes the mapping, if still open.*/
+		~MemoryMappedFile();
+
+		/** Maps the file @a fileName into memory. Any previously mapped file is closed.
+		@return True, if the file could be mapped, false otherwise.*/
+		bool open( const char* fileName );
+
+		/** Unmaps the file and closes all handles.*/
+		void close();
+
+		/** Tells the operating system that the mapped region will be read sequentially, once. This
+		enables aggressive read ahead and allows already read pages to be dropped early.*/
+		void adviseSequential();
+
+		/** Returns the pointer to the first byte of the mapped file.*/
+		const char* getData() const { return mData; }
+
+		/** Returns the size of the mapped file in bytes.*/
+		size_t getSize() const { return mSize; }
+
+		/** Returns true, if a file is currently mapped.*/
+		bool isOpen() const { return mData != 0; }
+
+		/** Asks the operating system to read the file @a fileName into the page cache in the background. 
+		Returns immediately. Does nothing on systems that do not support asynchronous read ahead.
+		@return True, if the read ahead has been started.*/
+		static bool readAhead( const char* fileName );
+
+	private:
+		/** Disable default copy ctor. */
+		MemoryMappedFile( const MemoryMappedFile& pre );
+		/** Disable default assignment operator. */
+		const MemoryMappedFile& operator= ( const MemoryMappedFile& pre );
+
+	};
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_MEMORYMAPPEDFILE_H__
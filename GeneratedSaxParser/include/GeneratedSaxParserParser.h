@@ -13,6 +13,7 @@
 
 #include "GeneratedSaxParserPrerequisites.h"
 #include "GeneratedSaxParserTypes.h"
+#include "GeneratedSaxParserUtils.h"
 
 namespace GeneratedSaxParser
 {
@@ -31,6 +32,12 @@ namespace GeneratedSaxParser
 
 		virtual bool elementBegin(const ParserChar* elementName, const ParserAttributes& attributes )=0;
 
+		/** Same as elementBegin(elementName, attributes), for sax parsers that already know the hashes of the 
+		prefix and the local name of @a elementName, as returned by Utils::calculateStringHashWithNamespace().
+		The default implementation ignores @a elementHashPair.*/
+		virtual bool elementBegin(const ParserChar* elementName, const StringHashPair& elementHashPair, const ParserAttributes& attributes )
+		{ return elementBegin(elementName, attributes); }
+
 		virtual bool elementEnd(const ParserChar* elementName )=0;
 
 		virtual bool textData(const ParserChar* text, size_t textLength)=0;
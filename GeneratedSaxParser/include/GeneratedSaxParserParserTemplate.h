@@ -23,6 +23,7 @@
 
 #include <map>
 #include <stack>
+#include <vector>
 #include <string.h>
 
 
@@ -128,6 +129,31 @@ namespace GeneratedSaxParser
         bool mLaxNamespaceHandling;
 
     private:
+        /** Entry of the dispatch table. */
+        struct DispatchEntry
+        {
+            /** The generated element hash, the entry belongs to. */
+            StringHash elementHash;
+            /** The functions of the element in the function map the table has been built for, or 0. */
+            const FunctionStruct* functions;
+            /** The namespace of the element, taken from mElementToNamespaceMap. */
+            StringHash namespaceHash;
+            /** True, if the element is contained in mElementToNamespaceMap. */
+            bool hasNamespace;
+            /** True, if the entry is used. */
+            bool used;
+        };
+        typedef std::vector<DispatchEntry> DispatchTable;
+
+        /** Open addressing hash table, that maps generated element hashes to the functions in the currently 
+        used function map and to the namespace in mElementToNamespaceMap. Replaces the tree lookups in these
+        maps for every element begin, element end and text data. Built on first use for each function map. */
+        DispatchTable mDispatchTable;
+        /** Size of mDispatchTable minus one. The size is a power of two. */
+        size_t mDispatchTableMask;
+        /** The function map mDispatchTable has been built for. */
+        const ElementFunctionMap* mDispatchTableFunctionMap;
+
 		/** Number of elements that have been opened and should be ignored due to mCurrentElementFunctionMap. */
 		size_t mIgnoreElements;
         /** Number of elements that have been opened and are unknown. */
@@ -145,6 +171,8 @@ namespace GeneratedSaxParser
               mUnknownHandler(0),
               mActiveNamespaceHandler(0),
               mLaxNamespaceHandling(false),
+              mDispatchTableMask(0),
+              mDispatchTableFunctionMap(0),
 			  mIgnoreElements(0),
               mUnknownElements(0),
               mNamespaceElements(0)
@@ -167,7 +195,7 @@ namespace GeneratedSaxParser
         const ElementFunctionMap* getElementFunctionMap() {return mCurrentElementFunctionMap;}
 
         /** Sets a new ElementFunctionMap. May be used to retrieve certain data first. */
-        void setElementFunctionMap(const ElementFunctionMap* map) {mCurrentElementFunctionMap = map;}
+        void setElementFunctionMap(const ElementFunctionMap* map) {mCurrentElementFunctionMap = map; mDispatchTableFunctionMap = 0;}
 
         /** Returns complete ElementFunctionMap (the one containing all function pointers). */
         const ElementFunctionMap& getCompleteElementFunctionMap() {return mElementFunctionMap;}
@@ -180,6 +208,8 @@ namespace GeneratedSaxParser
     public:
 		bool elementBegin(const ParserChar* elementName, const ParserAttributes& attributes );
 
+		bool elementBegin(const ParserChar* elementName, const StringHashPair& elementHashPair, const ParserAttributes& attributes );
+
 		bool elementEnd(const ParserChar* elementName );
 
 		bool textData(const ParserChar* text, size_t textLength);
@@ -192,6 +222,25 @@ namespace GeneratedSaxParser
         /** Checks for xmlns and xmlns:<name> attributes to add them to mNamespacesStack. */
         void parseNamespaceDeclarations( const ParserAttributes& attributes );
 
+    private:
+        /** Returns the dispatch table entry of the element with generated element hash @a elementHash or 0, 
+        if the element is neither in the currently used function map nor in mElementToNamespaceMap. The 
+        dispatch table is rebuilt, if the currently used function map has changed. */
+        const DispatchEntry* findDispatchEntry( StringHash elementHash );
+
+        /** Fills the dispatch table from @a functionMap and mElementToNamespaceMap. */
+        void buildDispatchTable( const ElementFunctionMap* functionMap );
+
+        /** Returns the entry for @a elementHash in the dispatch table, marked as used.*/
+        DispatchEntry& insertDispatchEntry( StringHash elementHash );
+
+        /** Returns the first slot to probe for @a elementHash.*/
+        size_t getDispatchTableSlot( StringHash elementHash ) const
+        {
+            // spread the bits of the hash, whose low bits mainly depend on the last characters
+            return (size_t)( (elementHash ^ (elementHash >> 11)) * 2654435761UL ) & mDispatchTableMask;
+        }
+
 	protected:
 		template<class DataType,
 				 DataType (*toData)( const ParserChar**, const ParserChar*, bool& )
@@ -1824,18 +1873,12 @@ namespace GeneratedSaxParser
 
         if ( mElementDataStack.empty() )
             return false;
-        ElementData elementData = mElementDataStack.back();
-        typename ElementFunctionMap::const_iterator it;
+        const ElementData& elementData = mElementDataStack.back();
 
-        const ElementFunctionMap* functionMapToUse;
-        if ( mCurrentElementFunctionMap )
-            functionMapToUse = mCurrentElementFunctionMap;
-        else
-            functionMapToUse = &mElementFunctionMap;
-		it = functionMapToUse->find(elementData.generatedElementHash);
-		if ( it == functionMapToUse->end() )
+        const DispatchEntry* dispatchEntry = findDispatchEntry(elementData.generatedElementHash);
+		if ( !dispatchEntry || !dispatchEntry->functions )
 			return true;
-		const FunctionStruct& functions = it->second;
+		const FunctionStruct& functions = *dispatchEntry->functions;
 
 		if ( !functions.textDataFunction || !(static_cast<DerivedClass*>(this)->*functions.textDataFunction)(text, textLength) )
 			return false;
@@ -1884,18 +1927,13 @@ namespace GeneratedSaxParser
             return false;
         ElementData elementData = mElementDataStack.back();
 
-        const ElementFunctionMap* functionMapToUse;
-        if ( mCurrentElementFunctionMap )
-            functionMapToUse = mCurrentElementFunctionMap;
-        else
-            functionMapToUse = &mElementFunctionMap;
-        typename ElementFunctionMap::const_iterator it = functionMapToUse->find(elementData.generatedElementHash);
-		if ( it == functionMapToUse->end() )
+        const DispatchEntry* dispatchEntry = findDispatchEntry(elementData.generatedElementHash);
+		if ( !dispatchEntry || !dispatchEntry->functions )
         {
             mElementDataStack.pop_back();
 			return false;
         }
-		const FunctionStruct& functions = it->second;
+		const FunctionStruct& functions = *dispatchEntry->functions;
 
 		if ( !functions.validateEndFunction || !(static_cast<DerivedClass*>(this)->*functions.validateEndFunction)())
         {
@@ -1919,6 +1957,16 @@ namespace GeneratedSaxParser
 	template<class DerivedClass, class ImplClass>
 	bool ParserTemplate<DerivedClass, ImplClass>::elementBegin( const ParserChar* elementName,
 																   const ParserAttributes& attributes)
+	{
+		return elementBegin( elementName, Utils::calculateStringHashWithNamespace( elementName ), attributes );
+	}
+
+
+	//--------------------------------------------------------------------
+	template<class DerivedClass, class ImplClass>
+	bool ParserTemplate<DerivedClass, ImplClass>::elementBegin( const ParserChar* elementName,
+																   const StringHashPair& elementHashPair,
+																   const ParserAttributes& attributes)
 	{
         if ( (mIgnoreElements > 0 || mUnknownElements > 0 || mNamespaceElements > 0) 
             && !mNamespacesStack.empty() )
@@ -1945,8 +1993,7 @@ namespace GeneratedSaxParser
         if ( mNamespaceElements > 0 )
         {
             mNamespaceElements++;
-            StringHashPair hashPair = Utils::calculateStringHashWithNamespace( elementName );
-            return mActiveNamespaceHandler->elementBegin( hashPair.second, elementName, attributes.attributes );
+            return mActiveNamespaceHandler->elementBegin( elementHashPair.second, elementName, attributes.attributes );
         }
 
         if ( isDifferentNamespaceAllowed() )
@@ -1954,9 +2001,8 @@ namespace GeneratedSaxParser
             parseNamespaceDeclarations( attributes );
         }
         ElementData newElementData;
-        StringHashPair elementNsPair = Utils::calculateStringHashWithNamespace(elementName);
-        newElementData.elementHash = elementNsPair.second;
-        StringHash currentNsPrefix = elementNsPair.first;
+        newElementData.elementHash = elementHashPair.second;
+        StringHash currentNsPrefix = elementHashPair.first;
         StringHash namespaceHash = 0;
         if ( !mNamespacesStack.empty() )
         {
@@ -1973,24 +2019,20 @@ namespace GeneratedSaxParser
         bool foundElementHash = findElementHash( newElementData );
 
         bool correctNamespace = false;
+        const DispatchEntry* dispatchEntry = 0;
         if ( foundElementHash )
         {
-            typename NamespacePrefixesMap::const_iterator nsFromMap = mElementToNamespaceMap.find( newElementData.generatedElementHash );
-            if ( nsFromMap != mElementToNamespaceMap.end() && nsFromMap->second == namespaceHash )
+            dispatchEntry = findDispatchEntry( newElementData.generatedElementHash );
+            if ( dispatchEntry && dispatchEntry->hasNamespace && dispatchEntry->namespaceHash == namespaceHash )
             {
                 correctNamespace = true;
             }
         }
 
-        const ElementFunctionMap* functionMapToUse;
-        if ( mCurrentElementFunctionMap )
-            functionMapToUse = mCurrentElementFunctionMap;
-        else
-            functionMapToUse = &mElementFunctionMap;
-        typename ElementFunctionMap::const_iterator it = functionMapToUse->end();
-        if ( foundElementHash && (correctNamespace || mLaxNamespaceHandling) )
-            it = functionMapToUse->find(newElementData.generatedElementHash);
-		if ( it == functionMapToUse->end() )
+        const FunctionStruct* functionsToUse = 0;
+        if ( dispatchEntry && (correctNamespace || mLaxNamespaceHandling) )
+            functionsToUse = dispatchEntry->functions;
+		if ( !functionsToUse )
 		{
             INamespaceHandler* nsHandler = mNamespaceHandlers[ namespaceHash ];
             if ( nsHandler != 0 )
@@ -2005,7 +2047,7 @@ namespace GeneratedSaxParser
             }
             else
             {
-                it = mElementFunctionMap.find(newElementData.elementHash);
+                typename ElementFunctionMap::const_iterator it = mElementFunctionMap.find(newElementData.elementHash);
                 if ( it != mElementFunctionMap.end() && correctNamespace )
                 {
                     mIgnoreElements = 1;
@@ -2041,7 +2083,7 @@ namespace GeneratedSaxParser
                 }
             }
 		}
-		const FunctionStruct& functions = it->second;
+		const FunctionStruct& functions = *functionsToUse;
 
 		void* attributeData = 0;
 		void* validationData = 0;
@@ -2323,6 +2365,79 @@ namespace GeneratedSaxParser
         mNamespaceHandlers.erase( namespaceHash );
     }
 
+    //--------------------------------------------------------------------
+    template<class DerivedClass, class ImplClass>
+    const typename ParserTemplate<DerivedClass, ImplClass>::DispatchEntry* 
+        ParserTemplate<DerivedClass, ImplClass>::findDispatchEntry( StringHash elementHash )
+    {
+        const ElementFunctionMap* functionMapToUse;
+        if ( mCurrentElementFunctionMap )
+            functionMapToUse = mCurrentElementFunctionMap;
+        else
+            functionMapToUse = &mElementFunctionMap;
+        if ( functionMapToUse != mDispatchTableFunctionMap )
+            buildDispatchTable( functionMapToUse );
+
+        for ( size_t slot = getDispatchTableSlot(elementHash); ; slot = (slot + 1) & mDispatchTableMask )
+        {
+            const DispatchEntry& entry = mDispatchTable[slot];
+            if ( !entry.used )
+                return 0;
+            if ( entry.elementHash == elementHash )
+                return &entry;
+        }
+    }
+
+    //--------------------------------------------------------------------
+    template<class DerivedClass, class ImplClass>
+    void ParserTemplate<DerivedClass, ImplClass>::buildDispatchTable( const ElementFunctionMap* functionMap )
+    {
+        // keep the load factor below one half, to keep the probe sequences short
+        size_t size = 16;
+        while ( size < 2 * (functionMap->size() + mElementToNamespaceMap.size()) )
+            size *= 2;
+
+        DispatchEntry emptyEntry;
+        emptyEntry.elementHash = 0;
+        emptyEntry.functions = 0;
+        emptyEntry.namespaceHash = 0;
+        emptyEntry.hasNamespace = false;
+        emptyEntry.used = false;
+        mDispatchTable.assign( size, emptyEntry );
+        mDispatchTableMask = size - 1;
+
+        typename ElementFunctionMap::const_iterator functionIt = functionMap->begin();
+        for ( ; functionIt != functionMap->end(); ++functionIt )
+        {
+            insertDispatchEntry( functionIt->first ).functions = &functionIt->second;
+        }
+
+        typename NamespacePrefixesMap::const_iterator namespaceIt = mElementToNamespaceMap.begin();
+        for ( ; namespaceIt != mElementToNamespaceMap.end(); ++namespaceIt )
+        {
+            DispatchEntry& entry = insertDispatchEntry( namespaceIt->first );
+            entry.namespaceHash = namespaceIt->second;
+            entry.hasNamespace = true;
+        }
+
+        mDispatchTableFunctionMap = functionMap;
+    }
+
+    //--------------------------------------------------------------------
+    template<class DerivedClass, class ImplClass>
+    typename ParserTemplate<DerivedClass, ImplClass>::DispatchEntry& 
+        ParserTemplate<DerivedClass, ImplClass>::insertDispatchEntry( StringHash elementHash )
+    {
+        size_t slot = getDispatchTableSlot(elementHash);
+        while ( mDispatchTable[slot].used && (mDispatchTable[slot].elementHash != elementHash) )
+            slot = (slot + 1) & mDispatchTableMask;
+
+        DispatchEntry& entry = mDispatchTable[slot];
+        entry.elementHash = elementHash;
+        entry.used = true;
+        return entry;
+    }
+
     //--------------------------------------------------------------------
     template<class DerivedClass, class ImplClass>
     void ParserTemplate<DerivedClass, ImplClass>::parseNamespaceDeclarations( const ParserAttributes& attributes )
@@ -18,6 +18,16 @@ namespace GeneratedSaxParser
 {
 	class Parser;
 
+	/** A contiguous part of an xml document in memory.*/
+	struct BufferSegment
+	{
+		/** Pointer to the first character of the segment.*/
+		const char* data;
+
+		/** The length of the segment in bytes.*/
+		size_t length;
+	};
+
 	class SaxParser
 	{
 
@@ -30,6 +40,15 @@ namespace GeneratedSaxParser
 		virtual bool parseFile(const char* fileName)=0;
 		virtual bool parseBuffer(const char* uri, const char* buffer, int length)=0;
 
+		/** Parses the file @a fileName from a read only memory mapping of the file, instead of reading 
+		it into intermediate buffers.*/
+		virtual bool parseMappedFile(const char* fileName);
+
+		/** Parses the concatenation of the @a segmentCount segments in @a segments as one document. The 
+		segments are passed to the xml parser in place, in the given order.
+		@param uri The uri of the document, used in error messages.*/
+		virtual bool parseBufferSegments(const char* uri, const BufferSegment* segments, size_t segmentCount)=0;
+
 		virtual size_t getLineNumer()const=0;
 		virtual size_t getColumnNumer()const=0;
 
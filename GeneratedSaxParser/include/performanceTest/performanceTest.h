@@ -0,0 +1,20 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef ___PERFORMANCETEST_H__
+#define ___PERFORMANCETEST_H__
+
+/** Checks that the block wise conversion of numbers in Utils returns the same values as the character 
+wise conversion and measures the throughput of the conversion of lists of numbers.
+@return True, if all values are identical.*/
+bool performanceTest();
+
+
+#endif // ___PERFORMANCETEST_H__
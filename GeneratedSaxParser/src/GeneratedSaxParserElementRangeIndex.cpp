@@ -0,0 +1,233 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include <cstring>
+#include "GeneratedSaxParserElementRangeIndex.h"
+
+
+namespace GeneratedSaxParser
+{
+	//--------------------------------------------------------------------
+	static inline bool isWhiteSpace( char c )
+	{
+		return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+	}
+
+	//--------------------------------------------------------------------
+	static inline bool startsWith( const char* begin, const char* end, const char* prefix, size_t prefixLength )
+	{
+		return ((size_t)(end - begin) >= prefixLength) && (memcmp(begin, prefix, prefixLength) == 0);
+	}
+
+	//--------------------------------------------------------------------
+	ElementRangeIndex::ElementRangeIndex()
+	{
+	}
+
+	//--------------------------------------------------------------------
+	ElementRangeIndex::~ElementRangeIndex()
+	{
+	}
+
+	//--------------------------------------------------------------------
+	const char* ElementRangeIndex::find( const char* begin, const char* end, const char* pattern, size_t patternLength )
+	{
+		while ( (size_t)(end - begin) >= patternLength )
+		{
+			begin = (const char*)memchr(begin, *pattern, (end - begin) - patternLength + 1);
+			if ( !begin )
+				return 0;
+			if ( memcmp(begin, pattern, patternLength) == 0 )
+				return begin;
+			++begin;
+		}
+		return 0;
+	}
+
+	//--------------------------------------------------------------------
+	const char* ElementRangeIndex::findTagEnd( const char* begin, const char* end )
+	{
+		char quote = 0;
+		for ( const char* pos = begin; pos < end; ++pos )
+		{
+			char c = *pos;
+			if ( quote )
+			{
+				if ( c == quote )
+					quote = 0;
+			}
+			else if ( (c == '"') || (c == '\'') )
+			{
+				quote = c;
+			}
+			else if ( c == '>' )
+			{
+				return pos + 1;
+			}
+		}
+		return 0;
+	}
+
+	//--------------------------------------------------------------------
+	const char* ElementRangeIndex::skipDeclaration( const char* begin, const char* end )
+	{
+		if ( *begin == '?' )
+		{
+			// processing instruction
+			const char* piEnd = find(begin, end, "?>", 2);
+			return piEnd ? piEnd + 2 : 0;
+		}
+
+		if ( startsWith(begin, end, "!--", 3) )
+		{
+			const char* commentEnd = find(begin + 3, end, "-->", 3);
+			return commentEnd ? commentEnd + 3 : 0;
+		}
+
+		if ( startsWith(begin, end, "![CDATA[", 8) )
+		{
+			const char* cdataEnd = find(begin + 8, end, "]]>", 3);
+			return cdataEnd ? cdataEnd + 3 : 0;
+		}
+
+		// document type declaration, possibly with an internal subset
+		int bracketDepth = 0;
+		for ( const char* pos = begin; pos < end; ++pos )
+		{
+			char c = *pos;
+			if ( c == '[' )
+				bracketDepth++;
+			else if ( c == ']' )
+				bracketDepth--;
+			else if ( (c == '>') && (bracketDepth == 0) )
+				return pos + 1;
+		}
+		return 0;
+	}
+
+	//--------------------------------------------------------------------
+	const char* ElementRangeIndex::findElementEnd( const char* begin, const char* end )
+	{
+		// Only the tags are inspected, the character data between them is skipped with memchr.
+		size_t depth = 1;
+		const char* pos = begin;
+		while ( pos < end )
+		{
+			pos = (const char*)memchr(pos, '<', end - pos);
+			if ( !pos )
+				return 0;
+
+			const char* next = pos + 1;
+			if ( next == end )
+				return 0;
+
+			if ( (*next == '?') || (*next == '!') )
+			{
+				pos = skipDeclaration(next, end);
+				if ( !pos )
+					return 0;
+				continue;
+			}
+
+			const char* tagEnd = findTagEnd(next, end);
+			if ( !tagEnd )
+				return 0;
+
+			if ( *next == '/' )
+			{
+				if ( --depth == 0 )
+					return tagEnd;
+			}
+			else if ( *(tagEnd - 2) != '/' )
+			{
+				++depth;
+			}
+			pos = tagEnd;
+		}
+		return 0;
+	}
+
+	//--------------------------------------------------------------------
+	bool ElementRangeIndex::scan( const char* buffer, size_t length )
+	{
+		mElementRanges.clear();
+
+		const char* end = buffer + length;
+		const char* pos = buffer;
+		bool insideRoot = false;
+
+		while ( pos < end )
+		{
+			pos = (const char*)memchr(pos, '<', end - pos);
+			if ( !pos )
+				break;
+
+			const char* next = pos + 1;
+			if ( next == end )
+				break;
+
+			if ( (*next == '?') || (*next == '!') )
+			{
+				pos = skipDeclaration(next, end);
+				if ( !pos )
+					break;
+				continue;
+			}
+
+			if ( *next == '/' )
+			{
+				// Children are skipped completely, so this can only be the end tag of the root element.
+				return insideRoot;
+			}
+
+			const char* tagEnd = findTagEnd(next, end);
+			if ( !tagEnd )
+				break;
+			bool isEmptyElement = *(tagEnd - 2) == '/';
+
+			if ( !insideRoot )
+			{
+				if ( isEmptyElement )
+					return true;
+				insideRoot = true;
+				pos = tagEnd;
+				continue;
+			}
+
+			const char* nameEnd = next;
+			while ( (nameEnd < tagEnd) && !isWhiteSpace(*nameEnd) && (*nameEnd != '/') && (*nameEnd != '>') )
+				++nameEnd;
+
+			ElementRange elementRange;
+			elementRange.name.assign(next, nameEnd);
+			elementRange.begin = pos - buffer;
+
+			if ( isEmptyElement )
+			{
+				elementRange.end = tagEnd - buffer;
+			}
+			else
+			{
+				const char* closingTagEnd = findElementEnd(tagEnd, end);
+				if ( !closingTagEnd )
+					break;
+				elementRange.end = closingTagEnd - buffer;
+			}
+
+			mElementRanges.push_back(elementRange);
+			pos = buffer + elementRange.end;
+		}
+
+		// The end tag of the root element has not been found
+		mElementRanges.clear();
+		return false;
+	}
+
+} // namespace GeneratedSaxParser
@@ -90,6 +90,41 @@ namespace GeneratedSaxParser
 		return status != XML_STATUS_ERROR;
 	}
 
+	//--------------------------------------------------------------------
+	bool ExpatSaxParser::parseBufferSegments( const char* uri, const BufferSegment* segments, size_t segmentCount )
+	{
+		mParser = XML_ParserCreate(0);
+
+		XML_SetUserData(mParser, this);
+		XML_SetElementHandler(mParser, startElement, endElement);
+		XML_SetCharacterDataHandler(mParser, characters);
+
+		// expat parses the segments in place. It only copies tokens that cross chunk boundaries.
+		XML_Status status = XML_STATUS_OK;
+		for ( size_t i = 0; (i < segmentCount) && (status != XML_STATUS_ERROR); ++i )
+		{
+			const char* data = segments[i].data;
+			size_t remainingSize = segments[i].length;
+			while ( (remainingSize > 0) && (status != XML_STATUS_ERROR) )
+			{
+				size_t chunkSize = SEGMENT_CHUNK_SIZE;
+				if ( remainingSize < chunkSize )
+					chunkSize = remainingSize;
+				status = XML_Parse(mParser, data, (int)chunkSize, false);
+				data += chunkSize;
+				remainingSize -= chunkSize;
+			}
+		}
+		if ( status != XML_STATUS_ERROR )
+		{
+			status = XML_Parse(mParser, 0, 0, true);
+		}
+
+		XML_ParserFree(mParser);
+
+		return status != XML_STATUS_ERROR;
+	}
+
 	//--------------------------------------------------------------------
 	void ExpatSaxParser::startElement( void* user_data, const XML_Char* name, const XML_Char** attrs )
 	{
@@ -37,8 +37,8 @@ namespace GeneratedSaxParser
 		0,                 		           //setDocumentLocatorSAXFunc setDocumentLocator;
 		0,                 		           //startDocumentSAXFunc startDocument;
 		0,                      		   //endDocumentSAXFunc endDocument;
-		&LibxmlSaxParser::startElement,    //startElementSAXFunc startElement;
-		&LibxmlSaxParser::endElement,	   //endElementSAXFunc endElement;
+		0,                                 //startElementSAXFunc startElement;
+		0,                      		   //endElementSAXFunc endElement;
 		0,                 		           //referenceSAXFunc reference;
 		&LibxmlSaxParser::characters,	   //charactersSAXFunc characters;
 		0,                 		           //ignorableWhitespaceSAXFunc ignorableWhitespace;
@@ -46,10 +46,21 @@ namespace GeneratedSaxParser
 		0,                 		           //commentSAXFunc comment;
 		0,                 		           //warningSAXFunc warning;
 		&LibxmlSaxParser::errorFunction,   //errorSAXFunc error;
-		&LibxmlSaxParser::errorFunction    //fatalErrorSAXFunc fatalError;
-
+		&LibxmlSaxParser::errorFunction,   //fatalErrorSAXFunc fatalError;
+		0,                 		           //getParameterEntitySAXFunc getParameterEntity;
+		0,                 		           //cdataBlockSAXFunc cdataBlock;
+		0,                 		           //externalSubsetSAXFunc externalSubset;
+		XML_SAX2_MAGIC,    		           //unsigned int initialized;
+		0,                 		           //void *_private;
+		&LibxmlSaxParser::startElementNs,  //startElementNsSAX2Func startElementNs;
+		&LibxmlSaxParser::endElementNs,    //endElementNsSAX2Func endElementNs;
+		&LibxmlSaxParser::structuredErrorFunction //xmlStructuredErrorFunc serror;
 	};
 
+	/** Prefix of the names of namespace declarations. Not interned by libxml, so it never is the address of 
+	a prefix or local name passed by libxml.*/
+	static const ::xmlChar* const XMLNS = (const ::xmlChar*)"xmlns";
+
 
 	//--------------------------------------------------------------------
 	LibxmlSaxParser::LibxmlSaxParser(Parser* parser)
@@ -162,26 +173,173 @@ namespace GeneratedSaxParser
         return true;
 	}
 
+	bool LibxmlSaxParser::parseBufferSegments( const char* uri, const BufferSegment* segments, size_t segmentCount )
+	{
+		// The segments are pushed in chunks. Memory parser contexts would copy the entire buffer into a 
+		// libxml buffer and are limited to int sizes.
+		mParserContext = xmlCreatePushParserCtxt( 0, 0, 0, 0, uri );
+
+		if ( !mParserContext )
+		{
+			ParserError error(ParserError::SEVERITY_CRITICAL,
+								ParserError::ERROR_COULD_NOT_OPEN_FILE,
+								0,
+								0,
+								0,
+								0,
+								uri);
+			IErrorHandler* errorHandler = getParser()->getErrorHandler();
+			if ( errorHandler )
+			{
+				errorHandler->handleError(error);
+			}
+			return false;
+		}
+
+		// We let libxml replace the entities
+		mParserContext->replaceEntities = 1;
+
+		if (mParserContext->sax != (xmlSAXHandlerPtr) &xmlDefaultSAXHandler)
+		{
+			xmlFree(mParserContext->sax);
+		}
+
+		mParserContext->sax = &SAXHANDLER;
+		mParserContext->userData = (void*)this;
+
+		initializeParserContext();
+
+		// parsing is stopped, if it has been aborted by abortParsing()
+		for ( size_t i = 0; (i < segmentCount) && (mParserContext->instate != XML_PARSER_EOF); ++i )
+		{
+			const char* data = segments[i].data;
+			size_t remainingSize = segments[i].length;
+			while ( (remainingSize > 0) && (mParserContext->instate != XML_PARSER_EOF) )
+			{
+				size_t chunkSize = SEGMENT_CHUNK_SIZE;
+				if ( remainingSize < chunkSize )
+					chunkSize = remainingSize;
+				xmlParseChunk(mParserContext, data, (int)chunkSize, 0);
+				data += chunkSize;
+				remainingSize -= chunkSize;
+			}
+		}
+		if ( mParserContext->instate != XML_PARSER_EOF )
+		{
+			xmlParseChunk(mParserContext, 0, 0, 1);
+		}
+
+		mParserContext->sax = 0;
+
+		if ( mParserContext->myDoc )
+		{
+			xmlFreeDoc(mParserContext->myDoc);
+			mParserContext->myDoc = 0;
+		}
+
+		xmlFreeParserCtxt(mParserContext);
+		mParserContext = 0;
+
+		return true;
+	}
+
 	void LibxmlSaxParser::initializeParserContext()
 	{
 		mParserContext->linenumbers = true;
 		mParserContext->validate = false;
+
+		// the names are interned in the dictionary of the new parser context
+		mQualifiedNames.clear();
 	}
 
+	//--------------------------------------------------------------------
+	const LibxmlSaxParser::QualifiedName& LibxmlSaxParser::getQualifiedName( const ::xmlChar* localname, const ::xmlChar* prefix )
+	{
+		QualifiedNameList& qualifiedNames = mQualifiedNames[localname];
+		for ( QualifiedNameList::const_iterator it = qualifiedNames.begin(); it != qualifiedNames.end(); ++it )
+		{
+			if ( it->prefix == prefix )
+				return *it;
+		}
+
+		qualifiedNames.push_back( QualifiedName() );
+		QualifiedName& qualifiedName = qualifiedNames.back();
+		qualifiedName.prefix = prefix;
+		if ( prefix )
+		{
+			qualifiedName.name = (const char*)prefix;
+			qualifiedName.name += ':';
+		}
+		qualifiedName.name += (const char*)localname;
+		qualifiedName.hashPair = Utils::calculateStringHashWithNamespace( qualifiedName.name.c_str() );
+		return qualifiedName;
+	}
 
-	void LibxmlSaxParser::startElement( void* user_data, const ::xmlChar* name, const ::xmlChar** attrs )
+	//--------------------------------------------------------------------
+	const ParserChar** LibxmlSaxParser::createAttributeList( int namespaceCount, const ::xmlChar** namespaces, 
+															 int attributeCount, const ::xmlChar** attributes )
+	{
+		if ( (namespaceCount == 0) && (attributeCount == 0) )
+			return 0;
+
+		// The attribute values are not zero terminated. They are copied into one buffer, that is reused 
+		// for all elements.
+		size_t valuesLength = 0;
+		for ( int i = 0; i < attributeCount; ++i )
+		{
+			const ::xmlChar** attribute = attributes + 5 * i;
+			valuesLength += (size_t)(attribute[4] - attribute[3]) + 1;
+		}
+		if ( mAttributeValues.size() < valuesLength )
+			mAttributeValues.resize( valuesLength );
+
+		mAttributes.clear();
+
+		// the namespace declarations are passed as attributes, as they were by libxml's sax1 interface
+		for ( int i = 0; i < namespaceCount; ++i )
+		{
+			const ::xmlChar* prefix = namespaces[2 * i];
+			const ::xmlChar* uri = namespaces[2 * i + 1];
+			const QualifiedName& name = prefix ? getQualifiedName( prefix, XMLNS ) : getQualifiedName( XMLNS, 0 );
+			mAttributes.push_back( name.name.c_str() );
+			mAttributes.push_back( uri ? (const ParserChar*)uri : "" );
+		}
+
+		ParserChar* value = valuesLength ? &mAttributeValues[0] : 0;
+		for ( int i = 0; i < attributeCount; ++i )
+		{
+			const ::xmlChar** attribute = attributes + 5 * i;
+			size_t valueLength = (size_t)(attribute[4] - attribute[3]);
+			memcpy( value, attribute[3], valueLength );
+			value[valueLength] = 0;
+			mAttributes.push_back( getQualifiedName( attribute[0], attribute[1] ).name.c_str() );
+			mAttributes.push_back( value );
+			value += valueLength + 1;
+		}
+
+		mAttributes.push_back( 0 );
+		return &mAttributes[0];
+	}
+
+	//--------------------------------------------------------------------
+	void LibxmlSaxParser::startElementNs( void* user_data, const ::xmlChar* localname, const ::xmlChar* prefix, const ::xmlChar* URI,
+										  int nb_namespaces, const ::xmlChar** namespaces, int nb_attributes, int nb_defaulted, 
+										  const ::xmlChar** attributes )
 	{
 		LibxmlSaxParser* thisObject = (LibxmlSaxParser*)user_data;
 		Parser* parser = thisObject->getParser();
-		if ( !parser->elementBegin((const ParserChar*)name, (const ParserChar**)attrs) )
+		const QualifiedName& elementName = thisObject->getQualifiedName( localname, prefix );
+		const ParserChar** attributeList = thisObject->createAttributeList( nb_namespaces, namespaces, nb_attributes, attributes );
+		if ( !parser->elementBegin(elementName.name.c_str(), elementName.hashPair, attributeList) )
 			thisObject->abortParsing();
 	}
 
-	void LibxmlSaxParser::endElement( void* user_data, const ::xmlChar* name)
+	//--------------------------------------------------------------------
+	void LibxmlSaxParser::endElementNs( void* user_data, const ::xmlChar* localname, const ::xmlChar* prefix, const ::xmlChar* URI )
 	{
 		LibxmlSaxParser* thisObject = (LibxmlSaxParser*)user_data;
 		Parser* parser = thisObject->getParser();
-		if ( !parser->elementEnd((const ParserChar*)name) )
+		if ( !parser->elementEnd(thisObject->getQualifiedName( localname, prefix ).name.c_str()) )
 			thisObject->abortParsing();
 	}
 
@@ -239,4 +397,30 @@ namespace GeneratedSaxParser
             errHandler->handleError(error);
 	}
 
+	void LibxmlSaxParser::structuredErrorFunction( void* userData, StructuredError error )
+	{
+		// userData is the context of a global structured error handler, if one is set
+		xmlParserCtxtPtr parserContext = (xmlParserCtxtPtr)error->ctxt;
+		LibxmlSaxParser* thisObject = (LibxmlSaxParser*)(parserContext ? parserContext->userData : userData);
+
+		// warnings have not been reported before
+		if ( error->level == XML_ERR_WARNING )
+			return;
+
+		// SAX2 checks namespaces. Undeclared prefixes are not reported as critical, since they have not been 
+		// checked at all before and libxml continues parsing anyway.
+		ParserError::Severity severity = (error->domain == XML_FROM_NAMESPACE) ? ParserError::SEVERITY_ERROR_NONCRITICAL : ParserError::SEVERITY_CRITICAL;
+		ParserError parserError(severity,
+					ParserError::ERROR_XML_PARSER_ERROR,
+					0,
+					0,
+					(error->line > 0) ? (size_t)error->line : 0,
+					(error->int2 > 0) ? (size_t)error->int2 : 0,
+					error->message ? error->message : "");
+
+		IErrorHandler* errHandler = thisObject->getParser()->getErrorHandler();
+		if ( errHandler ) 
+			errHandler->handleError(parserError);
+	}
+
 } // namespace GeneratedSaxParser
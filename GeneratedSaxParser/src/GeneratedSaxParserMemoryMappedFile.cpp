@@ -0,0 +1,233 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "GeneratedSaxParserMemoryMappedFile.h"
+
+#if defined(COLLADABU_OS_WIN)
+#	include <windows.h>
+#else
+#	include <sys/types.h>
+#	include <sys/stat.h>
+#	include <sys/mman.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#	include <climits>
+#endif
+
+
+namespace GeneratedSaxParser
+{
+	/** Used as data of empty files, which cannot be mapped.*/
+	static const char EMPTY_FILE_DATA[1] = {0};
+
+	//--------------------------------------------------------------------
+	MemoryMappedFile::MemoryMappedFile()
+		: mData(0)
+		, mSize(0)
+#if defined(COLLADABU_OS_WIN)
+		, mFileHandle(INVALID_HANDLE_VALUE)
+		, mMappingHandle(0)
+#else
+		, mFileDescriptor(-1)
+#endif
+	{
+	}
+
+	//--------------------------------------------------------------------
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		close();
+	}
+
+#if defined(COLLADABU_OS_WIN)
+
+	//--------------------------------------------------------------------
+	bool MemoryMappedFile::open( const char* fileName )
+	{
+		close();
+
+		mFileHandle = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+		if ( mFileHandle == INVALID_HANDLE_VALUE )
+			return false;
+
+		LARGE_INTEGER fileSize;
+		if ( !GetFileSizeEx(mFileHandle, &fileSize) )
+		{
+			close();
+			return false;
+		}
+
+		mSize = (size_t)fileSize.QuadPart;
+		if ( mSize == 0 )
+		{
+			mData = EMPTY_FILE_DATA;
+			return true;
+		}
+
+		mMappingHandle = CreateFileMappingA(mFileHandle, 0, PAGE_READONLY, 0, 0, 0);
+		if ( !mMappingHandle )
+		{
+			close();
+			return false;
+		}
+
+		mData = (const char*)MapViewOfFile(mMappingHandle, FILE_MAP_READ, 0, 0, 0);
+		if ( !mData )
+		{
+			close();
+			return false;
+		}
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	void MemoryMappedFile::close()
+	{
+		if ( mData && (mData != EMPTY_FILE_DATA) )
+			UnmapViewOfFile(mData);
+		if ( mMappingHandle )
+			CloseHandle(mMappingHandle);
+		if ( mFileHandle != INVALID_HANDLE_VALUE )
+			CloseHandle(mFileHandle);
+
+		mData = 0;
+		mSize = 0;
+		mMappingHandle = 0;
+		mFileHandle = INVALID_HANDLE_VALUE;
+	}
+
+	//--------------------------------------------------------------------
+	void MemoryMappedFile::adviseSequential()
+	{
+		// FILE_FLAG_SEQUENTIAL_SCAN has already been passed when the file was opened
+	}
+
+	/** Layout of WIN32_MEMORY_RANGE_ENTRY, which is not declared by older platform SDKs.*/
+	struct PrefetchMemoryRange
+	{
+		PVOID virtualAddress;
+		SIZE_T numberOfBytes;
+	};
+
+	/** Signature of PrefetchVirtualMemory.*/
+	typedef BOOL (WINAPI *PrefetchVirtualMemoryFunction)( HANDLE, ULONG_PTR, PrefetchMemoryRange*, ULONG );
+
+	//--------------------------------------------------------------------
+	bool MemoryMappedFile::readAhead( const char* fileName )
+	{
+		// PrefetchVirtualMemory is available since Windows 8 and therefore looked up at run time
+		static const PrefetchVirtualMemoryFunction prefetchVirtualMemory 
+			= (PrefetchVirtualMemoryFunction)GetProcAddress(GetModuleHandleA("kernel32.dll"), "PrefetchVirtualMemory");
+		if ( !prefetchVirtualMemory )
+			return false;
+
+		MemoryMappedFile file;
+		if ( !file.open(fileName) || (file.mData == EMPTY_FILE_DATA) )
+			return false;
+
+		// The read pages belong to the file cache and stay there after the view has been unmapped
+		PrefetchMemoryRange range;
+		range.virtualAddress = (PVOID)file.mData;
+		range.numberOfBytes = file.mSize;
+		return prefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != FALSE;
+	}
+
+#else
+
+	//--------------------------------------------------------------------
+	bool MemoryMappedFile::open( const char* fileName )
+	{
+		close();
+
+		mFileDescriptor = ::open(fileName, O_RDONLY);
+		if ( mFileDescriptor < 0 )
+			return false;
+
+		struct stat fileStatus;
+		if ( fstat(mFileDescriptor, &fileStatus) != 0 )
+		{
+			close();
+			return false;
+		}
+
+		mSize = (size_t)fileStatus.st_size;
+		if ( mSize == 0 )
+		{
+			mData = EMPTY_FILE_DATA;
+			return true;
+		}
+
+		void* data = mmap(0, mSize, PROT_READ, MAP_PRIVATE, mFileDescriptor, 0);
+		if ( data == MAP_FAILED )
+		{
+			close();
+			return false;
+		}
+
+		mData = (const char*)data;
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	void MemoryMappedFile::close()
+	{
+		if ( mData && (mData != EMPTY_FILE_DATA) )
+			munmap((void*)mData, mSize);
+		if ( mFileDescriptor >= 0 )
+			::close(mFileDescriptor);
+
+		mData = 0;
+		mSize = 0;
+		mFileDescriptor = -1;
+	}
+
+	//--------------------------------------------------------------------
+	void MemoryMappedFile::adviseSequential()
+	{
+		if ( mData && (mData != EMPTY_FILE_DATA) )
+			madvise((void*)mData, mSize, MADV_SEQUENTIAL);
+	}
+
+	//--------------------------------------------------------------------
+	bool MemoryMappedFile::readAhead( const char* fileName )
+	{
+		int fileDescriptor = ::open(fileName, O_RDONLY);
+		if ( fileDescriptor < 0 )
+			return false;
+
+#if defined(COLLADABU_OS_MAC)
+		struct stat fileStatus;
+		bool success = false;
+		if ( fstat(fileDescriptor, &fileStatus) == 0 )
+		{
+			// ra_count is an int. Files larger than INT_MAX bytes are advised in chunks.
+			success = true;
+			off_t offset = 0;
+			while ( success && (offset < fileStatus.st_size) )
+			{
+				off_t remaining = fileStatus.st_size - offset;
+				struct radvisory advisory;
+				advisory.ra_offset = offset;
+				advisory.ra_count = (remaining < INT_MAX) ? (int)remaining : INT_MAX;
+				success = fcntl(fileDescriptor, F_RDADVISE, &advisory) != -1;
+				offset += advisory.ra_count;
+			}
+		}
+#else
+		// the page cache keeps the read ahead pages after the descriptor has been closed
+		bool success = posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_WILLNEED) == 0;
+#endif
+		::close(fileDescriptor);
+		return success;
+	}
+
+#endif
+
+} // namespace GeneratedSaxParser
@@ -10,6 +10,9 @@
 
 #include "GeneratedSaxParserSaxParser.h"
 #include "GeneratedSaxParserParser.h"
+#include "GeneratedSaxParserParserError.h"
+#include "GeneratedSaxParserIErrorHandler.h"
+#include "GeneratedSaxParserMemoryMappedFile.h"
 
 namespace GeneratedSaxParser
 {
@@ -36,4 +39,31 @@ namespace GeneratedSaxParser
         }
     }
 
+	//--------------------------------------------------------------------
+	bool SaxParser::parseMappedFile( const char* fileName )
+	{
+		MemoryMappedFile mappedFile;
+		if ( !mappedFile.open(fileName) )
+		{
+			ParserError error(ParserError::SEVERITY_CRITICAL,
+								ParserError::ERROR_COULD_NOT_OPEN_FILE,
+								0,
+								0,
+								0,
+								0,
+								fileName);
+			IErrorHandler* errorHandler = mParser->getErrorHandler();
+			if ( errorHandler )
+			{
+				errorHandler->handleError(error);
+			}
+			return false;
+		}
+
+		mappedFile.adviseSequential();
+
+		BufferSegment segment = { mappedFile.getData(), mappedFile.getSize() };
+		return parseBufferSegments( fileName, &segment, 1 );
+	}
+
 } // namespace COLLADAPARSER
@@ -14,8 +14,298 @@
 #include <string.h>
 #include <limits>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#	define GENERATEDSAXPARSER_USE_SSE2
+#	include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#	include <intrin.h>
+#endif
+
 namespace GeneratedSaxParser
 {
+	/** Number of characters examined at once, to find the digits of a number.*/
+	static const size_t DIGIT_BLOCK_LENGTH = 16;
+
+	/** Maximum number of digits of a floating point number handled by the block wise conversion. The 
+	mantissa of a double holds all integers with up to 15 decimal digits exactly. The block wise conversion 
+	therefore calculates exactly the same values as the character wise one.*/
+	static const size_t MAX_EXACT_FLOATING_POINT_DIGITS = 15;
+
+	/** Maximum number of digits of an integer handled by the block wise conversion. Integers with up to 9 
+	decimal digits do not overflow an int.*/
+	static const size_t MAX_EXACT_INTEGER_DIGITS = 9;
+
+	/** Maximum number of exponent digits handled by the block wise conversion.*/
+	static const size_t MAX_EXPONENT_DIGITS = 2;
+
+	/** Smallest power of ten the block wise conversion can produce.*/
+	static const int MIN_BLOCKWISE_POWER = -(int)MAX_EXACT_FLOATING_POINT_DIGITS - 99;
+
+	/** Largest power of ten the block wise conversion can produce.*/
+	static const int MAX_BLOCKWISE_POWER = 99;
+
+	/** The powers of ten from MIN_BLOCKWISE_POWER to MAX_BLOCKWISE_POWER, as calculated by the character 
+	wise conversion of floating point numbers.*/
+	template<class FloatingPointType>
+	struct PowersOfTen
+	{
+		FloatingPointType values[MAX_BLOCKWISE_POWER - MIN_BLOCKWISE_POWER + 1];
+
+		PowersOfTen()
+		{
+			for ( int i = MIN_BLOCKWISE_POWER; i <= MAX_BLOCKWISE_POWER; ++i )
+			{
+				// volatile prevents the compiler from evaluating pow at compile time, which might round
+				// differently than the pow called at run time by the character wise conversion
+				volatile int power = i;
+				values[i - MIN_BLOCKWISE_POWER] = pow((FloatingPointType)10, (FloatingPointType)power);
+			}
+		}
+	};
+
+	static const PowersOfTen<float> FLOAT_POWERS_OF_TEN;
+	static const PowersOfTen<double> DOUBLE_POWERS_OF_TEN;
+
+	//--------------------------------------------------------------------
+	static inline float getPowerOfTen( int power, float )
+	{
+		return FLOAT_POWERS_OF_TEN.values[power - MIN_BLOCKWISE_POWER];
+	}
+
+	//--------------------------------------------------------------------
+	static inline double getPowerOfTen( int power, double )
+	{
+		return DOUBLE_POWERS_OF_TEN.values[power - MIN_BLOCKWISE_POWER];
+	}
+
+	//--------------------------------------------------------------------
+	/** Returns a bit mask with bit i set, if the character at @a text[i] is a decimal digit. @a text must
+	contain at least DIGIT_BLOCK_LENGTH characters.*/
+	static inline unsigned int getDigitMask( const ParserChar* text )
+	{
+#ifdef GENERATEDSAXPARSER_USE_SSE2
+		__m128i block = _mm_loadu_si128((const __m128i*)text);
+		__m128i notBelowZero = _mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1));
+		__m128i notAboveNine = _mm_cmplt_epi8(block, _mm_set1_epi8('9' + 1));
+		return (unsigned int)_mm_movemask_epi8(_mm_and_si128(notBelowZero, notAboveNine));
+#else
+		unsigned int mask = 0;
+		for ( size_t i = 0; i < DIGIT_BLOCK_LENGTH; ++i )
+		{
+			if ( (text[i] >= '0') && (text[i] <= '9') )
+				mask |= 1u << i;
+		}
+		return mask;
+#endif
+	}
+
+	//--------------------------------------------------------------------
+	/** Returns the number of consecutive digits starting at position @a position of the block 
+	@a digitMask has been created for.*/
+	static inline size_t countDigits( unsigned int digitMask, size_t position )
+	{
+		// the bits above the block are zero, i.e. nonDigitMask is never zero
+		unsigned int nonDigitMask = ~(digitMask >> position);
+#if defined(__GNUC__)
+		return (size_t)__builtin_ctz(nonDigitMask);
+#elif defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, nonDigitMask);
+		return (size_t)index;
+#else
+		size_t count = 0;
+		while ( (nonDigitMask & 1) == 0 )
+		{
+			nonDigitMask >>= 1;
+			++count;
+		}
+		return count;
+#endif
+	}
+
+	//--------------------------------------------------------------------
+	/** Appends the @a count digits at @a text to @a value.*/
+	static inline uint64 accumulateDigits( uint64 value, const ParserChar* text, size_t count )
+	{
+		for ( size_t i = 0; i < count; ++i )
+			value = value * 10 + (text[i] - '0');
+		return value;
+	}
+
+#ifdef GENERATEDSAXPARSER_USE_SSE2
+	//--------------------------------------------------------------------
+	/** Returns the value of the 1 to 8 digits at @a text. Eight characters are read from @a text. Calculates 
+	all digits at once, using the little endian byte order of x86.*/
+	static inline uint64 parseUpToEightDigits( const ParserChar* text, size_t count )
+	{
+		uint64 chunk;
+		memcpy(&chunk, text, sizeof(chunk));
+		// The characters after the digits are moved out, the shifted in zeros become leading zeros. A borrow 
+		// caused by a character after the digits only affects the characters after it.
+		chunk = (chunk - 0x3030303030303030ULL) << (8 * (8 - count));
+		chunk = (chunk * 10) + (chunk >> 8);
+		chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)))
+			+ (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+		return chunk;
+	}
+#endif
+
+	//--------------------------------------------------------------------
+	/** Appends the @a count digits at @a text to @a value. @a count must not exceed 16.*/
+	static inline uint64 appendDigits( uint64 value, const ParserChar* text, size_t count, const ParserChar* bufferEnd )
+	{
+#ifdef GENERATEDSAXPARSER_USE_SSE2
+		static const uint64 POWERS_OF_TEN[] = { 1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 
+			10000000ULL, 100000000ULL };
+
+		if ( count == 0 )
+			return value;
+		if ( (size_t)(bufferEnd - text) >= 16 )
+		{
+			if ( count <= 8 )
+				return value * POWERS_OF_TEN[count] + parseUpToEightDigits(text, count);
+			value = value * POWERS_OF_TEN[count - 8] + parseUpToEightDigits(text, count - 8);
+			return value * POWERS_OF_TEN[8] + parseUpToEightDigits(text + count - 8, 8);
+		}
+#endif
+		return accumulateDigits(value, text, count);
+	}
+
+	//--------------------------------------------------------------------
+	/** Converts the floating point number at @a *buffer, if it consists of at most
+	MAX_EXACT_FLOATING_POINT_DIGITS digits, an optional sign, decimal point and exponent of up to 
+	MAX_EXPONENT_DIGITS digits and is followed by a white space within the next DIGIT_BLOCK_LENGTH characters.
+	NaN and INF are not handled. 
+	@param buffer Pointer to the first character of the number, i.e. not a white space. Set to the first
+	character after the number on success.
+	@return True, if the number could be converted, false if it has to be converted character wise.*/
+	template<class FloatingPointType>
+	static inline bool toFloatingPointBlockwise( const ParserChar** buffer, const ParserChar* bufferEnd, FloatingPointType& value )
+	{
+		const ParserChar* s = *buffer;
+		if ( (size_t)(bufferEnd - s) < DIGIT_BLOCK_LENGTH )
+			return false;
+
+		unsigned int digitMask = getDigitMask(s);
+
+		size_t position = 0;
+		FloatingPointType sign = 1.0;
+		if ( *s == '-' )
+		{
+			position = 1;
+			sign = -1.0;
+		}
+		else if ( *s == '+' )
+		{
+			position = 1;
+		}
+
+		size_t integerDigitsBegin = position;
+		size_t integerDigits = countDigits(digitMask, position);
+		position += integerDigits;
+		if ( position == DIGIT_BLOCK_LENGTH )
+			return false;
+
+		size_t fractionDigitsBegin = position;
+		size_t fractionDigits = 0;
+		if ( s[position] == '.' )
+		{
+			++position;
+			fractionDigitsBegin = position;
+			fractionDigits = countDigits(digitMask, position);
+			position += fractionDigits;
+			if ( position == DIGIT_BLOCK_LENGTH )
+				return false;
+		}
+
+		size_t digits = integerDigits + fractionDigits;
+		if ( (digits == 0) || (digits > MAX_EXACT_FLOATING_POINT_DIGITS) )
+			return false;
+
+		int power = -(int)fractionDigits;
+		if ( (s[position] == 'e') || (s[position] == 'E') )
+		{
+			++position;
+			int exponentSign = 1;
+			if ( s[position] == '-' )
+			{
+				++position;
+				exponentSign = -1;
+			}
+			else if ( s[position] == '+' )
+			{
+				++position;
+			}
+			if ( position == DIGIT_BLOCK_LENGTH )
+				return false;
+
+			size_t exponentDigits = countDigits(digitMask, position);
+			if ( (exponentDigits == 0) || (exponentDigits > MAX_EXPONENT_DIGITS) )
+				return false;
+			power += exponentSign * (int)accumulateDigits(0, s + position, exponentDigits);
+			position += exponentDigits;
+			if ( position == DIGIT_BLOCK_LENGTH )
+				return false;
+		}
+
+		if ( !Utils::isWhiteSpace(s[position]) )
+			return false;
+
+		uint64 mantissa = appendDigits(0, s + integerDigitsBegin, integerDigits, bufferEnd);
+		mantissa = appendDigits(mantissa, s + fractionDigitsBegin, fractionDigits, bufferEnd);
+
+		// same operations as in the character wise conversion
+		value = (FloatingPointType)(double)mantissa * getPowerOfTen(power, FloatingPointType()) * sign;
+		*buffer = s + position;
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	/** Converts the integer at @a *buffer, if it consists of at most MAX_EXACT_INTEGER_DIGITS digits and 
+	an optional sign and is followed by a white space within the next DIGIT_BLOCK_LENGTH characters.
+	@param buffer Pointer to the first character of the number, i.e. not a white space. Set to the first
+	character after the number on success.
+	@return True, if the number could be converted, false if it has to be converted character wise.*/
+	template<class IntegerType, bool signedInteger>
+	static inline bool toIntegerBlockwise( const ParserChar** buffer, const ParserChar* bufferEnd, IntegerType& value )
+	{
+		const ParserChar* s = *buffer;
+		if ( (size_t)(bufferEnd - s) < DIGIT_BLOCK_LENGTH )
+			return false;
+
+		unsigned int digitMask = getDigitMask(s);
+
+		size_t position = 0;
+		IntegerType sign = 1;
+		if ( signedInteger )
+		{
+			if ( *s == '-' )
+			{
+				position = 1;
+				sign = -1;
+			}
+			else if ( *s == '+' )
+			{
+				position = 1;
+			}
+		}
+
+		size_t digitsBegin = position;
+		size_t digits = countDigits(digitMask, position);
+		position += digits;
+		if ( (digits == 0) || (digits > MAX_EXACT_INTEGER_DIGITS) || (position == DIGIT_BLOCK_LENGTH) )
+			return false;
+
+		if ( !Utils::isWhiteSpace(s[position]) )
+			return false;
+
+		value = (IntegerType)appendDigits(0, s + digitsBegin, digits, bufferEnd);
+		if ( signedInteger )
+			value = value * sign;
+		*buffer = s + position;
+		return true;
+	}
 
 	//--------------------------------------------------------------------
 	StringHash Utils::calculateStringHash( const ParserChar* text, size_t textLength )
@@ -207,6 +497,14 @@ namespace GeneratedSaxParser
 			}
 		}
 
+		FloatingPointType blockwiseValue;
+		if ( toFloatingPointBlockwise(&s, bufferEnd, blockwiseValue) )
+		{
+			failed = false;
+			*buffer = s;
+			return blockwiseValue;
+		}
+
         // check for 'NaN'
         if ( s[0] == 'N' && s[1] == 'a' && s[2] == 'N' )
         {
@@ -914,6 +1212,14 @@ namespace GeneratedSaxParser
 			}
 		}
 
+		IntegerType blockwiseValue;
+		if ( toIntegerBlockwise<IntegerType, signedInteger>(&s, bufferEnd, blockwiseValue) )
+		{
+			failed = false;
+			*buffer = s;
+			return blockwiseValue;
+		}
+
 		IntegerType value = 0;
 		IntegerType sign = 1;
 		if ( signedInteger )
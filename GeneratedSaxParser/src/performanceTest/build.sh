@@ -0,0 +1,13 @@
+OPTIONS="-O3 -Wall"
+
+INCLUDES="-I../../include -I../../include/performanceTest -I../../../COLLADABaseUtils/include -I../../../Externals/UTF/include"
+
+FILES="main.cpp performanceTest.cpp ../GeneratedSaxParserUtils.cpp ../../../COLLADABaseUtils/src/COLLADABUURI.cpp ../../../COLLADABaseUtils/src/COLLADABUUtils.cpp ../../../COLLADABaseUtils/src/COLLADABUStringUtils.cpp ../../../COLLADABaseUtils/src/COLLADABUPcreCompiledPattern.cpp"
+
+LIBS="-lpcre"
+
+OUTPUTFILE="-o performanceTest"
+
+
+
+g++ $OPTIONS $INCLUDES $FILES $LIBS $OUTPUTFILE
@@ -0,0 +1,185 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "performanceTest.h"
+
+#include "GeneratedSaxParserUtils.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+
+using namespace GeneratedSaxParser;
+
+
+/** Number of values in the generated lists.*/
+static const size_t VALUE_COUNT = 10000000;
+
+/** Number of values written to each list for the comparison of the block wise and the character wise
+conversion.*/
+static const size_t COMPARE_COUNT = 1000000;
+
+
+//--------------------------------------------------------------------
+/** Appends a random floating point number to @a text, formatted like the numbers written by the common
+exporters, followed by a space.*/
+static void appendRandomFloatingPoint( std::string& text )
+{
+	char buffer[64];
+	double value = ((double)rand() / RAND_MAX - 0.5) * pow(10.0, rand() % 9 - 4);
+	switch ( rand() % 6 )
+	{
+	case 0:
+		sprintf(buffer, "%g ", value);
+		break;
+	case 1:
+		sprintf(buffer, "%.9g ", value);
+		break;
+	case 2:
+		sprintf(buffer, "%.17g ", value);
+		break;
+	case 3:
+		sprintf(buffer, "%f ", value);
+		break;
+	case 4:
+		sprintf(buffer, "%e ", value);
+		break;
+	default:
+		sprintf(buffer, "%d ", rand() % 1000 - 500);
+		break;
+	}
+	text += buffer;
+}
+
+//--------------------------------------------------------------------
+/** Appends a random non negative integer to @a text, followed by a space.*/
+static void appendRandomInteger( std::string& text )
+{
+	char buffer[32];
+	unsigned int value = (unsigned int)rand();
+	if ( rand() % 8 == 0 )
+		value = value * (unsigned int)rand();
+	else
+		value %= 100000;
+	sprintf(buffer, "%u ", value);
+	text += buffer;
+}
+
+//--------------------------------------------------------------------
+/** Returns true, if @a lhs and @a rhs have the same bit pattern.*/
+template<class T>
+static bool isIdentical( T lhs, T rhs )
+{
+	return memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+
+//--------------------------------------------------------------------
+/** Converts each number of @a text once within the complete text, i.e. block wise where possible, and
+once isolated in a buffer too short for the block wise conversion, i.e. character wise.*/
+template<class T>
+static bool compare( const std::string& text, T (*toData)( const ParserChar**, const ParserChar*, bool& ), const char* typeName )
+{
+	const ParserChar* pos = text.c_str();
+	const ParserChar* end = pos + text.length();
+	size_t mismatchCount = 0;
+
+	while ( pos != end )
+	{
+		const ParserChar* numberBegin = pos;
+		bool failed = false;
+		T value = toData(&pos, end, failed);
+		if ( failed )
+			break;
+
+		const ParserChar* numberEnd = numberBegin;
+		while ( !Utils::isWhiteSpace(*numberEnd) )
+			++numberEnd;
+		// the number and its separator only, which is always shorter than a block
+		std::string isolated(numberBegin, numberEnd - numberBegin + 1);
+		const ParserChar* isolatedPos = isolated.c_str();
+		bool isolatedFailed = false;
+		T isolatedValue = toData(&isolatedPos, isolatedPos + isolated.length(), isolatedFailed);
+
+		if ( isolatedFailed || !isIdentical(value, isolatedValue) )
+		{
+			if ( mismatchCount++ < 10 )
+				printf("%s mismatch for '%s'\n", typeName, isolated.c_str());
+		}
+
+		// skip the separator
+		++pos;
+	}
+
+	printf("%s: %s\n", typeName, mismatchCount == 0 ? "block wise and character wise conversion are identical" : "MISMATCH");
+	return mismatchCount == 0;
+}
+
+//--------------------------------------------------------------------
+/** Converts all numbers in @a text and prints the throughput.*/
+template<class T>
+static void measure( const std::string& text, T (*toData)( const ParserChar**, const ParserChar*, bool& ), const char* typeName )
+{
+	const ParserChar* pos = text.c_str();
+	const ParserChar* end = pos + text.length();
+	size_t count = 0;
+	double sum = 0;
+
+	clock_t startTime = clock();
+	while ( true )
+	{
+		bool failed = false;
+		T value = toData(&pos, end, failed);
+		if ( failed )
+			break;
+		sum += (double)value;
+		++count;
+	}
+	double seconds = (double)(clock() - startTime) / CLOCKS_PER_SEC;
+
+	printf("%s: %u values, %.1f MB in %.3f s, %.1f MB/s (checksum %g)\n", typeName, (unsigned int)count,
+		text.length() / 1e6, seconds, text.length() / 1e6 / seconds, sum);
+}
+
+//--------------------------------------------------------------------
+bool performanceTest()
+{
+	srand(1);
+
+	std::string floatingPointText;
+	std::string integerText;
+	floatingPointText.reserve(VALUE_COUNT * 16);
+	integerText.reserve(VALUE_COUNT * 8);
+	for ( size_t i = 0; i < VALUE_COUNT; ++i )
+	{
+		appendRandomFloatingPoint(floatingPointText);
+		appendRandomInteger(integerText);
+	}
+
+	bool identical = true;
+	std::string compareFloatingPointText = floatingPointText.substr(0, floatingPointText.find(' ', COMPARE_COUNT * 12) + 1);
+	std::string compareIntegerText = integerText.substr(0, integerText.find(' ', COMPARE_COUNT * 6) + 1);
+	identical &= compare<float>(compareFloatingPointText, &Utils::toFloat, "float");
+	identical &= compare<double>(compareFloatingPointText, &Utils::toDouble, "double");
+	identical &= compare<uint32>(compareIntegerText, &Utils::toUint32, "uint32");
+	identical &= compare<sint32>(compareIntegerText, &Utils::toSint32, "sint32");
+	identical &= compare<uint64>(compareIntegerText, &Utils::toUint64, "uint64");
+
+	measure<float>(floatingPointText, &Utils::toFloat, "float");
+	measure<double>(floatingPointText, &Utils::toDouble, "double");
+	measure<uint32>(integerText, &Utils::toUint32, "uint32");
+	measure<uint64>(integerText, &Utils::toUint64, "uint64");
+
+	return identical;
+}
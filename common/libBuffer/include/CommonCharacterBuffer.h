@@ -65,6 +65,12 @@ namespace Common
 		( 16 digits ) if @a doublePrecision is true, otherwise single precision as the float version.*/
 		bool copyToBufferAsChar( double d, bool doublePrecision = false);
 
+		/** Copies the shortest string representation of @a f into the buffer, that is read back as exactly @a f.*/
+		bool copyToBufferAsCharShortest( float f);
+
+		/** Copies the shortest string representation of @a d into the buffer, that is read back as exactly @a d.*/
+		bool copyToBufferAsCharShortest( double d);
+
 		/** Copies a string representation @a i into the buffer.*/
 		bool copyToBufferAsChar( char i);
 		bool copyToBufferAsChar( unsigned char i);
@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <Commonftoa.h>
 #include <Commondtoa.h>
+#include <Commonrtoa.h>
 #include <Commonitoa.h>
 #include <ConvertUTF.h>
 
@@ -97,6 +98,50 @@ namespace Common
 		return true;
 	}
 
+	//--------------------------------------------------------------------
+	bool CharacterBuffer::copyToBufferAsCharShortest( float f )
+	{
+		if ( getBytesAvailable() < RTOA_BUFFERSIZE )
+		{
+			//The float might not fit into the buffer. We need to flush first.
+			flushBuffer();
+		}
+
+		if ( getBytesAvailable() < RTOA_BUFFERSIZE )
+		{
+			//No chance to convert the float with this buffer
+			return false;
+		}
+
+		size_t bytesWritten = ftoaShortest( f, getCurrentPosition() );
+
+		increaseCurrentPosition( bytesWritten );
+
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool CharacterBuffer::copyToBufferAsCharShortest( double d )
+	{
+		if ( getBytesAvailable() < RTOA_BUFFERSIZE )
+		{
+			//The double might not fit into the buffer. We need to flush first.
+			flushBuffer();
+		}
+
+		if ( getBytesAvailable() < RTOA_BUFFERSIZE )
+		{
+			//No chance to convert the double with this buffer
+			return false;
+		}
+
+		size_t bytesWritten = dtoaShortest( d, getCurrentPosition() );
+
+		increaseCurrentPosition( bytesWritten );
+
+		return true;
+	}
+
 	//--------------------------------------------------------------------
 	bool CharacterBuffer::copyToBufferAsChar( bool v )
 	{
@@ -5,7 +5,7 @@ INCLUDES="-I../../include -I../../include/performanceTest -I../../../libftoa/inc
 
 BUFFERFILES="main.cpp performanceTest.cpp ../CommonBuffer.cpp ../CommonFWriteBufferFlusher.cpp ../CommonCharacterBuffer.cpp ../CommonStreamBufferFlusher.cpp "
 
-FTOAFILES="../../../libftoa/src/Commondtoa.cpp ../../../libftoa/src/Commonftoa.cpp"
+FTOAFILES="../../../libftoa/src/Commondtoa.cpp ../../../libftoa/src/Commonftoa.cpp ../../../libftoa/src/Commonrtoa.cpp"
 
 FILES=$BUFFERFILES$FTOAFILES
 
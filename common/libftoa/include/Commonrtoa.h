@@ -0,0 +1,41 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libftoa.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COMMON_RTOA_H__
+#define __COMMON_RTOA_H__
+
+#include <stdlib.h>
+
+namespace Common
+{
+
+	/** The minimum size of the buffer, passed to ftoaShortest and dtoaShortest.*/
+	static const size_t RTOA_BUFFERSIZE = 30;
+
+
+	/** Writes the shortest string representation of @a f that is read back as exactly @a f (round trip).
+	The digits are generated with Grisu3. The few numbers Grisu3 cannot decide are handled by an exact
+	fall back. Uses the same notation as ftoa, i.e. exponential notation for numbers smaller than 0.001
+	or larger than 999999.
+	@param buffer The buffer the string representation of the number will be written to. Its size must be at
+	least RTOA_BUFFERSIZE.
+	@return The number of bytes written in to the buffer.*/
+	int ftoaShortest(float f, char* buffer);
+
+	/** Writes the shortest string representation of @a d that is read back as exactly @a d (round trip).
+	See ftoaShortest.
+	@param buffer The buffer the string representation of the number will be written to. Its size must be at
+	least RTOA_BUFFERSIZE.
+	@return The number of bytes written in to the buffer.*/
+	int dtoaShortest(double d, char* buffer);
+
+}
+
+#endif // __COMMON_RTOA_H__
@@ -0,0 +1,20 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libftoa.
+	
+    Licensed under the MIT Open Source License, 
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef ___RTOAUNITTEST_H__
+#define ___RTOAUNITTEST_H__
+
+bool rtoaUnitTest();
+
+/** Checks the round trip of all 2^32 floats. Takes several minutes.*/
+bool rtoaExhaustiveFloatTest();
+
+
+#endif // ___RTOAUNITTEST_H__
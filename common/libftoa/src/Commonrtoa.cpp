@@ -0,0 +1,542 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libftoa.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "Commonrtoa.h"
+#include "Commonitoa.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// no uint32_t and uint64_t in MSVC
+#ifdef _MSC_VER
+typedef unsigned __int32 uint32_t;
+typedef unsigned __int64 uint64_t;
+#else
+#include <stdint.h>
+#endif
+
+namespace Common
+{
+
+	typedef union {
+		uint64_t	L;
+		double	D;
+	}		ULD_t;
+
+	typedef union {
+		uint32_t	L;
+		float	F;
+	}		ULF_t;
+
+
+	/** The maximum number of significant digits needed to represent a double exactly.*/
+	static const int MAX_DOUBLE_DIGITS = 17;
+
+	/** The maximum number of significant digits needed to represent a float exactly.*/
+	static const int MAX_FLOAT_DIGITS = 9;
+
+	/** Numbers with a decimal point position in this range are written without exponent, i.e. all
+	numbers from 0.001 to 999999.*/
+	static const int MIN_DECIMAL_POINT_POSITION = -2;
+	static const int MAX_DECIMAL_POINT_POSITION = 6;
+
+
+	/** A floating point number f * 2^e with a 64 bit significand, as used by Grisu.*/
+	struct DiyFp
+	{
+		uint64_t f;
+		int e;
+	};
+
+	/** A cached power of ten: significand * 2^binaryExponent ~ 10^decimalExponent.*/
+	struct CachedPower
+	{
+		uint64_t significand;
+		short binaryExponent;
+		short decimalExponent;
+	};
+
+	/** Normalized and rounded powers of ten from 10^-348 to 10^340, in steps of 8.*/
+	static const CachedPower CACHED_POWERS[] =
+	{
+		{ 0xfa8fd5a0081c0288ULL, -1220, -348 },
+		{ 0xbaaee17fa23ebf76ULL, -1193, -340 },
+		{ 0x8b16fb203055ac76ULL, -1166, -332 },
+		{ 0xcf42894a5dce35eaULL, -1140, -324 },
+		{ 0x9a6bb0aa55653b2dULL, -1113, -316 },
+		{ 0xe61acf033d1a45dfULL, -1087, -308 },
+		{ 0xab70fe17c79ac6caULL, -1060, -300 },
+		{ 0xff77b1fcbebcdc4fULL, -1034, -292 },
+		{ 0xbe5691ef416bd60cULL, -1007, -284 },
+		{ 0x8dd01fad907ffc3cULL, -980, -276 },
+		{ 0xd3515c2831559a83ULL, -954, -268 },
+		{ 0x9d71ac8fada6c9b5ULL, -927, -260 },
+		{ 0xea9c227723ee8bcbULL, -901, -252 },
+		{ 0xaecc49914078536dULL, -874, -244 },
+		{ 0x823c12795db6ce57ULL, -847, -236 },
+		{ 0xc21094364dfb5637ULL, -821, -228 },
+		{ 0x9096ea6f3848984fULL, -794, -220 },
+		{ 0xd77485cb25823ac7ULL, -768, -212 },
+		{ 0xa086cfcd97bf97f4ULL, -741, -204 },
+		{ 0xef340a98172aace5ULL, -715, -196 },
+		{ 0xb23867fb2a35b28eULL, -688, -188 },
+		{ 0x84c8d4dfd2c63f3bULL, -661, -180 },
+		{ 0xc5dd44271ad3cdbaULL, -635, -172 },
+		{ 0x936b9fcebb25c996ULL, -608, -164 },
+		{ 0xdbac6c247d62a584ULL, -582, -156 },
+		{ 0xa3ab66580d5fdaf6ULL, -555, -148 },
+		{ 0xf3e2f893dec3f126ULL, -529, -140 },
+		{ 0xb5b5ada8aaff80b8ULL, -502, -132 },
+		{ 0x87625f056c7c4a8bULL, -475, -124 },
+		{ 0xc9bcff6034c13053ULL, -449, -116 },
+		{ 0x964e858c91ba2655ULL, -422, -108 },
+		{ 0xdff9772470297ebdULL, -396, -100 },
+		{ 0xa6dfbd9fb8e5b88fULL, -369, -92 },
+		{ 0xf8a95fcf88747d94ULL, -343, -84 },
+		{ 0xb94470938fa89bcfULL, -316, -76 },
+		{ 0x8a08f0f8bf0f156bULL, -289, -68 },
+		{ 0xcdb02555653131b6ULL, -263, -60 },
+		{ 0x993fe2c6d07b7facULL, -236, -52 },
+		{ 0xe45c10c42a2b3b06ULL, -210, -44 },
+		{ 0xaa242499697392d3ULL, -183, -36 },
+		{ 0xfd87b5f28300ca0eULL, -157, -28 },
+		{ 0xbce5086492111aebULL, -130, -20 },
+		{ 0x8cbccc096f5088ccULL, -103, -12 },
+		{ 0xd1b71758e219652cULL, -77, -4 },
+		{ 0x9c40000000000000ULL, -50, 4 },
+		{ 0xe8d4a51000000000ULL, -24, 12 },
+		{ 0xad78ebc5ac620000ULL, 3, 20 },
+		{ 0x813f3978f8940984ULL, 30, 28 },
+		{ 0xc097ce7bc90715b3ULL, 56, 36 },
+		{ 0x8f7e32ce7bea5c70ULL, 83, 44 },
+		{ 0xd5d238a4abe98068ULL, 109, 52 },
+		{ 0x9f4f2726179a2245ULL, 136, 60 },
+		{ 0xed63a231d4c4fb27ULL, 162, 68 },
+		{ 0xb0de65388cc8ada8ULL, 189, 76 },
+		{ 0x83c7088e1aab65dbULL, 216, 84 },
+		{ 0xc45d1df942711d9aULL, 242, 92 },
+		{ 0x924d692ca61be758ULL, 269, 100 },
+		{ 0xda01ee641a708deaULL, 295, 108 },
+		{ 0xa26da3999aef774aULL, 322, 116 },
+		{ 0xf209787bb47d6b85ULL, 348, 124 },
+		{ 0xb454e4a179dd1877ULL, 375, 132 },
+		{ 0x865b86925b9bc5c2ULL, 402, 140 },
+		{ 0xc83553c5c8965d3dULL, 428, 148 },
+		{ 0x952ab45cfa97a0b3ULL, 455, 156 },
+		{ 0xde469fbd99a05fe3ULL, 481, 164 },
+		{ 0xa59bc234db398c25ULL, 508, 172 },
+		{ 0xf6c69a72a3989f5cULL, 534, 180 },
+		{ 0xb7dcbf5354e9beceULL, 561, 188 },
+		{ 0x88fcf317f22241e2ULL, 588, 196 },
+		{ 0xcc20ce9bd35c78a5ULL, 614, 204 },
+		{ 0x98165af37b2153dfULL, 641, 212 },
+		{ 0xe2a0b5dc971f303aULL, 667, 220 },
+		{ 0xa8d9d1535ce3b396ULL, 694, 228 },
+		{ 0xfb9b7cd9a4a7443cULL, 720, 236 },
+		{ 0xbb764c4ca7a44410ULL, 747, 244 },
+		{ 0x8bab8eefb6409c1aULL, 774, 252 },
+		{ 0xd01fef10a657842cULL, 800, 260 },
+		{ 0x9b10a4e5e9913129ULL, 827, 268 },
+		{ 0xe7109bfba19c0c9dULL, 853, 276 },
+		{ 0xac2820d9623bf429ULL, 880, 284 },
+		{ 0x80444b5e7aa7cf85ULL, 907, 292 },
+		{ 0xbf21e44003acdd2dULL, 933, 300 },
+		{ 0x8e679c2f5e44ff8fULL, 960, 308 },
+		{ 0xd433179d9c8cb841ULL, 986, 316 },
+		{ 0x9e19db92b4e31ba9ULL, 1013, 324 },
+		{ 0xeb96bf6ebadf77d9ULL, 1039, 332 },
+		{ 0xaf87023b9bf0ee6bULL, 1066, 340 }
+	};
+
+	/** The decimal exponent of the first cached power, negated.*/
+	static const int CACHED_POWERS_OFFSET = 348;
+
+	/** The difference of the decimal exponents of two consecutive cached powers.*/
+	static const int CACHED_POWERS_DECIMAL_DISTANCE = 8;
+
+	/** The binary exponent range the scaled value has to be in for the digit generation.*/
+	static const int MIN_TARGET_EXPONENT = -60;
+	static const int MAX_TARGET_EXPONENT = -32;
+
+
+	//--------------------------------------------------------------------
+	static inline DiyFp makeDiyFp( uint64_t f, int e )
+	{
+		DiyFp result;
+		result.f = f;
+		result.e = e;
+		return result;
+	}
+
+	//--------------------------------------------------------------------
+	/** Shifts the significand of @a x until its highest bit is set.*/
+	static inline DiyFp normalize( DiyFp x )
+	{
+#if defined(__GNUC__)
+		int shift = __builtin_clzll( x.f );
+		x.f <<= shift;
+		x.e -= shift;
+#else
+		while ( (x.f & 0xFFC0000000000000ULL) == 0 )
+		{
+			x.f <<= 10;
+			x.e -= 10;
+		}
+		while ( (x.f & 0x8000000000000000ULL) == 0 )
+		{
+			x.f <<= 1;
+			x.e -= 1;
+		}
+#endif
+		return x;
+	}
+
+	//--------------------------------------------------------------------
+	/** Returns the upper 64 bits of the product of the significands, rounded.*/
+	static inline DiyFp multiply( DiyFp x, DiyFp y )
+	{
+		const uint64_t M32 = 0xFFFFFFFFULL;
+		uint64_t a = x.f >> 32;
+		uint64_t b = x.f & M32;
+		uint64_t c = y.f >> 32;
+		uint64_t d = y.f & M32;
+		uint64_t ac = a * c;
+		uint64_t bc = b * c;
+		uint64_t ad = a * d;
+		uint64_t bd = b * d;
+		uint64_t tmp = (bd >> 32) + (ad & M32) + (bc & M32) + (1ULL << 31);
+		return makeDiyFp( ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.e + y.e + 64 );
+	}
+
+	//--------------------------------------------------------------------
+	/** Returns a cached power of ten c ~ 10^decimalExponent, such that the binary exponent of the product
+	of c with a number with binary exponent @a exponent lies in [MIN_TARGET_EXPONENT, MAX_TARGET_EXPONENT].*/
+	static inline DiyFp getCachedPower( int exponent, int& decimalExponent )
+	{
+		int minExponent = MIN_TARGET_EXPONENT - (exponent + 64);
+		int k = (int)ceil( (minExponent + 63) * 0.30102999566398114 );
+		int index = (CACHED_POWERS_OFFSET + k - 1) / CACHED_POWERS_DECIMAL_DISTANCE + 1;
+		const CachedPower& cachedPower = CACHED_POWERS[index];
+		decimalExponent = cachedPower.decimalExponent;
+		return makeDiyFp( cachedPower.significand, cachedPower.binaryExponent );
+	}
+
+	//--------------------------------------------------------------------
+	/** Moves the last digit of @a digits closer to the exact value, if possible. Returns false, if it
+	cannot be guaranteed that the result is the closest shortest representation.*/
+	static bool roundWeed( char* digits, int length, uint64_t distanceTooHighW, uint64_t unsafeInterval,
+		uint64_t rest, uint64_t tenKappa, uint64_t unit )
+	{
+		uint64_t smallDistance = distanceTooHighW - unit;
+		uint64_t bigDistance = distanceTooHighW + unit;
+
+		while ( (rest < smallDistance) && (unsafeInterval - rest >= tenKappa)
+			&& ((rest + tenKappa < smallDistance) || (smallDistance - rest >= rest + tenKappa - smallDistance)) )
+		{
+			digits[length - 1]--;
+			rest += tenKappa;
+		}
+
+		if ( (rest < bigDistance) && (unsafeInterval - rest >= tenKappa)
+			&& ((rest + tenKappa < bigDistance) || (bigDistance - rest > rest + tenKappa - bigDistance)) )
+		{
+			return false;
+		}
+
+		return (2 * unit <= rest) && (rest <= unsafeInterval - 4 * unit);
+	}
+
+	//--------------------------------------------------------------------
+	/** Generates the shortest digits of a number in the interval (@a low, @a high), that is closest to @a w.
+	All three numbers must have the same binary exponent in [MIN_TARGET_EXPONENT, MAX_TARGET_EXPONENT].*/
+	static bool generateDigits( DiyFp low, DiyFp w, DiyFp high, char* digits, int& length, int& kappa )
+	{
+		uint64_t unit = 1;
+		DiyFp tooLow = makeDiyFp( low.f - unit, low.e );
+		DiyFp tooHigh = makeDiyFp( high.f + unit, high.e );
+		uint64_t unsafeInterval = tooHigh.f - tooLow.f;
+		int shift = -w.e;
+		uint64_t one = 1ULL << shift;
+		uint32_t integrals = (uint32_t)(tooHigh.f >> shift);
+		uint64_t fractionals = tooHigh.f & (one - 1);
+
+		// the biggest power of ten less or equal to integrals
+		uint32_t divisor = 1;
+		kappa = 0;
+		if ( integrals != 0 )
+		{
+			kappa = 1;
+			while ( integrals / divisor >= 10 )
+			{
+				divisor *= 10;
+				kappa++;
+			}
+		}
+
+		length = 0;
+		while ( kappa > 0 )
+		{
+			digits[length++] = (char)('0' + integrals / divisor);
+			integrals %= divisor;
+			kappa--;
+			uint64_t rest = ((uint64_t)integrals << shift) + fractionals;
+			if ( rest < unsafeInterval )
+			{
+				return roundWeed( digits, length, tooHigh.f - w.f, unsafeInterval, rest, (uint64_t)divisor << shift, unit );
+			}
+			divisor /= 10;
+		}
+
+		for (;;)
+		{
+			fractionals *= 10;
+			unit *= 10;
+			unsafeInterval *= 10;
+			digits[length++] = (char)('0' + (fractionals >> shift));
+			fractionals &= one - 1;
+			kappa--;
+			if ( fractionals < unsafeInterval )
+			{
+				return roundWeed( digits, length, (tooHigh.f - w.f) * unit, unsafeInterval, fractionals, one, unit );
+			}
+		}
+	}
+
+	//--------------------------------------------------------------------
+	/** Generates the shortest digits of significand * 2^exponent with Grisu3. The number is represented by
+	digits * 10^decimalExponent. @a lowerBoundaryIsCloser must be true, if the significand is a power of
+	two and the next lower floating point number therefore closer than the next higher one.
+	@return False, if Grisu3 could not decide on the shortest representation.*/
+	static bool grisu3( uint64_t significand, int exponent, bool lowerBoundaryIsCloser, char* digits, int& length, int& decimalExponent )
+	{
+		DiyFp w = normalize( makeDiyFp(significand, exponent) );
+
+		// the boundaries between this number and its neighbors
+		DiyFp boundaryPlus = normalize( makeDiyFp((significand << 1) + 1, exponent - 1) );
+		DiyFp boundaryMinus;
+		if ( lowerBoundaryIsCloser )
+			boundaryMinus = makeDiyFp( (significand << 2) - 1, exponent - 2 );
+		else
+			boundaryMinus = makeDiyFp( (significand << 1) - 1, exponent - 1 );
+		boundaryMinus.f <<= boundaryMinus.e - boundaryPlus.e;
+		boundaryMinus.e = boundaryPlus.e;
+
+		int cachedDecimalExponent = 0;
+		DiyFp cachedPower = getCachedPower( w.e, cachedDecimalExponent );
+
+		int kappa = 0;
+		bool success = generateDigits( multiply(boundaryMinus, cachedPower), multiply(w, cachedPower),
+			multiply(boundaryPlus, cachedPower), digits, length, kappa );
+		decimalExponent = kappa - cachedDecimalExponent;
+		return success;
+	}
+
+	//--------------------------------------------------------------------
+	/** Extracts the digits and the decimal exponent from @a text, the output of printf with "%e".*/
+	static void parseExponentialNotation( const char* text, int precision, char* digits, int& length, int& decimalExponent )
+	{
+		digits[0] = text[0];
+		// skip the decimal point, which depends on the locale
+		memcpy( digits + 1, text + 2, precision - 1 );
+		length = precision;
+		const char* exponent = strchr( text, 'e' );
+		decimalExponent = atoi( exponent + 1 ) - (precision - 1);
+	}
+
+	//--------------------------------------------------------------------
+	/** Returns true, if @a text is read back as @a d.*/
+	static inline bool isReadBackAs( const char* text, double d )
+	{
+		return strtod( text, 0 ) == d;
+	}
+
+	//--------------------------------------------------------------------
+	/** Returns true, if @a text is read back as @a f.*/
+	static inline bool isReadBackAs( const char* text, float f )
+	{
+#if defined(_MSC_VER) && (_MSC_VER < 1800)
+		// no strtof before VS 2013
+		return (float)strtod( text, 0 ) == f;
+#else
+		return strtof( text, 0 ) == f;
+#endif
+	}
+
+	//--------------------------------------------------------------------
+	/** Generates the shortest digits of the positive number @a value, that are read back as @a value. Used
+	for the numbers Grisu3 cannot decide on. A correctly rounded representation with more digits than the
+	shortest one is read back correctly as well, so the precision can be searched binary.
+	@tparam maxDigits The number of significant digits that always suffice for @a FloatingPointType.*/
+	template<class FloatingPointType, int maxDigits>
+	static void exactShortestDigits( FloatingPointType value, char* digits, int& length, int& decimalExponent )
+	{
+		char text[RTOA_BUFFERSIZE + 10];
+		int minPrecision = 1;
+		int maxPrecision = maxDigits;
+		while ( minPrecision < maxPrecision )
+		{
+			int precision = (minPrecision + maxPrecision) / 2;
+			sprintf( text, "%.*e", precision - 1, (double)value );
+			if ( isReadBackAs(text, value) )
+				maxPrecision = precision;
+			else
+				minPrecision = precision + 1;
+		}
+		sprintf( text, "%.*e", maxPrecision - 1, (double)value );
+		parseExponentialNotation( text, maxPrecision, digits, length, decimalExponent );
+	}
+
+	//--------------------------------------------------------------------
+	/** Writes digits * 10^decimalExponent to @a buffer, in the notation used by ftoa and dtoa.*/
+	static int writeDigits( bool negative, const char* digits, int length, int decimalExponent, char* buffer )
+	{
+		char* p = buffer;
+		if ( negative )
+			*p++ = '-';
+
+		// the number is 0.digits * 10^decimalPointPosition
+		int decimalPointPosition = length + decimalExponent;
+
+		if ( (decimalPointPosition < MIN_DECIMAL_POINT_POSITION) || (decimalPointPosition > MAX_DECIMAL_POINT_POSITION) )
+		{
+			*p++ = digits[0];
+			if ( length > 1 )
+			{
+				*p++ = '.';
+				memcpy( p, digits + 1, length - 1 );
+				p += length - 1;
+			}
+			*p++ = 'e';
+			p += itoa( decimalPointPosition - 1, p, 10 );
+		}
+		else if ( decimalPointPosition <= 0 )
+		{
+			*p++ = '0';
+			*p++ = '.';
+			for ( int i = decimalPointPosition; i < 0; ++i )
+				*p++ = '0';
+			memcpy( p, digits, length );
+			p += length;
+		}
+		else if ( decimalPointPosition < length )
+		{
+			memcpy( p, digits, decimalPointPosition );
+			p += decimalPointPosition;
+			*p++ = '.';
+			memcpy( p, digits + decimalPointPosition, length - decimalPointPosition );
+			p += length - decimalPointPosition;
+		}
+		else
+		{
+			memcpy( p, digits, length );
+			p += length;
+			for ( int i = length; i < decimalPointPosition; ++i )
+				*p++ = '0';
+		}
+
+		*p = 0;
+		return (int)(p - buffer);
+	}
+
+	//--------------------------------------------------------------------
+	/** Writes the representation of zero, infinity and NaN to @a buffer. Returns 0 and writes nothing for all
+	other numbers.*/
+	static int writeSpecialValue( bool negative, bool exponentBitsSet, bool exponentBitsClear, bool significandClear, char* buffer )
+	{
+		char* p = buffer;
+		if ( exponentBitsSet && !significandClear )
+		{
+			memcpy( p, "NaN", 3 );
+			p += 3;
+		}
+		else if ( exponentBitsSet || (exponentBitsClear && significandClear) )
+		{
+			if ( negative )
+				*p++ = '-';
+			if ( exponentBitsSet )
+			{
+				memcpy( p, "INF", 3 );
+				p += 3;
+			}
+			else
+			{
+				*p++ = '0';
+			}
+		}
+		else
+		{
+			return 0;
+		}
+		*p = 0;
+		return (int)(p - buffer);
+	}
+
+	//--------------------------------------------------------------------
+	int ftoaShortest( float f, char* buffer )
+	{
+		ULF_t x;
+		x.F = f;
+		bool negative = (x.L >> 31) != 0;
+		uint32_t biasedExponent = (x.L >> 23) & 0xFF;
+		uint32_t fraction = x.L & 0x7FFFFF;
+
+		int bytesWritten = writeSpecialValue( negative, biasedExponent == 0xFF, biasedExponent == 0, fraction == 0, buffer );
+		if ( bytesWritten != 0 )
+			return bytesWritten;
+
+		uint64_t significand = fraction;
+		int exponent = -149;
+		if ( biasedExponent != 0 )
+		{
+			significand |= 0x800000;
+			exponent = (int)biasedExponent - 150;
+		}
+
+		char digits[MAX_DOUBLE_DIGITS + 1];
+		int length = 0;
+		int decimalExponent = 0;
+		if ( !grisu3(significand, exponent, (fraction == 0) && (biasedExponent > 1), digits, length, decimalExponent) )
+			exactShortestDigits<float, MAX_FLOAT_DIGITS>( negative ? -f : f, digits, length, decimalExponent );
+
+		return writeDigits( negative, digits, length, decimalExponent, buffer );
+	}
+
+	//--------------------------------------------------------------------
+	int dtoaShortest( double d, char* buffer )
+	{
+		ULD_t x;
+		x.D = d;
+		bool negative = (x.L >> 63) != 0;
+		uint64_t biasedExponent = (x.L >> 52) & 0x7FF;
+		uint64_t fraction = x.L & 0xFFFFFFFFFFFFFULL;
+
+		int bytesWritten = writeSpecialValue( negative, biasedExponent == 0x7FF, biasedExponent == 0, fraction == 0, buffer );
+		if ( bytesWritten != 0 )
+			return bytesWritten;
+
+		uint64_t significand = fraction;
+		int exponent = -1074;
+		if ( biasedExponent != 0 )
+		{
+			significand |= 0x10000000000000ULL;
+			exponent = (int)biasedExponent - 1075;
+		}
+
+		char digits[MAX_DOUBLE_DIGITS + 1];
+		int length = 0;
+		int decimalExponent = 0;
+		if ( !grisu3(significand, exponent, (fraction == 0) && (biasedExponent > 1), digits, length, decimalExponent) )
+			exactShortestDigits<double, MAX_DOUBLE_DIGITS>( negative ? -d : d, digits, length, decimalExponent );
+
+		return writeDigits( negative, digits, length, decimalExponent, buffer );
+	}
+
+}
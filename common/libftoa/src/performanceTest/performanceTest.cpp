@@ -2,8 +2,8 @@
     Copyright (c) 2009 NetAllied Systems GmbH
 
     This file is part of Common libftoa.
-	
-    Licensed under the MIT Open Source License, 
+
+    Licensed under the MIT Open Source License,
     for details please see LICENSE file or the website
     http://www.opensource.org/licenses/mit-license.php
 */
@@ -12,61 +12,92 @@
 
 #include "Commonftoa.h"
 #include "Commondtoa.h"
+#include "Commonrtoa.h"
 #include "math.h"
 
 #include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
 
 #include <sys/types.h>
-#include <sys/timeb.h> 
+#include <sys/timeb.h>
 
 
-void performanceTest()
-{
+static const size_t NUMBER_COUNT = 10000000;
 
-	std::string mLocale = setlocale(LC_NUMERIC, 0);
-	setlocale(LC_NUMERIC, "C");
+/** Converts a double to a string in @a buffer and returns the number of bytes written.*/
+typedef int (*DoubleConverter)(double d, char* buffer);
 
-	char testString[] = "01234";
+/** Converts a float to a string in @a buffer and returns the number of bytes written.*/
+typedef int (*FloatConverter)(float f, char* buffer);
 
-	float testFloat = 0;
-	double testDouble = 1.23456;
 
+static double getTime()
+{
 #pragma warning(disable: 4996)
-	_timeb startTimeBuffer;
-	_ftime( &startTimeBuffer );
-	double startTime = (double)startTimeBuffer.time + (double)startTimeBuffer.millitm / 1000;
-
+	_timeb timeBuffer;
+	_ftime( &timeBuffer );
+#pragma warning(default: 4996)
+	return (double)timeBuffer.time + (double)timeBuffer.millitm / 1000;
+}
 
-	char ftoaBuffer[Common::FTOA_BUFFERSIZE];
-	static float sum = 0 ;
-	static int sumi = 0;
+static int dtoaSinglePrecision(double d, char* buffer)
+{
+	return Common::dtoa(d, buffer, false);
+}
 
-	for ( size_t i= 0; i < 10000000 ; ++i)
-	{
+static int dtoaDoublePrecision(double d, char* buffer)
+{
+	return Common::dtoa(d, buffer, true);
+}
 
+static int sprintfRoundTrip(double d, char* buffer)
+{
+	return sprintf(buffer, "%.17g", d);
+}
 
-		int bytesWritten;
+template<class FloatingPointType, class Converter>
+static void measure(const FloatingPointType* numbers, Converter converter, const char* name)
+{
+	char buffer[Common::RTOA_BUFFERSIZE];
+	size_t bytesWritten = 0;
 
-//		bytesWritten=sprintf(ftoaBuffer, "%g", testFloat);
+	double startTime = getTime();
+	for ( size_t i= 0; i < NUMBER_COUNT ; ++i)
+	{
+		bytesWritten += converter(numbers[i], buffer);
+	}
+	double endTime = getTime();
 
-//		bytesWritten=sprintf(ftoaBuffer, "%.16f", testDouble);
+	std::cout << name << ": time elapsed: " << endTime - startTime << ", average length: " << (double)bytesWritten / NUMBER_COUNT << std::endl;
+}
 
-//		bytesWritten = Common::ftoa(testFloat, ftoaBuffer);
 
-		bytesWritten = Common::dtoa(testDouble, ftoaBuffer);
+void performanceTest()
+{
 
-		sumi += bytesWritten;
+	std::string mLocale = setlocale(LC_NUMERIC, 0);
+	setlocale(LC_NUMERIC, "C");
 
+	// numbers as typically found in geometry data
+	double* doubles = new double[NUMBER_COUNT];
+	float* floats = new float[NUMBER_COUNT];
+	srand(1);
+	for ( size_t i= 0; i < NUMBER_COUNT ; ++i)
+	{
+		doubles[i] = ((double)rand() / RAND_MAX - 0.5) * pow(10.0, rand() % 6 - 2);
+		floats[i] = (float)doubles[i];
 	}
 
+	measure(floats, (FloatConverter)&Common::ftoa, "ftoa");
+	measure(floats, (FloatConverter)&Common::ftoaShortest, "ftoaShortest");
+	measure(doubles, (DoubleConverter)&dtoaSinglePrecision, "dtoa");
+	measure(doubles, (DoubleConverter)&dtoaDoublePrecision, "dtoa double precision");
+	measure(doubles, (DoubleConverter)&Common::dtoaShortest, "dtoaShortest");
+	measure(doubles, (DoubleConverter)&sprintfRoundTrip, "sprintf %.17g");
 
-	setlocale(LC_NUMERIC, mLocale.c_str());
-	_timeb endTimeBuffer;
-	_ftime(&endTimeBuffer);
-#pragma warning(default: 4996)
-
-	double endTime = (double)endTimeBuffer.time + (double)endTimeBuffer.millitm / 1000;
-
-	std::cout << std::endl << "time elapsed: " << endTime - startTime << std::endl;
+	delete[] floats;
+	delete[] doubles;
 
-};
\ No newline at end of file
+	setlocale(LC_NUMERIC, mLocale.c_str());
+};
@@ -15,11 +15,14 @@
 #include "ftoaUnitTest.h"
 #include "dtoaUnitTest.h"
 #include "itoaUnitTest.h"
+#include "rtoaUnitTest.h"
 
 #include <stdio.h>
+#include <string.h>
 
 
-int main()
+/** Pass "exhaustive" to additionally check the round trip of all 2^32 floats.*/
+int main(int argc, char* argv[])
 {
 
 	unsigned long long i = 0xFFFFFFFFFFFFFFFF;
@@ -41,5 +44,10 @@ int main()
 
 	itoaUnitTest();
 
+	rtoaUnitTest();
+
+	if ( (argc > 1) && (strcmp(argv[1], "exhaustive") == 0) )
+		rtoaExhaustiveFloatTest();
+
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,152 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libftoa.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "rtoaUnitTest.h"
+
+#include "Commonrtoa.h"
+
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <string.h>
+
+static int errroCount = 0;
+
+
+char rtoaBuffer[Common::RTOA_BUFFERSIZE];
+
+
+static bool testFloat(float f, const char* expectedString)
+{
+	Common::ftoaShortest(f, rtoaBuffer);
+
+	if ( strcmp( rtoaBuffer, expectedString) == 0)
+	{
+		std::cout << "match                 " << f << ":           " << rtoaBuffer << std::endl;
+		return true;
+	}
+	else
+	{
+		std::cout << "      don't match     " << f << ":           " << rtoaBuffer << " and " <<  expectedString << std::endl;
+		errroCount++;
+		return false;
+	}
+}
+
+static bool testDouble(double d, const char* expectedString)
+{
+	Common::dtoaShortest(d, rtoaBuffer);
+
+	if ( strcmp( rtoaBuffer, expectedString) == 0)
+	{
+		std::cout << "match                 " << d << ":           " << rtoaBuffer << std::endl;
+		return true;
+	}
+	else
+	{
+		std::cout << "      don't match     " << d << ":           " << rtoaBuffer << " and " <<  expectedString << std::endl;
+		errroCount++;
+		return false;
+	}
+}
+
+/** Returns true, if the float read back from @a text has the same bit pattern as @a f.*/
+static bool isReadBackAs(const char* text, float f)
+{
+	float readBack = strtof(text, 0);
+	return memcmp(&readBack, &f, sizeof(float)) == 0;
+}
+
+bool rtoaUnitTest()
+{
+	std::cout << "rtoaUnitTest()" << std::endl;
+	std::cout << std::endl;
+
+	testFloat(std::numeric_limits<float>::infinity(),"INF");
+	testFloat(-std::numeric_limits<float>::infinity(),"-INF");
+	testFloat(std::numeric_limits<float>::quiet_NaN(),"NaN");
+	testFloat(0,                   "0");
+	testFloat(-0.0f,               "-0");
+	testFloat(1,                   "1");
+	testFloat(0.1f,                "0.1");
+	testFloat(0.3f,                "0.3");
+	testFloat(1.00001f,            "1.00001");
+	testFloat(1.00001e7f,          "1.00001e7");
+	testFloat(1.234567f,           "1.234567");
+	testFloat(123456,              "123456");
+	testFloat(1234567,             "1.234567e6");
+	testFloat(123456.789f,         "123456.79");
+	testFloat(0.001f,              "0.001");
+	testFloat(0.000098f,           "9.8e-5");
+	testFloat(16777216,            "1.6777216e7");
+	testFloat(std::numeric_limits<float>::max(),        "3.4028235e38");
+	testFloat(std::numeric_limits<float>::min(),        "1.1754944e-38");
+	testFloat(std::numeric_limits<float>::denorm_min(), "1e-45");
+
+	std::cout << std::endl;
+	std::cout << std::endl;
+
+	testDouble(std::numeric_limits<double>::infinity(),"INF");
+	testDouble(-std::numeric_limits<double>::infinity(),"-INF");
+	testDouble(0,                  "0");
+	testDouble(1,                  "1");
+	testDouble(-2.5,               "-2.5");
+	testDouble(0.1,                "0.1");
+	testDouble(0.3,                "0.3");
+	testDouble(0.1 + 0.2,          "0.30000000000000004");
+	testDouble(123.456,            "123.456");
+	testDouble(999999,             "999999");
+	testDouble(1000000,            "1e6");
+	testDouble(0.000999,           "9.99e-4");
+	testDouble(1e23,               "1e23");
+	testDouble(1.23456789012345678,"1.2345678901234567");
+	testDouble(9007199254740993.0, "9.007199254740992e15");
+	testDouble(std::numeric_limits<double>::max(),        "1.7976931348623157e308");
+	testDouble(std::numeric_limits<double>::min(),        "2.2250738585072014e-308");
+	testDouble(std::numeric_limits<double>::denorm_min(), "5e-324");
+
+	std::cout << std::endl;
+	std::cout << std::endl;
+
+	return errroCount == 0;
+}
+
+bool rtoaExhaustiveFloatTest()
+{
+	std::cout << "rtoaExhaustiveFloatTest()" << std::endl;
+	std::cout << std::endl;
+
+	size_t failureCount = 0;
+	unsigned int bits = 0;
+	do
+	{
+		float f;
+		memcpy(&f, &bits, sizeof(float));
+		if ( f == f )
+		{
+			Common::ftoaShortest(f, rtoaBuffer);
+			if ( !isReadBackAs(rtoaBuffer, f) )
+			{
+				if ( failureCount < 100 )
+					std::cout << "      no round trip   " << bits << ":           " << rtoaBuffer << std::endl;
+				failureCount++;
+			}
+		}
+
+		if ( (bits & 0xFFFFFFF) == 0 )
+			std::cout << (bits >> 28) << "/16" << std::endl;
+	}
+	while ( ++bits != 0 );
+
+	std::cout << failureCount << " floats not read back correctly" << std::endl;
+	std::cout << std::endl;
+
+	return failureCount == 0;
+}
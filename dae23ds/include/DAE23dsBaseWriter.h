@@ -68,13 +68,12 @@ namespace DAE23ds
 
 		Common::Buffer& getBuffer() { return mWriter->getBuffer(); }
 
-		/** The chunk length of all object block and material blocks.*/
-		ChunkLength getObjectAndMaterialBlockLength() const { return mWriter->getObjectAndMaterialBlockLength(); }
+		/** Writes the header of a chunk with id @a chunkId and a placeholder length. After the content of the 
+		chunk has been written, closeChunk() must be called.*/
+		Writer::OpenedChunk openChunk( ChunkID chunkId ) { return mWriter->openChunk(chunkId); }
 
-		/** The chunk length of all object block and material blocks.*/
-		void setObjectAndMaterialBlockLength(ChunkLength val) { mWriter->setObjectAndMaterialBlockLength(val); }
-
-		void addToObjectAndMaterialBlockLength(ChunkLength val);
+		/** Sets the length of @a chunk to the number of bytes written since it has been opened.*/
+		void closeChunk( const Writer::OpenedChunk& chunk ) { mWriter->closeChunk(chunk); }
 
 		void addMeshData( const Writer::MeshData& meshData );
 
@@ -47,7 +47,7 @@ namespace DAE23ds
 		void setBit( size_t n, bool value);
 
 		/** Returns the n'th bit. No check is performed if n is in [0...bitCount]*/
-		bool setBit( size_t n);
+		bool getBit( size_t n) const;
 
 	private:
 
@@ -24,28 +24,8 @@ namespace DAE23ds
 	class MeshBase : public BaseWriter
 	{
 	protected:
-		/** Used */
-		struct ObjectBlockData
-		{
-			//			ChunkLength verticesCount;	
-			CountType trianglesCount;
-			size_t firstTriangleIndex;
-		};
-
-		struct WriteMeshIntoMultipleObjectsData
-		{
-			ChunkLength editObjectLength;
-			ChunkLength fullBlocksCount;
-			ChunkLength remainingTriangles;
-		};
-
-
 		struct WriteMeshIntoOneObject
 		{
-			ChunkLength editObjectLength;
-			ChunkLength triangularMeshLength;
-			ChunkLength verticesLength;
-			ChunkLength facesDescriptionLength;
 			CountType trianglesCount;
 		};
 
@@ -68,8 +48,6 @@ namespace DAE23ds
 
 		/** handles the mesh.*/
 		bool handle();
-
-		static void calculateBlockCountAndRemainingTriangles( size_t trianglesCount, ChunkLength& remainingTriangles, ChunkLength& blockCount, ChunkLength& fullBlockCount);
 	
 	private:
 
@@ -90,7 +68,7 @@ namespace DAE23ds
 
 
 		/** Writes the mesh using @a materialBindings to assign materials.*/
-		virtual bool writeMeshIntoMultipleObjects( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const WriteMeshIntoMultipleObjectsData& data, const COLLADAFW::InstanceGeometry* alreadyUsingInstance) = 0;
+		virtual bool writeMeshIntoMultipleObjects( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const COLLADAFW::InstanceGeometry* alreadyUsingInstance) = 0;
 
 		/** Writes the mesh using @a materialBindings to assign materials.*/
 		virtual bool writeMeshIntoOneObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const WriteMeshIntoOneObject& data, const COLLADAFW::InstanceGeometry* alreadyUsingInstance) = 0;
@@ -106,30 +84,12 @@ namespace DAE23ds
 		/** Calculates the length of the vertices for a mesh with  (verticesCount_times3 / 3) vertices.*/
 		ChunkLength calculateVerticesLength(ChunkLength verticesCount_times3);
 
-		/** Calculates the length of all the vertices of the current mesh, if written into multiple objects.*/
-		ChunkLength calculateTotalVerticesLengthMultiObject(size_t trianglesCount, ChunkLength blockCount );
-
-		/** Calculates the length of the object of the current mesh given the length of the triangular mesh.*/
-		ChunkLength calculateObjectLength(ChunkLength triangularMeshLength);
-
-		/** Calculates the length of all the object of the current mesh given the length of the triangular mesh.*/
-		ChunkLength calculateTotalObjectLengthMultiObject(ChunkLength triangularMeshLength, ChunkLength blockCount);
-
 		/** Calculates the number of triangles in the mesh.*/
 		size_t calculateTrianglesCount();
 
 		/** Calculates the length including null termination of all materials names.*/
 //		ChunkLength calculateMaterialNamesLength( const COLLADAFW::MaterialBindingArray& materialBindings);
 
-		/** Calculates the length of all material faces.*/
-		ChunkLength calculateFacesMaterialsLength(CountType trianglesCount, const COLLADAFW::MaterialBindingArray& materialBindings);
-
-		/** Calculates the length of the faces description, given the number of triangles.*/
-		ChunkLength calculateFacesDescriptionLength(CountType trianglesCount, ChunkLength facesMaterialsLength);
-
-		/** Calculates the length of the faces description, given the number of triangles and blocks. The calculated size is for all object blocks.*/
-		ChunkLength calculateFacesDescriptionLengthMultiObject(size_t trianglesCount, ChunkLength blockCount, ChunkLength facesMaterialsLength, ChunkLength remainderFacesMaterialsLength, ChunkLength fullBlocksCount);
-
 		bool splitMeshInChunks();
 		
 //		ChunkLength calculateMaterialNameLengthFromMaterialBinding( const COLLADAFW::InstanceGeometry::MaterialBinding& materialBinding);
@@ -13,15 +13,28 @@
 
 #include "DAE23dsPrerequisites.h"
 #include "DAE23dsBitSet.h"
+#include "DAE23dsTriangle.h"
 
-namespace COLLADAFW
-{
-	class Mesh;
-}
+#include <vector>
 
 namespace DAE23ds
 {
 
+	/** Splits a mesh into blocks, that do not exceed a maximal number of vertices and triangles, e.g. the
+	16 bit indices of 3ds objects.
+	Each block is grown from a seed triangle across the shared vertices of its triangles, i.e. breadth first
+	over the vertex neighborhoods, until it is full. The blocks are therefore compact patches of the
+	surface and only the vertices on their borders need to be duplicated. The next block is seeded at
+	the border of the previous one, such that the remaining triangles are not fragmented.
+	The vertices of a block are numbered in the order they are used first and the triangles are passed
+	in the order they have been added, i.e. fan by fan around the vertices. Triangles close in the
+	index list therefore reference vertices close in the vertex list.
+	The triangle handler must provide:
+	- void handleNewBlock( const AccessorIndexType* vertexIndices, size_t verticesCount, size_t trianglesCount )
+	  @a vertexIndices maps the vertex indices of the block to the vertex indices of the mesh
+	- void handleTriangle( const HandlerTriangle& triangle ) with the vertex indices of the block
+	- void handleEndBlock()
+	*/
 	template<class MeshAccessor, class _AccessorIndexType, class TriangleHandler, class _HandlerIndexType>
 	class MeshSpliter 	
 	{
@@ -31,6 +44,13 @@ namespace DAE23ds
 
 		typedef Triangle<AccessorIndexType> AccessorTriangle; 
 		typedef Triangle<HandlerIndexType> HandlerTriangle; 
+
+	private:
+		typedef std::vector<AccessorTriangle> AccessorTriangleList;
+		typedef std::vector<AccessorIndexType> AccessorIndexList;
+		typedef std::vector<HandlerIndexType> HandlerIndexList;
+		typedef std::vector<size_t> SizeList;
+
 	private:
 
 		/** The mesh accessor of the mesh to split. */
@@ -47,10 +67,51 @@ namespace DAE23ds
 
 		/** Maximal number of tringles per block.*/
 		size_t mMaxTrianglesPerBlock;
+
+		/** Maximal number of vertices per block.*/
+		size_t mMaxVerticesPerBlock;
+
+		/** The triangles of the mesh.*/
+		AccessorTriangleList mTriangles;
+
+		/** The triangles adjacent to vertex i are mVertexTriangles[mFirstVertexTriangle[i]] to
+		mVertexTriangles[mFirstVertexTriangle[i+1]-1].*/
+		SizeList mFirstVertexTriangle;
+
+		/** The indices of the triangles adjacent to the vertices.*/
+		SizeList mVertexTriangles;
+
+		/** The number of the block, the vertex has been added to last, 0 if it has not been added to a block yet.*/
+		SizeList mVertexBlock;
+
+		/** The index of the vertex within the block it has been added to last.*/
+		HandlerIndexList mVertexBlockIndex;
+
+		/** The vertices of the current block, in the order they have been added. Also used as queue of
+		the vertices whose neighborhoods still need to be visited.*/
+		AccessorIndexList mBlockVertices;
+
+		/** The triangles of the current block, in the order they have been added.*/
+		SizeList mBlockTriangles;
+
+		/** The number of the current block. Blocks are numbered starting at 1.*/
+		size_t mBlockNumber;
+
+		/** The index in mBlockVertices of the next vertex, whose neighborhood needs to be visited.*/
+		size_t mNextBlockVertex;
+
+		/** A triangle, that did not fit into the previous block, or mTrianglesCount. Used as seed of the
+		next block, if it has not been handled meanwhile.*/
+		size_t mBorderTriangle;
+
+		/** All triangles with a lower index have been handled.*/
+		size_t mFirstUnhandledTriangle;
 	
 	public:
-        /** Constructor. */
-		MeshSpliter( const MeshAccessor& meshAccessor, TriangleHandler& triangleHandler);
+        /** Constructor. 
+		@param maxVerticesPerBlock The maximal number of vertices per block. Must be at least 3.
+		@param maxTrianglesPerBlock The maximal number of triangles per block. Must be at least 1.*/
+		MeshSpliter( const MeshAccessor& meshAccessor, TriangleHandler& triangleHandler, size_t maxVerticesPerBlock, size_t maxTrianglesPerBlock);
 
         /** Destructor. */
 		virtual ~MeshSpliter();
@@ -58,9 +119,6 @@ namespace DAE23ds
 		/** Performances the splitting of the mesh.*/
 		bool split();
 
-		/** Performances the splitting of the mesh.*/
-		bool splitTest();
-
 	private:
 
         /** Disable default copy ctor. */
@@ -69,6 +127,26 @@ namespace DAE23ds
         /** Disable default assignment operator. */
 		const MeshSpliter& operator= ( const MeshSpliter& pre );
 
+		/** Reads the triangles of the mesh and determines the triangles adjacent to each vertex.*/
+		void createAdjacency();
+
+		/** Adds the triangles adjacent to the vertices of the current block, until the block is full or
+		all of them have been visited.
+		@return False, if the block is full, true otherwise.*/
+		bool growBlock();
+
+		/** Adds the triangle @a triangleIndex to the current block, if the block does not exceed the 
+		maximal number of vertices and triangles afterwards.
+		@return True, if the triangle has been added, false otherwise.*/
+		bool addTriangle( size_t triangleIndex );
+
+		/** Returns the triangle the next block should be grown from, or mTrianglesCount, if all triangles
+		have been handled.*/
+		size_t findSeedTriangle();
+
+		/** Passes the current block to the triangle handler.*/
+		void handleBlock();
+
 	};
 
 } // namespace DAE23ds
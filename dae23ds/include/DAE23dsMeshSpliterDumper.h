@@ -40,9 +40,11 @@ namespace DAE23ds
         /** Destructor. */
 		virtual ~MeshSpliterDumper();
 
+		void handleNewBlock( const unsigned int* vertexIndices, size_t verticesCount, size_t trianglesCount );
+
 		void handleTriangle( const TriangleType& triangle);
 
-		void handleNewBlock();
+		void handleEndBlock();
 
 	private:
 
@@ -19,13 +19,20 @@ namespace DAE23ds
 
 	//------------------------------
 	template<class MeshAccessor, class _AccessorIndexType, class TriangleHandler, class _HandlerIndexType>
-	MeshSpliter<MeshAccessor, _AccessorIndexType, TriangleHandler, _HandlerIndexType>::MeshSpliter( const MeshAccessor& meshAccessor, TriangleHandler& triangleHandler)
+	MeshSpliter<MeshAccessor, _AccessorIndexType, TriangleHandler, _HandlerIndexType>::MeshSpliter( const MeshAccessor& meshAccessor, TriangleHandler& triangleHandler, size_t maxVerticesPerBlock, size_t maxTrianglesPerBlock)
 		: mMeshAccessor(meshAccessor)
 		, mTriangleHandler(triangleHandler)
-		, mTrianglesCount( mMeshAccessor.getTrianglesCount())
+		, mTrianglesCount( (AccessorIndexType)mMeshAccessor.getTrianglesCount())
 		, mHandledTriangles( mTrianglesCount, false )
+		, mMaxTrianglesPerBlock(maxTrianglesPerBlock)
+		, mMaxVerticesPerBlock(maxVerticesPerBlock)
+		, mBlockNumber(0)
+		, mNextBlockVertex(0)
+		, mBorderTriangle(mTrianglesCount)
+		, mFirstUnhandledTriangle(0)
 	{
-
+		assert( maxVerticesPerBlock >= 3 );
+		assert( maxTrianglesPerBlock >= 1 );
 	}
 
 
@@ -39,25 +46,115 @@ namespace DAE23ds
 	//------------------------------
 	template<class MeshAccessor, class _AccessorIndexType, class TriangleHandler, class _HandlerIndexType>
 	bool 
-		DAE23ds::MeshSpliter<MeshAccessor, _AccessorIndexType, TriangleHandler, _HandlerIndexType>::splitTest()
+		DAE23ds::MeshSpliter<MeshAccessor, _AccessorIndexType, TriangleHandler, _HandlerIndexType>::split()
 	{
+		createAdjacency();
+
+		for ( ;; )
+		{
+			size_t seedTriangle = findSeedTriangle();
+			if ( seedTriangle == mTrianglesCount )
+			{
+				// all triangles have been handled
+				break;
+			}
+
+			mBlockNumber++;
+			mBlockVertices.clear();
+			mBlockTriangles.clear();
+			mNextBlockVertex = 0;
+			mBorderTriangle = mTrianglesCount;
+
+			// a single triangle always fits into an empty block
+			addTriangle( seedTriangle );
+
+			while ( growBlock() )
+			{
+				// all triangles connected to the block have been added, but the block is not full yet.
+				// Continue with the next part of the mesh.
+				seedTriangle = findSeedTriangle();
+				if ( (seedTriangle == mTrianglesCount) || !addTriangle( seedTriangle ) )
+					break;
+			}
+
+			handleBlock();
+		}
+
+		return true;
+	}
+
+	//------------------------------
+	template<class MeshAccessor, class _AccessorIndexType, class TriangleHandler, class _HandlerIndexType>
+	void 
+		DAE23ds::MeshSpliter<MeshAccessor, _AccessorIndexType, TriangleHandler, _HandlerIndexType>::createAdjacency()
+	{
+		if ( mTrianglesCount == 0 )
+			return;
+
+		// read the triangles once, the accessor is efficient only for sequential access
+		mTriangles.reserve( mTrianglesCount );
+		size_t verticesCount = 0;
+		for ( AccessorIndexType i = 0; i < mTrianglesCount; ++i)
+		{
+			typename MeshAccessor::TriangleType triangle = (i == 0) ? mMeshAccessor.getTriangle( 0 ) : mMeshAccessor.getNextTriangle();
+			mTriangles.push_back( AccessorTriangle( (AccessorIndexType)triangle.indices[0], 
+				                                    (AccessorIndexType)triangle.indices[1], 
+				                                    (AccessorIndexType)triangle.indices[2], 
+				                                    triangle.materialId ) );
+			for ( size_t k = 0; k < 3; ++k )
+			{
+				if ( (size_t)triangle.indices[k] >= verticesCount )
+					verticesCount = (size_t)triangle.indices[k] + 1;
+			}
+		}
 
-		//testing
-		AccessorIndexType count = mMeshAccessor.getTrianglesCount();
-		AccessorTriangle triAccessor = mMeshAccessor.getTriangle( 0 );
-		HandlerTriangle triHandler((HandlerIndexType)triAccessor.indices[0], 
-			(HandlerIndexType)triAccessor.indices[1], 
-			(HandlerIndexType)triAccessor.indices[2]);
-		mTriangleHandler.handleTriangle(triHandler);
+		// count the triangles per vertex
+		mFirstVertexTriangle.assign( verticesCount + 1, 0 );
+		for ( size_t i = 0; i < mTrianglesCount; ++i)
+		{
+			const AccessorTriangle& triangle = mTriangles[i];
+			mFirstVertexTriangle[triangle.indices[0] + 1]++;
+			mFirstVertexTriangle[triangle.indices[1] + 1]++;
+			mFirstVertexTriangle[triangle.indices[2] + 1]++;
+		}
+		for ( size_t i = 1; i <= verticesCount; ++i)
+		{
+			mFirstVertexTriangle[i] += mFirstVertexTriangle[i - 1];
+		}
 
+		// fill the triangles of each vertex
+		mVertexTriangles.resize( 3 * (size_t)mTrianglesCount );
+		SizeList nextVertexTriangle( mFirstVertexTriangle.begin(), mFirstVertexTriangle.end() - 1 );
+		for ( size_t i = 0; i < mTrianglesCount; ++i)
+		{
+			const AccessorTriangle& triangle = mTriangles[i];
+			mVertexTriangles[nextVertexTriangle[triangle.indices[0]]++] = i;
+			mVertexTriangles[nextVertexTriangle[triangle.indices[1]]++] = i;
+			mVertexTriangles[nextVertexTriangle[triangle.indices[2]]++] = i;
+		}
+
+		mVertexBlock.assign( verticesCount, 0 );
+		mVertexBlockIndex.resize( verticesCount );
+	}
 
-		for ( AccessorIndexType i = 1; i < count; ++i)
+	//------------------------------
+	template<class MeshAccessor, class _AccessorIndexType, class TriangleHandler, class _HandlerIndexType>
+	bool 
+		DAE23ds::MeshSpliter<MeshAccessor, _AccessorIndexType, TriangleHandler, _HandlerIndexType>::growBlock()
+	{
+		// mBlockVertices grows while we iterate. This visits the neighborhoods breadth first.
+		while ( mNextBlockVertex < mBlockVertices.size() )
 		{
-			AccessorTriangle triAccessor = mMeshAccessor.getNextTriangle( );
-			HandlerTriangle triHandler((HandlerIndexType)triAccessor.indices[0], 
-				(HandlerIndexType)triAccessor.indices[1], 
-				(HandlerIndexType)triAccessor.indices[2]);
-			mTriangleHandler.handleTriangle(triHandler);
+			AccessorIndexType vertex = mBlockVertices[mNextBlockVertex++];
+			for ( size_t i = mFirstVertexTriangle[vertex], last = mFirstVertexTriangle[vertex + 1]; i < last; ++i)
+			{
+				size_t triangleIndex = mVertexTriangles[i];
+				if ( mHandledTriangles.getBit( triangleIndex ) )
+					continue;
+
+				if ( !addTriangle( triangleIndex ) && (mBlockTriangles.size() >= mMaxTrianglesPerBlock) )
+					return false;
+			}
 		}
 		return true;
 	}
@@ -65,13 +162,82 @@ namespace DAE23ds
 	//------------------------------
 	template<class MeshAccessor, class _AccessorIndexType, class TriangleHandler, class _HandlerIndexType>
 	bool 
-		DAE23ds::MeshSpliter<MeshAccessor, _AccessorIndexType, TriangleHandler, _HandlerIndexType>::split()
+		DAE23ds::MeshSpliter<MeshAccessor, _AccessorIndexType, TriangleHandler, _HandlerIndexType>::addTriangle( size_t triangleIndex )
 	{
+		const AccessorTriangle& triangle = mTriangles[triangleIndex];
 
+		// count the vertices not yet in the block. A degenerated triangle may contain a vertex twice.
+		size_t newVerticesCount = 0;
+		for ( size_t k = 0; k < 3; ++k )
+		{
+			AccessorIndexType vertex = triangle.indices[k];
+			if ( mVertexBlock[vertex] == mBlockNumber )
+				continue;
+			if ( (k > 0) && (vertex == triangle.indices[0]) )
+				continue;
+			if ( (k > 1) && (vertex == triangle.indices[1]) )
+				continue;
+			newVerticesCount++;
+		}
+
+		if ( (mBlockTriangles.size() >= mMaxTrianglesPerBlock) || (mBlockVertices.size() + newVerticesCount > mMaxVerticesPerBlock) )
+		{
+			// the triangle is on the border of the block. Remember it to start the next block there.
+			if ( mBorderTriangle == mTrianglesCount )
+				mBorderTriangle = triangleIndex;
+			return false;
+		}
 
+		for ( size_t k = 0; k < 3; ++k )
+		{
+			AccessorIndexType vertex = triangle.indices[k];
+			if ( mVertexBlock[vertex] != mBlockNumber )
+			{
+				mVertexBlock[vertex] = mBlockNumber;
+				mVertexBlockIndex[vertex] = (HandlerIndexType)mBlockVertices.size();
+				mBlockVertices.push_back( vertex );
+			}
+		}
+
+		mHandledTriangles.setBit( triangleIndex, true );
+		mBlockTriangles.push_back( triangleIndex );
 		return true;
 	}
 
+	//------------------------------
+	template<class MeshAccessor, class _AccessorIndexType, class TriangleHandler, class _HandlerIndexType>
+	size_t 
+		DAE23ds::MeshSpliter<MeshAccessor, _AccessorIndexType, TriangleHandler, _HandlerIndexType>::findSeedTriangle()
+	{
+		if ( (mBorderTriangle < mTrianglesCount) && !mHandledTriangles.getBit( mBorderTriangle ) )
+			return mBorderTriangle;
+
+		while ( (mFirstUnhandledTriangle < mTrianglesCount) && mHandledTriangles.getBit( mFirstUnhandledTriangle ) )
+			mFirstUnhandledTriangle++;
+
+		return mFirstUnhandledTriangle;
+	}
+
+	//------------------------------
+	template<class MeshAccessor, class _AccessorIndexType, class TriangleHandler, class _HandlerIndexType>
+	void 
+		DAE23ds::MeshSpliter<MeshAccessor, _AccessorIndexType, TriangleHandler, _HandlerIndexType>::handleBlock()
+	{
+		mTriangleHandler.handleNewBlock( &mBlockVertices[0], mBlockVertices.size(), mBlockTriangles.size() );
+
+		for ( size_t i = 0, count = mBlockTriangles.size(); i < count; ++i)
+		{
+			const AccessorTriangle& triangle = mTriangles[mBlockTriangles[i]];
+			HandlerTriangle handlerTriangle( mVertexBlockIndex[triangle.indices[0]], 
+				                             mVertexBlockIndex[triangle.indices[1]], 
+				                             mVertexBlockIndex[triangle.indices[2]], 
+				                             triangle.materialId );
+			mTriangleHandler.handleTriangle( handlerTriangle );
+		}
+
+		mTriangleHandler.handleEndBlock();
+	}
+
 
 } // namespace DAE23ds
 
@@ -27,14 +27,28 @@ namespace DAE23ds
 
 	class MeshWriter : public MeshBase
 	{
+	public:
+		typedef Triangle<IndexType> TriangleType;
+
+	private:
+		typedef std::vector<COLLADAFW::MaterialId> MaterialIdList;
+
 	private:
 
 		const COLLADAFW::Mesh* mMesh;
 
 		Common::Buffer& mBuffer;
 
-		// material ids of the triangles in the last block written
-		COLLADAFW::MaterialId mMaterialIds[MAX_TRIANGLES_PER_BLOCK];
+		// material ids of the triangles in the block currently written
+		MaterialIdList mBlockMaterialIds;
+
+		/** The instance the block currently written belongs to.*/
+		const Writer::InstanceGeometryInfo* mBlockInstanceGeometryInfo;
+
+		/** The chunks of the block currently written.*/
+		Writer::OpenedChunk mBlockEditObjectChunk;
+		Writer::OpenedChunk mBlockTriangularMeshChunk;
+		Writer::OpenedChunk mBlockFacesDescriptionChunk;
 
 		MeshAccessor mMeshAccessor;
 
@@ -56,32 +70,32 @@ namespace DAE23ds
 		bool writeMeshIntoOneObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const WriteMeshIntoOneObject& data, const COLLADAFW::InstanceGeometry* alreadyUsingInstance);
 
 		/** Writes the mesh using @a materialBindings to assign materials.*/
-		bool writeMeshIntoMultipleObjects( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const WriteMeshIntoMultipleObjectsData& data, const COLLADAFW::InstanceGeometry* alreadyUsingInstance);
+		bool writeMeshIntoMultipleObjects( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const COLLADAFW::InstanceGeometry* alreadyUsingInstance);
 
-		/** Writes the mesh using @a materialBindings to assign materials.*/
-		bool writeMeshIntoObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo);
+		/** Called by the mesh spliter. Starts an object for a block with @a verticesCount vertices and
+		@a trianglesCount triangles and writes the vertices of the mesh listed in @a vertexIndices.*/
+		void handleNewBlock( const unsigned int* vertexIndices, size_t verticesCount, size_t trianglesCount );
+
+		/** Called by the mesh spliter. Writes @a triangle, that references the vertices of the block.*/
+		void handleTriangle( const TriangleType& triangle );
 
-		/** Writes the mesh using @a materialBindings to assign materials and data provided in @a blockData.*/
-		bool writeMeshIntoObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const ObjectBlockData& blockData);
+		/** Called by the mesh spliter. Writes the face materials and finishes the object of the block.*/
+		void handleEndBlock();
 
 		/** Writes the vertices/position as floats into @a buffer.*/
 		bool writeVertices(const COLLADABU::Math::Matrix4& worldMatrix);
 
-		/** Writes the positions for @a trianglesCount triangles, starting at @a firstTriangleIndex.*/
-		bool writeVerticesForMultipleObjects(size_t firstTriangleIndex, CountType trianglesCount, const COLLADABU::Math::Matrix4& worldMatrix);
+		/** Writes the positions of the @a verticesCount vertices listed in @a vertexIndices.*/
+		bool writeVerticesForMultipleObjects(const unsigned int* vertexIndices, size_t verticesCount, const COLLADABU::Math::Matrix4& worldMatrix);
 
 		/** Writes all the triangles/fans/strips into @a buffer.*/
 		bool writeTriangles();
 
-
-		/** Writes the numbers 0...@a trianglesCount into @a buffer.*/
-		bool writeTrianglesForMultipleObjects(CountType trianglesCount);
-
 		/** writes the faces materials.*/
 		bool writeFaceMaterials(const COLLADAFW::MaterialBindingArray& materialBindings);
 
 		/** */
-		bool writeFaceMaterialsForMultipleObjects(const COLLADAFW::MaterialBindingArray& materialBindings, const ObjectBlockData& blockData);
+		bool writeFaceMaterialsForMultipleObjects(const COLLADAFW::MaterialBindingArray& materialBindings);
 
 		/** Writes the mesh matrix of the tri object.*/
 		bool writeMeshMatrix(const COLLADABU::Math::Matrix4& worldMatrix);
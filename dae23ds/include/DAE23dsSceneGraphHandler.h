@@ -34,8 +34,6 @@ namespace DAE23ds
 		NodeInfoStack mNodeInfoStack;
 		Writer::UniqueIdNodeMap& mUniqueIdNodeMap;
 
-		ChunkLength mSceneGraphLength;
-
 	public:
 
 		SceneGraphHandler( Writer* writer3ds, const COLLADAFW::VisualScene* visualScene, const Writer::LibraryNodesList& libraryNodesList );
@@ -44,8 +42,6 @@ namespace DAE23ds
 
 		bool handle();
 
-		ChunkLength getScenegraphLength() const { return mSceneGraphLength; }
-
 
 	private:
 
@@ -62,8 +58,6 @@ namespace DAE23ds
 		void handleInstanceGeometries( const COLLADAFW::Node* node, const COLLADABU::Math::Matrix4& matrix );
 
 		void handleInstanceNodes( const COLLADAFW::InstanceNodePointerArray& instanceNodes);
-
-		void addNodeLength( ChunkLength objectRefLength, ChunkLength factor , const COLLADABU::Math::Matrix4& matrix);
 	};
 
 } // namespace DAE23DS
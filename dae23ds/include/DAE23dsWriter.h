@@ -25,9 +25,12 @@
 #include "COLLADABUURI.h"
 #include "Math/COLLADABUMathMatrix4.h"
 
+#include "CommonIBufferFlusher.h"
+
 #include <stack>
 #include <list>
 #include <map>
+#include <vector>
 
 
 namespace Common
@@ -58,8 +61,6 @@ namespace DAE23ds
 	static const IndexType MAX_INDEX_COUNT = 65535;
 //	static const IndexType MAX_INDEX_COUNT = 5;
 
-	static const IndexType MAX_TRIANGLES_PER_BLOCK = MAX_INDEX_COUNT/3;
-
 	// the flags used for faces
 	static const CountType FACES_FLAGS = 6;
 
@@ -180,14 +181,17 @@ namespace DAE23ds
 
 		typedef std::map<InstanceGeometryIdentifier, ObjectIdList> InstanceGeometryObjectIdMap;
 
-		/** Maps unique ids of framework materials to the corresponding framework material.*/
-		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Material> UniqueIdFWMaterialMap;
+		/** Maps unique ids of framework materials to the corresponding framework material. The materials are
+		owned by the writer.*/
+		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Material*> UniqueIdFWMaterialMap;
 
-		/** Maps unique ids of framework images to the corresponding framework image.*/
-		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Image> UniqueIdFWImageMap;
+		/** Maps unique ids of framework images to the corresponding framework image. The images are owned by
+		the writer.*/
+		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Image*> UniqueIdFWImageMap;
 
-		/** Maps unique ids of framework effects to the corresponding framework material.*/
-		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Effect> UniqueIdFWEffectMap;
+		/** Maps unique ids of framework effects to the corresponding framework material. The effects are owned
+		by the writer.*/
+		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Effect*> UniqueIdFWEffectMap;
 
 		enum Severity
 		{
@@ -210,6 +214,25 @@ namespace DAE23ds
 
 		typedef std::map< COLLADAFW::UniqueId, MaterialNumber> UniqueMaterialNumberMap;
 
+		/** A chunk whose header has been written with a placeholder length, see openChunk().*/
+		struct OpenedChunk
+		{
+			/** Marks the position of the length in the chunk header.*/
+			Common::IBufferFlusher::MarkId lengthMarkId;
+
+			/** The number of bytes written before the chunk header.*/
+			size_t chunkStart;
+		};
+
+		/** The length of a closed chunk, that still needs to be written into its header.*/
+		struct ChunkLengthPatch
+		{
+			Common::IBufferFlusher::MarkId lengthMarkId;
+			ChunkLength length;
+		};
+
+		typedef std::vector<ChunkLengthPatch> ChunkLengthPatchList;
+
 	private:
 		COLLADABU::URI mInputFile;
 		COLLADABU::URI mOutputFile;
@@ -243,8 +266,8 @@ namespace DAE23ds
 		UniqueIdFWImageMap mUniqueIdFWImageMap;
 		UniqueIdFWEffectMap mUniqueIdFWEffectMap;
 
-		/** The chunk length of all object block and material blocks.*/
-		ChunkLength mObjectAndMaterialBlockLength;
+		/** The lengths of all closed chunks, that have not been written into their headers yet.*/
+		ChunkLengthPatchList mChunkLengthPatches;
 
 		/** The mesh data of all the meshes parsed at the first run.*/
 		MeshDataMap mMeshDataMap;
@@ -304,10 +327,18 @@ namespace DAE23ds
 		@return True on succeeded, false otherwise.*/
 		virtual bool writeMaterial( const COLLADAFW::Material* material );
 
+		/** Keeps the material without copying it.
+		@return True on succeeded, false otherwise.*/
+		virtual bool adoptMaterial( COLLADAFW::Material* material );
+
 		/** Writes the effect.
 		@return True on succeeded, false otherwise.*/
 		virtual bool writeEffect( const COLLADAFW::Effect* effect );
 
+		/** Keeps the effect without copying it.
+		@return True on succeeded, false otherwise.*/
+		virtual bool adoptEffect( COLLADAFW::Effect* effect );
+
 		/** Writes the camera.
 		@return True on succeeded, false otherwise.*/
 		virtual bool writeCamera( const COLLADAFW::Camera* camera );
@@ -316,6 +347,10 @@ namespace DAE23ds
 		@return True on succeeded, false otherwise.*/
 		virtual bool writeImage( const COLLADAFW::Image* image );
 
+		/** Keeps the image without copying it.
+		@return True on succeeded, false otherwise.*/
+		virtual bool adoptImage( COLLADAFW::Image* image );
+
 		/** Writes the light.
 		@return True on succeeded, false otherwise.*/
 		virtual bool writeLight( const COLLADAFW::Light* light );
@@ -395,21 +430,21 @@ namespace DAE23ds
 
 		Common::Buffer& getBuffer() { return *mBuffer; }
 
-		/** The chunk length of all object block and material blocks.*/
-		ChunkLength getObjectAndMaterialBlockLength() const { return mObjectAndMaterialBlockLength; }
+		/** Writes the header of a chunk with id @a chunkId and a placeholder length. After the content of the 
+		chunk has been written, closeChunk() must be called.*/
+		OpenedChunk openChunk( ChunkID chunkId );
+
+		/** Calculates the length of @a chunk from the bytes written since it has been opened. The length is
+		written into the chunk header by patchChunkLengths().*/
+		void closeChunk( const OpenedChunk& chunk );
 
-		/** The chunk length of all object block and material blocks.*/
-		void setObjectAndMaterialBlockLength(ChunkLength val) { mObjectAndMaterialBlockLength = val; }
+		/** Writes the lengths of all closed chunks into their headers and continues at the end of the file.
+		@return True on success, false otherwise.*/
+		bool patchChunkLengths();
 
 		/** The mesh data of all the meshes parsed at the first run.*/
 		MeshDataMap& getMeshDataMap() { return mMeshDataMap; }
 
-		/** Calculates the length of all meshes.*/
-		void calculateMeshesLength();
-
-		/** Calculates the length of all material blocks.*/
-		void calculateMaterialsBlockLength();
-
 		/** Writes all material blocks.*/
 		void writeMaterialsBlocks();
 
@@ -448,7 +483,8 @@ namespace DAE23ds
 		/** Fills the bindingMap of @a materialBinding.*/
 		static void fillMaterialBindingMap(const GeometryMaterialBinding& materialBinding);
 
-		bool writeHeader( ChunkLength sceneGraphLength );
+		/** Writes the header and opens the main chunk @a mainChunk and the 3d editor chunk @a edit3DSChunk.*/
+		bool writeHeader( OpenedChunk& mainChunk, OpenedChunk& edit3DSChunk );
 
 		template<class NumberType, char prefix>
 		static const char* calculateNameFromNumber( const NumberType& number);
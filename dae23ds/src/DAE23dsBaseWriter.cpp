@@ -92,7 +92,7 @@ namespace DAE23ds
 		}
 		else
 		{
-			return &it->second;
+			return it->second;
 		}
 	}
 
@@ -107,7 +107,7 @@ namespace DAE23ds
 		}
 		else
 		{
-			return &it->second;
+			return it->second;
 		}
 	}
 
@@ -156,12 +156,6 @@ namespace DAE23ds
 
 	}
 
-	//------------------------------
-	void BaseWriter::addToObjectAndMaterialBlockLength( ChunkLength val )
-	{
-		mWriter->setObjectAndMaterialBlockLength( mWriter->getObjectAndMaterialBlockLength() + val );
-	}
-
 	//------------------------------
 	void BaseWriter::addMeshData( const Writer::MeshData& meshData )
 	{
@@ -11,13 +11,21 @@
 #include "DAE23dsStableHeaders.h"
 #include "DAE23dsBitSet.h"
 
+#include <limits.h>
+
 
 namespace DAE23ds
 {
 
+	//------------------------------
+	static size_t calculateByteCount( size_t bitCount )
+	{
+		return (bitCount + CHAR_BIT - 1) / CHAR_BIT;
+	}
+
     //------------------------------
 	BitSet::BitSet( size_t bitCount ) 
-		: mBuffer( new char[(bitCount - 1) / sizeof(char) + 1] )
+		: mBuffer( new char[calculateByteCount(bitCount)] )
 		, mBitCount( bitCount )
 	{
 
@@ -25,16 +33,16 @@ namespace DAE23ds
 
 	//------------------------------
 	BitSet::BitSet( size_t bitCount, bool defaultValue ) 
-		: mBuffer( new char[(bitCount - 1) / sizeof(char) + 1] )
+		: mBuffer( new char[calculateByteCount(bitCount)] )
 		, mBitCount( bitCount )
 	{
 		if ( defaultValue )
 		{
-			memset( mBuffer, 0xFF, (bitCount - 1) / sizeof(char) + 1);
+			memset( mBuffer, 0xFF, calculateByteCount(bitCount));
 		}
 		else
 		{
-			memset( mBuffer, 0x00, (bitCount - 1) / sizeof(char) + 1);
+			memset( mBuffer, 0x00, calculateByteCount(bitCount));
 		}
 	}
 
@@ -48,9 +56,9 @@ namespace DAE23ds
 	void BitSet::setBit( size_t n, bool value )
 	{
 		assert( n < mBitCount );
-		char& c = mBuffer[ n / sizeof(char) ];
-		char bitInByte = (char)(n % sizeof(char));
-		char bitMask = 1 << bitInByte;
+		char& c = mBuffer[ n / CHAR_BIT ];
+		char bitInByte = (char)(n % CHAR_BIT);
+		char bitMask = (char)(1 << bitInByte);
 		if ( value )
 		{
 			c |= bitMask;
@@ -62,12 +70,12 @@ namespace DAE23ds
 	}
 
 	//------------------------------
-	bool BitSet::setBit( size_t n )
+	bool BitSet::getBit( size_t n ) const
 	{
 		assert( n < mBitCount );
-		char& c = mBuffer[ n / sizeof(char) ];
-		char bitInByte = (char)(n % sizeof(char));
-		char bitMask = 1 << bitInByte;
+		char c = mBuffer[ n / CHAR_BIT ];
+		char bitInByte = (char)(n % CHAR_BIT);
+		char bitMask = (char)(1 << bitInByte);
 		return (c & bitMask) == bitMask;
 	}
 
@@ -58,7 +58,7 @@ namespace DAE23ds
 		Writer::UniqueIdFWMaterialMap::const_iterator it = mUniqueIdFWMaterialMap.begin();
 		for ( ; it != mUniqueIdFWMaterialMap.end(); ++it )
 		{
-			const COLLADAFW::Material* material = &it->second;
+			const COLLADAFW::Material* material = it->second;
 
 			MaterialNumber materialNumber = getAndIncreaseNextMaterialNumber();
 			addUniqueIdMaterialNumberPair( material->getUniqueId(), materialNumber);
@@ -68,20 +68,8 @@ namespace DAE23ds
 			ChunkLength materialNameChunkLength = EMPTY_CHUNK_LENGTH;
 			materialNameChunkLength += Writer::getMaterialNameLength();
 
-			ChunkLength materialBlockLength = 0;
-
-			// material block empty chunk
-			materialBlockLength += EMPTY_CHUNK_LENGTH;
-
-			// the name chunk
-			materialBlockLength += materialNameChunkLength;
-
-			//all the color chunks
-			materialBlockLength += calculateMaterialColorLength(material);
-
 			// write material block
-			mBuffer.copyToBuffer(EDIT_MATERIAL);
-			mBuffer.copyToBuffer(materialBlockLength);
+			Writer::OpenedChunk materialBlockChunk = openChunk(EDIT_MATERIAL);
 
 			// write name
 			mBuffer.copyToBuffer(MATERIAL_NAME);
@@ -106,6 +94,7 @@ namespace DAE23ds
 				writeColorBlock(effectCommon->getSpecular().getColor(), MATERIAL_SPECULAR_COLOR);
 			}
 
+			closeChunk(materialBlockChunk);
 		}
 		return true;
 	}
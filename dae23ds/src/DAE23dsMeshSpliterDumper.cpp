@@ -27,6 +27,16 @@ namespace DAE23ds
 	{
 	}
 
+	//------------------------------
+	void MeshSpliterDumper::handleNewBlock( const unsigned int* vertexIndices, size_t verticesCount, size_t trianglesCount )
+	{
+		mCharacterBuffer.copyToBuffer( "New block, vertices: " );
+		mCharacterBuffer.copyToBufferAsChar( (unsigned int)verticesCount );
+		mCharacterBuffer.copyToBuffer( ", triangles: " );
+		mCharacterBuffer.copyToBufferAsChar( (unsigned int)trianglesCount );
+		mCharacterBuffer.copyToBuffer( "\n" );
+	}
+
 	//------------------------------
 	void MeshSpliterDumper::handleTriangle( const TriangleType& triangle )
 	{
@@ -39,8 +49,8 @@ namespace DAE23ds
 	}
 
 	//------------------------------
-	void MeshSpliterDumper::handleNewBlock()
+	void MeshSpliterDumper::handleEndBlock()
 	{
-		mCharacterBuffer.copyToBuffer( "New block\n" );
+		mCharacterBuffer.copyToBuffer( "End block\n" );
 	}
 } // namespace DAE23ds
@@ -29,6 +29,7 @@ namespace DAE23ds
 		: MeshBase(writer3ds)
 		, mMesh(mesh)
 		, mBuffer(getBuffer())
+		, mBlockInstanceGeometryInfo(0)
 		, mMeshAccessor(mesh)
 		, mMeshPositions( mesh->getPositions() )
 		, mMeshNormals( mesh->getNormals() )
@@ -49,7 +50,7 @@ namespace DAE23ds
 	}
 
 	//------------------------------
-	bool MeshWriter::writeMeshIntoMultipleObjects( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const WriteMeshIntoMultipleObjectsData& data, const COLLADAFW::InstanceGeometry* alreadyUsingInstance)
+	bool MeshWriter::writeMeshIntoMultipleObjects( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const COLLADAFW::InstanceGeometry* alreadyUsingInstance)
 	{
 		const COLLADAFW::InstanceGeometry* instanceGeometry = instanceGeometryInfo.fwInstanceGeometry;
 		if ( alreadyUsingInstance && !getApplyTransformationsToMeshes() )
@@ -65,52 +66,25 @@ namespace DAE23ds
 		}
 		else
 		{
-			// we need to export the mesh
-			const COLLADAFW::MaterialBindingArray& materialBindings = instanceGeometry->getMaterialBindings();
-
-//			writeMaterialBlocks(materialBindings);
+			// we need to export the mesh. The spliter calls handleNewBlock(), handleTriangle() and 
+			// handleEndBlock() for each object
+			mBlockInstanceGeometryInfo = &instanceGeometryInfo;
 
-			ObjectBlockData blockData;
-			blockData.trianglesCount = MAX_TRIANGLES_PER_BLOCK;
-			blockData.firstTriangleIndex = 0;
-			//		blockData.verticesCount = MAX_INDEX_COUNT;
-
-			// loop here over all blocks
-			for ( ChunkLength i = 0; i  < data.fullBlocksCount; ++i )
-			{
-				writeMeshIntoObject( instanceGeometryInfo, blockData);
-				blockData.firstTriangleIndex += blockData.trianglesCount;
-			}
+			MeshSpliter<MeshAccessor, unsigned int, MeshWriter, IndexType> meshSpliter( mMeshAccessor, *this, MAX_INDEX_COUNT, MAX_INDEX_COUNT );
+			meshSpliter.split();
 
-			// write the remaining triangles
-			if ( data.remainingTriangles > 0)
-			{
-				blockData.trianglesCount = data.remainingTriangles;
-				writeMeshIntoObject( instanceGeometryInfo, blockData);
-			}
+			mBlockInstanceGeometryInfo = 0;
 		}
 		return true;
 	}
 
 	//------------------------------
-	bool MeshWriter::writeMeshIntoObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const ObjectBlockData& blockData)
+	void MeshWriter::handleNewBlock( const unsigned int* vertexIndices, size_t verticesCount, size_t trianglesCount )
 	{
-		const COLLADAFW::InstanceGeometry* instanceGeometry = instanceGeometryInfo.fwInstanceGeometry;
-		const COLLADAFW::MaterialBindingArray& materialBindings = instanceGeometry->getMaterialBindings();
-		ChunkLength verticesLength = calculateVerticesLength(blockData.trianglesCount*3*3);
-
-		ChunkLength facesMaterialsLength = calculateFacesMaterialsLength(blockData.trianglesCount, materialBindings);
-
-		ChunkLength facesDescriptionLength = calculateFacesDescriptionLength(blockData.trianglesCount, facesMaterialsLength);
-
-		// vertices  and faces description plus empty chunk
-		ChunkLength triangularMeshLength = verticesLength + facesDescriptionLength+ EMPTY_CHUNK_LENGTH+TRI_LOCAL_LENGTH;
-
-		ChunkLength editObjectLength = calculateObjectLength(triangularMeshLength);
+		const Writer::InstanceGeometryInfo& instanceGeometryInfo = *mBlockInstanceGeometryInfo;
 
 		// object chunk
-		mBuffer.copyToBuffer(EDIT_OBJECT);
-		mBuffer.copyToBuffer(editObjectLength);
+		mBlockEditObjectChunk = openChunk(EDIT_OBJECT);
 
 		Writer::ObjectId objectId = getAndIncreaseNextObjectId();
 		const char* meshName3ds = Writer::calculateObjectNameFromObjectId( objectId );
@@ -118,25 +92,45 @@ namespace DAE23ds
 		addInstanceGeometryObjectId(Writer::InstanceGeometryIdentifier(instanceGeometryInfo.fwInstanceGeometry, instanceGeometryInfo.instanceNumber), objectId);
 
 		// triangular mesh
-		mBuffer.copyToBuffer(OBJ_TRIMESH);
-		mBuffer.copyToBuffer(triangularMeshLength);
+		mBlockTriangularMeshChunk = openChunk(OBJ_TRIMESH);
 
 		// vertices list mesh
 		mBuffer.copyToBuffer(TRI_VERTEXL);
-		mBuffer.copyToBuffer(verticesLength);
-		mBuffer.copyToBuffer((CountType)(blockData.trianglesCount*3));
-		writeVerticesForMultipleObjects(blockData.firstTriangleIndex, blockData.trianglesCount,instanceGeometryInfo.worldMatrix);
+		mBuffer.copyToBuffer(calculateVerticesLength((ChunkLength)(verticesCount*3)));
+		mBuffer.copyToBuffer((CountType)(verticesCount));
+		writeVerticesForMultipleObjects(vertexIndices, verticesCount, instanceGeometryInfo.worldMatrix);
 
 		// faces description
-		mBuffer.copyToBuffer(TRI_FACEL1);
-		mBuffer.copyToBuffer(facesDescriptionLength);
-		mBuffer.copyToBuffer((CountType)(blockData.trianglesCount));
-		writeTrianglesForMultipleObjects(blockData.trianglesCount);
+		mBlockFacesDescriptionChunk = openChunk(TRI_FACEL1);
+		mBuffer.copyToBuffer((CountType)(trianglesCount));
+
+		mBlockMaterialIds.clear();
+		mBlockMaterialIds.reserve(trianglesCount);
+	}
+
+	//------------------------------
+	void MeshWriter::handleTriangle( const TriangleType& triangle )
+	{
+		mBuffer.copyToBuffer(triangle.indices[0]);
+		mBuffer.copyToBuffer(triangle.indices[1]);
+		mBuffer.copyToBuffer(triangle.indices[2]);
+		mBuffer.copyToBuffer( FACES_FLAGS );
 
-		writeFaceMaterialsForMultipleObjects(materialBindings, blockData);
+		mBlockMaterialIds.push_back(triangle.materialId);
+	}
+
+	//------------------------------
+	void MeshWriter::handleEndBlock()
+	{
+		const Writer::InstanceGeometryInfo& instanceGeometryInfo = *mBlockInstanceGeometryInfo;
+
+		writeFaceMaterialsForMultipleObjects(instanceGeometryInfo.fwInstanceGeometry->getMaterialBindings());
+		closeChunk(mBlockFacesDescriptionChunk);
 
 		writeMeshMatrix(instanceGeometryInfo.worldMatrix);
-		return true;
+
+		closeChunk(mBlockTriangularMeshChunk);
+		closeChunk(mBlockEditObjectChunk);
 	}
 
 
@@ -162,8 +156,7 @@ namespace DAE23ds
 //			writeMaterialBlocks(materialBindings);
 
 			// object chunk
-			mBuffer.copyToBuffer(EDIT_OBJECT);
-			mBuffer.copyToBuffer(data.editObjectLength);
+			Writer::OpenedChunk editObjectChunk = openChunk(EDIT_OBJECT);
 
 			Writer::ObjectId objectId = getAndIncreaseNextObjectId();
 			const char* meshName3ds = Writer::calculateObjectNameFromObjectId( objectId );
@@ -171,23 +164,26 @@ namespace DAE23ds
 			addInstanceGeometryObjectId(Writer::InstanceGeometryIdentifier(instanceGeometryInfo.fwInstanceGeometry, instanceGeometryInfo.instanceNumber), objectId);
 
 			// triangular mesh
-			mBuffer.copyToBuffer(OBJ_TRIMESH);
-			mBuffer.copyToBuffer(data.triangularMeshLength);
+			Writer::OpenedChunk triangularMeshChunk = openChunk(OBJ_TRIMESH);
 
 			// vertices list mesh
 			mBuffer.copyToBuffer(TRI_VERTEXL);
-			mBuffer.copyToBuffer(data.verticesLength);
+			mBuffer.copyToBuffer(calculateVerticesLength());
 			mBuffer.copyToBuffer((CountType)(mMeshPositions.getValuesCount()/3));
 			writeVertices(instanceGeometryInfo.worldMatrix);
 
 			// faces description
-			mBuffer.copyToBuffer(TRI_FACEL1);
-			mBuffer.copyToBuffer(data.facesDescriptionLength);
+			Writer::OpenedChunk facesDescriptionChunk = openChunk(TRI_FACEL1);
 			mBuffer.copyToBuffer(data.trianglesCount);
 			writeTriangles();
 
 			writeFaceMaterials(materialBindings);
+			closeChunk(facesDescriptionChunk);
+
 			writeMeshMatrix(instanceGeometryInfo.worldMatrix);
+
+			closeChunk(triangularMeshChunk);
+			closeChunk(editObjectChunk);
 		}
 
 		return true;
@@ -297,11 +293,10 @@ namespace DAE23ds
 	}
 
 	//------------------------------
-	bool MeshWriter::writeVerticesForMultipleObjects(size_t firstTriangleIndex, CountType trianglesCount, const COLLADABU::Math::Matrix4& worldMatrix)
+	bool MeshWriter::writeVerticesForMultipleObjects(const unsigned int* vertexIndices, size_t verticesCount, const COLLADABU::Math::Matrix4& worldMatrix)
 	{
 		if ( mMeshPositions.getType() == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_FLOAT )
 		{
-			MeshAccessor::TriangleType triangle = mMeshAccessor.getTriangle(firstTriangleIndex);
 			const COLLADAFW::FloatArray* floatArray = mMeshPositions.getFloatValues();
 			if ( getApplyTransformationsToMeshes() && multiplyMeshes )
 			{
@@ -320,81 +315,41 @@ namespace DAE23ds
 				wm[2][2] = (float)worldMatrix.getElement(2,2);
 				wm[2][3] = (float)worldMatrix.getElement(2,3);
 
-				for ( IndexType i = 0; ; ++i)
+				for ( size_t i = 0; i < verticesCount; ++i)
 				{
-					// apply transformation
-					transformAndWriteVertex( *floatArray, wm, 3*triangle.indices[0]);
-					transformAndWriteVertex( *floatArray, wm, 3*triangle.indices[1]);
-					transformAndWriteVertex( *floatArray, wm, 3*triangle.indices[2]);
-
-					mMaterialIds[i] = triangle.materialId;
-					if ( i >= trianglesCount - 1)
-						break;
-					triangle = mMeshAccessor.getNextTriangle();
+					transformAndWriteVertex( *floatArray, wm, 3*(size_t)vertexIndices[i]);
 				}
 			}
 			else
 			{
-				for ( IndexType i = 0; ; ++i)
+				for ( size_t i = 0; i < verticesCount; ++i)
 				{
 					// we can write the vertices directly to the mBuffer
-					mBuffer.copyToBuffer(floatArray->getData() + 3*triangle.indices[0], 3);
-					mBuffer.copyToBuffer(floatArray->getData() + 3*triangle.indices[1], 3);
-					mBuffer.copyToBuffer(floatArray->getData() + 3*triangle.indices[2], 3);
-					mMaterialIds[i] = triangle.materialId;
-					if ( i >= trianglesCount - 1)
-						break;
-					triangle = mMeshAccessor.getNextTriangle();
+					mBuffer.copyToBuffer(floatArray->getData() + 3*(size_t)vertexIndices[i], 3);
 				}
 			}
 		}
 		else if ( mMeshPositions.getType() == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE )
 		{
-			// we need to cast the values from double to float
 			const COLLADAFW::DoubleArray* doubleArray = mMeshPositions.getDoubleValues();
 
-			MeshAccessor::TriangleType triangle = mMeshAccessor.getTriangle(firstTriangleIndex);
-
 			if ( getApplyTransformationsToMeshes() && multiplyMeshes )
 			{
-				for ( IndexType i = 0; ; ++i)
+				for ( size_t i = 0; i < verticesCount; ++i)
 				{
 					// apply transformation
-					transformAndWriteVertex( *doubleArray, worldMatrix, 3*triangle.indices[0]);
-					transformAndWriteVertex( *doubleArray, worldMatrix, 3*triangle.indices[1]);
-					transformAndWriteVertex( *doubleArray, worldMatrix, 3*triangle.indices[2]);
-
-					mMaterialIds[i] = triangle.materialId;
-					if ( i < trianglesCount - 1)
-						break;
-
-					triangle = mMeshAccessor.getNextTriangle();
+					transformAndWriteVertex( *doubleArray, worldMatrix, 3*(size_t)vertexIndices[i]);
 				}
 			}
 			else
 			{
-				for ( IndexType i = 0; ; ++i)
+				for ( size_t i = 0; i < verticesCount; ++i)
 				{
 					// we need to cast the values from double to float
-					IndexType index = 3*triangle.indices[0];
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-
-					index = 3*triangle.indices[1];
+					size_t index = 3*(size_t)vertexIndices[i];
 					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
 					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
 					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-
-					index = 3*triangle.indices[2];
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-					mMaterialIds[i] = triangle.materialId;
-					if ( i < trianglesCount - 1)
-						break;
-
-					triangle = mMeshAccessor.getNextTriangle();
 				}
 			}
 		}
@@ -488,7 +443,7 @@ namespace DAE23ds
 	}
 
 	//------------------------------
-	bool MeshWriter::writeFaceMaterialsForMultipleObjects(const COLLADAFW::MaterialBindingArray& materialBindings, const ObjectBlockData& blockData)
+	bool MeshWriter::writeFaceMaterialsForMultipleObjects(const COLLADAFW::MaterialBindingArray& materialBindings)
 	{
 		for ( size_t i = 0, count = materialBindings.getCount(); i < count; ++i)
 		{
@@ -500,9 +455,9 @@ namespace DAE23ds
 			// calculate number of faces that use this material
 			CountType faceCount = 0;
 
-			for ( size_t j = 0; j < blockData.trianglesCount; ++j)
+			for ( size_t j = 0, trianglesCount = mBlockMaterialIds.size(); j < trianglesCount; ++j)
 			{
-				COLLADAFW::MaterialId triangleMaterialId = mMaterialIds[j];
+				COLLADAFW::MaterialId triangleMaterialId = mBlockMaterialIds[j];
 				if ( triangleMaterialId != materialId)
 				{
 					// we are not interested in that primitive right now
@@ -535,10 +490,10 @@ namespace DAE23ds
 
 			// we need to iterate over the primitives again to fill the facenuum array
 			IndexType faceIndex = 0;
-			for ( size_t j = 0; j < blockData.trianglesCount; ++j)
+			for ( size_t j = 0, trianglesCount = mBlockMaterialIds.size(); j < trianglesCount; ++j)
 			{
 				
-				COLLADAFW::MaterialId triangleMaterialId = mMaterialIds[j];
+				COLLADAFW::MaterialId triangleMaterialId = mBlockMaterialIds[j];
 				if ( triangleMaterialId == materialId)
 				{
 					mBuffer.copyToBuffer((IndexType)j);
@@ -643,20 +598,6 @@ namespace DAE23ds
 		return true;
 	}
 
-	//------------------------------
-	bool MeshWriter::writeTrianglesForMultipleObjects(CountType trianglesCount)
-	{
-		// we simply need to write the numbers 0...trianglesCount
-		for ( IndexType i = 0, index = 0; i < trianglesCount; ++i)
-		{
-			mBuffer.copyToBuffer(index++);
-			mBuffer.copyToBuffer(index++);
-			mBuffer.copyToBuffer(index++);
-			mBuffer.copyToBuffer( FACES_FLAGS );
-		}
-		return true;
-	}
-
 	//------------------------------
 	bool MeshWriter::writeMeshMatrix( const COLLADABU::Math::Matrix4& worldMatrix )
 	{
@@ -10,23 +10,14 @@
 
 #include "DAE23dsStableHeaders.h"
 #include "DAE23dsSceneGraphHandler.h"
-#include "DAE23dsMeshBase.h"
 
 
 namespace DAE23ds
 {
-	static const ChunkLength STATIC_SCENGRAPH_LENGHT = EMPTY_CHUNK_LENGTH  //main key frame chunk
-		                                             + EMPTY_CHUNK_LENGTH + sizeof(short)+ sizeof(long) + sizeof(FILENAME) //KFHDR
-   		                                             + EMPTY_CHUNK_LENGTH + 2*sizeof(long)//KEYF_FRAMES
-                                                     + EMPTY_CHUNK_LENGTH + sizeof(long); //KFCURTIME
-													 
-	const char DUMMY[]="$$$DUMMY"; 
-
 	//------------------------------
 	SceneGraphHandler::SceneGraphHandler( Writer* writer3ds, const COLLADAFW::VisualScene* visualScene, const Writer::LibraryNodesList& libraryNodesList )
 		: SceneGraphBase( writer3ds, visualScene, libraryNodesList )
 		, mUniqueIdNodeMap(getUniqueIdNodeMap())
-		, mSceneGraphLength( STATIC_SCENGRAPH_LENGHT )
 	{
 	}
 
@@ -65,8 +56,6 @@ namespace DAE23ds
 		NodeInfo nodeInfo( worldMatrix );
 		mNodeInfoStack.push(nodeInfo);
 
-		addNodeLength( sizeof(DUMMY) , 1, nodeToWriter->getTransformationMatrix());
-
 		handleInstanceGeometries( nodeToWriter, worldMatrix );
 
 		handleNodes(nodeToWriter->getChildNodes());
@@ -87,29 +76,6 @@ namespace DAE23ds
 
  			Writer::InstanceGeometryInfo instanceGeometryInfo( instanceGeometry, matrix, getNextInstanceNumber(instanceGeometry) );
 
-			const COLLADAFW::UniqueId& meshUniqueId = instanceGeometry->getInstanciatedObjectId();
-			const Writer::MeshData& meshdata = getMeshData( meshUniqueId );
-
-
-			ChunkLength fullBlockCount = 1;
-			ChunkLength nameLength = 0;
-			ChunkLength remainingTriangles;
-			ChunkLength blockCount = 1;
-			ChunkLength objectNameLength = OBJECT_NAME_LENGTH;
-
-			if ( meshdata.positionsCount > MAX_INDEX_COUNT )
-			{
-				MeshBase::calculateBlockCountAndRemainingTriangles( meshdata.trianglesCount, remainingTriangles, blockCount, fullBlockCount );
-//				nameLength = (ChunkLength)(min(meshdata.name.length() + 4, MAX_OBJECT_NAME_LENGTH) + 1);
-			}
-			else
-			{
-//				nameLength = (ChunkLength)(min(meshdata.name.length(), MAX_OBJECT_NAME_LENGTH) + 1);
-			}
-
-//			addNodeLength( nameLength, fullBlockCount, COLLADABU::Math::Matrix4::IDENTITY );
-			addNodeLength( objectNameLength, blockCount, COLLADABU::Math::Matrix4::IDENTITY );
-
  			addInstanceGeometryInstanceGeometryInfoPair(instanceGeometry->getInstanciatedObjectId(), instanceGeometryInfo);
 		}
 	}
@@ -130,31 +96,4 @@ namespace DAE23ds
 		}
 	}
 
-	//------------------------------
-	void SceneGraphHandler::addNodeLength( ChunkLength objectRefLength, ChunkLength factor, const COLLADABU::Math::Matrix4& matrix )
-	{
-		// empty chunk + node name + 3 short flags
-		ChunkLength nodeHDRLength = EMPTY_CHUNK_LENGTH + objectRefLength + 3*sizeof(short);
-
-		// empty chunk + node id
-		ChunkLength nodeIDLength = EMPTY_CHUNK_LENGTH + sizeof(short);
-
-		// empty chunk + node hdr + node id
-		ChunkLength objectDesLength = EMPTY_CHUNK_LENGTH + nodeHDRLength + nodeIDLength;
-
-		if ( !getApplyTransformationsToMeshes() )
-		{
-
-			// add transformations
-			objectDesLength += PIVOT_LENGTH;
-			objectDesLength += POS_TRACK_TAG_LENGTH;
-			objectDesLength += SCL_TRACK_TAG_LENGTH;
-			objectDesLength += ROT_TRACK_TAG_LENGTH;
-		}
-
-
-		mSceneGraphLength += factor * objectDesLength;
-	}
-
-
 } // namespace DAE23ds
@@ -36,11 +36,10 @@ namespace DAE23ds
 	}
 
 	//------------------------------
-	bool SceneGraphWriter::write( ChunkLength scenegraphLength )
+	bool SceneGraphWriter::write()
 	{
-		// write key frame chunk
-		mBuffer.copyToBuffer(KEYF3DS);
-		mBuffer.copyToBuffer(scenegraphLength);
+		// write key frame chunk. The number of objects per mesh is only known after the meshes have been written
+		Writer::OpenedChunk keyFrameChunk = openChunk(KEYF3DS);
 
 		// write KFHDR chunk
 		mBuffer.copyToBuffer(KEYF_HDR);
@@ -64,6 +63,8 @@ namespace DAE23ds
 		mBuffer.copyToBuffer((long)0);  //current frame
 
 		writeNodes( mVisualScene->getRootNodes(), (short)0xFFFF);
+
+		closeChunk(keyFrameChunk);
 		return true;
 	}
 
@@ -12,10 +12,8 @@
 #include "DAE23dsWriter.h"
 #include "DAE23dsMeshWriter.h"
 #include "DAE23dsMeshHandler.h"
-#include "DAE23dsMeshLengthCalculator.h"
 #include "DAE23dsSceneGraphWriter.h"
 #include "DAE23dsSceneGraphHandler.h"
-#include "DAE23dsMaterialsLengthCalculator.h"
 #include "DAE23dsMaterialsWriter.h"
 
 #include "COLLADASaxFWLLoader.h"
@@ -76,7 +74,6 @@ namespace DAE23ds
 		, mCurrentRun(SCENEGRAPH_RUN)
 		, mVisualScene(0)
 		, mGeometryMaterialBindingFileNameMap(compare)
-		, mObjectAndMaterialBlockLength(0)
 		, mNextObjectId( RESERVED_OBJECTIDS_COUNT )
 		, mNextMaterialNumber( RESERVED_MATERIALNUMBERS_COUNT )
 	{
@@ -86,6 +83,13 @@ namespace DAE23ds
 	Writer::~Writer()
 	{
 		delete mVisualScene;
+
+		for ( UniqueIdFWMaterialMap::const_iterator it = mUniqueIdFWMaterialMap.begin(); it != mUniqueIdFWMaterialMap.end(); ++it )
+			delete it->second;
+		for ( UniqueIdFWImageMap::const_iterator it = mUniqueIdFWImageMap.begin(); it != mUniqueIdFWImageMap.end(); ++it )
+			delete it->second;
+		for ( UniqueIdFWEffectMap::const_iterator it = mUniqueIdFWEffectMap.begin(); it != mUniqueIdFWEffectMap.end(); ++it )
+			delete it->second;
 	}
 
 	//--------------------------------------------------------------------
@@ -120,6 +124,10 @@ namespace DAE23ds
 
 		mBuffer = &buffer;
 
+		// The meshes can only be written after the scene graph has been handled, since the instances determine
+		// how often and with which materials they are written. Keep them instead of loading the document twice.
+		loader.setRetainGeometries(true);
+
 		// Load scene graph 
 		loader.setObjectFlags(   COLLADASaxFWL::Loader::ASSET_FLAG 
 							   | COLLADASaxFWL::Loader::EFFECT_FLAG
@@ -136,40 +144,75 @@ namespace DAE23ds
 		SceneGraphHandler sceneGraphHandler(this, mVisualScene, mLibraryNodesList);
 		sceneGraphHandler.handle();
 
-		calculateMaterialsBlockLength();
-		calculateMeshesLength();
-
-		writeHeader( sceneGraphHandler.getScenegraphLength() );
+		// the lengths of the chunks are only known after their content has been written
+		OpenedChunk mainChunk;
+		OpenedChunk edit3DSChunk;
+		writeHeader( mainChunk, edit3DSChunk );
 		writeMaterialsBlocks();
 
-		// load and write geometries
+		// write the retained geometries
 		mCurrentRun = GEOMETRY_RUN;
-		if ( !root.loadDocument(mInputFile.toNativePath()) )
+		bool success = loader.writeRetainedGeometries(this);
+		loader.deleteRetainedGeometries();
+		if ( !success )
 			return false;
 
+		closeChunk( edit3DSChunk );
+
 		SceneGraphWriter sceneGraphWriter(this, mVisualScene, mLibraryNodesList);
-		sceneGraphWriter.write( sceneGraphHandler.getScenegraphLength() );
+		sceneGraphWriter.write();
 
-		return true;
+		closeChunk( mainChunk );
+
+		return patchChunkLengths();
 	}
 
 	//--------------------------------------------------------------------
-	void Writer::calculateMeshesLength()
+	Writer::OpenedChunk Writer::openChunk( ChunkID chunkId )
 	{
-		MeshDataMap::const_iterator it = mMeshDataMap.begin();
-		for ( ; it != mMeshDataMap.end(); ++it)
-		{
-			const MeshData& meshData = it->second;
-			MeshLengthCalculator meshLengthCalculator( this, meshData );
-			meshLengthCalculator.handle();
-		}
+		OpenedChunk chunk;
+		chunk.chunkStart = mBuffer->getBytesCopiedToBuffer();
+
+		mBuffer->copyToBuffer(chunkId);
+
+		// the mark refers to the current position in the file, i.e. the position of the length
+		mBuffer->startMark();
+		chunk.lengthMarkId = mBuffer->endMark();
+		mBuffer->copyToBuffer((ChunkLength)0);
+
+		return chunk;
+	}
+
+	//--------------------------------------------------------------------
+	void Writer::closeChunk( const OpenedChunk& chunk )
+	{
+		ChunkLengthPatch patch;
+		patch.lengthMarkId = chunk.lengthMarkId;
+		patch.length = (ChunkLength)(mBuffer->getBytesCopiedToBuffer() - chunk.chunkStart);
+		mChunkLengthPatches.push_back(patch);
 	}
 
 	//--------------------------------------------------------------------
-	void Writer::calculateMaterialsBlockLength()
+	bool Writer::patchChunkLengths()
 	{
-		MaterialsLengthCalculator materialsLengthCalculator(this);
-		materialsLengthCalculator.calculate();
+		// the lengths are written after all chunks have been closed, to write the file sequentially until then
+		bool success = true;
+		for ( size_t i = 0, count = mChunkLengthPatches.size(); i < count; ++i)
+		{
+			const ChunkLengthPatch& patch = mChunkLengthPatches[i];
+			if ( !mBuffer->jumpToMark(patch.lengthMarkId) )
+			{
+				success = false;
+				continue;
+			}
+			mBuffer->copyToBuffer(patch.length);
+		}
+		mChunkLengthPatches.clear();
+
+		if ( !mBuffer->jumpToMark(Common::IBufferFlusher::END_OF_STREAM) )
+			return false;
+
+		return success;
 	}
 
 	//--------------------------------------------------------------------
@@ -280,7 +323,15 @@ namespace DAE23ds
 	{
 		if ( mCurrentRun != SCENEGRAPH_RUN )
 			return true;
-		mUniqueIdFWMaterialMap.insert(std::make_pair(material->getUniqueId(),*material ));
+		// only called, if the loader still needs the material
+		return adoptMaterial( new COLLADAFW::Material(*material) );
+	}
+
+	//--------------------------------------------------------------------
+	bool Writer::adoptMaterial( COLLADAFW::Material* material )
+	{
+		if ( (mCurrentRun != SCENEGRAPH_RUN) || !mUniqueIdFWMaterialMap.insert(std::make_pair(material->getUniqueId(), material)).second )
+			delete material;
 		return true;
 	}
 
@@ -289,7 +340,15 @@ namespace DAE23ds
 	{
 		if ( mCurrentRun != SCENEGRAPH_RUN )
 			return true;
-		mUniqueIdFWEffectMap.insert(std::make_pair(effect->getUniqueId(),*effect ));
+		// only called, if the loader still needs the effect
+		return adoptEffect( new COLLADAFW::Effect(*effect) );
+	}
+
+	//--------------------------------------------------------------------
+	bool Writer::adoptEffect( COLLADAFW::Effect* effect )
+	{
+		if ( (mCurrentRun != SCENEGRAPH_RUN) || !mUniqueIdFWEffectMap.insert(std::make_pair(effect->getUniqueId(), effect)).second )
+			delete effect;
 		return true;
 	}
 
@@ -306,7 +365,15 @@ namespace DAE23ds
 	{
 		if ( mCurrentRun != SCENEGRAPH_RUN )
 			return true;
-		mUniqueIdFWImageMap.insert(std::make_pair(image->getUniqueId(),*image ));
+		// only called, if the loader still needs the image
+		return adoptImage( new COLLADAFW::Image(*image) );
+	}
+
+	//--------------------------------------------------------------------
+	bool Writer::adoptImage( COLLADAFW::Image* image )
+	{
+		if ( (mCurrentRun != SCENEGRAPH_RUN) || !mUniqueIdFWImageMap.insert(std::make_pair(image->getUniqueId(), image)).second )
+			delete image;
 		return true;
 	}
 
@@ -400,32 +467,12 @@ namespace DAE23ds
 	}
 
 	//--------------------------------------------------------------------
-	bool Writer::writeHeader( ChunkLength sceneGraphLength )
+	bool Writer::writeHeader( OpenedChunk& mainChunk, OpenedChunk& edit3DSChunk )
 	{
-		// triangle mesh 
-		//plus material blocks
-		//plus plus empty chunk
-		ChunkLength edit3DSLength = mObjectAndMaterialBlockLength + EMPTY_CHUNK_LENGTH ;
-
-		// add mesh version size
-		edit3DSLength += MESH_VERSION_CHUNK_LENGTH;
-
-		// add EDIT_MASTERSCALE version length
-		edit3DSLength += EDIT_MASTERSCALE_CHUNK_LENGTH;
-
-
-		// edit 3ds plus empty chunk
-		ChunkLength mainLength = edit3DSLength + EMPTY_CHUNK_LENGTH;
-
-		// add M3D3DS_VERSION version length and scene graph length
-		mainLength += M3D_VERSION_CHUNK_LENGTH+ sceneGraphLength;
-
-
 		//  write header
  
 		//Main chunk
- 		mBuffer->copyToBuffer(MAIN3DS);
- 		mBuffer->copyToBuffer(mainLength);
+		mainChunk = openChunk(MAIN3DS);
  
  
 		// M3D_VERSION version
@@ -434,8 +481,7 @@ namespace DAE23ds
 		mBuffer->copyToBuffer(M3D_VERSION);
 
 		//3d editor chunk
- 		mBuffer->copyToBuffer(EDIT3DS);
- 		mBuffer->copyToBuffer(edit3DSLength);
+		edit3DSChunk = openChunk(EDIT3DS);
  
 		// mesh version
  		mBuffer->copyToBuffer(MESH3DS_VERSION);
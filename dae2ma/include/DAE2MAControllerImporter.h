@@ -172,18 +172,21 @@ namespace DAE2MA
 
         /**
          * The map holds the skin controller objects for every source (mesh or skin controller).
+         * The controllers are owned by the loader.
          */
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::SkinController*> > mSkinControllersMap;
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::SkinController*> > mSkinControllersMap;
 
         /**
         * The map holds the morph controller objects for every source (mesh).
+        * The controllers are owned by the loader.
         */
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::MorphController*> > mMorphControllersMap;
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::MorphController*> > mMorphControllersMap;
 
         /**
         * The map holds the morph controller objects for every morph target object (mesh).
+        * The controllers are owned by the loader.
         */
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::MorphController*> > mMorphTargetsMap;
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::MorphController*> > mMorphTargetsMap;
 
         /**
          * The map holds a list of controller objects.
@@ -264,43 +267,43 @@ namespace DAE2MA
         /**
         * Returns the skin controller element, which uses the given source. 
         */
-        std::vector<COLLADAFW::Controller*> findControllersBySourceId ( const COLLADAFW::UniqueId& sourceId );
+        std::vector<const COLLADAFW::Controller*> findControllersBySourceId ( const COLLADAFW::UniqueId& sourceId );
 
         /**
         * Returns the morph controller element, which uses the given source. If no morph controller 
         * uses the source, the method returns null.
         */
-        std::vector<COLLADAFW::MorphController*>* findMorphControllersBySourceId ( const COLLADAFW::UniqueId& sourceId );
+        std::vector<const COLLADAFW::MorphController*>* findMorphControllersBySourceId ( const COLLADAFW::UniqueId& sourceId );
 
         /**
         * Returns the morph controller element, which uses the given source. If no morph controller 
         * uses the source, the method returns null.
         */
-        const std::vector<COLLADAFW::MorphController*>* findMorphControllersBySourceId ( const COLLADAFW::UniqueId& sourceId ) const;
+        const std::vector<const COLLADAFW::MorphController*>* findMorphControllersBySourceId ( const COLLADAFW::UniqueId& sourceId ) const;
 
         /**
         * Returns the morph controller element, which uses the given geometry as a morph target. 
         * If no morph controller uses the source, the method returns null.
         */
-        std::vector<COLLADAFW::MorphController*>* findMorphControllersByMorphTargetId ( const COLLADAFW::UniqueId& geometryId );
+        std::vector<const COLLADAFW::MorphController*>* findMorphControllersByMorphTargetId ( const COLLADAFW::UniqueId& geometryId );
 
         /**
         * Returns the morph controller element, which uses the given geometry as a morph target. 
         * If no morph controller uses the source, the method returns null.
         */
-        const std::vector<COLLADAFW::MorphController*>* findMorphControllersByMorphTargetId ( const COLLADAFW::UniqueId& geometryId ) const;
+        const std::vector<const COLLADAFW::MorphController*>* findMorphControllersByMorphTargetId ( const COLLADAFW::UniqueId& geometryId ) const;
 
         /**
         * Returns the skin controller element, which uses the given source. If no skin controller 
         * uses the source, the method returns null.
         */
-        std::vector<COLLADAFW::SkinController*>* findSkinControllersBySourceId ( const COLLADAFW::UniqueId& sourceId );
+        std::vector<const COLLADAFW::SkinController*>* findSkinControllersBySourceId ( const COLLADAFW::UniqueId& sourceId );
 
         /**
         * Returns the skin controller element, which uses the given source. If no skin controller 
         * uses the source, the method returns null.
         */
-        const std::vector<COLLADAFW::SkinController*>* findSkinControllersBySourceId ( const COLLADAFW::UniqueId& sourceId ) const;
+        const std::vector<const COLLADAFW::SkinController*>* findSkinControllersBySourceId ( const COLLADAFW::UniqueId& sourceId ) const;
 
         /**
          * Returns the geometryId of the skinController's id.
@@ -331,7 +334,7 @@ namespace DAE2MA
          * Returns true, if the import was successful.
          */
         const bool importMorphController ( 
-            COLLADAFW::MorphController* morphController );
+            const COLLADAFW::MorphController* morphController );
 
         /**
         * Create a maya skin cluster object and the skin cluster object set with all needed maya
@@ -353,7 +356,7 @@ namespace DAE2MA
         * and weight values, to produce a new shape that is the specified blending of the input shapes. 
         */
         const String createBlendShape ( 
-            COLLADAFW::MorphController* morphController, 
+            const COLLADAFW::MorphController* morphController, 
             BlendShapeData& blendShapeData );
 
         /**
@@ -396,7 +399,7 @@ namespace DAE2MA
         * Returns the skin controller element, with the given skinControllerDataId. 
         * If no skin controller  uses the source, the method returns null.
         */
-        const std::vector<COLLADAFW::SkinController*> findSkinControllersByDataId ( const COLLADAFW::UniqueId& skinControllerDataId );
+        const std::vector<const COLLADAFW::SkinController*> findSkinControllersByDataId ( const COLLADAFW::UniqueId& skinControllerDataId );
 
         /**
         * Get the maya controller node with the given unique id.
@@ -54,23 +54,25 @@ namespace DAE2MA
     /** 
      * The main importer class. This class imports all data of the scene. 
      * 
-     * We have to parse the document always for two times. Once to get the used visual scene,
-     * which is always in the current scene. This element is always at the end of a collada 
-     * document, why we have to parse always twice. The order to handle the parsed data:
+     * The document is parsed only once. The used visual scene is referenced by the current scene, 
+     * which is always at the end of a collada document, why the import of the elements is deferred 
+     * until the document is parsed. The loader retains all framework objects until it is destroyed, 
+     * so the elements are not copied, we just store the pointers. The order to handle the parsed data:
      * 
-     * 1.) First parsing:
+     * 1.) Parsing:
      * 1.1) Import asset
-     * 1.2) Copy some of the elements, so we don't need to parse once more again. 
-     *      Following elements should be copied, the order doesn't matter:
-     *      - Copy visual scene
-     *      - Copy library nodes
-     *      - Copy controllers
-     *      - Copy materials
-     *      - Copy images
-     *      - Copy animation lists
+     * 1.2) Store the elements, the order doesn't matter:
+     *      - Store visual scene
+     *      - Store library nodes
+     *      - Store controllers
+     *      - Store materials
+     *      - Store effects
+     *      - Store images
+     *      - Store animation lists
+     *      - Store geometries, cameras, lights, animations and skinControllerDatas
      * 1.3) Read scene (is always at the end of a collada document)
      * 
-     * 2.) Between first and second parsing:
+     * 2.) After parsing:
      * 2.1) Import referenced visual scene
      * 2.3) Import referenced library nodes
      * 2.4) Import node instances
@@ -80,14 +82,15 @@ namespace DAE2MA
      * 2.8) Import referenced images
      * 2.9) Detect scale animations
      *
-     * 3.) Second parsing:
-     * 3.1) Import all data directly, the order doesn't matter:
+     * 3.) After the scene graph:
+     * 3.1) Import the stored objects in the order they have been parsed:
      *      - Import referenced geometries
      *      - Import (not just the referenced) cameras 
      *      - Import (not just the referenced) lights
      *      - Import (not just the referenced) animations (in depend on scale animations)
      *      - Import referenced skinControllerDatas
-     * 4.) After second parsing:
+     * 3.2) Import the playback options (in depend on animations)
+     * 4.) After the import:
      * 4.1) Make all connections, the order doesn't matter:
      *      - controller
      *      - materials / effects
@@ -114,12 +117,10 @@ namespace DAE2MA
         enum ParseSteps
         {
             NO_PARSING = 0,
-            FIRST_PARSING,
+            PARSING,
             IMPORT_ASSET,
-            COPY_ELEMENTS, // no order: scene, visual scene, library nodes, materials, animationLists, writeController
-            ELEMENTS_COPIED,
+            ELEMENTS_STORED,
             VISUAL_SCENE_IMPORTED,
-            SECOND_PARSING, 
             ANIMATIONS_IMPORTED,
             GEOMETRY_IMPORTED,
             MAKE_CONNECTIONS
@@ -140,22 +141,27 @@ namespace DAE2MA
         ExtraDataCallbackHandler mMayaIdCallbackHandler;
 
         /** The URI of the visual scene to use. */
-        COLLADAFW::InstanceVisualScene* mInstanceVisualScene;
+        const COLLADAFW::InstanceVisualScene* mInstanceVisualScene;
 
-        /** A copy of the framework's visual scene elements. */
-        std::vector<COLLADAFW::VisualScene*> mVisualScenesList;
+        /** The framework's visual scene elements, retained by the loader. */
+        std::vector<const COLLADAFW::VisualScene*> mVisualScenesList;
 
-        /** A copy of the framework's library nodes elements. */
-        std::vector<COLLADAFW::LibraryNodes*> mLibraryNodesList;
+        /** The framework's library nodes elements, retained by the loader. */
+        std::vector<const COLLADAFW::LibraryNodes*> mLibraryNodesList;
 
-        /** A copy of the framework's library materials elements. */
-        std::vector<COLLADAFW::Material*> mMaterialsList;
+        /** The framework's library materials elements, retained by the loader. */
+        std::vector<const COLLADAFW::Material*> mMaterialsList;
 
-        /** A copy of the framework's library effects elements. */
-        std::vector<COLLADAFW::Effect*> mEffectsList;
+        /** The framework's library effects elements, retained by the loader. */
+        std::vector<const COLLADAFW::Effect*> mEffectsList;
 
-        /** A copy of the framework's animation list elements. */
-        std::vector<COLLADAFW::AnimationList*> mAnimationListsList;
+        /** The framework's animation list elements, retained by the loader. */
+        std::vector<const COLLADAFW::AnimationList*> mAnimationListsList;
+
+        /** The framework's geometries, cameras, lights, animations and skin controller datas, 
+        retained by the loader, in the order they have been parsed. They are imported after the 
+        scene graph. */
+        std::vector<const COLLADAFW::Object*> mObjectsList;
 
         /** The buffer for fprintf. */
         char *mBuffer; // 2MB Puffer!!
@@ -223,9 +229,6 @@ namespace DAE2MA
         /** Pointer to the controller importer. */
         ControllerImporter* mControllerImporter;
 
-        /** The variable tells, how many times the document is read. */
-        size_t mNumDocumentParses;
-
         /** The error handler for the sax parser. */
         SaxErrorHandler mSaxParserErrorHandler;
 
@@ -508,7 +511,7 @@ namespace DAE2MA
         * First import materials, then effects and after this images.
         * The order of the import is relevant, about we have to know which effects are used 
         * by this material. After the import of the effects, we know which images we need.
-        * We have to import this before we write the animations in the second parsing, about
+        * We have to import this before we import the animations, about
         * to know the animated effects.
         */
         void importMaterials ();
@@ -517,7 +520,7 @@ namespace DAE2MA
         * First import materials, then effects and after this images.
         * The order of the import is relevant, about we have to know which effects are used 
         * by this material. After the import of the effects, we know which images we need.
-        * We have to import this before we write the animations in the second parsing, about
+        * We have to import this before we import the animations, about
         * to know the animated effects.
         */
         void importEffects ();
@@ -526,11 +529,18 @@ namespace DAE2MA
         * First import materials, then effects and after this images.
         * The order of the import is relevant, about we have to know which effects are used 
         * by this material. After the import of the effects, we know which images we need.
-        * We have to import this before we write the animations in the second parsing, about
+        * We have to import this before we import the animations, about
         * to know the animated effects.
         */
         void importImages ();
 
+        /**
+        * Imports the stored geometries, cameras, lights, animations and skin controller datas 
+        * in the order they have been parsed. They can be imported first after the visual scene, 
+        * the materials and the effects are imported and the scale animations are detected.
+        */
+        void importObjects ();
+
         /**
         * Imports the morph controllers.
         */
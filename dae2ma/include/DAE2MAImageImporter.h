@@ -38,9 +38,9 @@ namespace DAE2MA
 	private:
 
         /** 
-         * A copy of the framework's library image elements. 
+         * The framework's library image elements. The images are owned by the loader.
          */
-        std::map<COLLADAFW::UniqueId, COLLADAFW::Image*> mImagesMap;
+        std::map<COLLADAFW::UniqueId, const COLLADAFW::Image*> mImagesMap;
 	
         /**
          * The map holds the Maya image file objects for the unique image file ids.
@@ -64,54 +64,6 @@ namespace DAE2MA
             mMayaControllerNodesMap.clear ();
         }
 
-        {
-            std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::SkinController*> >::iterator it = mSkinControllersMap.begin ();
-            while ( it != mSkinControllersMap.end () )
-            {
-                std::vector<COLLADAFW::SkinController*>& skinControllers = it->second;
-                for ( size_t i=0; i<skinControllers.size (); ++i )
-                {
-                    COLLADAFW::SkinController* skinController = skinControllers[i];
-                    delete skinController;
-                }
-                skinControllers.clear ();
-                ++it;
-            }
-            mSkinControllersMap.clear ();
-        }
-
-        {
-            std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::MorphController*> >::iterator it = mMorphControllersMap.begin ();
-            while ( it != mMorphControllersMap.end () )
-            {
-                std::vector<COLLADAFW::MorphController*>& morphControllers = it->second;
-                for ( size_t i=0; i<morphControllers.size (); ++i )
-                {
-                    COLLADAFW::MorphController* morphController = morphControllers[i];
-                    delete morphController;
-                }
-                morphControllers.clear ();
-                ++it;
-            }
-            mMorphControllersMap.clear ();
-        }
-
-        {
-            std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::MorphController*> >::iterator it = mMorphTargetsMap.begin ();
-            while ( it != mMorphTargetsMap.end () )
-            {
-                std::vector<COLLADAFW::MorphController*>& morphControllers = it->second;
-                for ( size_t i=0; i<morphControllers.size (); ++i )
-                {
-                    COLLADAFW::MorphController* morphController = morphControllers[i];
-                    delete morphController;
-                }
-                morphControllers.clear ();
-                ++it;
-            }
-            mMorphControllersMap.clear ();
-        }
-
         {
             std::map<COLLADAFW::UniqueId, GeometryFilterData*>::iterator it = mGeometryFilterDataMap.begin ();
             while ( it != mGeometryFilterDataMap.end () )
@@ -127,8 +79,8 @@ namespace DAE2MA
     //------------------------------
     void ControllerImporter::storeController ( const COLLADAFW::Controller* controller )
     {
-        // This is the first parsing. We just copy the controller.
-        // On the second parsing, we create the maya skinController object with the data.
+        // This is the parsing. We just store the controller, it is owned by the loader.
+        // After the parsing, we create the maya skinController object with the data.
         if ( controller == 0 ) return;
 
         // Check if the current controller is already imported.
@@ -141,27 +93,27 @@ namespace DAE2MA
         case COLLADAFW::Controller::CONTROLLER_TYPE_SKIN:
             {
                 // Get the skin controller object.
-                COLLADAFW::SkinController* skinController = (COLLADAFW::SkinController*)controller;
+                const COLLADAFW::SkinController* skinController = (const COLLADAFW::SkinController*)controller;
 
                 // Returns the unique id of the source that gets modified by this controller. 
                 // Must be a mesh or a controller.
                 const COLLADAFW::UniqueId& sourceId = skinController->getSource ();
 
-                // Make a copy of the controller element.
-                mSkinControllersMap [ sourceId ].push_back ( new COLLADAFW::SkinController (*skinController) );
+                // Store the controller element.
+                mSkinControllersMap [ sourceId ].push_back ( skinController );
             }
             break;
         case COLLADAFW::Controller::CONTROLLER_TYPE_MORPH:
             {
                 // Get the skin controller object.
-                COLLADAFW::MorphController* morphController = (COLLADAFW::MorphController*)controller;
+                const COLLADAFW::MorphController* morphController = (const COLLADAFW::MorphController*)controller;
 
                 // Returns the unique id of the source that gets modified by this controller. 
                 // Must be a mesh.
                 const COLLADAFW::UniqueId& sourceId = morphController->getSource ();
 
-                // Make a copy of the controller element and push it in the list of morph controlled elements.
-                mMorphControllersMap [ sourceId ].push_back ( new COLLADAFW::MorphController (*morphController) );
+                // Push the controller element in the list of morph controlled elements.
+                mMorphControllersMap [ sourceId ].push_back ( morphController );
 
                 // The morph targets must also be stored (every morph target has to be imported).
                 const COLLADAFW::UniqueIdArray& morphTargets = morphController->getMorphTargets ();
@@ -169,7 +121,7 @@ namespace DAE2MA
                 {
                     const COLLADAFW::UniqueId& targetId = morphTargets [targetIndex];
                     if ( targetId != sourceId )
-                        mMorphTargetsMap [ targetId ].push_back ( new COLLADAFW::MorphController (*morphController) );
+                        mMorphTargetsMap [ targetId ].push_back ( morphController );
                 }
             }
             break;
@@ -183,13 +135,13 @@ namespace DAE2MA
     {
         // Iterate over all existing morph controllers and import them.
         // The map holds the morph controller objects for every source (mesh).
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::MorphController*> >::iterator it = mMorphControllersMap.begin ();
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::MorphController*> >::iterator it = mMorphControllersMap.begin ();
         while ( it != mMorphControllersMap.end () )
         {
-            std::vector<COLLADAFW::MorphController*> morphControllers = it->second;
+            std::vector<const COLLADAFW::MorphController*> morphControllers = it->second;
             for ( size_t i=0; i<morphControllers.size (); ++i )
             {
-                COLLADAFW::MorphController* morphController = morphControllers [i];
+                const COLLADAFW::MorphController* morphController = morphControllers [i];
                 importMorphController ( morphController );
             }
 
@@ -199,7 +151,7 @@ namespace DAE2MA
 
     // --------------------------------------------
     const bool ControllerImporter::importMorphController ( 
-        COLLADAFW::MorphController* morphController )
+        const COLLADAFW::MorphController* morphController )
     {
         if ( morphController == 0 ) return false;
 
@@ -223,7 +175,7 @@ namespace DAE2MA
         if ( transformIds == 0 ) 
         {
             // Check if the morph controller is referenced from a skin controller.
-            const std::vector<COLLADAFW::SkinController*>* skinControllers = findSkinControllersBySourceId ( morphControllerId );
+            const std::vector<const COLLADAFW::SkinController*>* skinControllers = findSkinControllersBySourceId ( morphControllerId );
             if ( skinControllers == 0 || skinControllers->size () == 0 ) return false;
         }
 
@@ -253,7 +205,7 @@ namespace DAE2MA
 
     // --------------------------------------------
     const String ControllerImporter::createBlendShape ( 
-        COLLADAFW::MorphController* morphController, 
+        const COLLADAFW::MorphController* morphController, 
         BlendShapeData& blendShapeData )
     {
         // The uniqueId.
@@ -286,7 +238,7 @@ namespace DAE2MA
         // Write the weights
         const COLLADAFW::UniqueIdArray& morphTargets = morphController->getMorphTargets ();
         size_t numMorphTargets = morphTargets.getCount ();
-        COLLADAFW::FloatOrDoubleArray& morphWeights = morphController->getMorphWeights ();
+        const COLLADAFW::FloatOrDoubleArray& morphWeights = morphController->getMorphWeights ();
         size_t numMorphWeights = morphWeights.getValuesCount ();
         if (  numMorphTargets != numMorphWeights )
         {
@@ -309,22 +261,13 @@ namespace DAE2MA
         }
         else
         {
-            const COLLADAFW::FloatOrDoubleArray::DataType& inputDataType = morphWeights.getType ();
-            if ( inputDataType == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_FLOAT )
-            {
-                COLLADAFW::FloatArray* floatArray = morphWeights.getFloatValues ();
-                blendShape->setWeight ( 0, numMorphWeights-1, floatArray->getData () );
-            }
-            else
+            blendShape->startWeight ( 0, numMorphWeights-1 );
+            for ( size_t weightIndex=0; weightIndex<numMorphWeights; ++weightIndex )
             {
-                blendShape->startWeight ( 0, numMorphWeights-1 );
-                for ( size_t weightIndex=0; weightIndex<numMorphWeights; ++weightIndex )
-                {
-                    float weight = getFloatValue ( morphWeights, weightIndex );
-                    blendShape->appendWeight ( weight );
-                }
-                blendShape->endWeight ();
+                float weight = getFloatValue ( morphWeights, weightIndex );
+                blendShape->appendWeight ( weight );
             }
+            blendShape->endWeight ();
         }
 
         // Import the animations.
@@ -405,7 +348,7 @@ namespace DAE2MA
 
         // Get all controller objects, which use the current skinControllerData.
         // We have to create the skinController data for every skinController object.
-        const std::vector<COLLADAFW::SkinController*>& skinControllers = findSkinControllersByDataId ( skinControllerDataId );
+        const std::vector<const COLLADAFW::SkinController*>& skinControllers = findSkinControllersByDataId ( skinControllerDataId );
         for ( size_t i=0; i<skinControllers.size (); ++i )
         {
             // Get the current controller.
@@ -877,18 +820,18 @@ namespace DAE2MA
     }
 
     // --------------------------------------------
-    const std::vector<COLLADAFW::SkinController*> ControllerImporter::findSkinControllersByDataId ( 
+    const std::vector<const COLLADAFW::SkinController*> ControllerImporter::findSkinControllersByDataId ( 
         const COLLADAFW::UniqueId& skinControllerDataId )
     {
-        std::vector<COLLADAFW::SkinController*> skinControllersNewList (0);
+        std::vector<const COLLADAFW::SkinController*> skinControllersNewList (0);
 
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::SkinController*> >::iterator it = mSkinControllersMap.begin ();
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::SkinController*> >::iterator it = mSkinControllersMap.begin ();
         while ( it != mSkinControllersMap.end () )
         {
-            std::vector<COLLADAFW::SkinController*>& skinControllers = it->second;
+            std::vector<const COLLADAFW::SkinController*>& skinControllers = it->second;
             for ( size_t i=0; i<skinControllers.size (); ++i )
             {
-                COLLADAFW::SkinController* skinController = skinControllers[i];
+                const COLLADAFW::SkinController* skinController = skinControllers[i];
                 if ( skinController->getSkinControllerData () == skinControllerDataId )
                 {
                     skinControllersNewList.push_back ( skinController );
@@ -913,10 +856,10 @@ namespace DAE2MA
     const COLLADAFW::MorphController* ControllerImporter::findMorphController ( 
         const COLLADAFW::UniqueId& controllerId )
     {
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::MorphController*> >::const_iterator it = mMorphControllersMap.begin ();
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::MorphController*> >::const_iterator it = mMorphControllersMap.begin ();
         while ( it != mMorphControllersMap.end () )
         {
-            const std::vector<COLLADAFW::MorphController*>& morphControllers = it->second;
+            const std::vector<const COLLADAFW::MorphController*>& morphControllers = it->second;
             for ( size_t i=0; i<morphControllers.size (); ++i )
             {
                 const COLLADAFW::MorphController* morphController = morphControllers[i];
@@ -932,10 +875,10 @@ namespace DAE2MA
     const COLLADAFW::SkinController* ControllerImporter::findSkinController ( 
         const COLLADAFW::UniqueId& controllerId )
     {
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::SkinController*> >::const_iterator it = mSkinControllersMap.begin ();
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::SkinController*> >::const_iterator it = mSkinControllersMap.begin ();
         while ( it != mSkinControllersMap.end () )
         {
-            const std::vector<COLLADAFW::SkinController*>& skinControllers = it->second;
+            const std::vector<const COLLADAFW::SkinController*>& skinControllers = it->second;
             for ( size_t i=0; i<skinControllers.size (); ++i )
             {
                 const COLLADAFW::SkinController* skinController = skinControllers[i];
@@ -954,13 +897,13 @@ namespace DAE2MA
         bool hasController = false;
 
         // Get the skin controllers and append them in the list.
-        const std::vector<COLLADAFW::SkinController*>* skinControllers = findSkinControllersBySourceId ( sourceId );
+        const std::vector<const COLLADAFW::SkinController*>* skinControllers = findSkinControllersBySourceId ( sourceId );
         if ( skinControllers ) hasController = true;
 
         if ( !hasController )
         {
             // Get the morph controllers and append them in the list.
-            const std::vector<COLLADAFW::MorphController*>* morphControllers = findMorphControllersBySourceId ( sourceId );
+            const std::vector<const COLLADAFW::MorphController*>* morphControllers = findMorphControllersBySourceId ( sourceId );
             if ( morphControllers ) hasController = true;
         }
 
@@ -968,26 +911,26 @@ namespace DAE2MA
     }
 
     // --------------------------------------------
-    std::vector<COLLADAFW::Controller*> ControllerImporter::findControllersBySourceId ( 
+    std::vector<const COLLADAFW::Controller*> ControllerImporter::findControllersBySourceId ( 
         const COLLADAFW::UniqueId& sourceId ) 
     {
         // Push the skin controllers in the list.
-        std::vector<COLLADAFW::Controller*> controllers;
+        std::vector<const COLLADAFW::Controller*> controllers;
 
         // Get the skin controllers and append them in the list.
-        std::vector<COLLADAFW::SkinController*>* skinControllers = findSkinControllersBySourceId ( sourceId );
+        std::vector<const COLLADAFW::SkinController*>* skinControllers = findSkinControllersBySourceId ( sourceId );
         if ( skinControllers )
             controllers.assign ( skinControllers->begin (), skinControllers->end () );
 
         // Get the morph controllers and append them in the list.
-        std::vector<COLLADAFW::MorphController*>* morphControllers = findMorphControllersBySourceId ( sourceId );
+        std::vector<const COLLADAFW::MorphController*>* morphControllers = findMorphControllersBySourceId ( sourceId );
         if ( morphControllers )
         {
             if ( controllers.size () > 0 )
             {
                 for ( size_t i=0; i<morphControllers->size (); ++i )
                 {
-                    COLLADAFW::MorphController* morphController = (*morphControllers) [i];
+                    const COLLADAFW::MorphController* morphController = (*morphControllers) [i];
                     controllers.push_back ( morphController );
                 }
             }
@@ -1001,84 +944,84 @@ namespace DAE2MA
     }
     
     // --------------------------------------------
-    std::vector<COLLADAFW::MorphController*>* ControllerImporter::findMorphControllersByMorphTargetId ( 
+    std::vector<const COLLADAFW::MorphController*>* ControllerImporter::findMorphControllersByMorphTargetId ( 
         const COLLADAFW::UniqueId& geometryId )
     {
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::MorphController*> >::iterator it;
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::MorphController*> >::iterator it;
         it = mMorphTargetsMap.find ( geometryId );
         if ( it != mMorphTargetsMap.end () )
         {
-            std::vector<COLLADAFW::MorphController*>& morphControllers = it->second;
+            std::vector<const COLLADAFW::MorphController*>& morphControllers = it->second;
             return &morphControllers;
         }
         return 0;
     }
 
     // --------------------------------------------
-    const std::vector<COLLADAFW::MorphController*>* ControllerImporter::findMorphControllersByMorphTargetId ( 
+    const std::vector<const COLLADAFW::MorphController*>* ControllerImporter::findMorphControllersByMorphTargetId ( 
         const COLLADAFW::UniqueId& geometryId ) const
     {
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::MorphController*> >::const_iterator it;
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::MorphController*> >::const_iterator it;
         it = mMorphTargetsMap.find ( geometryId );
         if ( it != mMorphTargetsMap.end () )
         {
-            const std::vector<COLLADAFW::MorphController*>& morphControllers = it->second;
+            const std::vector<const COLLADAFW::MorphController*>& morphControllers = it->second;
             return &morphControllers;
         }
         return 0;
     }
 
     // --------------------------------------------
-    std::vector<COLLADAFW::MorphController*>* ControllerImporter::findMorphControllersBySourceId ( 
+    std::vector<const COLLADAFW::MorphController*>* ControllerImporter::findMorphControllersBySourceId ( 
         const COLLADAFW::UniqueId& sourceId ) 
     {
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::MorphController*> >::iterator it;
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::MorphController*> >::iterator it;
         it = mMorphControllersMap.find ( sourceId );
         if ( it != mMorphControllersMap.end () )
         {
-            std::vector<COLLADAFW::MorphController*>& morphControllers = it->second;
+            std::vector<const COLLADAFW::MorphController*>& morphControllers = it->second;
             return &morphControllers;
         }
         return 0;
     }
 
     // --------------------------------------------
-    const std::vector<COLLADAFW::MorphController*>* ControllerImporter::findMorphControllersBySourceId ( 
+    const std::vector<const COLLADAFW::MorphController*>* ControllerImporter::findMorphControllersBySourceId ( 
         const COLLADAFW::UniqueId& sourceId ) const
     {
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::MorphController*> >::const_iterator it;
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::MorphController*> >::const_iterator it;
         it = mMorphControllersMap.find ( sourceId );
         if ( it != mMorphControllersMap.end () )
         {
-            const std::vector<COLLADAFW::MorphController*>& morphControllers = it->second;
+            const std::vector<const COLLADAFW::MorphController*>& morphControllers = it->second;
             return &morphControllers;
         }
         return 0;
     }
 
     // --------------------------------------------
-    std::vector<COLLADAFW::SkinController*>* ControllerImporter::findSkinControllersBySourceId ( 
+    std::vector<const COLLADAFW::SkinController*>* ControllerImporter::findSkinControllersBySourceId ( 
         const COLLADAFW::UniqueId& sourceId ) 
     {
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::SkinController*> >::iterator it;
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::SkinController*> >::iterator it;
         it = mSkinControllersMap.find ( sourceId );
         if ( it != mSkinControllersMap.end () )
         {
-            std::vector<COLLADAFW::SkinController*>& skinControllers = it->second;
+            std::vector<const COLLADAFW::SkinController*>& skinControllers = it->second;
             return &skinControllers;
         }
         return 0;
     }
 
     // --------------------------------------------
-    const std::vector<COLLADAFW::SkinController*>* ControllerImporter::findSkinControllersBySourceId ( 
+    const std::vector<const COLLADAFW::SkinController*>* ControllerImporter::findSkinControllersBySourceId ( 
         const COLLADAFW::UniqueId& sourceId ) const
     {
-        std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::SkinController*> >::const_iterator it;
+        std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::SkinController*> >::const_iterator it;
         it = mSkinControllersMap.find ( sourceId );
         if ( it != mSkinControllersMap.end () )
         {
-            const std::vector<COLLADAFW::SkinController*>& skinControllers = it->second;
+            const std::vector<const COLLADAFW::SkinController*>& skinControllers = it->second;
             return &skinControllers;
         }
         return 0;
@@ -1089,10 +1032,10 @@ namespace DAE2MA
         const COLLADAFW::UniqueId& controllerId ) const
     {
         {
-            std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::SkinController*> >::const_iterator it = mSkinControllersMap.begin ();
+            std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::SkinController*> >::const_iterator it = mSkinControllersMap.begin ();
             while ( it != mSkinControllersMap.end () )
             {
-                const std::vector<COLLADAFW::SkinController*>& skinControllers = it->second;
+                const std::vector<const COLLADAFW::SkinController*>& skinControllers = it->second;
                 for ( size_t i=0; i<skinControllers.size (); ++i )
                 {
                     const COLLADAFW::SkinController* skinController = skinControllers[i];
@@ -1104,10 +1047,10 @@ namespace DAE2MA
         }
 
         {
-            std::map<COLLADAFW::UniqueId, std::vector<COLLADAFW::MorphController*> >::const_iterator it = mMorphControllersMap.begin ();
+            std::map<COLLADAFW::UniqueId, std::vector<const COLLADAFW::MorphController*> >::const_iterator it = mMorphControllersMap.begin ();
             while ( it != mMorphControllersMap.end () )
             {
-                const std::vector<COLLADAFW::MorphController*>& morphControllers = it->second;
+                const std::vector<const COLLADAFW::MorphController*>& morphControllers = it->second;
                 for ( size_t i=0; i<morphControllers.size (); ++i )
                 {
                     const COLLADAFW::MorphController* morphController = morphControllers[i];
@@ -1249,7 +1192,7 @@ namespace DAE2MA
 
         // Get the skin controllers, which instantiates the morph controller 
         // and get the transformations of the skin controller.
-        const std::vector<COLLADAFW::SkinController*>* skinControllers = controllerImporter->findSkinControllersBySourceId ( controllerId );
+        const std::vector<const COLLADAFW::SkinController*>* skinControllers = controllerImporter->findSkinControllersBySourceId ( controllerId );
         if ( skinControllers == 0 ) 
         {
             // The current morph controller is not referenced, neither from the scene 
@@ -110,6 +110,7 @@ namespace DAE2MA
         , mMaterialsList (0)
         , mEffectsList (0)
         , mAnimationListsList (0)
+        , mObjectsList (0)
         , mFile ( 0 )
         , mNodeImporter (0)
         , mVisualSceneImporter (0)
@@ -121,7 +122,6 @@ namespace DAE2MA
         , mImageImporter (0)
         , mAnimationImporter (0)
         , mControllerImporter (0)
-        , mNumDocumentParses (0)
         , mUpAxisType ( COLLADAFW::FileInfo::Y_UP )
         , mLinearUnitConvertFactor ( 1.0 )
         , mLinearUnitMayaBindShapeBugConvertFactor ( 1.0 )
@@ -143,49 +143,6 @@ namespace DAE2MA
         // Close the maya ascii file
         closeMayaAsciiFile ();
 
-        // Don't delete the objects earlier, other parts use the elements!
-        delete mInstanceVisualScene;
-
-        // A copy of the framework's library visual scenes elements. 
-        for ( size_t i=0; i< mVisualScenesList.size (); ++i )
-        {
-            COLLADAFW::VisualScene* visualScene = mVisualScenesList [i];
-            delete visualScene;
-        }
-        mVisualScenesList.clear ();
-
-        // A copy of the framework's library nodes elements. 
-        for ( size_t i=0; i< mLibraryNodesList.size (); ++i )
-        {
-            COLLADAFW::LibraryNodes* libraryNodes = mLibraryNodesList [i];
-            delete libraryNodes;
-        }
-        mLibraryNodesList.clear ();
-
-        // A copy of the framework's library materials elements. 
-        for ( size_t i=0; i< mMaterialsList.size (); ++i )
-        {
-            COLLADAFW::Material* material = mMaterialsList [i];
-            delete material;
-        }
-        mMaterialsList.clear ();
-
-        // A copy of the framework's library effect elements. 
-        for ( size_t i=0; i< mEffectsList.size (); ++i )
-        {
-            COLLADAFW::Effect* effect = mEffectsList [i];
-            delete effect;
-        }
-        mEffectsList.clear ();
-
-        // A copy of the framework's library animationList elements. 
-        for ( size_t i=0; i< mAnimationListsList.size (); ++i )
-        {
-            COLLADAFW::AnimationList* animationList = mAnimationListsList [i];
-            delete animationList;
-        }
-        mAnimationListsList.clear ();
-        
         // Delete the library elements.
         releaseLibraries(); 
 
@@ -238,7 +195,7 @@ namespace DAE2MA
         createLibraries ();
 
         // Load the collada document into the collada framework.
-        mParseStep = FIRST_PARSING;
+        mParseStep = PARSING;
 
         // TODO
         int objectFlags = 
@@ -337,75 +294,53 @@ namespace DAE2MA
     //-----------------------------
     void DocumentImporter::finish ()
     {
-        // First parse is done.
-        if ( mParseStep <= COPY_ELEMENTS )
-        {
-            // The order of the steps here is very important!
-            mParseStep = ELEMENTS_COPIED;
-
-            // Create the scene graph and map the unique node ids to the framwork node objects.
-            importNodes ();
-
-            // Import referenced visual scene
-            importVisualScene ();
-
-            // After the import of the visual scene, we can determine the scale animations.
-            detectScaleAnimations ();
-
-            // Import morph controllers 
-            importMorphControllers ();
-
-            // First import materials, then effects and after this images.
-            // The order of the import is relevant, about we have to know which effects are used 
-            // by this material. After the import of the effects, we know which images we need.
-            // We have to import this before we write the animations in the second parsing, about
-            // to know the animated effects.
-            importMaterials ();
-            importEffects ();
-            importImages ();
-
-            // Get the minimum and the maximum time values of the animations to get the start 
-            // time and the end time of the animation. This times we have to set as the 
-            // "playbackOptions" in the "sceneConfigurationScriptNode".
-            importPlaybackOptions ();
-
-            // Start the next parsing.
-            mParseStep = SECOND_PARSING;
-
-            // TODO Not active in the current implementation!
-            int objectFlags = 
-                COLLADASaxFWL::Loader::GEOMETRY_FLAG |
-                COLLADASaxFWL::Loader::EFFECT_FLAG |
-                COLLADASaxFWL::Loader::CAMERA_FLAG |
-                COLLADASaxFWL::Loader::IMAGE_FLAG |
-                COLLADASaxFWL::Loader::LIGHT_FLAG |
-                COLLADASaxFWL::Loader::ANIMATION_FLAG |
-                COLLADASaxFWL::Loader::ANIMATION_LIST_FLAG | 
-                COLLADASaxFWL::Loader::SKIN_CONTROLLER_DATA_FLAG;
-            //mSaxLoader.setObjectFlags ( objectFlags );
-
-            readColladaDocument ();
-        }
+        // The parse is done, all elements are stored.
+        // The order of the steps here is very important!
+        mParseStep = ELEMENTS_STORED;
 
-        // If the last read is ready, we can write the connections and close the file.
-        --mNumDocumentParses;
-        if ( mNumDocumentParses == 0 ) 
-        {
-            mParseStep = GEOMETRY_IMPORTED;
+        // Create the scene graph and map the unique node ids to the framwork node objects.
+        importNodes ();
 
-            // After we have imported the geometries, we can create the necessary uv-choosers.
-            // We can't create them earlier, about we need to know, if the geometry has more than 
-            // one uv-set (texture coordinates).
-            createUvChoosers ();
+        // Import referenced visual scene
+        importVisualScene ();
 
-            // After the complete read of the collada document, 
-            // the connections can be written into the maya file.
-            mParseStep = MAKE_CONNECTIONS;
-            writeConnections ();
+        // After the import of the visual scene, we can determine the scale animations.
+        detectScaleAnimations ();
 
-            // Close the file
-            closeMayaAsciiFile ();
-        }
+        // Import morph controllers 
+        importMorphControllers ();
+
+        // First import materials, then effects and after this images.
+        // The order of the import is relevant, about we have to know which effects are used 
+        // by this material. After the import of the effects, we know which images we need.
+        // We have to import this before we import the animations, about
+        // to know the animated effects.
+        importMaterials ();
+        importEffects ();
+        importImages ();
+
+        // Import the geometries, cameras, lights, animations and skin controller datas.
+        importObjects ();
+
+        // Get the minimum and the maximum time values of the animations to get the start 
+        // time and the end time of the animation. This times we have to set as the 
+        // "playbackOptions" in the "sceneConfigurationScriptNode".
+        importPlaybackOptions ();
+
+        mParseStep = GEOMETRY_IMPORTED;
+
+        // After we have imported the geometries, we can create the necessary uv-choosers.
+        // We can't create them earlier, about we need to know, if the geometry has more than 
+        // one uv-set (texture coordinates).
+        createUvChoosers ();
+
+        // After the complete read of the collada document, 
+        // the connections can be written into the maya file.
+        mParseStep = MAKE_CONNECTIONS;
+        writeConnections ();
+
+        // Close the file
+        closeMayaAsciiFile ();
     }
 
     //-----------------------------
@@ -459,9 +394,11 @@ namespace DAE2MA
     {
         // See revision 511 (generate new loader object without setting object flags).
         COLLADASaxFWL::Loader saxLoader ( &mSaxParserErrorHandler );
+        saxLoader.registerExtraDataCallbackHandler ( &mMayaIdCallbackHandler );
 
-        if ( mParseStep == FIRST_PARSING )
-            saxLoader.registerExtraDataCallbackHandler ( &mMayaIdCallbackHandler );
+        // The loader keeps all framework objects until it is destroyed, so we can store 
+        // them instead of copying and import them in finish().
+        saxLoader.setRetainObjects ( true );
 
         // TODO
         COLLADAFW::Root root ( &saxLoader, this );
@@ -469,8 +406,16 @@ namespace DAE2MA
         String filename = getColladaFilename ();
         String fileUriString = URI::nativePathToUri ( filename );
 
-        ++mNumDocumentParses;
         root.loadDocument ( fileUriString );
+
+        // The stored elements are deleted with the loader.
+        mInstanceVisualScene = 0;
+        mVisualScenesList.clear ();
+        mLibraryNodesList.clear ();
+        mMaterialsList.clear ();
+        mEffectsList.clear ();
+        mAnimationListsList.clear ();
+        mObjectsList.clear ();
     }
 
     //-----------------------------
@@ -698,12 +643,8 @@ namespace DAE2MA
             return false;
         }
 
-        if ( mParseStep <= COPY_ELEMENTS ) 
-        {
-            // Make a copy of the instantiated visual scene element.
-            mParseStep = COPY_ELEMENTS;
-            mInstanceVisualScene = scene->getInstanceVisualScene ()->clone ();
-        }
+        // Store the instantiated visual scene element.
+        mInstanceVisualScene = scene->getInstanceVisualScene ();
 
         return true;
     }
@@ -711,7 +652,7 @@ namespace DAE2MA
     //-----------------------------
     void DocumentImporter::importNodes ()
     {
-        if ( mParseStep >= ELEMENTS_COPIED )
+        if ( mParseStep >= ELEMENTS_STORED )
         {
             // Get the visual scene element to import.
             for ( size_t i=0; i<mVisualScenesList.size (); ++i )
@@ -748,12 +689,8 @@ namespace DAE2MA
             return false;
         }
 
-        if ( mParseStep <= COPY_ELEMENTS )
-        {
-            // Make a copy of the visual scene element and push it into the list of visual scenes.
-            mParseStep = COPY_ELEMENTS;
-            mVisualScenesList.push_back ( new COLLADAFW::VisualScene ( *visualScene ) );
-        }
+        // Push the visual scene element into the list of visual scenes.
+        mVisualScenesList.push_back ( visualScene );
 
         return true;
     }
@@ -761,7 +698,7 @@ namespace DAE2MA
     //-----------------------------
     void DocumentImporter::importVisualScene ()
     {
-        if ( mParseStep >= ELEMENTS_COPIED )
+        if ( mParseStep >= ELEMENTS_STORED )
         {
             // The file must already exist.
             if ( mFile == 0 )
@@ -794,12 +731,8 @@ namespace DAE2MA
             return false;
         }
 
-        if ( mParseStep <= COPY_ELEMENTS )
-        {
-            // Make a copy of the library nodes element and push it into the list of library nodes.
-            mParseStep = COPY_ELEMENTS;
-            mLibraryNodesList.push_back ( new COLLADAFW::LibraryNodes ( *libraryNodes ) );
-        }
+        // Push the library nodes element into the list of library nodes.
+        mLibraryNodesList.push_back ( libraryNodes );
 
         return true;
     }
@@ -832,12 +765,8 @@ namespace DAE2MA
             return false;
         }
 
-        if ( mParseStep <= COPY_ELEMENTS )
-        {
-            // Make a copy of the material element and push it into the list.
-            mParseStep = COPY_ELEMENTS;
-            mMaterialsList.push_back ( new COLLADAFW::Material ( *material ) );
-        }
+        // Push the material element into the list.
+        mMaterialsList.push_back ( material );
 
         return true;
     }
@@ -853,7 +782,7 @@ namespace DAE2MA
         }
 
         // Import the materials data.
-        if ( mParseStep >= ELEMENTS_COPIED )
+        if ( mParseStep >= ELEMENTS_STORED )
         {
             for ( size_t i=0; i<mMaterialsList.size (); ++i )
             {
@@ -873,12 +802,8 @@ namespace DAE2MA
             return false;
         }
 
-        if ( mParseStep <= COPY_ELEMENTS )
-        {
-            // Make a copy of the effect element and push it into the list.
-            mParseStep = COPY_ELEMENTS;
-            mEffectsList.push_back ( new COLLADAFW::Effect ( *effect ) );
-        }
+        // Push the effect element into the list.
+        mEffectsList.push_back ( effect );
 
         return true;
     }
@@ -894,7 +819,7 @@ namespace DAE2MA
         }
 
         // Import the effects data.
-        if ( mParseStep >= ELEMENTS_COPIED )
+        if ( mParseStep >= ELEMENTS_STORED )
         {
             for ( size_t i=0; i<mEffectsList.size (); ++i )
             {
@@ -914,18 +839,13 @@ namespace DAE2MA
             return false;
         }
 
-        // We first should copy the images, about it's possible, that we have to create an 
+        // We first should store the images, about it's possible, that we have to create an 
         // image for more than one time. This happens if:
         // a) one image is referenced from multiple effects 
         // b) one image is referenced in multiple samplers in one effect 
         // c) one effect uses the same sampler multiple times.
         // We have to dublicate the image, about the possibility to create multiple uv-sets on it.
-        if ( mParseStep <= COPY_ELEMENTS )
-        {
-            // Make a copy of the material element and push it into the list.
-            mParseStep = COPY_ELEMENTS;
-            mImageImporter->storeImage ( image );
-        }
+        mImageImporter->storeImage ( image );
 
         return true;
     }
@@ -941,12 +861,53 @@ namespace DAE2MA
         }
 
         // Import the images data.
-        if ( mParseStep >= ELEMENTS_COPIED )
+        if ( mParseStep >= ELEMENTS_STORED )
         {
             mImageImporter->importImages ();
         }
     }
 
+    //-----------------------------
+    void DocumentImporter::importObjects ()
+    {
+        // The file must already exist.
+        if ( mFile == 0 )
+        {
+            std::cerr << "DocumentImporter::importObjects(): Cant't import, no maya file exist!" << std::endl;
+            return;
+        }
+
+        // Import the objects after the scale animations are detected.
+        if ( mParseStep >= VISUAL_SCENE_IMPORTED )
+        {
+            for ( size_t i=0; i<mObjectsList.size (); ++i )
+            {
+                const COLLADAFW::Object* object = mObjectsList [i];
+                switch ( object->getClassId () )
+                {
+                case COLLADAFW::COLLADA_TYPE::GEOMETRY:
+                    mGeometryImporter->importGeometry ( COLLADAFW::objectSafeCast<COLLADAFW::Geometry> ( object ) );
+                    break;
+                case COLLADAFW::COLLADA_TYPE::CAMERA:
+                    mCameraImporter->importCamera ( COLLADAFW::objectSafeCast<COLLADAFW::Camera> ( object ) );
+                    break;
+                case COLLADAFW::COLLADA_TYPE::LIGHT:
+                    mLightImporter->importLight ( COLLADAFW::objectSafeCast<COLLADAFW::Light> ( object ) );
+                    break;
+                case COLLADAFW::COLLADA_TYPE::ANIMATION:
+                    mAnimationImporter->importAnimation ( COLLADAFW::objectSafeCast<COLLADAFW::Animation> ( object ) );
+                    mParseStep = ANIMATIONS_IMPORTED;
+                    break;
+                case COLLADAFW::COLLADA_TYPE::SKIN_DATA:
+                    mControllerImporter->importSkinControllerData ( COLLADAFW::objectSafeCast<COLLADAFW::SkinControllerData> ( object ) );
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+    }
+
     //-----------------------------
     bool DocumentImporter::writeGeometry ( const COLLADAFW::Geometry* geometry )
     {
@@ -957,11 +918,8 @@ namespace DAE2MA
             return false;
         }
 
-        if ( mParseStep >= SECOND_PARSING )
-        {
-            // Import the data.
-            mGeometryImporter->importGeometry ( geometry );
-        }
+        // Store the geometry, it is imported after the scene graph.
+        mObjectsList.push_back ( geometry );
 
         return true;
     }
@@ -976,11 +934,8 @@ namespace DAE2MA
             return false;
         }
 
-        if ( mParseStep >= SECOND_PARSING )
-        {
-            // Import the data.
-            mCameraImporter->importCamera ( camera );
-        }
+        // Store the camera, it is imported after the scene graph.
+        mObjectsList.push_back ( camera );
 
         return true;
     }
@@ -995,11 +950,8 @@ namespace DAE2MA
             return false;
         }
 
-        if ( mParseStep >= SECOND_PARSING )
-        {
-            // Import the data.
-            mLightImporter->importLight ( light );
-        }
+        // Store the light, it is imported after the scene graph.
+        mObjectsList.push_back ( light );
 
         return true;
     }
@@ -1014,11 +966,8 @@ namespace DAE2MA
             return false;
         }
 
-        if ( mParseStep >= SECOND_PARSING )
-        {
-            getAnimationImporter ()->importAnimation ( animation );
-            mParseStep = ANIMATIONS_IMPORTED;
-        }
+        // Store the animation, it is imported after the scale animations are detected.
+        mObjectsList.push_back ( animation );
 
         return true;
     }
@@ -1037,27 +986,20 @@ namespace DAE2MA
         // scale animation. To get this info, we have to get the transformations of the transform 
         // animations and have to check for scale animations. Scale animations must have a physical 
         // dimension number (double) instead of length (distance)!
-        // The transformations exist after the first parsing, after the visual scene is imported.
-        // So we have to store the animation lists in the first parsing. After the visual scene 
+        // The transformations exist after the parsing, after the visual scene is imported.
+        // So we have to store the animation lists on parsing. After the visual scene 
         // import we can iterate over the animation lists and determine the scale animations. After 
         // we know the scale animations, we can import the animations with the correct physical 
         // dimension. After we have imported all animations, we can write the animation connections
         // from the stored animation lists.
         // Order of the parse steps:
-        // COPY_ELEMENTS
+        // ELEMENTS_STORED
         // VISUAL_SCENE_IMPORTED
-        // SECOND_PARSING
         // ANIMATIONS_IMPORTED
         // MAKE_CONNECTIONS
 
-
-        // On first parsing, we have to store the animation lists.
-        if ( mParseStep <= COPY_ELEMENTS )
-        {
-            // Make a copy of the visual scene element and push it into the list of visual scenes.
-            mParseStep = COPY_ELEMENTS;
-            mAnimationListsList.push_back ( new COLLADAFW::AnimationList ( *animationList ) );
-        }
+        // Push the animation list element into the list of animation lists.
+        mAnimationListsList.push_back ( animationList );
 
         return true;
     }
@@ -1068,7 +1010,7 @@ namespace DAE2MA
         // After we have imported the visual scene, we can detect the scale animations.
         if ( mParseStep == MAKE_CONNECTIONS )
         {
-            std::vector<COLLADAFW::AnimationList*>::const_iterator it = mAnimationListsList.begin ();
+            std::vector<const COLLADAFW::AnimationList*>::const_iterator it = mAnimationListsList.begin ();
             while ( it != mAnimationListsList.end () )
             {
                 const COLLADAFW::AnimationList* animationList = *it;
@@ -1084,7 +1026,7 @@ namespace DAE2MA
         // After we have imported the visual scene, we can detect the scale animations.
         if ( mParseStep >= VISUAL_SCENE_IMPORTED )
         {
-            std::vector<COLLADAFW::AnimationList*>::const_iterator it = mAnimationListsList.begin ();
+            std::vector<const COLLADAFW::AnimationList*>::const_iterator it = mAnimationListsList.begin ();
             while ( it != mAnimationListsList.end () )
             {
                 const COLLADAFW::AnimationList* animationList = *it;
@@ -1122,10 +1064,8 @@ namespace DAE2MA
             return false;
         }
         
-        if ( mParseStep >= SECOND_PARSING )
-        {
-            mControllerImporter->importSkinControllerData ( skinControllerData );
-        }
+        // Store the skin controller data, it is imported after the scene graph.
+        mObjectsList.push_back ( skinControllerData );
 
         return true;
     }
@@ -1141,12 +1081,8 @@ namespace DAE2MA
             return false;
         }
 
-        if ( mParseStep <= COPY_ELEMENTS )
-        {
-            // Make a copy of the controller element and push it into the list.
-            mParseStep = COPY_ELEMENTS;
-            mControllerImporter->storeController ( controller );
-        }
+        // Store the controller element.
+        mControllerImporter->storeController ( controller );
 
         return true;
     }
@@ -1154,7 +1090,7 @@ namespace DAE2MA
     //-----------------------------
     void DocumentImporter::importMorphControllers ()
     {
-        if ( mParseStep >= ELEMENTS_COPIED )
+        if ( mParseStep >= ELEMENTS_STORED )
         {
             // The file must already exist.
             if ( mFile == 0 )
@@ -1248,7 +1184,7 @@ namespace DAE2MA
     //-----------------------------
     const COLLADAFW::Material* DocumentImporter::getMaterialById ( const COLLADAFW::UniqueId& materialId )
     {
-        std::vector<COLLADAFW::Material*>::const_iterator it = mMaterialsList.begin ();
+        std::vector<const COLLADAFW::Material*>::const_iterator it = mMaterialsList.begin ();
         while ( it != mMaterialsList.end () )
         {
             if ( materialId == (*it)->getUniqueId () )
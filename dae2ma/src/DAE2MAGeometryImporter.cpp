@@ -120,7 +120,7 @@ namespace DAE2MA
         VisualSceneImporter* visualSceneImporter = getDocumentImporter ()->getVisualSceneImporter ();
 
         // Check if we need to import the geometry, about it is referenced from a morph target.
-        const std::vector<COLLADAFW::MorphController*>* morphControllers = controllerImporter->findMorphControllersByMorphTargetId ( geometryId );
+        const std::vector<const COLLADAFW::MorphController*>* morphControllers = controllerImporter->findMorphControllersByMorphTargetId ( geometryId );
         if ( morphControllers == 0 ) return;
 
         for ( size_t i=0; i<morphControllers->size (); ++i )
@@ -141,7 +141,7 @@ namespace DAE2MA
                 // A morph controller can also be referenced from a skin controller. 
                 // In this case, we have to check, if the skin controller is referenced from 
                 // the scene graph. If so, we can start to import the geometry.
-                const std::vector<COLLADAFW::SkinController*>* skinControllers = controllerImporter->findSkinControllersBySourceId ( morphControllerId );
+                const std::vector<const COLLADAFW::SkinController*>* skinControllers = controllerImporter->findSkinControllersBySourceId ( morphControllerId );
                 if ( skinControllers == 0 || skinControllers->size () == 0 ) continue;
 
                 for ( size_t j=0; j<skinControllers->size (); ++j )
@@ -188,7 +188,7 @@ namespace DAE2MA
 
         // Check, if the mesh is directly referenced from a controller object.
         const COLLADAFW::UniqueId& geometryId = mesh->getUniqueId ();
-        std::vector<COLLADAFW::Controller*> controllers = controllerImporter->findControllersBySourceId ( geometryId );
+        std::vector<const COLLADAFW::Controller*> controllers = controllerImporter->findControllersBySourceId ( geometryId );
         if ( controllers.size () == 0 ) return;
         for ( size_t i=0; i<controllers.size (); ++i )
         {
@@ -206,7 +206,7 @@ namespace DAE2MA
             if ( controller->getControllerType () == COLLADAFW::Controller::CONTROLLER_TYPE_MORPH )
             {
                 // Import the geometry for skin controllers, which use a morph controller, which use the geometry.
-                const COLLADAFW::MorphController* morphController = (COLLADAFW::MorphController*)controller;
+                const COLLADAFW::MorphController* morphController = (const COLLADAFW::MorphController*)controller;
                 if ( importSkinAndMorphControlledGeometry ( mesh, morphController, isImported, hasGeometryInstance ) )
                     isImported = true;
             }
@@ -263,7 +263,7 @@ namespace DAE2MA
         const COLLADAFW::UniqueId& morphControllerId = morphController->getUniqueId ();
 
         // Get all skin controllers, who reference the current morph controller.
-        const std::vector<COLLADAFW::SkinController*>* skinControllers = controllerImporter->findSkinControllersBySourceId ( morphControllerId );
+        const std::vector<const COLLADAFW::SkinController*>* skinControllers = controllerImporter->findSkinControllersBySourceId ( morphControllerId );
         if ( skinControllers == 0 || skinControllers->size () == 0 ) return retValue;
         const size_t numSkinControllers = skinControllers->size ();
 
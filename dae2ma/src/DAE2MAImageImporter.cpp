@@ -30,22 +30,13 @@ namespace DAE2MA
     //------------------------------
 	ImageImporter::~ImageImporter()
 	{
-        // A copy of the framework's library image elements. 
-        std::map<COLLADAFW::UniqueId, COLLADAFW::Image*>::iterator it = mImagesMap.begin ();
-        while ( it != mImagesMap.end () )
-        {
-            COLLADAFW::Image* image = it->second;
-            delete image;
-            ++it;
-        }
-        mImagesMap.clear ();
 	}
 
     //------------------------------
     void ImageImporter::storeImage ( const COLLADAFW::Image* image )
     {
         const COLLADAFW::UniqueId& imageId = image->getUniqueId ();
-        mImagesMap [imageId] = new COLLADAFW::Image ( *image );
+        mImagesMap [imageId] = image;
     }
 
     //------------------------------
@@ -151,7 +142,7 @@ namespace DAE2MA
     //------------------------------
     const COLLADAFW::Image* ImageImporter::findImage ( const COLLADAFW::UniqueId& imageId )
     {
-        std::map<COLLADAFW::UniqueId, COLLADAFW::Image*>::iterator it = mImagesMap.find ( imageId );
+        std::map<COLLADAFW::UniqueId, const COLLADAFW::Image*>::iterator it = mImagesMap.find ( imageId );
         if ( it != mImagesMap.end () ) 
             return it->second;
         return 0;
@@ -21,7 +21,7 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADAFWArrayPrimitiveType.h"
 #include "COLLADAFWMeshVertexData.h"
 
-#include <map>
+#include <vector>
 
 namespace COLLADAFW
 {
@@ -42,14 +42,53 @@ namespace DAE2Ogre
 			unsigned int normalIndex;
 			unsigned int textureIndex;
 			unsigned int colorIndex;
-			bool operator<(const Tuple& rhs) const;
+			bool operator==(const Tuple& rhs) const;
+		};
+
+		/** Maps each tuple to its vertex index. The vertex indices are assigned in the order the tuples are 
+		added, starting with 0. The tuples are stored in one pool in this order, i.e. the position of a tuple
+		in the pool is its vertex index. An open addressing hash table with linear probing holds the vertex
+		indices.*/
+		class TupleIndexMap
+		{
+		private:
+			typedef std::vector<Tuple> TupleList;
+			typedef std::vector<int> IndexList;
+
+			/** Marks an unused slot in mTable.*/
+			static const int EMPTY_SLOT = -1;
+
+			/** All tuples added so far, in the order they have been added.*/
+			TupleList mTuples;
+
+			/** The hash table. Each slot contains the index of a tuple in mTuples or EMPTY_SLOT. Its size is a 
+			power of two and at least twice the number of tuples.*/
+			IndexList mTable;
+
+			/** The size of mTable minus one.*/
+			size_t mTableMask;
+
+		public:
+			TupleIndexMap();
+
+			/** Returns the vertex index of @a tuple. If @a tuple has not been added before, it is added with
+			the next vertex index and @a added is set to true.*/
+			int addTuple( const Tuple& tuple, bool& added );
+
+			/** Removes all tuples. The memory is kept for the next sub mesh.*/
+			void clear();
+
+		private:
+			static size_t calculateHash( const Tuple& tuple );
+
+			/** Resizes mTable to @a tableSize slots and reinserts all tuples.*/
+			void rehash( size_t tableSize );
 		};
 
 		typedef COLLADAFW::ArrayPrimitiveType<float> FloatList;
 		typedef COLLADAFW::ArrayPrimitiveType<double> DoubleList;
 		typedef COLLADAFW::ArrayPrimitiveType<int> IntList;
 		typedef COLLADAFW::ArrayPrimitiveType<unsigned int> UIntList;
-		typedef std::map<Tuple, int> TupleIndexMap;
 		typedef std::vector<String> StringList;
 
 	private:
@@ -54,14 +54,17 @@ namespace DAE2Ogre
 
 		typedef std::multimap<COLLADAFW::UniqueId, InstanceGeometryInfo> GeometryUniqueIdInstanceGeometryInfoMap;
 
-		/** Maps unique ids of framework materials to the corresponding framework material.*/
-		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Material> UniqueIdFWMaterialMap;
+		/** Maps unique ids of framework materials to the corresponding framework material. The materials are
+		owned by the writer.*/
+		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Material*> UniqueIdFWMaterialMap;
 
-		/** Maps unique ids of framework images to the corresponding framework image.*/
-		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Image> UniqueIdFWImageMap;
+		/** Maps unique ids of framework images to the corresponding framework image. The images are owned by
+		the writer.*/
+		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Image*> UniqueIdFWImageMap;
 
-		/** Maps unique ids of framework effects to the corresponding framework material.*/
-		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Effect> UniqueIdFWEffectMap;
+		/** Maps unique ids of framework effects to the corresponding framework material. The effects are owned
+		by the writer.*/
+		typedef std::map<COLLADAFW::UniqueId, COLLADAFW::Effect*> UniqueIdFWEffectMap;
 
 		enum Severity
 		{
@@ -131,10 +134,18 @@ namespace DAE2Ogre
 		@return True on succeeded, false otherwise.*/
 		virtual bool writeMaterial( const COLLADAFW::Material* material );
 
+		/** Keeps the material without copying it.
+		@return True on succeeded, false otherwise.*/
+		virtual bool adoptMaterial( COLLADAFW::Material* material );
+
 		/** Writes the effect.
 		@return True on succeeded, false otherwise.*/
 		virtual bool writeEffect( const COLLADAFW::Effect* effect );
 
+		/** Keeps the effect without copying it.
+		@return True on succeeded, false otherwise.*/
+		virtual bool adoptEffect( COLLADAFW::Effect* effect );
+
 		/** Writes the camera.
 		@return True on succeeded, false otherwise.*/
 		virtual bool writeCamera( const COLLADAFW::Camera* camera );
@@ -143,6 +154,10 @@ namespace DAE2Ogre
 		@return True on succeeded, false otherwise.*/
 		virtual bool writeImage( const COLLADAFW::Image* image );
 
+		/** Keeps the image without copying it.
+		@return True on succeeded, false otherwise.*/
+		virtual bool adoptImage( COLLADAFW::Image* image );
+
 		/** Writes the light.
 		@return True on succeeded, false otherwise.*/
 		virtual bool writeLight( const COLLADAFW::Light* light );
@@ -68,33 +68,81 @@ namespace DAE2Ogre
 	}
 
 	//------------------------------
-	bool MeshWriter::Tuple::operator<( const Tuple& rhs ) const
+	bool MeshWriter::Tuple::operator==( const Tuple& rhs ) const
 	{
-		if ( positionIndex < rhs.positionIndex )
-			return true;
+		return (positionIndex == rhs.positionIndex) && (normalIndex == rhs.normalIndex)
+			&& (textureIndex == rhs.textureIndex) && (colorIndex == rhs.colorIndex);
+	}
 
-		if ( positionIndex > rhs.positionIndex )
-			return false;
+	//------------------------------
+	const int MeshWriter::TupleIndexMap::EMPTY_SLOT;
 
-		if ( normalIndex < rhs.normalIndex )
-			return true;
+	//------------------------------
+	MeshWriter::TupleIndexMap::TupleIndexMap()
+		: mTable(16, EMPTY_SLOT)
+		, mTableMask(15)
+	{
+	}
 
-		if ( normalIndex > rhs.normalIndex )
-			return false;
+	//------------------------------
+	size_t MeshWriter::TupleIndexMap::calculateHash( const Tuple& tuple )
+	{
+		unsigned int hash = tuple.positionIndex * 0x9E3779B1U;
+		hash ^= tuple.normalIndex * 0x85EBCA77U;
+		hash ^= tuple.textureIndex * 0xC2B2AE3DU;
+		hash ^= tuple.colorIndex * 0x27D4EB2FU;
+		hash ^= hash >> 15;
+		return hash;
+	}
+
+	//------------------------------
+	int MeshWriter::TupleIndexMap::addTuple( const Tuple& tuple, bool& added )
+	{
+		size_t slot = calculateHash(tuple) & mTableMask;
+		for (;;)
+		{
+			int index = mTable[slot];
+			if ( index == EMPTY_SLOT )
+				break;
+			if ( mTuples[index] == tuple )
+			{
+				added = false;
+				return index;
+			}
+			slot = (slot + 1) & mTableMask;
+		}
 
-		if ( textureIndex < rhs.textureIndex )
-			return true;
+		int index = (int)mTuples.size();
+		mTuples.push_back(tuple);
+		mTable[slot] = index;
+		added = true;
 
-		if ( textureIndex > rhs.textureIndex )
-			return false;
+		// keep the load factor below 0.5
+		if ( 2 * mTuples.size() > mTable.size() )
+			rehash(2 * mTable.size());
 
-		if ( colorIndex < rhs.colorIndex )
-			return true;
+		return index;
+	}
 
-		if ( colorIndex > rhs.colorIndex )
-			return false;
+	//------------------------------
+	void MeshWriter::TupleIndexMap::rehash( size_t tableSize )
+	{
+		mTable.assign(tableSize, EMPTY_SLOT);
+		mTableMask = tableSize - 1;
+		for ( size_t i = 0, count = mTuples.size(); i < count; ++i )
+		{
+			size_t slot = calculateHash(mTuples[i]) & mTableMask;
+			while ( mTable[slot] != EMPTY_SLOT )
+				slot = (slot + 1) & mTableMask;
+			mTable[slot] = (int)i;
+		}
+	}
 
-		return false;
+	//------------------------------
+	void MeshWriter::TupleIndexMap::clear()
+	{
+		mTuples.clear();
+		mTable.assign(mTable.size(), EMPTY_SLOT);
 	}
 
 
@@ -227,10 +275,12 @@ namespace DAE2Ogre
 	//------------------------------
 	void MeshWriter::addTupleIndex( const Tuple& tuple )
 	{
-		TupleIndexMap::const_iterator it = mTupleMap.find(tuple);
-		if ( it == mTupleMap.end() )
+		bool added = false;
+		int tupleIndex = mTupleMap.addTuple(tuple, added);
+		mOgreIndices.append(tupleIndex);
+		if ( added )
 		{
-			mOgreIndices.append( mTupleMap[tuple] = mNextTupleIndex++ );
+			mNextTupleIndex++;
 
 			if ( mMeshPositions.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
 			{
@@ -298,10 +348,6 @@ namespace DAE2Ogre
 			}
 
 		}
-		else
-		{
-			mOgreIndices.append(it->second);
-		}
 	}
 
 	//------------------------------
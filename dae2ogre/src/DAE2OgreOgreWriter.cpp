@@ -42,6 +42,13 @@ namespace DAE2Ogre
 	OgreWriter::~OgreWriter()
 	{
 		delete mVisualScene;
+
+		for ( UniqueIdFWMaterialMap::const_iterator it = mUniqueIdFWMaterialMap.begin(); it != mUniqueIdFWMaterialMap.end(); ++it )
+			delete it->second;
+		for ( UniqueIdFWImageMap::const_iterator it = mUniqueIdFWImageMap.begin(); it != mUniqueIdFWImageMap.end(); ++it )
+			delete it->second;
+		for ( UniqueIdFWEffectMap::const_iterator it = mUniqueIdFWEffectMap.begin(); it != mUniqueIdFWEffectMap.end(); ++it )
+			delete it->second;
 	}
 
 	//--------------------------------------------------------------------
@@ -71,6 +78,9 @@ namespace DAE2Ogre
 		COLLADASaxFWL::Loader loader;
 		COLLADAFW::Root root(&loader, this);
 
+		// The geometries are written after the scene graph. Keep them instead of loading the document twice.
+		loader.setRetainGeometries(true);
+
 		// Load scene graph 
 		if ( !root.loadDocument(mInputFile.toNativePath()) )
 			return false;
@@ -82,12 +92,12 @@ namespace DAE2Ogre
 			sceneGraphWriter.write();
 		}
 
-		// load and write geometries
+		// write the retained geometries
 		mCurrentRun = GEOMETRY_RUN;
-		if ( !root.loadDocument(mInputFile.toNativePath()) )
-			return false;
+		bool success = loader.writeRetainedGeometries(this);
+		loader.deleteRetainedGeometries();
 
-		return true;
+		return success;
 	}
 
 	//--------------------------------------------------------------------
@@ -159,7 +169,15 @@ namespace DAE2Ogre
 	{
 		if ( mCurrentRun != SCENEGRAPH_RUN )
 			return true;
-		mUniqueIdFWMaterialMap.insert(std::make_pair(material->getUniqueId(),*material ));
+		// only called, if the loader still needs the material
+		return adoptMaterial( new COLLADAFW::Material(*material) );
+	}
+
+	//--------------------------------------------------------------------
+	bool OgreWriter::adoptMaterial( COLLADAFW::Material* material )
+	{
+		if ( (mCurrentRun != SCENEGRAPH_RUN) || !mUniqueIdFWMaterialMap.insert(std::make_pair(material->getUniqueId(), material)).second )
+			delete material;
 		return true;
 	}
 
@@ -168,7 +186,15 @@ namespace DAE2Ogre
 	{
 		if ( mCurrentRun != SCENEGRAPH_RUN )
 			return true;
-		mUniqueIdFWEffectMap.insert(std::make_pair(effect->getUniqueId(),*effect ));
+		// only called, if the loader still needs the effect
+		return adoptEffect( new COLLADAFW::Effect(*effect) );
+	}
+
+	//--------------------------------------------------------------------
+	bool OgreWriter::adoptEffect( COLLADAFW::Effect* effect )
+	{
+		if ( (mCurrentRun != SCENEGRAPH_RUN) || !mUniqueIdFWEffectMap.insert(std::make_pair(effect->getUniqueId(), effect)).second )
+			delete effect;
 		return true;
 	}
 
@@ -185,7 +211,15 @@ namespace DAE2Ogre
 	{
 		if ( mCurrentRun != SCENEGRAPH_RUN )
 			return true;
-		mUniqueIdFWImageMap.insert(std::make_pair(image->getUniqueId(),*image ));
+		// only called, if the loader still needs the image
+		return adoptImage( new COLLADAFW::Image(*image) );
+	}
+
+	//--------------------------------------------------------------------
+	bool OgreWriter::adoptImage( COLLADAFW::Image* image )
+	{
+		if ( (mCurrentRun != SCENEGRAPH_RUN) || !mUniqueIdFWImageMap.insert(std::make_pair(image->getUniqueId(), image)).second )
+			delete image;
 		return true;
 	}
 